@@ -10,6 +10,12 @@
 
 #include "Alloc.h"
 
+#ifdef Z7_LARGE_PAGES_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #if defined(Z7_LARGE_PAGES) && defined(_WIN32) && \
     (!defined(Z7_WIN32_WINNT_MIN) || Z7_WIN32_WINNT_MIN < 0x0502)  // < Win2003 (xp-64)
   #define Z7_USE_DYN_GetLargePageMinimum
@@ -34,6 +40,8 @@
 static int g_allocCount = 0;
 #ifdef _WIN32
 static int g_allocCountMid = 0;
+#endif
+#if defined(_WIN32) || defined(Z7_LARGE_PAGES_MMAP)
 static int g_allocCountBig = 0;
 #endif
 
@@ -139,7 +147,7 @@ static void PrintAddr(void *p)
  
 #else
 
-#ifdef _WIN32
+#if defined(_WIN32) || defined(Z7_LARGE_PAGES_MMAP)
 #define PRINT_ALLOC(name, cnt, size, ptr)
 #endif
 #define PRINT_FREE(name, cnt, ptr)
@@ -320,6 +328,155 @@ void BigFree(void *address)
 #endif // _WIN32
 
 
+#ifdef Z7_LARGE_PAGES_MMAP
+
+/*
+  BigAlloc() for big blocks (size > g_LargePageSize / 2):
+    1) mmap(MAP_HUGETLB) : it uses reserved huge pages (/proc/sys/vm/nr_hugepages).
+    2) mmap() of aligned block and madvise(MADV_HUGEPAGE) :
+       transparent huge pages, if there are no reserved huge pages.
+  munmap() requires the size of block. So the blocks allocated with mmap()
+  are stored in small table. If the table is full, z7_AlignedAlloc() is used.
+*/
+
+extern
+SIZE_T g_LargePageSize;
+SIZE_T g_LargePageSize = 0;
+
+// the total size of blocks that were allocated with huge pages
+extern
+UInt64 g_LargePages_HugeTlb_Size;
+UInt64 g_LargePages_HugeTlb_Size = 0;
+extern
+UInt64 g_LargePages_Thp_Size;
+UInt64 g_LargePages_Thp_Size = 0;
+
+void SetLargePageSize(void)
+{
+  char buf[32];
+  SIZE_T size = 0;
+  ssize_t n;
+  const char *s;
+  const int fd = open("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", O_RDONLY);
+  if (fd < 0)
+    return;
+  n = read(fd, buf, sizeof(buf) - 1);
+  close(fd);
+  if (n <= 0)
+    return;
+  buf[n] = 0;
+  for (s = buf; *s >= '0' && *s <= '9'; s++)
+    size = size * 10 + (unsigned)(*s - '0');
+  if (size == 0 || (size & (size - 1)) != 0 || size > ((SIZE_T)1 << 30))
+    return;
+  g_LargePageSize = size;
+}
+
+#define BIG_MMAP_TABLE_SIZE 64
+#define BIG_MMAP_RESERVED ((void *)(size_t)1)
+
+static void *g_BigMmap_Ptrs[BIG_MMAP_TABLE_SIZE];
+static size_t g_BigMmap_Sizes[BIG_MMAP_TABLE_SIZE];
+
+// (size) is multiple of (ps)
+static void *BigMmap(size_t size, size_t ps)
+{
+  Byte *p;
+  size_t allocSize, head;
+
+ #ifdef MAP_HUGETLB
+  {
+    void *p2 = mmap(NULL, size, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (p2 != MAP_FAILED)
+    {
+      __atomic_fetch_add(&g_LargePages_HugeTlb_Size, (UInt64)size, __ATOMIC_RELAXED);
+      return p2;
+    }
+  }
+ #endif
+
+  allocSize = size + ps;
+  if (allocSize < size)
+    return NULL;
+  {
+    void *p2 = mmap(NULL, allocSize, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p2 == MAP_FAILED)
+      return NULL;
+    p = (Byte *)p2;
+  }
+  // we unmap the unaligned head and the tail
+  head = (size_t)(ps - ((size_t)p & (ps - 1))) & (ps - 1);
+  if (head != 0)
+    munmap(p, head);
+  if (allocSize - head != size)
+    munmap(p + head + size, allocSize - head - size);
+  p += head;
+ #ifdef MADV_HUGEPAGE
+  if (madvise(p, size, MADV_HUGEPAGE) == 0)
+    __atomic_fetch_add(&g_LargePages_Thp_Size, (UInt64)size, __ATOMIC_RELAXED);
+ #endif
+  return p;
+}
+
+void *BigAlloc(size_t size)
+{
+  const size_t ps = g_LargePageSize;
+  if (size == 0)
+    return NULL;
+
+  PRINT_ALLOC("Alloc-Big", g_allocCountBig, size, NULL)
+
+  if (ps != 0 && size > (ps / 2))
+  {
+    const size_t size2 = (size + (ps - 1)) & ~(ps - 1);
+    if (size2 >= size)
+    {
+      unsigned i;
+      for (i = 0; i < BIG_MMAP_TABLE_SIZE; i++)
+      {
+        void *expected = NULL;
+        if (__atomic_compare_exchange_n(&g_BigMmap_Ptrs[i], &expected, BIG_MMAP_RESERVED,
+            0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+        {
+          void *p = BigMmap(size2, ps);
+          if (!p)
+          {
+            __atomic_store_n(&g_BigMmap_Ptrs[i], NULL, __ATOMIC_RELEASE);
+            break;
+          }
+          g_BigMmap_Sizes[i] = size2;
+          __atomic_store_n(&g_BigMmap_Ptrs[i], p, __ATOMIC_RELEASE);
+          return p;
+        }
+      }
+    }
+  }
+  
+  return z7_AlignedAlloc(size);
+}
+
+void BigFree(void *address)
+{
+  unsigned i;
+  PRINT_FREE("Free-Big", g_allocCountBig, address)
+  if (!address)
+    return;
+  for (i = 0; i < BIG_MMAP_TABLE_SIZE; i++)
+    if (__atomic_load_n(&g_BigMmap_Ptrs[i], __ATOMIC_ACQUIRE) == address)
+    {
+      const size_t size = g_BigMmap_Sizes[i];
+      __atomic_store_n(&g_BigMmap_Ptrs[i], NULL, __ATOMIC_RELEASE);
+      munmap(address, size);
+      return;
+    }
+  z7_AlignedFree(address);
+}
+
+#endif // Z7_LARGE_PAGES_MMAP
+
+
 static void *SzAlloc(ISzAllocPtr p, size_t size) { UNUSED_VAR(p)  return MyAlloc(size); }
 static void SzFree(ISzAllocPtr p, void *address) { UNUSED_VAR(p)  MyFree(address); }
 const ISzAlloc g_Alloc = { SzAlloc, SzFree };
@@ -331,6 +488,10 @@ static void *SzBigAlloc(ISzAllocPtr p, size_t size) { UNUSED_VAR(p)  return BigA
 static void SzBigFree(ISzAllocPtr p, void *address) { UNUSED_VAR(p)  BigFree(address); }
 const ISzAlloc g_MidAlloc = { SzMidAlloc, SzMidFree };
 const ISzAlloc g_BigAlloc = { SzBigAlloc, SzBigFree };
+#elif defined(Z7_LARGE_PAGES_MMAP)
+static void *SzBigAlloc(ISzAllocPtr p, size_t size) { UNUSED_VAR(p)  return BigAlloc(size); }
+static void SzBigFree(ISzAllocPtr p, void *address) { UNUSED_VAR(p)  BigFree(address); }
+const ISzAlloc g_BigAlloc = { SzBigAlloc, SzBigFree };
 #endif
 
 #ifndef Z7_ALLOC_NO_OFFSET_ALLOCATOR
@@ -42,18 +42,32 @@ void BigFree(void *address);
 
 #define MidAlloc(size)    z7_AlignedAlloc(size)
 #define MidFree(address)  z7_AlignedFree(address)
+
+#ifdef Z7_LARGE_PAGES
+/* BigAlloc() uses mmap() with huge pages (MAP_HUGETLB or MADV_HUGEPAGE),
+   if SetLargePageSize() was called */
+#define Z7_LARGE_PAGES_MMAP
+void SetLargePageSize(void);
+void *BigAlloc(size_t size);
+void BigFree(void *address);
+#else
 #define BigAlloc(size)    z7_AlignedAlloc(size)
 #define BigFree(address)  z7_AlignedFree(address)
+#endif
 
 #endif
 
 extern const ISzAlloc g_Alloc;
 
-#ifdef _WIN32
+#if defined(_WIN32) || defined(Z7_LARGE_PAGES_MMAP)
 extern const ISzAlloc g_BigAlloc;
-extern const ISzAlloc g_MidAlloc;
 #else
 #define g_BigAlloc g_AlignedAlloc
+#endif
+
+#ifdef _WIN32
+extern const ISzAlloc g_MidAlloc;
+#else
 #define g_MidAlloc g_AlignedAlloc
 #endif
 
@@ -929,15 +929,12 @@ static UInt32 * Hc_GetMatchesSpec(size_t lenLimit, UInt32 curMatch, UInt32 pos,
       diff = (ptrdiff_t)0 - (ptrdiff_t)delta;
       if (cur[maxLen] == cur[(ptrdiff_t)maxLen + diff])
       {
-        const Byte *c = cur;
-        while (*c == c[diff])
+        const Byte *c = LzFind_ExtendMatch(cur, lim, diff);
+        if (c == lim)
         {
-          if (++c == lim)
-          {
-            d[0] = (UInt32)(lim - cur);
-            d[1] = delta - 1;
-            return d + 2;
-          }
+          d[0] = (UInt32)(lim - cur);
+          d[1] = delta - 1;
+          return d + 2;
         }
         {
           const unsigned len = (unsigned)(c - cur);
@@ -987,9 +984,7 @@ UInt32 * GetMatchesSpec1(UInt32 lenLimit, UInt32 curMatch, UInt32 pos, const Byt
       if (pb[len] == cur[len])
       {
         if (++len != lenLimit && pb[len] == cur[len])
-          while (++len != lenLimit)
-            if (pb[len] != cur[len])
-              break;
+          len = (unsigned)(LzFind_ExtendMatch(cur + len + 1, cur + lenLimit, (ptrdiff_t)0 - (ptrdiff_t)delta) - cur);
         if (maxLen < len)
         {
           maxLen = (UInt32)len;
@@ -1053,9 +1048,7 @@ static void SkipMatchesSpec(UInt32 lenLimit, UInt32 curMatch, UInt32 pos, const
       unsigned len = (len0 < len1 ? len0 : len1);
       if (pb[len] == cur[len])
       {
-        while (++len != lenLimit)
-          if (pb[len] != cur[len])
-            break;
+        len = (unsigned)(LzFind_ExtendMatch(cur + len + 1, cur + lenLimit, (ptrdiff_t)0 - (ptrdiff_t)delta) - cur);
         {
           if (len == lenLimit)
           {
@@ -3,6 +3,8 @@
 
 #include "Precomp.h"
 
+#include <string.h>
+
 // #include <stdio.h>
 
 #include "CpuArch.h"
@@ -86,7 +88,7 @@ static void MtSync_Construct(CMtSync *p)
   p->wasCreated = False;
   p->csWasInitialized = False;
   p->csWasEntered = False;
-  Thread_CONSTRUCT(&p->thread)
+  PoolThread_CONSTRUCT(&p->thread);
   Event_Construct(&p->canStart);
   Event_Construct(&p->wasStopped);
   Semaphore_Construct(&p->freeSemaphore);
@@ -150,7 +152,7 @@ static UInt32 MtSync_GetNextBlock(CMtSync *p)
 Z7_NO_INLINE
 static void MtSync_StopWriting(CMtSync *p)
 {
-  if (!Thread_WasCreated(&p->thread) || p->needStart)
+  if (!PoolThread_WasCreated(&p->thread) || p->needStart)
     return;
 
     PRF(printf("\nMtSync_StopWriting %p\n", p));
@@ -190,7 +192,7 @@ static void MtSync_Destruct(CMtSync *p)
 {
     PRF(printf("\nMtSync_Destruct %p\n", p));
   
-  if (Thread_WasCreated(&p->thread))
+  if (PoolThread_WasCreated(&p->thread))
   {
     /* we want thread to be in Stopped state before sending EXIT command.
        note: stop(btSync) will stop (htSync) also */
@@ -199,7 +201,7 @@ static void MtSync_Destruct(CMtSync *p)
     p->exit = True;
     // if (p->needStart)  // it's (true)
     Event_Set(&p->canStart);  // we send EXIT command to thread
-    Thread_Wait_Close(&p->thread);  // we wait thread finishing
+    PoolThread_Wait_Close(&p->thread);  // we wait thread finishing
   }
 
   if (p->csWasInitialized)
@@ -260,9 +262,9 @@ static WRes MtSync_Create_WRes(CMtSync *p, THREAD_FUNC_TYPE startAddress, void *
   // return EINVAL; // for debug
 
   if (p->affinity != 0)
-    wres = Thread_Create_With_Affinity(&p->thread, startAddress, obj, (CAffinityMask)p->affinity);
+    wres = PoolThread_Create_With_Affinity(&p->thread, startAddress, obj, (CAffinityMask)p->affinity);
   else
-    wres = Thread_Create(&p->thread, startAddress, obj);
+    wres = PoolThread_Create(&p->thread, startAddress, obj);
 
   RINOK_THREAD(wres)
   p->wasCreated = True;
@@ -567,6 +569,149 @@ UInt32 * Z7_FASTCALL GetMatchesSpecN_2(const Byte *lenLimit, size_t pos, const B
 
 #endif
 
+UInt32 * Z7_FASTCALL GetMatchesSpecN_Hc(UInt32 lenLimit, UInt32 pos, const Byte *cur, const CLzRef *son,
+    size_t _cyclicBufferPos, UInt32 cbs, UInt32 historySize, UInt32 _cutValue,
+    UInt32 _maxLen, UInt32 num, UInt32 *d);
+
+
+// ---------- HC THREADS ----------
+
+/* minimal number of positions for one thread in HC mode.
+   Smaller parts are not effective for multithreading */
+#define kMtHcNumPosMin (1 << 8)
+
+#define HC_GET_MATCHES(p, _cur, _pos, _cyclicBufferPos, _lenLimit, _num, _d) \
+    GetMatchesSpecN_Hc(_lenLimit, _pos, _cur, (p)->son, _cyclicBufferPos, \
+        (p)->cyclicBufferSize, (p)->historySize, (p)->cutValue, (p)->numHashBytes - 1, _num, _d)
+
+static void HcThreadFunc(CMtHcThread *t)
+{
+  for (;;)
+  {
+    Event_Wait(&t->canStart);
+    if (t->exit)
+      return;
+    t->dEnd = HC_GET_MATCHES(t->mt, t->cur, t->pos, t->cyclicBufferPos, t->lenLimit, t->num, t->d);
+    Event_Set(&t->wasFinished);
+  }
+}
+
+static THREAD_FUNC_DECL HcThreadFunc2(void *p) { HcThreadFunc((CMtHcThread *)p);  return 0; }
+
+
+static void MtHcThread_Construct(CMtHcThread *t)
+{
+  t->wasCreated = False;
+  PoolThread_CONSTRUCT(&t->thread);
+  Event_Construct(&t->canStart);
+  Event_Construct(&t->wasFinished);
+}
+
+static void MtHcThread_Destruct(CMtHcThread *t)
+{
+  if (PoolThread_WasCreated(&t->thread))
+  {
+    t->exit = True;
+    Event_Set(&t->canStart);
+    PoolThread_Wait_Close(&t->thread);
+  }
+  Event_Close(&t->canStart);
+  Event_Close(&t->wasFinished);
+  t->wasCreated = False;
+}
+
+static WRes MtHcThread_Create(CMtHcThread *t, CMatchFinderMt *mt, UInt64 affinity)
+{
+  WRes wres;
+  if (t->wasCreated)
+    return 0;
+  t->mt = mt;
+  t->exit = False;
+  RINOK_THREAD(AutoResetEvent_CreateNotSignaled(&t->canStart))
+  RINOK_THREAD(AutoResetEvent_CreateNotSignaled(&t->wasFinished))
+  if (affinity != 0)
+    wres = PoolThread_Create_With_Affinity(&t->thread, HcThreadFunc2, t, (CAffinityMask)affinity);
+  else
+    wres = PoolThread_Create(&t->thread, HcThreadFunc2, t);
+  RINOK_THREAD(wres)
+  t->wasCreated = True;
+  return 0;
+}
+
+
+/*
+  Hc_GetMatches() is called in BT thread in HC mode.
+  It adds links to hash chains for (num <= size) positions,
+  and then it searches the chains of these positions in (numHcThreads) threads.
+  Each thread writes the matches to own part of (d) that is reserved for
+  worst case, and then we move the matches to the end of previous part.
+  It returns the number of processed positions.
+  It returns 0, if there is no enough space in (d) for effective multithreading.
+*/
+
+static UInt32 Hc_GetMatches(CMatchFinderMt *p, UInt32 *d, UInt32 *curPosRes,
+    UInt32 size, UInt32 lenLimit, UInt32 pos, UInt32 cyclicBufferPos)
+{
+  const UInt32 curPos = *curPosRes;
+  UInt32 num, step, maxItems;
+  unsigned numThreads, i;
+  {
+    UInt32 numPairs = lenLimit - p->numHashBytes + 1;
+    if (numPairs > p->cutValue)
+      numPairs = p->cutValue;
+    maxItems = 1 + numPairs * 2;
+  }
+  num = (kMtBtBlockSize - curPos) / maxItems;
+  if (num < kMtHcNumPosMin && curPos != 2 && p->numHcThreads > 1)
+    return 0;
+  if (num > size)
+    num = size;
+  
+  {
+    CLzRef *son = p->son + cyclicBufferPos;
+    const UInt32 *hash = p->hashBuf + p->hashBufPos;
+    for (i = 0; i < num; i++)
+      son[i] = pos + i - hash[i];
+  }
+
+  numThreads = p->numHcThreads;
+  if (numThreads > num / kMtHcNumPosMin)
+    numThreads = num / kMtHcNumPosMin;
+  if (numThreads == 0)
+    numThreads = 1;
+  step = num / numThreads;
+
+  for (i = 1; i < numThreads; i++)
+  {
+    CMtHcThread *t = &p->hcThreads[(size_t)i - 1];
+    const UInt32 offset = step * i;
+    t->cur = p->buffer + offset;
+    t->pos = pos + offset;
+    t->cyclicBufferPos = cyclicBufferPos + offset;
+    t->lenLimit = lenLimit;
+    t->num = (i == numThreads - 1) ? num - offset : step;
+    t->d = d + curPos + (size_t)offset * maxItems;
+    Event_Set(&t->canStart);
+  }
+  
+  {
+    UInt32 *dEnd = HC_GET_MATCHES(p, p->buffer, pos, cyclicBufferPos, lenLimit,
+        numThreads == 1 ? num : step, d + curPos);
+
+    for (i = 1; i < numThreads; i++)
+    {
+      CMtHcThread *t = &p->hcThreads[(size_t)i - 1];
+      Event_Wait(&t->wasFinished);
+      {
+        const size_t numItems = (size_t)(t->dEnd - t->d);
+        memmove(dEnd, t->d, numItems * sizeof(UInt32));
+        dEnd += numItems;
+      }
+    }
+    *curPosRes = (UInt32)(dEnd - d);
+  }
+  return num;
+}
 
 static void BtGetMatches(CMatchFinderMt *p, UInt32 *d)
 {
@@ -662,9 +807,20 @@ static void BtGetMatches(CMatchFinderMt *p, UInt32 *d)
         const UInt32 subValue = (pos - p->cyclicBufferSize); // & ~(UInt32)(kNormalizeAlign - 1);
         pos -= subValue;
         p->pos = pos;
-        MatchFinder_Normalize3(subValue, p->son, (size_t)p->cyclicBufferSize * 2);
+        MatchFinder_Normalize3(subValue, p->son, (size_t)p->cyclicBufferSize << p->btMode);
       }
 
+      if (!p->btMode)
+      {
+        const UInt32 processed = Hc_GetMatches(p, d, &curPos, size, lenLimit, pos, cyclicBufferPos);
+        if (processed == 0)
+          break;
+        pos += processed;
+        p->hashBufPos += processed;
+        cyclicBufferPos += processed;
+        p->buffer += processed;
+      }
+      else
       #ifndef MFMT_GM_INLINE
       while (curPos < limit && size-- != 0)
       {
@@ -788,9 +944,13 @@ static void BtThreadFunc(CMatchFinderMt *mt)
 
 void MatchFinderMt_Construct(CMatchFinderMt *p)
 {
+  unsigned i;
   p->hashBuf = NULL;
+  p->numHcThreads = 1;
   MtSync_Construct(&p->hashSync);
   MtSync_Construct(&p->btSync);
+  for (i = 0; i < MF_MT_HC_THREADS_MAX - 1; i++)
+    MtHcThread_Construct(&p->hcThreads[i]);
 }
 
 static void MatchFinderMt_FreeMem(CMatchFinderMt *p, ISzAllocPtr alloc)
@@ -815,6 +975,12 @@ void MatchFinderMt_Destruct(CMatchFinderMt *p, ISzAllocPtr alloc)
 
   MtSync_Destruct(&p->btSync);
   MtSync_Destruct(&p->hashSync);
+  {
+    // BT thread was stopped. So HC threads are not used here
+    unsigned i;
+    for (i = 0; i < MF_MT_HC_THREADS_MAX - 1; i++)
+      MtHcThread_Destruct(&p->hcThreads[i]);
+  }
 
   LOG_ITER(
   printf("\nTree %9d * %7d iter = %9d = sum  :  bytes = %9d\n",
@@ -861,11 +1027,40 @@ SRes MatchFinderMt_Create(CMatchFinderMt *p, UInt32 historySize, UInt32 keepAddB
   }
   keepAddBufferBefore += (kHashBufferSize + kBtBufferSize);
   keepAddBufferAfter += kMtHashBlockSize;
-  if (!MatchFinder_Create(mf, historySize, keepAddBufferBefore, matchMaxLen, keepAddBufferAfter, alloc))
-    return SZ_ERROR_MEM;
+  {
+    UInt32 cbsHistory = historySize;
+    if (!mf->btMode)
+    {
+      /* HC mode: BT thread writes links for up to (kMtBtBlockSize) positions
+         before search. So we use larger cyclic buffer to keep old links */
+      cbsHistory += kMtBtBlockSize;
+      if (cbsHistory < historySize)
+        return SZ_ERROR_PARAM;
+    }
+    if (!MatchFinder_Create(mf, cbsHistory, keepAddBufferBefore, matchMaxLen, keepAddBufferAfter, alloc))
+      return SZ_ERROR_MEM;
+  }
 
   RINOK(MtSync_Create(&p->hashSync, HashThreadFunc2, p))
   RINOK(MtSync_Create(&p->btSync, BtThreadFunc2, p))
+
+  if (p->numHcThreads < 1)
+    p->numHcThreads = 1;
+  if (p->numHcThreads > MF_MT_HC_THREADS_MAX)
+    p->numHcThreads = MF_MT_HC_THREADS_MAX;
+  if (!mf->btMode)
+  {
+    unsigned i;
+    for (i = 0; i < p->numHcThreads - 1; i++)
+    {
+      const WRes wres = MtHcThread_Create(&p->hcThreads[i], p, p->btSync.affinity);
+      if (wres != 0)
+      {
+        MtHcThread_Destruct(&p->hcThreads[i]);
+        return MY_SRes_HRESULT_FROM_WRes(wres);
+      }
+    }
+  }
   return SZ_OK;
 }
 
@@ -912,6 +1107,7 @@ static void MatchFinderMt_Init(void *_p)
   // memcpy(p->crc, mf->crc, sizeof(mf->crc));
 
   p->son = mf->son;
+  p->btMode = mf->btMode;
   p->matchMaxLen = mf->matchMaxLen;
   p->numHashBytes = mf->numHashBytes;
   
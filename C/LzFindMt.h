@@ -12,7 +12,7 @@ EXTERN_C_BEGIN
 typedef struct
 {
   UInt32 numProcessedBlocks;
-  CThread thread;
+  CPoolThread thread;
   UInt64 affinity;
 
   BoolInt wasCreated;
@@ -34,6 +34,30 @@ typedef struct
 
 struct CMatchFinderMt_;
 
+/* In hash-chain mode (MatchFinder->btMode == 0) the chains of each block
+   are searched by (numHcThreads) threads: BT thread and (numHcThreads - 1) HC threads. */
+
+#define MF_MT_HC_THREADS_MAX 16
+
+typedef struct
+{
+  CPoolThread thread;
+  BoolInt wasCreated;
+  BoolInt exit;
+  CAutoResetEvent canStart;
+  CAutoResetEvent wasFinished;
+  struct CMatchFinderMt_ *mt;
+
+  /* job from BT thread */
+  const Byte *cur;
+  UInt32 pos;
+  UInt32 cyclicBufferPos;
+  UInt32 lenLimit;
+  UInt32 num;
+  UInt32 *d;
+  UInt32 *dEnd;
+} CMtHcThread;
+
 typedef UInt32 * (*Mf_Mix_Matches)(struct CMatchFinderMt_ *p, UInt32 matchMinPos, UInt32 *distances);
 
 /* kMtCacheLineDummy must be >= size_of_CPU_cache_line */
@@ -82,9 +106,14 @@ typedef struct CMatchFinderMt_
   UInt32 pos;
   const Byte *buffer;
   UInt32 cyclicBufferPos;
-  UInt32 cyclicBufferSize; /* it must be = (historySize + 1) */
+  UInt32 cyclicBufferSize; /* it must be = (historySize + 1) in BT mode */
   UInt32 cutValue;
 
+  /* HC mode */
+  UInt32 btMode;
+  UInt32 numHcThreads; /* it can be set before MatchFinderMt_Create() */
+  CMtHcThread hcThreads[MF_MT_HC_THREADS_MAX - 1];
+
   /* BT + Hash */
   CMtSync hashSync;
   /* Byte hashDummy[kMtCacheLineDummy]; */
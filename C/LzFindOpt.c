@@ -5,6 +5,7 @@
 
 #include "CpuArch.h"
 #include "LzFind.h"
+#include "LzHash.h"
 
 // #include "LzFindMt.h"
 
@@ -90,12 +91,7 @@ else
       if (len[diff] == len[0])
       {
         if (++len != lenLimit && len[diff] == len[0])
-          while (++len != lenLimit)
-          {
-            LOG_ITER(g_NumIters_Bytes++);
-            if (len[diff] != len[0])
-              break;
-          }
+          len = LzFind_ExtendMatch(len + 1, lenLimit, diff);
         if (maxLen < len)
         {
           maxLen = len;
@@ -291,12 +287,7 @@ else
       if (len[diff] == len[0])
       {
         if (++len != lenLimit && len[diff] == len[0])
-          while (++len != lenLimit)
-          {
-            LOG_ITER(g_NumIters_Bytes++);
-            if (len[diff] != len[0])
-              break;
-          }
+          len = LzFind_ExtendMatch(len + 1, lenLimit, diff);
         if (maxLen < len)
         {
           maxLen = len;
@@ -400,6 +391,73 @@ else
 }
 
 
+/*
+  GetMatchesSpecN_Hc() searches hash chains for (num) positions.
+  Links for all these positions must be written to (son) already.
+  So different threads can search different parts of block.
+  (son) contains (cbs) items. It's larger than (historySize + 1), and
+  the links, that can be overwritten by newer positions of current block,
+  are not used for match, if (delta <= historySize).
+  (num) positions must not cross the end of (son) buffer.
+  Output format for each position is same as in GetMatchesSpecN_2():
+    {numItems, (len, dist) pairs}
+*/
+
+UInt32 * Z7_FASTCALL GetMatchesSpecN_Hc(UInt32 lenLimit, UInt32 pos, const Byte *cur, const CLzRef *son,
+    size_t _cyclicBufferPos, UInt32 cbs, UInt32 historySize, UInt32 _cutValue,
+    UInt32 _maxLen, UInt32 num, UInt32 *d);
+
+Z7_NO_INLINE
+UInt32 * Z7_FASTCALL GetMatchesSpecN_Hc(UInt32 lenLimit, UInt32 pos, const Byte *cur, const CLzRef *son,
+    size_t _cyclicBufferPos, UInt32 cbs, UInt32 historySize, UInt32 _cutValue,
+    UInt32 _maxLen, UInt32 num, UInt32 *d)
+{
+  for (; num != 0; num--)
+  {
+    UInt32 *_distances = d++;
+    const Byte *lim = cur + lenLimit;
+    size_t maxLen = _maxLen;
+    UInt32 cutValue = _cutValue;
+    UInt32 curMatch = son[_cyclicBufferPos];
+
+    do
+    {
+      UInt32 delta;
+      ptrdiff_t diff;
+      if (curMatch == kEmptyHashValue)
+        break;
+      delta = pos - curMatch;
+      // (delta == 0) is failure. We don't allow such match
+      if (delta - 1 >= historySize)
+        break;
+      diff = (ptrdiff_t)0 - (ptrdiff_t)delta;
+      curMatch = son[_cyclicBufferPos - delta + ((delta > _cyclicBufferPos) ? cbs : 0)];
+      if (cur[maxLen] == cur[(ptrdiff_t)maxLen + diff])
+      {
+        const Byte *c = LzFind_ExtendMatch(cur, lim, diff);
+        const size_t len = (size_t)(c - cur);
+        if (maxLen < len)
+        {
+          maxLen = len;
+          d[0] = (UInt32)len;
+          d[1] = delta - 1;
+          d += 2;
+          if (c == lim)
+            break;
+        }
+      }
+    }
+    while (--cutValue);
+
+    *_distances = (UInt32)(d - _distances - 1);
+    pos++;
+    _cyclicBufferPos++;
+    cur++;
+  }
+  return d;
+}
+
+
 
 /*
 typedef UInt32 uint32plus; // size_t
@@ -4,6 +4,23 @@
 #ifndef ZIP7_INC_LZ_HASH_H
 #define ZIP7_INC_LZ_HASH_H
 
+#include "CpuArch.h"
+
+#if defined(MY_CPU_AMD64) && (defined(_MSC_VER) || defined(__SSE2__))
+  #define Z7_LZ_MATCH_SSE2
+  #include <emmintrin.h>
+#endif
+
+#if defined(MY_CPU_LE_UNALIGN) && defined(MY_CPU_64BIT)
+  #if defined(__GNUC__) || defined(__clang__)
+    #define Z7_LZ_MATCH_CTZ64(x)  ((unsigned)__builtin_ctzll(x))
+  #elif defined(_MSC_VER) && (defined(MY_CPU_AMD64) || defined(MY_CPU_ARM64))
+    #include <intrin.h>
+    Z7_FORCE_INLINE static unsigned Z7_LZ_MATCH_CTZ64(UInt64 x)
+      { unsigned long index; _BitScanForward64(&index, x); return (unsigned)index; }
+  #endif
+#endif
+
 /*
   (kHash2Size >= (1 <<  8)) : Required
   (kHash3Size >= (1 << 16)) : Required
@@ -31,4 +48,41 @@
 #define kLzHash_CrcShift_1 5
 #define kLzHash_CrcShift_2 10
 
+/*
+  LzFind_ExtendMatch() compares (cur[i]) and (cur[i + diff]) for (cur <= i < lim).
+  It returns pointer to first mismatched byte in (cur), or (lim), if all bytes are equal.
+  Most of calls stop at first bytes, so we compare 16 bytes with SSE2 (it's
+  baseline for x64) and 8 bytes with (xor + ctz) before the byte loop for tail.
+  It doesn't read bytes outside of [cur, lim) and [cur + diff, lim + diff).
+*/
+
+Z7_FORCE_INLINE
+static const Byte *LzFind_ExtendMatch(const Byte *cur, const Byte *lim, ptrdiff_t diff)
+{
+ #ifdef Z7_LZ_MATCH_SSE2
+  while (lim - cur >= 16)
+  {
+    const unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(
+        _mm_loadu_si128((const __m128i *)(const void *)cur),
+        _mm_loadu_si128((const __m128i *)(const void *)(cur + diff)))) ^ 0xffff;
+    if (mask)
+      return cur + Z7_LZ_MATCH_CTZ64(mask);
+    cur += 16;
+  }
+ #endif
+ #ifdef Z7_LZ_MATCH_CTZ64
+  while (lim - cur >= 8)
+  {
+    const UInt64 x = GetUi64(cur) ^ GetUi64(cur + diff);
+    if (x)
+      return cur + (Z7_LZ_MATCH_CTZ64(x) >> 3);
+    cur += 8;
+  }
+ #endif
+  for (; cur != lim; cur++)
+    if (*cur != cur[diff])
+      break;
+  return cur;
+}
+
 #endif
@@ -241,6 +241,7 @@ void Lzma2EncProps_Normalize(CLzma2EncProps *p)
 {
   UInt64 fileSize;
   int t1, t1n, t2, t2r, t3;
+  BoolInt t1s;
   {
     CLzmaEncProps lzmaProps = p->lzmaProps;
     LzmaEncProps_Normalize(&lzmaProps);
@@ -248,6 +249,7 @@ void Lzma2EncProps_Normalize(CLzma2EncProps *p)
   }
 
   t1 = p->lzmaProps.numThreads;
+  t1s = (t1 > 0);
   t2 = p->numBlockThreads_Max;
   t3 = p->numTotalThreads;
 
@@ -300,6 +302,9 @@ void Lzma2EncProps_Normalize(CLzma2EncProps *p)
   if (p->blockSize == LZMA2_ENC_PROPS_BLOCK_SIZE_SOLID)
   {
     t2r = t2 = 1;
+    /* hashChain match finder can use all threads for single solid stream */
+    if (!t1s && !p->lzmaProps.btMode && p->numTotalThreads > t1)
+      p->lzmaProps.numThreads = t1 = p->numTotalThreads;
     t3 = t1;
   }
   else if (p->blockSize == LZMA2_ENC_PROPS_BLOCK_SIZE_AUTO && t2 <= 1)
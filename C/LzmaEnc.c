@@ -596,6 +596,8 @@ SRes LzmaEnc_SetProps(CLzmaEncHandle p, const CLzmaEncProps *props2)
   }
   */
   p->multiThread = (props.numThreads > 1);
+  /* hash-chain match finder in MT mode uses (numThreads - 1) threads to search chains */
+  p->matchFinderMt.numHcThreads = (UInt32)(props.numThreads > 1 ? props.numThreads - 1 : 1);
   p->matchFinderMt.btSync.affinity =
   p->matchFinderMt.hashSync.affinity = props.affinity;
   #endif
@@ -2692,7 +2694,7 @@ static SRes LzmaEnc_Alloc(CLzmaEnc *p, UInt32 keepWindowSize, ISzAllocPtr alloc,
     return SZ_ERROR_MEM;
 
   #ifndef Z7_ST
-  p->mtMode = (p->multiThread && !p->fastMode && (MFB.btMode != 0));
+  p->mtMode = (p->multiThread && (MFB.btMode == 0 || !p->fastMode));
   #endif
 
   {
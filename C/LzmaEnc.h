@@ -26,7 +26,8 @@ typedef struct
   unsigned numHashOutBits;  /* default = ? */
   UInt32 mc;       /* 1 <= mc <= (1 << 30), default = 32 */
   unsigned writeEndMark;  /* 0 - do not write EOPM, 1 - write EOPM, default = 0 */
-  int numThreads;  /* 1 or 2, default = 2 */
+  int numThreads;  /* 1 or 2, default = 2 (1 for hashChain mode).
+                      hashChain mode can use more threads: (numThreads - 1) threads search chains */
 
   // int _pad;
 
@@ -45,8 +45,17 @@ static SRes MtCoderThread_CreateAndStart(CMtCoderThread *t)
   if (wres == 0)
   {
     t->stop = False;
-    if (!Thread_WasCreated(&t->thread))
-      wres = Thread_Create(&t->thread, ThreadFunc, t);
+    if (!PoolThread_WasCreated(&t->thread))
+    {
+      /* the thread allocates its (inBuf) and coder state itself,
+         so these buffers are local for the node of thread */
+      const unsigned numNodes = Numa_GetNumNodes();
+      if (numNodes > 1)
+        wres = PoolThread_Create_On_NumaNode(&t->thread, ThreadFunc, t,
+            Numa_GetThreadNode(t->index, t->mtCoder->numStartedThreadsLimit, numNodes));
+      else
+        wres = PoolThread_Create(&t->thread, ThreadFunc, t);
+    }
     if (wres == 0)
       wres = Event_Set(&t->startEvent);
   }
@@ -58,11 +67,11 @@ static SRes MtCoderThread_CreateAndStart(CMtCoderThread *t)
 
 static void MtCoderThread_Destruct(CMtCoderThread *t)
 {
-  if (Thread_WasCreated(&t->thread))
+  if (PoolThread_WasCreated(&t->thread))
   {
     t->stop = 1;
     Event_Set(&t->startEvent);
-    Thread_Wait_Close(&t->thread);
+    PoolThread_Wait_Close(&t->thread);
   }
 
   Event_Close(&t->startEvent);
@@ -371,7 +380,7 @@ void MtCoder_Construct(CMtCoder *p)
     t->inBuf = NULL;
     t->stop = False;
     Event_Construct(&t->startEvent);
-    Thread_CONSTRUCT(&t->thread)
+    PoolThread_CONSTRUCT(&t->thread);
   }
 
   #ifdef MTCODER_USE_WRITE_THREAD
@@ -51,7 +51,7 @@ typedef struct
   Byte *inBuf;
 
   CAutoResetEvent startEvent;
-  CThread thread;
+  CPoolThread thread;
 } CMtCoderThread;
 
 
@@ -116,9 +116,17 @@ static SRes MtDecThread_CreateAndStart(CMtDecThread *t)
   // wres = 17; // for test
   if (wres == 0)
   {
-    if (Thread_WasCreated(&t->thread))
+    if (PoolThread_WasCreated(&t->thread))
       return SZ_OK;
-    wres = Thread_Create(&t->thread, MtDec_ThreadFunc, t);
+    {
+      // the thread allocates its input buffers itself
+      const unsigned numNodes = Numa_GetNumNodes();
+      if (numNodes > 1)
+        wres = PoolThread_Create_On_NumaNode(&t->thread, MtDec_ThreadFunc, t,
+            Numa_GetThreadNode(t->index, t->mtDec->numStartedThreads_Limit, numNodes));
+      else
+        wres = PoolThread_Create(&t->thread, MtDec_ThreadFunc, t);
+    }
     if (wres == 0)
       return SZ_OK;
   }
@@ -145,11 +153,11 @@ void MtDecThread_FreeInBufs(CMtDecThread *t)
 
 static void MtDecThread_CloseThread(CMtDecThread *t)
 {
-  if (Thread_WasCreated(&t->thread))
+  if (PoolThread_WasCreated(&t->thread))
   {
     Event_Set(&t->canWrite); /* we can disable it. There are no threads waiting canWrite in normal cases */
     Event_Set(&t->canRead);
-    Thread_Wait_Close(&t->thread);
+    PoolThread_Wait_Close(&t->thread);
   }
 
   Event_Close(&t->canRead);
@@ -978,7 +986,7 @@ void MtDec_Construct(CMtDec *p)
     t->inBuf = NULL;
     Event_Construct(&t->canRead);
     Event_Construct(&t->canWrite);
-    Thread_CONSTRUCT(&t->thread)
+    PoolThread_CONSTRUCT(&t->thread);
   }
 
   // Event_Construct(&p->finishedEvent);
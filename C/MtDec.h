@@ -36,7 +36,7 @@ SRes MtProgress_ProgressAdd(CMtProgress *p, UInt64 inSize, UInt64 outSize);
 SRes MtProgress_GetError(CMtProgress *p);
 void MtProgress_SetError(CMtProgress *p, SRes res);
 
-struct CMtDec;
+struct CMtDec_;
 
 typedef struct
 {
@@ -47,7 +47,7 @@ typedef struct
   size_t inDataSize_Start; // size of input data in start block
   UInt64 inDataSize;       // total size of input data in all blocks
 
-  CThread thread;
+  CPoolThread thread;
   CAutoResetEvent canRead;
   CAutoResetEvent canWrite;
   void  *allocaPtr;
@@ -5,6 +5,8 @@
 
 #ifdef _WIN32
 
+#include <stdlib.h>
+
 #ifndef USE_THREADS_CreateThread
 #include <process.h>
 #endif
@@ -189,6 +191,62 @@ WRes CriticalSection_Init(CCriticalSection *p)
 }
 
 
+#define NUMA_MAX_NODES 64
+
+typedef BOOL (WINAPI *Func_GetNumaHighestNodeNumber)(PULONG highestNodeNumber);
+typedef BOOL (WINAPI *Func_GetNumaNodeProcessorMask)(UCHAR node, PULONGLONG processorMask);
+
+/* it returns the affinity masks of nodes that contain CPUs of process.
+   GetNumaNodeProcessorMask() reports CPUs of current processor group only. */
+static unsigned Numa_GetNodeMasks(CAffinityMask *masks)
+{
+  unsigned num = 0;
+  ULONG highest = 0;
+  ULONG i;
+  DWORD_PTR processMask, systemMask;
+  const HMODULE hm = GetModuleHandle(TEXT("kernel32.dll"));
+Z7_DIAGNOSTIC_IGNORE_CAST_FUNCTION
+  const
+   Func_GetNumaHighestNodeNumber fnHighest =
+  (Func_GetNumaHighestNodeNumber) Z7_CAST_FUNC_C GetProcAddress(hm, "GetNumaHighestNodeNumber");
+  const
+   Func_GetNumaNodeProcessorMask fnMask =
+  (Func_GetNumaNodeProcessorMask) Z7_CAST_FUNC_C GetProcAddress(hm, "GetNumaNodeProcessorMask");
+  if (!fnHighest || !fnMask
+      || !fnHighest(&highest) || highest == 0
+      || !GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask))
+    return 0;
+  for (i = 0; i <= highest && i <= 0xff && num < NUMA_MAX_NODES; i++)
+  {
+    ULONGLONG mask = 0;
+    if (fnMask((UCHAR)i, &mask))
+    {
+      const CAffinityMask m = (CAffinityMask)mask & processMask;
+      if (m != 0)
+        masks[num++] = m;
+    }
+  }
+  return num;
+}
+
+unsigned Numa_GetNumNodes(void)
+{
+  CAffinityMask masks[NUMA_MAX_NODES];
+  const unsigned num = Numa_GetNodeMasks(masks);
+  return num > 1 ? num : 1;
+}
+
+static BoolInt Numa_GetThreadCpuSet(unsigned node, CCpuSet *cs)
+{
+  CAffinityMask masks[NUMA_MAX_NODES];
+  const unsigned num = Numa_GetNodeMasks(masks);
+  if (num < 2 || node >= num)
+    return False;
+  *cs = masks[node];
+  return True;
+}
+
+
 
 
 #else // _WIN32
@@ -214,8 +272,11 @@ Z7_DIAGNOSTIC_IGNORE_END_RESERVED_MACRO_IDENTIFIER
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #ifdef Z7_AFFINITY_SUPPORTED
 // #include <sched.h>
+#include <fcntl.h>
+#include <stdio.h>
 #endif
 
 
@@ -318,6 +379,105 @@ WRes Thread_Create_With_Affinity(CThread *p, THREAD_FUNC_TYPE func, LPVOID param
 }
 
 
+#ifdef Z7_AFFINITY_SUPPORTED
+
+#define NUMA_MAX_NODES 64
+
+static unsigned g_Numa_NumNodes;
+static CCpuSet g_Numa_CpuSets[NUMA_MAX_NODES];
+static pthread_once_t g_Numa_Once = PTHREAD_ONCE_INIT;
+
+/* it reads the list from sysfs file, like "0-3,8-11" */
+static int Numa_ReadList(const char *path, CCpuSet *cs)
+{
+  char buf[1 << 12];
+  const char *s = buf;
+  ssize_t size;
+  const int fd = open(path, O_RDONLY);
+  if (fd < 0)
+    return 0;
+  size = read(fd, buf, sizeof(buf) - 1);
+  close(fd);
+  if (size <= 0)
+    return 0;
+  buf[size] = 0;
+  CpuSet_Zero(cs);
+  for (;;)
+  {
+    char *end;
+    unsigned long a, b;
+    if (*s < '0' || *s > '9')
+      break;
+    a = strtoul(s, &end, 10);
+    b = a;
+    s = end;
+    if (*s == '-')
+    {
+      b = strtoul(s + 1, &end, 10);
+      s = end;
+    }
+    if (b >= CPU_SETSIZE)
+      return 0;
+    for (; a <= b; a++)
+      CpuSet_Set(cs, a);
+    if (*s != ',')
+      break;
+    s++;
+  }
+  return 1;
+}
+
+static void Numa_Init(void)
+{
+  CCpuSet nodes;
+  unsigned num = 0;
+  unsigned i;
+  if (Numa_ReadList("/sys/devices/system/node/online", &nodes))
+    for (i = 0; i < CPU_SETSIZE && num < NUMA_MAX_NODES; i++)
+      if (CpuSet_IsSet(&nodes, i))
+      {
+        char path[64];
+        CCpuSet *cs = &g_Numa_CpuSets[num];
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", i);
+        if (Numa_ReadList(path, cs) && CPU_COUNT(cs) != 0)
+          num++;
+      }
+  g_Numa_NumNodes = num;
+}
+
+unsigned Numa_GetNumNodes(void)
+{
+  pthread_once(&g_Numa_Once, Numa_Init);
+  return g_Numa_NumNodes > 1 ? g_Numa_NumNodes : 1;
+}
+
+// the CPUs that are not allowed for current thread (taskset) are excluded
+static BoolInt Numa_GetThreadCpuSet(unsigned node, CCpuSet *cs)
+{
+  if (Numa_GetNumNodes() < 2 || node >= g_Numa_NumNodes
+      || sched_getaffinity(0, sizeof(*cs), cs) != 0)
+    return False;
+  CPU_AND(cs, cs, &g_Numa_CpuSets[node]);
+  return CPU_COUNT(cs) != 0;
+}
+
+#else
+
+unsigned Numa_GetNumNodes(void)
+{
+  return 1;
+}
+
+static BoolInt Numa_GetThreadCpuSet(unsigned node, CCpuSet *cs)
+{
+  UNUSED_VAR(node)
+  UNUSED_VAR(cs)
+  return False;
+}
+
+#endif
+
+
 WRes Thread_Close(CThread *p)
 {
   // Print("Thread_Close")
@@ -349,6 +509,74 @@ WRes Thread_Wait_Close(CThread *p)
 
 
 
+#ifdef Z7_USE_FUTEX
+
+/*
+  Futex based events and semaphores:
+    (_state) / (_count) is futex word.
+    (_numWaiters) is the number of threads that can sleep in FUTEX_WAIT.
+  Set / Release stores new value and then reads (_numWaiters).
+  Wait increments (_numWaiters) and then reads new value.
+  All these operations are sequentially consistent,
+  so Set / Release can't miss the thread that goes to sleep.
+  The waiting thread spins for short time before sleeping,
+  because the wait time for another thread in multithreaded coders is short.
+*/
+
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+#define FUTEX_ATOMIC_LOAD(p)       __atomic_load_n(p, __ATOMIC_SEQ_CST)
+#define FUTEX_ATOMIC_STORE(p, v)   __atomic_store_n(p, v, __ATOMIC_SEQ_CST)
+#define FUTEX_ATOMIC_ADD(p, v)     __atomic_add_fetch(p, v, __ATOMIC_SEQ_CST)
+#define FUTEX_ATOMIC_CAS(p, expected, v) \
+    __atomic_compare_exchange_n(p, expected, v, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+
+#if defined(__i386__) || defined(__x86_64__)
+  #define FUTEX_SPIN_PAUSE  __asm__ __volatile__("pause");
+#elif defined(__aarch64__) || (defined(__arm__) && defined(__ARM_ARCH) && (__ARM_ARCH >= 7))
+  #define FUTEX_SPIN_PAUSE  __asm__ __volatile__("yield");
+#else
+  #define FUTEX_SPIN_PAUSE
+#endif
+
+#define FUTEX_SPIN_COUNT  (1 << 7)
+
+// spinning is useless, if there is only one CPU
+static unsigned g_Futex_SpinCount = (unsigned)(int)-1;
+
+static void Futex_InitSpinCount(void)
+{
+  if (__atomic_load_n(&g_Futex_SpinCount, __ATOMIC_RELAXED) == (unsigned)(int)-1)
+    __atomic_store_n(&g_Futex_SpinCount,
+        sysconf(_SC_NPROCESSORS_ONLN) > 1 ? FUTEX_SPIN_COUNT : 0, __ATOMIC_RELAXED);
+}
+
+static void Futex_Wait(UInt32 *addr, UInt32 val)
+{
+  // it returns immediately with EAGAIN, if (*addr != val)
+  syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, NULL, NULL, 0);
+}
+
+static void Futex_Wake(UInt32 *addr, int num)
+{
+  syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, num, NULL, NULL, 0);
+}
+
+
+static WRes Event_Create(CEvent *p, int manualReset, int signaled)
+{
+  Futex_InitSpinCount();
+  p->_manual_reset = manualReset;
+  p->_state = (signaled ? 1 : 0);
+  p->_numWaiters = 0;
+  p->_created = 1;
+  return 0;
+}
+
+#else
+
 static WRes Event_Create(CEvent *p, int manualReset, int signaled)
 {
   RINOK(pthread_mutex_init(&p->_mutex, NULL))
@@ -359,6 +587,8 @@ static WRes Event_Create(CEvent *p, int manualReset, int signaled)
   return 0;
 }
 
+#endif
+
 WRes ManualResetEvent_Create(CManualResetEvent *p, int signaled)
   { return Event_Create(p, True, signaled); }
 WRes ManualResetEvent_CreateNotSignaled(CManualResetEvent *p)
@@ -369,6 +599,128 @@ WRes AutoResetEvent_CreateNotSignaled(CAutoResetEvent *p)
   { return AutoResetEvent_Create(p, 0); }
 
 
+#ifdef Z7_USE_FUTEX
+
+static BoolInt Event_TryWait(CEvent *p)
+{
+  UInt32 expected = 1;
+  if (p->_manual_reset)
+    return FUTEX_ATOMIC_LOAD(&p->_state) != 0;
+  return FUTEX_ATOMIC_CAS(&p->_state, &expected, 0);
+}
+
+WRes Event_Set(CEvent *p)
+{
+  FUTEX_ATOMIC_STORE(&p->_state, 1);
+  if (FUTEX_ATOMIC_LOAD(&p->_numWaiters) != 0)
+    Futex_Wake(&p->_state, p->_manual_reset ? INT_MAX : 1);
+  return 0;
+}
+
+WRes Event_Reset(CEvent *p)
+{
+  FUTEX_ATOMIC_STORE(&p->_state, 0);
+  return 0;
+}
+
+WRes Event_Wait(CEvent *p)
+{
+  unsigned i;
+  for (i = __atomic_load_n(&g_Futex_SpinCount, __ATOMIC_RELAXED); i != 0; i--)
+  {
+    if (Event_TryWait(p))
+      return 0;
+    FUTEX_SPIN_PAUSE
+  }
+  FUTEX_ATOMIC_ADD(&p->_numWaiters, 1);
+  while (!Event_TryWait(p))
+    Futex_Wait(&p->_state, 0);
+  FUTEX_ATOMIC_ADD(&p->_numWaiters, (UInt32)(Int32)-1);
+  return 0;
+}
+
+WRes Event_Close(CEvent *p)
+{
+  p->_created = 0;
+  return 0;
+}
+
+
+WRes Semaphore_Create(CSemaphore *p, UInt32 initCount, UInt32 maxCount)
+{
+  if (initCount > maxCount || maxCount < 1)
+    return EINVAL;
+  Futex_InitSpinCount();
+  p->_count = initCount;
+  p->_maxCount = maxCount;
+  p->_numWaiters = 0;
+  p->_created = 1;
+  return 0;
+}
+
+WRes Semaphore_OptCreateInit(CSemaphore *p, UInt32 initCount, UInt32 maxCount)
+{
+  if (Semaphore_IsCreated(p))
+  {
+    if (initCount > maxCount || maxCount < 1)
+      return EINVAL;
+    FUTEX_ATOMIC_STORE(&p->_count, initCount);
+    p->_maxCount = maxCount;
+    return 0;
+  }
+  return Semaphore_Create(p, initCount, maxCount);
+}
+
+WRes Semaphore_ReleaseN(CSemaphore *p, UInt32 releaseCount)
+{
+  UInt32 count;
+  if (releaseCount < 1)
+    return EINVAL;
+  count = FUTEX_ATOMIC_LOAD(&p->_count);
+  do
+  {
+    if (releaseCount > p->_maxCount - count)
+      return ERROR_TOO_MANY_POSTS; // EINVAL;
+  }
+  while (!FUTEX_ATOMIC_CAS(&p->_count, &count, count + releaseCount));
+  if (FUTEX_ATOMIC_LOAD(&p->_numWaiters) != 0)
+    Futex_Wake(&p->_count, releaseCount > INT_MAX ? INT_MAX : (int)releaseCount);
+  return 0;
+}
+
+static BoolInt Semaphore_TryWait(CSemaphore *p)
+{
+  UInt32 count = FUTEX_ATOMIC_LOAD(&p->_count);
+  while (count != 0)
+    if (FUTEX_ATOMIC_CAS(&p->_count, &count, count - 1))
+      return True;
+  return False;
+}
+
+WRes Semaphore_Wait(CSemaphore *p)
+{
+  unsigned i;
+  for (i = __atomic_load_n(&g_Futex_SpinCount, __ATOMIC_RELAXED); i != 0; i--)
+  {
+    if (Semaphore_TryWait(p))
+      return 0;
+    FUTEX_SPIN_PAUSE
+  }
+  FUTEX_ATOMIC_ADD(&p->_numWaiters, 1);
+  while (!Semaphore_TryWait(p))
+    Futex_Wait(&p->_count, 0);
+  FUTEX_ATOMIC_ADD(&p->_numWaiters, (UInt32)(Int32)-1);
+  return 0;
+}
+
+WRes Semaphore_Close(CSemaphore *p)
+{
+  p->_created = 0;
+  return 0;
+}
+
+#else // Z7_USE_FUTEX
+
 #if defined(Z7_LLVM_CLANG_VERSION) && (__clang_major__ == 13)
 // freebsd:
 #pragma GCC diagnostic ignored "-Wthread-safety-analysis"
@@ -502,6 +854,9 @@ WRes Semaphore_Close(CSemaphore *p)
 
 
 
+#endif // Z7_USE_FUTEX
+
+
 WRes CriticalSection_Init(CCriticalSection *p)
 {
   // Print("CriticalSection_Init")
@@ -577,5 +932,392 @@ WRes AutoResetEvent_OptCreate_And_Reset(CAutoResetEvent *p)
   return AutoResetEvent_CreateNotSignaled(p);
 }
 
+
+// ---------- Thread pool ----------
+
+/*
+  The worker of thread pool executes one thread function at a time.
+  PoolThread_Wait_Close() returns the worker to the list of idle workers,
+  and next PoolThread_Create*() call reuses it instead of creating new thread.
+  The number of active workers is not limited, because the callers
+  require that all their threads run at same time.
+*/
+
+#ifdef _WIN32
+  #define THREAD_POOL_ERROR_MEM  ERROR_NOT_ENOUGH_MEMORY
+#else
+  #define THREAD_POOL_ERROR_MEM  ENOMEM
+#endif
+
+struct CThreadPoolWorker_
+{
+  CThread thread;
+  CAutoResetEvent startEvent;
+  CAutoResetEvent finishedEvent;
+  THREAD_FUNC_TYPE func; // NULL means exit
+  LPVOID param;
+  struct CThreadPoolWorker_ *next;
+  BoolInt cpuSetDefined;
+  CCpuSet cpuSet;
+ #ifdef _WIN32
+  HMODULE module; // reference to the module that contains the code of worker
+ #endif
+};
+
+typedef struct CThreadPoolWorker_ CThreadPoolWorker;
+
+static CThreadPoolWorker *g_ThreadPool_Idle;
+static unsigned g_ThreadPool_NumIdle;
+static unsigned g_ThreadPool_MaxIdle;
+
+#ifdef _WIN32
+
+/* ThreadPool_Lock() returns False, if the lock can't be created.
+   Then the callers don't use the list of idle workers. */
+
+#if defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0600)
+
+static SRWLOCK g_ThreadPool_Lock = SRWLOCK_INIT;
+
+static BoolInt ThreadPool_Lock(void)
+{
+  AcquireSRWLockExclusive(&g_ThreadPool_Lock);
+  return True;
+}
+
+static void ThreadPool_Unlock(void)
+{
+  ReleaseSRWLockExclusive(&g_ThreadPool_Lock);
+}
+
+#else
+
+// there is no statically initialized lock before Vista.
+// So the first caller creates critical section and publishes it.
+
+static CRITICAL_SECTION * volatile g_ThreadPool_Lock;
+
+static BoolInt ThreadPool_Lock(void)
+{
+  CRITICAL_SECTION *cs = g_ThreadPool_Lock;
+  if (!cs)
+  {
+    CRITICAL_SECTION *cs2;
+    cs = (CRITICAL_SECTION *)malloc(sizeof(CRITICAL_SECTION));
+    if (!cs || CriticalSection_Init(cs) != 0)
+    {
+      free(cs);
+      return False;
+    }
+    cs2 = (CRITICAL_SECTION *)InterlockedCompareExchangePointer(
+        (PVOID volatile *)&g_ThreadPool_Lock, cs, NULL);
+    if (cs2)
+    {
+      // another thread has published its critical section
+      DeleteCriticalSection(cs);
+      free(cs);
+      cs = cs2;
+    }
+  }
+  EnterCriticalSection(cs);
+  return True;
+}
+
+static void ThreadPool_Unlock(void)
+{
+  LeaveCriticalSection(g_ThreadPool_Lock);
+}
+
+#endif
+
+static unsigned ThreadPool_GetNumCpus(void)
+{
+  SYSTEM_INFO si;
+  GetSystemInfo(&si);
+  return (unsigned)si.dwNumberOfProcessors;
+}
+
+#else
+
+static pthread_mutex_t g_ThreadPool_Mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static BoolInt ThreadPool_Lock(void)
+{
+  return pthread_mutex_lock(&g_ThreadPool_Mutex) == 0;
+}
+
+static void ThreadPool_Unlock(void)
+{
+  pthread_mutex_unlock(&g_ThreadPool_Mutex);
+}
+
+static unsigned ThreadPool_GetNumCpus(void)
+{
+  const long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return n > 0 ? (unsigned)n : 1;
+}
+
+#endif
+
+
+#ifdef _WIN32
+
+/* The DLL can't wait for exit of threads in DllMain(DLL_PROCESS_DETACH)
+   under loader lock, and it can't terminate them there.
+   So worker that can be kept in the list of idle workers holds a reference
+   to the module that contains its code, and it exits via FreeLibraryAndExitThread().
+   The module is not unloaded, while there are idle workers.
+   ThreadPool_Shutdown() frees idle workers and releases their references. */
+
+#ifndef GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS
+#define GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS  4
+#endif
+
+typedef BOOL (WINAPI *Func_GetModuleHandleExW)(DWORD flags, LPCWSTR name, HMODULE *module);
+
+static HMODULE ThreadPool_RefModule(void)
+{
+  HMODULE module = NULL;
+Z7_DIAGNOSTIC_IGNORE_CAST_FUNCTION
+  const
+   Func_GetModuleHandleExW fn =
+  (Func_GetModuleHandleExW) Z7_CAST_FUNC_C GetProcAddress(GetModuleHandle(TEXT("kernel32.dll")),
+       "GetModuleHandleExW");
+  // GetModuleHandleExW() is not supported before WinXP
+  if (!fn || !fn(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS,
+      (LPCWSTR)(const void *)&g_ThreadPool_Idle, &module))
+    return NULL;
+  return module;
+}
+
+#endif
+
+
+static THREAD_FUNC_DECL ThreadPool_WorkerFunc(void *pp)
+{
+  CThreadPoolWorker *w = (CThreadPoolWorker *)pp;
+  for (;;)
+  {
+    if (Event_Wait(&w->startEvent) != 0 || !w->func)
+    {
+     #ifdef _WIN32
+      if (w->module)
+        FreeLibraryAndExitThread(w->module, 0);
+     #endif
+      return THREAD_FUNC_RET_ZERO;
+    }
+    #if !defined(_WIN32) && defined(Z7_AFFINITY_SUPPORTED)
+    if (w->cpuSetDefined)
+      sched_setaffinity(0, sizeof(w->cpuSet), &w->cpuSet);
+    #endif
+    w->func(w->param);
+    Event_Set(&w->finishedEvent);
+  }
+}
+
+
+static WRes ThreadPoolWorker_Create(CThreadPoolWorker **wp)
+{
+  WRes wres;
+  CThreadPoolWorker *w = (CThreadPoolWorker *)malloc(sizeof(CThreadPoolWorker));
+  *wp = NULL;
+  if (!w)
+    return THREAD_POOL_ERROR_MEM;
+  Thread_CONSTRUCT(&w->thread)
+  Event_Construct(&w->startEvent);
+  Event_Construct(&w->finishedEvent);
+  w->func = NULL;
+  w->cpuSetDefined = False;
+ #ifdef _WIN32
+  w->module = ThreadPool_RefModule();
+ #endif
+  wres = AutoResetEvent_CreateNotSignaled(&w->startEvent);
+  if (wres == 0)
+    wres = AutoResetEvent_CreateNotSignaled(&w->finishedEvent);
+  if (wres == 0)
+    wres = Thread_Create(&w->thread, ThreadPool_WorkerFunc, w);
+  if (wres != 0)
+  {
+   #ifdef _WIN32
+    if (w->module)
+      FreeLibrary(w->module);
+   #endif
+    Event_Close(&w->startEvent);
+    Event_Close(&w->finishedEvent);
+    free(w);
+    return wres;
+  }
+  *wp = w;
+  return 0;
+}
+
+
+static void ThreadPoolWorker_Destroy(CThreadPoolWorker *w)
+{
+  w->func = NULL;
+  if (Event_Set(&w->startEvent) != 0)
+    return; // the thread can't exit, so we can't free (w)
+  Thread_Wait_Close(&w->thread);
+  Event_Close(&w->startEvent);
+  Event_Close(&w->finishedEvent);
+  free(w);
+}
+
+
+/* new thread in Posix inherits affinity from parent thread.
+   So we emulate it for reused worker, if (cpuSet) is not defined. */
+static void ThreadPoolWorker_SetCpuSet(CThreadPoolWorker *w, const CCpuSet *cpuSet)
+{
+ #ifdef _WIN32
+  if (cpuSet)
+  {
+    SetThreadAffinityMask(w->thread, *cpuSet);
+    w->cpuSetDefined = True;
+  }
+  else if (w->cpuSetDefined)
+  {
+    DWORD_PTR processMask, systemMask;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask))
+    {
+      SetThreadAffinityMask(w->thread, processMask);
+      w->cpuSetDefined = False;
+    }
+  }
+ #elif defined(Z7_AFFINITY_SUPPORTED)
+  w->cpuSetDefined = True;
+  if (cpuSet)
+    w->cpuSet = *cpuSet;
+  else if (sched_getaffinity(0, sizeof(w->cpuSet), &w->cpuSet) != 0)
+    w->cpuSetDefined = False;
+ #else
+  UNUSED_VAR(w)
+  UNUSED_VAR(cpuSet)
+ #endif
+}
+
+
+/* it removes one worker from the list of idle workers,
+   if the number of idle workers is larger than (numIdleToKeep). */
+static CThreadPoolWorker *ThreadPool_PopIdle(unsigned numIdleToKeep)
+{
+  CThreadPoolWorker *w = NULL;
+  if (!ThreadPool_Lock())
+    return NULL;
+  if (g_ThreadPool_NumIdle > numIdleToKeep)
+  {
+    w = g_ThreadPool_Idle;
+    g_ThreadPool_Idle = w->next;
+    g_ThreadPool_NumIdle--;
+  }
+  ThreadPool_Unlock();
+  return w;
+}
+
+
+WRes PoolThread_Create_With_CpuSet(CPoolThread *p, THREAD_FUNC_TYPE func, LPVOID param, const CCpuSet *cpuSet)
+{
+  CThreadPoolWorker *w;
+  WRes wres;
+  *p = NULL;
+  w = ThreadPool_PopIdle(0);
+  if (!w)
+  {
+    RINOK(ThreadPoolWorker_Create(&w))
+  }
+  w->func = func;
+  w->param = param;
+  ThreadPoolWorker_SetCpuSet(w, cpuSet);
+  wres = Event_Set(&w->startEvent);
+  if (wres == 0)
+    *p = w;
+  return wres;
+}
+
+WRes PoolThread_Create(CPoolThread *p, THREAD_FUNC_TYPE func, LPVOID param)
+{
+  return PoolThread_Create_With_CpuSet(p, func, param, NULL);
+}
+
+WRes PoolThread_Create_With_Affinity(CPoolThread *p, THREAD_FUNC_TYPE func, LPVOID param, CAffinityMask affinity)
+{
+  CCpuSet cs;
+ #ifdef _WIN32
+  cs = affinity;
+ #else
+  unsigned i;
+  CpuSet_Zero(&cs);
+  for (i = 0; i < sizeof(affinity) * 8 && affinity != 0; i++, affinity >>= 1)
+    if (affinity & 1)
+    {
+      CpuSet_Set(&cs, i);
+    }
+ #endif
+  return PoolThread_Create_With_CpuSet(p, func, param, &cs);
+}
+
+WRes PoolThread_Create_On_NumaNode(CPoolThread *p, THREAD_FUNC_TYPE func, LPVOID param, unsigned node)
+{
+  CCpuSet cs;
+  if (Numa_GetThreadCpuSet(node, &cs))
+    return PoolThread_Create_With_CpuSet(p, func, param, &cs);
+  return PoolThread_Create(p, func, param);
+}
+
+
+WRes PoolThread_Wait_Close(CPoolThread *p)
+{
+  CThreadPoolWorker *w = *p;
+  WRes wres;
+  if (!w)
+    return 0;
+  *p = NULL;
+  wres = Event_Wait(&w->finishedEvent);
+  if (wres != 0)
+    return wres; // we don't know the state of worker, so we don't reuse it
+  if (
+     #ifdef _WIN32
+      w->module && // the worker without reference to module can't outlive the module
+     #endif
+      ThreadPool_Lock())
+  {
+    if (g_ThreadPool_MaxIdle == 0)
+      g_ThreadPool_MaxIdle = ThreadPool_GetNumCpus() * 2;
+    if (g_ThreadPool_NumIdle < g_ThreadPool_MaxIdle)
+    {
+      w->next = g_ThreadPool_Idle;
+      g_ThreadPool_Idle = w;
+      g_ThreadPool_NumIdle++;
+      w = NULL;
+    }
+    ThreadPool_Unlock();
+  }
+  if (w)
+    ThreadPoolWorker_Destroy(w);
+  return 0;
+}
+
+
+void ThreadPool_SetMaxIdle(unsigned num)
+{
+  CThreadPoolWorker *w;
+  if (num == 0)
+    num = 1;
+  if (!ThreadPool_Lock())
+    return;
+  g_ThreadPool_MaxIdle = num;
+  ThreadPool_Unlock();
+  while ((w = ThreadPool_PopIdle(num)) != NULL)
+    ThreadPoolWorker_Destroy(w);
+}
+
+
+void ThreadPool_Shutdown(void)
+{
+  CThreadPoolWorker *w;
+  while ((w = ThreadPool_PopIdle(0)) != NULL)
+    ThreadPoolWorker_Destroy(w);
+}
+
+
 #undef PRF
 #undef Print
@@ -146,6 +146,49 @@ WRes Thread_Wait_Close(CThread *p);
 WRes Thread_Create_With_CpuSet(CThread *p, THREAD_FUNC_TYPE func, LPVOID param, const CCpuSet *cpuSet);
 #endif
 
+/*
+  CPoolThread is the thread from global pool of threads:
+    PoolThread_Create*() runs (func) in idle worker thread of pool,
+      or it creates new worker, if there is no idle worker.
+    PoolThread_Wait_Close() waits for (func) finishing and
+      returns the worker to pool for later reusing.
+  The number of idle workers is limited by ThreadPool_SetMaxIdle(),
+  default limit is (number_of_CPUs * 2).
+*/
+typedef struct CThreadPoolWorker_ *CPoolThread;
+
+#define PoolThread_CONSTRUCT(p)   *(p) = NULL
+#define PoolThread_WasCreated(p)  (*(p) != NULL)
+
+WRes PoolThread_Create(CPoolThread *p, THREAD_FUNC_TYPE func, LPVOID param);
+WRes PoolThread_Create_With_Affinity(CPoolThread *p, THREAD_FUNC_TYPE func, LPVOID param, CAffinityMask affinity);
+WRes PoolThread_Create_With_CpuSet(CPoolThread *p, THREAD_FUNC_TYPE func, LPVOID param, const CCpuSet *cpuSet);
+WRes PoolThread_Wait_Close(CPoolThread *p);
+void ThreadPool_SetMaxIdle(unsigned num);
+
+/*
+  ThreadPool_Shutdown() wakes all idle workers and waits for their exit.
+    In Posix it must be called when the module that contains the pool is unloaded.
+    In Windows idle workers hold a reference to the module, so the module
+    is not unloaded before ThreadPool_Shutdown() call.
+*/
+void ThreadPool_Shutdown(void);
+
+/*
+  Numa_GetNumNodes() returns the number of NUMA nodes that contain CPUs
+    allowed for the process. It returns 1, if NUMA is not supported.
+  PoolThread_Create_On_NumaNode() runs the thread only on CPUs of (node).
+    The memory that is allocated and touched first in that thread
+    is placed to that node by "first touch" policy of OS.
+    If (node) is not available, the thread runs without affinity.
+*/
+unsigned Numa_GetNumNodes(void);
+WRes PoolThread_Create_On_NumaNode(CPoolThread *p, THREAD_FUNC_TYPE func, LPVOID param, unsigned node);
+
+// (numThreads) threads are split to contiguous groups of threads per node
+#define Numa_GetThreadNode(threadIndex, numThreads, numNodes) \
+  ((unsigned)((UInt64)(threadIndex) * (numNodes) / (numThreads)))
+
 
 #ifdef _WIN32
 
@@ -182,6 +225,26 @@ WRes CriticalSection_Init(CCriticalSection *p);
 
 #else // _WIN32
 
+/* Z7_USE_FUTEX : events and semaphores use futex syscall in Linux.
+   The uncontended Set / Release / Wait calls don't enter the kernel. */
+// #define Z7_FUTEX_DISABLE
+#if defined(__linux__) && !defined(Z7_FUTEX_DISABLE) \
+    && (defined(__clang__) || (defined(__GNUC__) && (__GNUC__ * 100 + __GNUC_MINOR__ >= 407)))
+#define Z7_USE_FUTEX
+#endif
+
+#ifdef Z7_USE_FUTEX
+
+typedef struct
+{
+  int _created;
+  int _manual_reset;
+  UInt32 _state; // futex word
+  UInt32 _numWaiters;
+} CEvent;
+
+#else
+
 typedef struct
 {
   int _created;
@@ -191,6 +254,8 @@ typedef struct
   pthread_cond_t _cond;
 } CEvent;
 
+#endif
+
 typedef CEvent CAutoResetEvent;
 typedef CEvent CManualResetEvent;
 
@@ -208,6 +273,18 @@ WRes Event_Wait(CEvent *p);
 WRes Event_Close(CEvent *p);
 
 
+#ifdef Z7_USE_FUTEX
+
+typedef struct
+{
+  int _created;
+  UInt32 _count; // futex word
+  UInt32 _maxCount;
+  UInt32 _numWaiters;
+} CSemaphore;
+
+#else
+
 typedef struct
 {
   int _created;
@@ -217,6 +294,8 @@ typedef struct
   pthread_cond_t _cond;
 } CSemaphore;
 
+#endif
+
 #define Semaphore_Construct(p) (p)->_created = 0
 #define Semaphore_IsCreated(p) ((p)->_created)
 
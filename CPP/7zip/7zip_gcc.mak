@@ -440,6 +440,8 @@ $O/Window2.o: ../../../Windows/Control/Window2.cpp
 	$(CXX) $(CXXFLAGS) $<
 
 
+$O/CachedInStream.o: ../../Common/CachedInStream.cpp
+	$(CXX) $(CXXFLAGS) $<
 $O/CreateCoder.o: ../../Common/CreateCoder.cpp
 	$(CXX) $(CXXFLAGS) $<
 $O/CWrappers.o: ../../Common/CWrappers.cpp
@@ -450,6 +452,8 @@ $O/FileStreams.o: ../../Common/FileStreams.cpp
 	$(CXX) $(CXXFLAGS) $<
 $O/FilterCoder.o: ../../Common/FilterCoder.cpp
 	$(CXX) $(CXXFLAGS) $<
+$O/FilterThread.o: ../../Common/FilterThread.cpp
+	$(CXX) $(CXXFLAGS) $<
 $O/InBuffer.o: ../../Common/InBuffer.cpp
 	$(CXX) $(CXXFLAGS) $<
 $O/InOutTempBuffer.o: ../../Common/InOutTempBuffer.cpp
@@ -743,6 +747,8 @@ $O/CopyRegister.o: ../../Compress/CopyRegister.cpp
 	$(CXX) $(CXXFLAGS) $<
 $O/Deflate64Register.o: ../../Compress/Deflate64Register.cpp
 	$(CXX) $(CXXFLAGS) $<
+$O/DedupCoder.o: ../../Compress/DedupCoder.cpp
+	$(CXX) $(CXXFLAGS) $<
 $O/DeflateDecoder.o: ../../Compress/DeflateDecoder.cpp
 	$(CXX) $(CXXFLAGS) $<
 $O/DeflateEncoder.o: ../../Compress/DeflateEncoder.cpp
@@ -781,6 +787,14 @@ $O/LzOutWindow.o: ../../Compress/LzOutWindow.cpp
 	$(CXX) $(CXXFLAGS) $<
 $O/LzxDecoder.o: ../../Compress/LzxDecoder.cpp
 	$(CXX) $(CXXFLAGS) $<
+$O/LzxEncoder.o: ../../Compress/LzxEncoder.cpp
+	$(CXX) $(CXXFLAGS) $<
+$O/Ppmd2Decoder.o: ../../Compress/Ppmd2Decoder.cpp
+	$(CXX) $(CXXFLAGS) $<
+$O/Ppmd2Encoder.o: ../../Compress/Ppmd2Encoder.cpp
+	$(CXX) $(CXXFLAGS) $<
+$O/Ppmd2Register.o: ../../Compress/Ppmd2Register.cpp
+	$(CXX) $(CXXFLAGS) $<
 $O/PpmdDecoder.o: ../../Compress/PpmdDecoder.cpp
 	$(CXX) $(CXXFLAGS) $<
 $O/PpmdEncoder.o: ../../Compress/PpmdEncoder.cpp
@@ -807,6 +821,8 @@ $O/ShrinkDecoder.o: ../../Compress/ShrinkDecoder.cpp
 	$(CXX) $(CXXFLAGS) $<
 $O/XpressDecoder.o: ../../Compress/XpressDecoder.cpp
 	$(CXX) $(CXXFLAGS) $<
+$O/XpressEncoder.o: ../../Compress/XpressEncoder.cpp
+	$(CXX) $(CXXFLAGS) $<
 $O/XzDecoder.o: ../../Compress/XzDecoder.cpp
 	$(CXX) $(CXXFLAGS) $<
 $O/XzEncoder.o: ../../Compress/XzEncoder.cpp
@@ -866,6 +882,8 @@ $O/InStreamWithCRC.o: ../../Archive/Common/InStreamWithCRC.cpp
 	$(CXX) $(CXXFLAGS) $<
 $O/ItemNameUtils.o: ../../Archive/Common/ItemNameUtils.cpp
 	$(CXX) $(CXXFLAGS) $<
+$O/MtChunkDecoder.o: ../../Archive/Common/MtChunkDecoder.cpp
+	$(CXX) $(CXXFLAGS) $<
 $O/MultiStream.o: ../../Archive/Common/MultiStream.cpp
 	$(CXX) $(CXXFLAGS) $<
 $O/OutStreamWithCRC.o: ../../Archive/Common/OutStreamWithCRC.cpp
@@ -874,6 +892,8 @@ $O/OutStreamWithSha1.o: ../../Archive/Common/OutStreamWithSha1.cpp
 	$(CXX) $(CXXFLAGS) $<
 $O/ParseProperties.o: ../../Archive/Common/ParseProperties.cpp
 	$(CXX) $(CXXFLAGS) $<
+$O/SeekIndex.o: ../../Archive/Common/SeekIndex.cpp
+	$(CXX) $(CXXFLAGS) $<
 
 
 
@@ -950,6 +970,10 @@ $O/Client7z.o: ../../UI/Client7z/Client7z.cpp
 	$(CXX) $(CXXFLAGS) $<
 
 
+$O/ArcBenchCon.o: ../../UI/Console/ArcBenchCon.cpp
+	$(CXX) $(CXXFLAGS) $<
+$O/ArcBenchRef.o: ../../UI/Console/ArcBenchRef.cpp
+	$(CXX) $(CXXFLAGS) $<
 $O/BenchCon.o: ../../UI/Console/BenchCon.cpp
 	$(CXX) $(CXXFLAGS) $<
 $O/ConsoleClose.o: ../../UI/Console/ConsoleClose.cpp
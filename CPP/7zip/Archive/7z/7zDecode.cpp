@@ -2,6 +2,7 @@
 
 #include "StdAfx.h"
 
+#include "../../Common/FilterCoder.h"
 #include "../../Common/LimitedStreams.h"
 #include "../../Common/ProgressUtils.h"
 #include "../../Common/StreamObjects.h"
@@ -108,7 +109,8 @@ static bool AreBindInfoExEqual(const CBindInfoEx &a1, const CBindInfoEx &a2)
 }
 
 CDecoder::CDecoder(bool useMixerMT):
-    _bindInfoPrev_Defined(false)
+    _bindInfoPrev_Defined(false),
+    FilterStat(NULL)
 {
   #if defined(USE_MIXER_ST) && defined(USE_MIXER_MT)
   _useMixerMT = useMixerMT;
@@ -270,6 +272,7 @@ HRESULT CDecoder::Decode(
   if (!_bindInfoPrev_Defined || !AreBindInfoExEqual(bindInfo, _bindInfoPrev))
   {
     _bindInfoPrev_Defined = false;
+    _filterCoders.Clear();
     _mixerRef.Release();
 
     #ifdef USE_MIXER_MT
@@ -322,6 +325,8 @@ HRESULT CDecoder::Decode(
         if (!cod.Coder2 || cod.NumStreams != coderInfo.NumStreams)
           return E_NOTIMPL;
       }
+      if (cod.IsFilter)
+        _filterCoders.Add((CFilterCoder *)(ICompressCoder *)cod.Coder);
       _mixer->AddCoder(cod);
       
       // now there is no codec that uses another external codec
@@ -343,6 +348,9 @@ HRESULT CDecoder::Decode(
   }
 
   RINOK(_mixer->ReInit2())
+
+  FOR_VECTOR(k, _filterCoders)
+    _filterCoders[k]->Stat = FilterStat;
   
   UInt32 packStreamIndex = 0;
   UInt32 unpackStreamIndexStart = folders.FoToCoderUnpackSizes[folderIndex];
@@ -3,10 +3,14 @@
 #ifndef ZIP7_INC_7Z_DECODE_H
 #define ZIP7_INC_7Z_DECODE_H
 
+#include "../../Common/IoStat.h"
+
 #include "../Common/CoderMixer2.h"
 
 #include "7zIn.h"
 
+class CFilterCoder;
+
 namespace NArchive {
 namespace N7z {
 
@@ -41,8 +45,10 @@ class CDecoder
   
   NCoderMixer2::CMixer *_mixer;
   CMyComPtr<IUnknown> _mixerRef;
+  CRecordVector<CFilterCoder *> _filterCoders; // they are referenced by _mixerRef
 
 public:
+  CStageStatItem *FilterStat; // optional: time of filters
 
   CDecoder(bool useMixerMT);
   
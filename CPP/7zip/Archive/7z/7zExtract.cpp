@@ -16,6 +16,13 @@
 namespace NArchive {
 namespace N7z {
 
+static UInt64 GetTime_of_OutStages(const CStageStatItem *stages)
+{
+  return stages[NExtract::NStage::kFilter].Time
+       + stages[NExtract::NStage::kCrc].Time
+       + stages[NExtract::NStage::kWrite].Time;
+}
+
 Z7_CLASS_IMP_COM_1(
   CFolderOutStream
   , ISequentialOutStream
@@ -44,12 +51,14 @@ private:
 public:
   const CDbEx *_db;
   CMyComPtr<IArchiveExtractCallback> ExtractCallback;
+  CStageStatItem *Stages; // optional: [NExtract::NStage::kNumStages]
 
   bool ExtraWriteWasCut;
 
   CFolderOutStream():
       TestMode(false),
-      CheckCrc(true)
+      CheckCrc(true),
+      Stages(NULL)
       {}
 
   HRESULT Init(unsigned startIndex, const UInt32 *indexes, unsigned numFiles);
@@ -88,7 +97,13 @@ HRESULT CFolderOutStream::OpenFile(bool isCorrupted)
     askMode = NExtract::NAskMode::kTest;
   
   CMyComPtr<ISequentialOutStream> realOutStream;
-  RINOK(ExtractCallback->GetStream(_fileIndex, &realOutStream, askMode))
+  {
+    // GetStream() can create the output file, so it's part of (kWrite) stage
+    const UInt64 startTime = Stages ? IoStat_GetTime_us() : 0;
+    RINOK(ExtractCallback->GetStream(_fileIndex, &realOutStream, askMode))
+    if (Stages)
+      Stages[NExtract::NStage::kWrite].Add(startTime, 0);
+  }
   
   _stream = realOutStream;
   _crc = CRC_INIT_VAL;
@@ -119,7 +134,12 @@ HRESULT CFolderOutStream::CloseFile_and_SetResult(Int32 res)
   }
 
   _fileIndex++;
-  return ExtractCallback->SetOperationResult(res);
+  if (!Stages)
+    return ExtractCallback->SetOperationResult(res);
+  const UInt64 startTime = IoStat_GetTime_us();
+  const HRESULT hres = ExtractCallback->SetOperationResult(res);
+  Stages[NExtract::NStage::kWrite].Add(startTime, 0);
+  return hres;
 }
 
 HRESULT CFolderOutStream::CloseFile()
@@ -158,9 +178,19 @@ Z7_COM7F_IMF(CFolderOutStream::Write(const void *data, UInt32 size, UInt32 *proc
       }
       HRESULT result = S_OK;
       if (_stream)
+      {
+        const UInt64 startTime = Stages ? IoStat_GetTime_us() : 0;
         result = _stream->Write(data, cur, &cur);
+        if (Stages)
+          Stages[NExtract::NStage::kWrite].Add(startTime, cur);
+      }
       if (_calcCrc)
+      {
+        const UInt64 startTime = Stages ? IoStat_GetTime_us() : 0;
         _crc = CrcUpdate(_crc, data, cur);
+        if (Stages)
+          Stages[NExtract::NStage::kCrc].Add(startTime, cur);
+      }
       if (processedSize)
         *processedSize += cur;
       data = (const Byte *)data + cur;
@@ -274,7 +304,17 @@ Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
   CMyComPtr2_Create<ICompressProgressInfo, CLocalProgress> lps;
   lps->Init(extractCallback, false);
 
-  CDecoder decoder(
+  CMyComPtr<IArchiveExtractCallbackStat> callbackStat;
+  extractCallback.QueryInterface(IID_IArchiveExtractCallbackStat, &callbackStat);
+  if (callbackStat)
+  {
+    Int32 enabled = 0;
+    RINOK(callbackStat->IsStageStatEnabled(&enabled))
+    if (!enabled)
+      callbackStat.Release();
+  }
+
+  bool useMixerMT =
     #if !defined(USE_MIXER_MT)
       false
     #elif !defined(USE_MIXER_ST)
@@ -288,7 +328,19 @@ Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
     #else
       _useMultiThreadMixer
     #endif
-    );
+    ;
+
+  #if defined(USE_MIXER_MT) && defined(USE_MIXER_ST)
+  // the coders in MT mixer work in parallel, so the times of stages would overlap
+  if (callbackStat)
+    useMixerMT = false;
+  #endif
+
+  CDecoder decoder(useMixerMT);
+
+  CStageStatItem stages[NExtract::NStage::kNumStages];
+  if (callbackStat)
+    decoder.FilterStat = &stages[NExtract::NStage::kFilter];
 
   UInt64 curPacked, curUnpacked;
 
@@ -302,6 +354,8 @@ Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
   folderOutStream->ExtractCallback = extractCallback;
   folderOutStream->TestMode = (testModeSpec != 0);
   folderOutStream->CheckCrc = (_crcSize != 0);
+  if (callbackStat)
+    folderOutStream->Stages = stages;
 
   for (UInt32 i = 0;; lps->OutSize += curUnpacked, lps->InSize += curPacked)
   {
@@ -376,6 +430,9 @@ Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
 
       bool dataAfterEnd_Error = false;
 
+      const UInt64 decodeStartTime = callbackStat ? IoStat_GetTime_us() : 0;
+      const UInt64 outStartTime = GetTime_of_OutStages(stages);
+
       const HRESULT result = decoder.Decode(
           EXTERNAL_CODECS_VARS
           _inStream,
@@ -394,6 +451,17 @@ Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
           #endif
           );
 
+      if (callbackStat)
+      {
+        // Decode() calls the filters and CFolderOutStream::Write(),
+        // so we exclude the times of these stages from (kDecode) stage.
+        const UInt64 t = IoStat_GetTime_us() - decodeStartTime;
+        const UInt64 outTime = GetTime_of_OutStages(stages) - outStartTime;
+        CStageStatItem &dec = stages[NExtract::NStage::kDecode];
+        dec.Time += t - MyMin(t, outTime);
+        dec.Size += curUnpacked;
+      }
+
       if (result == S_FALSE || result == E_NOTIMPL || dataAfterEnd_Error)
       {
         const bool wasFinished = folderOutStream->WasWritingFinished();
@@ -436,6 +504,14 @@ Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
     }
   }
 
+  if (callbackStat)
+  {
+    for (unsigned k = 0; k < NExtract::NStage::kNumStages; k++)
+    {
+      RINOK(callbackStat->ReportStageStat(k, stages[k].Time, stages[k].Size))
+    }
+  }
+
   return S_OK;
 
   COM_TRY_END
@@ -43,6 +43,8 @@ CHandler::CHandler()
   _useMultiThreadMixer = true;
   #endif
   
+  #else
+  _appendMode = false;
   #endif
 }
 
@@ -355,7 +357,7 @@ Z7_COM7F_IMF(CHandler::GetRawProp(UInt32 index, PROPID propID, const void **data
       const size_t size = (_db.NameOffsets[index + 1] - offset) * 2;
       if (size < ((UInt32)1 << 31))
       {
-        *data = (const void *)(_db.NamesBuf.ConstData() + offset * 2);
+        *data = (const void *)(_db.NamesBuf + offset * 2);
         *dataSize = (UInt32)size;
         *propType = NPropDataType::kUtf16z;
       }
@@ -436,7 +438,19 @@ HRESULT CHandler::SetMethodToProp(CNum folderIndex, PROPVARIANT *prop) const
     char s[32];
     s[0] = 0;
     
-    if (id64 <= (UInt32)0xFFFFFFFF)
+    if (id64 == k_PPMD || id64 == k_PPMD2)
+    {
+      name = (id64 == k_PPMD) ? "PPMD" : "PPMD2";
+      if (propsSize == (id64 == k_PPMD ? 5u : 6u))
+      {
+        char *dest = s;
+        *dest++ = 'o';
+        dest = ConvertUInt32ToString(*props, dest);
+        dest = MyStpCpy(dest, ":mem");
+        GetStringForSizeValue(dest, GetUi32(props + 1));
+      }
+    }
+    else if (id64 <= (UInt32)0xFFFFFFFF)
     {
       const UInt32 id = (UInt32)id64;
       if (id == k_LZMA)
@@ -465,18 +479,6 @@ HRESULT CHandler::SetMethodToProp(CNum folderIndex, PROPVARIANT *prop) const
         if (propsSize == 1)
           GetLzma2String(s, props[0]);
       }
-      else if (id == k_PPMD)
-      {
-        name = "PPMD";
-        if (propsSize == 5)
-        {
-          char *dest = s;
-          *dest++ = 'o';
-          dest = ConvertUInt32ToString(*props, dest);
-          dest = MyStpCpy(dest, ":mem");
-          GetStringForSizeValue(dest, GetUi32(props + 1));
-        }
-      }
       else if (id == k_Delta)
       {
         name = "Delta";
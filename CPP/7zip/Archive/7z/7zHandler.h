@@ -91,6 +91,7 @@ class CHandler Z7_final:
   
   #ifndef Z7_EXTRACT_ONLY
   public IOutArchive,
+  public IOutArchiveAppend,
   #endif
   
   Z7_PUBLIC_ISetCompressCodecsInfo_IFEC
@@ -110,6 +111,7 @@ class CHandler Z7_final:
  #endif
  #ifndef Z7_EXTRACT_ONLY
   Z7_COM_QI_ENTRY(IOutArchive)
+  Z7_COM_QI_ENTRY(IOutArchiveAppend)
  #endif
   Z7_COM_QI_ENTRY_ISetCompressCodecsInfo_IFEC
   Z7_COM_QI_END
@@ -122,6 +124,7 @@ class CHandler Z7_final:
  #endif
  #ifndef Z7_EXTRACT_ONLY
   Z7_IFACE_COM7_IMP(IOutArchive)
+  Z7_IFACE_COM7_IMP(IOutArchiveAppend)
  #endif
   DECL_ISetCompressCodecsInfo
 
@@ -146,6 +149,7 @@ private:
   #else
   
   CRecordVector<CBond2> _bonds;
+  bool _appendMode;
 
   HRESULT PropsMethod_To_FullMethod(CMethodFull &dest, const COneMethodInfo &m);
   HRESULT SetHeaderMethod(CCompressionMethodMode &headerMethod);
@@ -6,6 +6,8 @@
 #include "../../../Common/StringToInt.h"
 #include "../../../Common/Wildcard.h"
 
+#include "../../Common/StreamUtils.h"
+
 #include "../Common/ItemNameUtils.h"
 #include "../Common/ParseProperties.h"
 
@@ -147,7 +149,8 @@ HRESULT CHandler::SetMainMethod(CCompressionMethodMode &methodMode)
     {
       case k_LZMA:
       case k_LZMA2: dicSize = oneMethodInfo.Get_Lzma_DicSize(); break;
-      case k_PPMD: dicSize = oneMethodInfo.Get_Ppmd_MemSize(); break;
+      case k_PPMD:
+      case k_PPMD2: dicSize = oneMethodInfo.Get_Ppmd_MemSize(); break;
       case k_Deflate: dicSize = (UInt32)1 << 15; break;
       case k_Deflate64: dicSize = (UInt32)1 << 16; break;
       case k_BZip2: dicSize = oneMethodInfo.Get_BZip2_BlockSize(); break;
@@ -274,6 +277,34 @@ HRESULT CHandler::SetMainMethod(CCompressionMethodMode &methodMode)
       numSolidBytes = (UInt64)dicSize << 7;
       if (numSolidBytes > kSolidBytes_Max)
         numSolidBytes = kSolidBytes_Max;
+
+      #ifndef Z7_ST
+      if (methodFull.Id == k_PPMD2
+          && !numThreads_WasSpecifiedInMethod
+          && !methodMode.NumThreads_WasForced
+          && methodMode.MemoryUsageLimit_WasSet
+          )
+      {
+        // each PPMD2 block thread uses model, input block and output buffer.
+        // default block size is calculated as in PPMD2 encoder code
+        UInt64 bs = oneMethodInfo.GetProp_BlockSize(NCoderPropID::kBlockSize);
+        if (bs == 0)
+        {
+          bs = dicSize << 2;
+          const UInt32 kMinSize = (UInt32)1 << 20;
+          const UInt32 kMaxSize = (UInt32)1 << 28;
+          if (bs < kMinSize) bs = kMinSize;
+          if (bs > kMaxSize) bs = kMaxSize;
+        }
+        const UInt32 numThreads_Original = methodMode.NumThreads;
+        UInt32 numThreads = numThreads_Original;
+        for (; numThreads > 1; numThreads--)
+          if (numThreads * (dicSize + 2 * bs) <= methodMode.MemoryUsageLimit)
+            break;
+        if (numThreads != numThreads_Original)
+          CMultiMethodProps::SetMethodThreadsTo_Replace(methodFull, numThreads);
+      }
+      #endif
     }
 
     if (_numSolidBytesDefined)
@@ -800,6 +831,9 @@ Z7_COM7F_IMF(CHandler::UpdateItems(ISequentialOutStream *outStream, UInt32 numIt
 
   options.MultiThreadMixer = _useMultiThreadMixer;
 
+  options.AppendMode = _appendMode;
+  _appendMode = false;
+
   /*
   if (secureBlocks.Sorted.Size() > 1)
   {
@@ -812,7 +846,17 @@ Z7_COM7F_IMF(CHandler::UpdateItems(ISequentialOutStream *outStream, UInt32 numIt
   }
   */
 
-  return Update(
+  #ifndef Z7_7Z_VOL
+  CAppendRollback rollback;
+  if (options.AppendMode)
+  {
+    RINOK(rollback.Save(_inStream, *db, outStream))
+  }
+  const HRESULT updateRes =
+  #else
+  return
+  #endif
+  Update(
       EXTERNAL_CODECS_VARS
       #ifdef Z7_7Z_VOL
       volume ? volume->Stream: 0,
@@ -826,9 +870,40 @@ Z7_COM7F_IMF(CHandler::UpdateItems(ISequentialOutStream *outStream, UInt32 numIt
       // secureBlocks,
       outStream, updateCallback, options);
 
+  #ifndef Z7_7Z_VOL
+  if (updateRes != S_OK && options.AppendMode)
+  {
+    // it includes E_ABORT from Ctrl+C in console
+    rollback.Restore();
+  }
+  return updateRes;
+  #endif
+
   COM_TRY_END
 }
 
+Z7_COM7F_IMF(CHandler::SetAppendMode(Int32 appendMode))
+{
+  _appendMode = false;
+  if (appendMode == 0)
+    return S_OK;
+  #ifdef Z7_7Z_VOL
+  return E_NOTIMPL;
+  #else
+  if (!_inStream || !_db.CanUpdate() || _removeSfxBlock)
+    return E_NOTIMPL;
+  {
+    UInt64 fileSize;
+    RINOK(InStream_GetSize_SeekToEnd(_inStream, fileSize))
+    const UInt64 arcEndPos = GetAppendArcEndPos(_db);
+    if (fileSize < arcEndPos || arcEndPos < GetAppendDataEndPos(_db))
+      return E_NOTIMPL;
+  }
+  _appendMode = true;
+  return S_OK;
+  #endif
+}
+
 static HRESULT ParseBond(UString &srcString, UInt32 &coder, UInt32 &stream)
 {
   stream = 0;
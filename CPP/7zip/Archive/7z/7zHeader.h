@@ -124,6 +124,9 @@ const UInt32 k_SPARC = 0x3030805;
 
 const UInt32 k_AES   = 0x6F10701;
 
+// developer IDs (3F ZZ ZZ ZZ ZZ ZZ MM MM), see DOC/Methods.txt
+const UInt64 k_PPMD2 = 0x3FFD010644E40002;
+
 // const UInt32 k_ZSTD = 0x4015D; // winzip zstd
 // 0x4F71101, 7z-zstd
 
@@ -1310,23 +1310,41 @@ HRESULT CInArchive::ReadHeader(
         CStreamSwitch streamSwitch;
         streamSwitch.Set(this, &dataVector);
         const size_t rem = _inByteBack->GetRem();
-        db.NamesBuf.Alloc(rem);
-        ReadBytes(db.NamesBuf, rem);
+        if ((UInt64)rem >= ((UInt64)1 << 33))
+          ThrowUnsupported();
+        const Byte *names = _inByteBack->GetPtr();
+        if (names > db.HeaderBuf.ConstData() &&
+            names + rem <= db.HeaderBuf.ConstData() + db.HeaderBuf.Size())
+        {
+          /* names are in unpacked header. We use them without copying.
+             The byte before names (External flag) was read already,
+             so we can move names to that position to get aligned data. */
+          Byte *dest = db.HeaderBuf.NonConstData() + (names - db.HeaderBuf.ConstData());
+          if (((size_t)(names - db.HeaderBuf.ConstData()) & 1) != 0)
+            memmove(--dest, names, rem);
+          db.NamesBuf = dest;
+        }
+        else
+        {
+          db.NamesBuf_Copy.CopyFrom(names, rem);
+          db.NamesBuf = db.NamesBuf_Copy;
+        }
+        _inByteBack->SkipDataNoCheck(rem);
         db.NameOffsets.Alloc(numFiles + 1);
         size_t pos = 0;
         unsigned i;
         for (i = 0; i < numFiles; i++)
         {
           const size_t curRem = (rem - pos) / 2;
-          const UInt16 *buf = (const UInt16 *)(const void *)(db.NamesBuf.ConstData() + pos);
+          const Byte *buf = db.NamesBuf + pos;
           size_t j;
-          for (j = 0; j < curRem && buf[j] != 0; j++);
+          for (j = 0; j < curRem && GetUi16a(buf + j * 2) != 0; j++);
           if (j == curRem)
             ThrowEndOfData();
-          db.NameOffsets[i] = pos / 2;
+          db.NameOffsets[i] = (UInt32)(pos / 2);
           pos += j * 2 + 2;
         }
-        db.NameOffsets[i] = pos / 2;
+        db.NameOffsets[i] = (UInt32)(pos / 2);
         if (pos != rem)
           ThereIsHeaderError = true;
         break;
@@ -1681,7 +1699,9 @@ HRESULT CInArchive::ReadDatabase2(
   const size_t nextHeaderSize_t = (size_t)nextHeaderSize;
   if (nextHeaderSize_t != nextHeaderSize)
     return E_OUTOFMEMORY;
-  CByteBuffer buffer2(nextHeaderSize_t);
+  // unpacked header is stored in (db.HeaderBuf), because names are not copied from header
+  CByteBuffer &buffer2 = db.HeaderBuf;
+  buffer2.Alloc(nextHeaderSize_t);
 
   RINOK(ReadStream_FALSE(_stream, buffer2, nextHeaderSize_t))
 
@@ -1714,7 +1734,9 @@ HRESULT CInArchive::ReadDatabase2(
     if (dataVector.Size() > 1)
       ThrowIncorrect();
     streamSwitch.Remove();
-    streamSwitch.Set(this, dataVector.Front());
+    db.HeaderBuf.Swap(dataVector.Front());
+    dataVector.Clear();
+    streamSwitch.Set(this, db.HeaderBuf);
     if (ReadID() != NID::kHeader)
       ThrowIncorrect();
   }
@@ -1723,11 +1745,14 @@ HRESULT CInArchive::ReadDatabase2(
 
   db.HeadersSize = HeadersSize;
 
-  return ReadHeader(
+  const HRESULT res = ReadHeader(
     EXTERNAL_CODECS_LOC_VARS
     db
     Z7_7Z_DECODER_CRYPRO_VARS
     );
+  if (!db.NamesBuf || db.NamesBuf == db.NamesBuf_Copy.ConstData())
+    db.HeaderBuf.Free();
+  return res;
 }
 
 
@@ -123,8 +123,15 @@ struct CDatabase: public CFolders
   CRecordVector<UInt32> SecureIDs;
   */
 
-  CByteBuffer NamesBuf;
-  CObjArray<size_t> NameOffsets; // numFiles + 1, offsets of utf-16 symbols
+  /* Names are not copied from unpacked header:
+     (NamesBuf) points to names in (HeaderBuf) or in (NamesBuf_Copy).
+     (NamesBuf) is aligned for 2 bytes. */
+  CByteBuffer HeaderBuf;
+  CByteBuffer NamesBuf_Copy;
+  const Byte *NamesBuf;
+  CObjArray<UInt32> NameOffsets; // numFiles + 1, offsets of utf-16 symbols
+
+  CDatabase(): NamesBuf(NULL) {}
 
   /*
   void ClearSecure()
@@ -139,7 +146,9 @@ struct CDatabase: public CFolders
     CFolders::Clear();
     // ClearSecure();
 
-    NamesBuf.Free();
+    NamesBuf = NULL;
+    NamesBuf_Copy.Free();
+    HeaderBuf.Free();
     NameOffsets.Free();
     
     Files.Clear();
@@ -102,6 +102,7 @@ HRESULT COutArchive::Create_and_WriteStartPrefix(ISequentialOutStream *stream /*
   _endMarker = endMarker;
   #endif
   SeqStream = stream;
+  _appendMode = false;
   // if (!endMarker)
   {
     SeqStream.QueryInterface(IID_IOutStream, &Stream);
@@ -131,6 +132,26 @@ HRESULT COutArchive::Create_and_WriteStartPrefix(ISequentialOutStream *stream /*
   #endif
 }
 
+static HRESULT FlushStream(IOutStream *stream)
+{
+  Z7_DECL_CMyComPtr_QI_FROM(IOutStreamFlush, flush, stream)
+  if (!flush)
+    return S_OK;
+  return flush->Flush();
+}
+
+HRESULT COutArchive::Create_for_Append(ISequentialOutStream *stream, UInt64 signatureHeaderPos, UInt64 arcEndPos)
+{
+  Close();
+  SeqStream = stream;
+  SeqStream.QueryInterface(IID_IOutStream, &Stream);
+  if (!Stream)
+    return E_NOTIMPL;
+  _appendMode = true;
+  _signatureHeaderPos = signatureHeaderPos;
+  return Stream->Seek((Int64)arcEndPos, STREAM_SEEK_SET, NULL);
+}
+
 void COutArchive::Close()
 {
   SeqStream.Release();
@@ -979,6 +1000,19 @@ HRESULT COutArchive::WriteDatabase(
   #endif
   if (Stream)
   {
+    if (_appendMode)
+    {
+      // file can contain the data of interrupted append after old archive
+      UInt64 endPos = 0;
+      RINOK(Stream->Seek(0, STREAM_SEEK_CUR, &endPos))
+      RINOK(Stream->SetSize(endPos))
+      /* new data and new header must be on disk before start header points to them.
+         Otherwise a crash could leave new start header with old bytes at new header position. */
+      RINOK(FlushStream(Stream))
+      RINOK(Stream->Seek((Int64)_signatureHeaderPos, STREAM_SEEK_SET, NULL))
+      RINOK(WriteStartHeader(sh))
+      return FlushStream(Stream);
+    }
     RINOK(Stream->Seek((Int64)_signatureHeaderPos, STREAM_SEEK_SET, NULL))
     return WriteStartHeader(sh);
   }
@@ -315,6 +315,7 @@ class COutArchive
   CWriteBufferLoc _outByte2;
   COutBuffer _outByte;
   UInt64 _signatureHeaderPos;
+  bool _appendMode;
   CMyComPtr<IOutStream> Stream;
 
   #ifdef Z7_7Z_VOL
@@ -328,6 +329,10 @@ public:
 
   // COutArchive();
   HRESULT Create_and_WriteStartPrefix(ISequentialOutStream *stream /* , bool endMarker */);
+  /* it's for existing archive in (stream) that is open for writing.
+     New data will be written from (arcEndPos) position after old header,
+     and start header at (signatureHeaderPos) will be rewritten at the end. */
+  HRESULT Create_for_Append(ISequentialOutStream *stream, UInt64 signatureHeaderPos, UInt64 arcEndPos);
   void Close();
   HRESULT WriteDatabase(
       DECL_EXTERNAL_CODECS_LOC_VARS
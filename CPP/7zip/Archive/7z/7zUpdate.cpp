@@ -11,6 +11,7 @@
 #include "../../Common/CreateCoder.h"
 #include "../../Common/LimitedStreams.h"
 #include "../../Common/ProgressUtils.h"
+#include "../../Common/StreamUtils.h"
 
 #include "../../Compress/CopyCoder.h"
 
@@ -585,6 +586,41 @@ static unsigned Get_FilterGroup_for_Folder(
 static HRESULT WriteRange(IInStream *inStream, ISequentialOutStream *outStream,
     UInt64 position, UInt64 size, ICompressProgressInfo *progress)
 {
+  {
+    // unchanged packed streams can be copied by file system without reading to user space
+    Z7_DECL_CMyComPtr_QI_FROM(IOutStreamCopyFrom, copyFrom, outStream)
+    if (copyFrom)
+    {
+      const UInt64 kStepSize = (UInt64)1 << 26;
+      UInt64 done = 0;
+      while (done != size)
+      {
+        UInt64 cur = size - done;
+        if (cur > kStepSize)
+          cur = kStepSize;
+        UInt64 processed = 0;
+        const HRESULT res = copyFrom->CopyFrom(inStream, position + done, cur, &processed);
+        done += processed;
+        if (res != S_OK)
+        {
+          if (res != S_FALSE)
+            return res;
+          break;
+        }
+        if (processed != cur)
+          break;
+        if (progress)
+        {
+          RINOK(progress->SetRatioInfo(&done, &done))
+        }
+      }
+      if (done == size)
+        return S_OK;
+      // we copy the remaining data in user space
+      position += done;
+      size -= done;
+    }
+  }
   RINOK(InStream_SeekSet(inStream, position))
   CMyComPtr2_Create<ISequentialInStream, CLimitedSequentialInStream> streamSpec;
   streamSpec->SetStream(inStream);
@@ -1889,6 +1925,78 @@ static void GetFile(const CDatabase &inDb, unsigned index, CFileItem &file, CFil
   // file2.IsAux = inDb.IsItemAux(index);
 }
 
+// it adds the description of old folder that is copied without changes
+static void AddOldFolder(const CDbEx &db, unsigned folderIndex, CArchiveDatabaseOut &newDatabase)
+{
+  const unsigned folderIndex_New = newDatabase.Folders.Size();
+  CFolder &folder = newDatabase.Folders.AddNew();
+  // v23.01: we copy FolderCrc, if FolderCrc was used
+  if (db.FolderCRCs.ValidAndDefined(folderIndex))
+    newDatabase.FolderUnpackCRCs.SetItem(folderIndex_New,
+        true, db.FolderCRCs.Vals[folderIndex]);
+
+  db.ParseFolderInfo(folderIndex, folder);
+  const CNum startIndex = db.FoStartPackStreamIndex[folderIndex];
+  FOR_VECTOR (j, folder.PackStreams)
+  {
+    newDatabase.PackSizes.Add(db.GetStreamPackSize(startIndex + j));
+    // newDatabase.PackCRCsDefined.Add(db.PackCRCsDefined[startIndex + j]);
+    // newDatabase.PackCRCs.Add(db.PackCRCs[startIndex + j]);
+  }
+
+  size_t indexStart = db.FoToCoderUnpackSizes[folderIndex];
+  const size_t indexEnd = db.FoToCoderUnpackSizes[folderIndex + 1];
+  for (; indexStart < indexEnd; indexStart++)
+    newDatabase.CoderUnpackSizes.Add(db.CoderUnpackSizes.ConstData()[indexStart]);
+}
+
+// it adds old files of folder that were not replaced by new data
+static void AddOldFolderFiles(const CDbEx &db, unsigned folderIndex,
+    const CIntArr &fileIndexToUpdateIndexMap,
+    const CObjectVector<CUpdateItem> &updateItems,
+    CArchiveDatabaseOut &newDatabase)
+{
+  const CNum numUnpackStreams = db.NumUnpackStreamsVector[folderIndex];
+  CNum indexInFolder = 0;
+  for (CNum fi = db.FolderStartFileIndex[folderIndex]; indexInFolder < numUnpackStreams; fi++)
+  {
+    if (db.Files[fi].HasStream)
+    {
+      indexInFolder++;
+      const int updateIndex = fileIndexToUpdateIndexMap[fi];
+      if (updateIndex >= 0)
+      {
+        const CUpdateItem &ui = updateItems[(unsigned)updateIndex];
+        if (ui.NewData)
+          continue;
+
+        UString name;
+        CFileItem file;
+        CFileItem2 file2;
+        GetFile(db, fi, file, file2);
+
+        if (ui.NewProps)
+        {
+          UpdateItem_To_FileItem2(ui, file2);
+          file.IsDir = ui.IsDir;
+          name = ui.Name;
+        }
+        else
+          db.GetPath(fi, name);
+
+        /*
+        file.Parent = ui.ParentFolderIndex;
+        if (ui.TreeFolderIndex >= 0)
+          treeFolderToArcIndex[ui.TreeFolderIndex] = newDatabase.Files.Size();
+        if (totalSecureDataSize != 0)
+          newDatabase.SecureIDs.Add(ui.SecureIndex);
+        */
+        newDatabase.AddFile(file, file2, name);
+      }
+    }
+  }
+}
+
 HRESULT Update(
     DECL_EXTERNAL_CODECS_LOC_VARS
     IInStream *inStream,
@@ -1920,7 +2028,16 @@ HRESULT Update(
 
   // size_t totalSecureDataSize = (size_t)secureBlocks.GetTotalSizeInBytes();
 
+  if (options.AppendMode)
+  {
+    /* old packed streams must be contiguous after start header,
+       because new data and new header will be written after them */
+    if (!db || db->ArcInfo.DataStartPosition != db->ArcInfo.StartPositionAfterHeader)
+      return E_NOTIMPL;
+  }
+
   CMyComPtr<IStreamSetRestriction> v_StreamSetRestriction;
+  if (!options.AppendMode)
   {
     Z7_DECL_CMyComPtr_QI_FROM(
         IOutStream,
@@ -2018,6 +2135,14 @@ HRESULT Update(
         }
       }
 
+      if (options.AppendMode)
+      {
+        // all old folders are kept in place without changes
+        if (numCopyItems != numUnpackStreams)
+          return E_NOTIMPL;
+        continue;
+      }
+
       if (numCopyItems == 0)
         continue;
 
@@ -2212,7 +2337,14 @@ HRESULT Update(
   COutArchive archive;
   CArchiveDatabaseOut newDatabase;
 
-  RINOK(archive.Create_and_WriteStartPrefix(seqOutStream))
+  if (options.AppendMode)
+  {
+    RINOK(archive.Create_for_Append(seqOutStream, db->ArcInfo.StartPosition, GetAppendArcEndPos(*db)))
+  }
+  else
+  {
+    RINOK(archive.Create_and_WriteStartPrefix(seqOutStream))
+  }
 
   /*
   CIntVector treeFolderToArcIndex;
@@ -2311,6 +2443,41 @@ HRESULT Update(
     }
   }
 
+  if (options.AppendMode)
+  {
+    // ---------- Keep old solid blocks in place ----------
+    for (unsigned folderIndex = 0; folderIndex < db->NumFolders; folderIndex++)
+    {
+      AddOldFolder(*db, folderIndex, newDatabase);
+      newDatabase.NumUnpackStreamsVector.Add(db->NumUnpackStreamsVector[folderIndex]);
+      AddOldFolderFiles(*db, folderIndex, fileIndexToUpdateIndexMap, updateItems, newDatabase);
+    }
+    {
+      /* new data is written after old archive, and the old header must be kept
+         until the new start header is written. So we describe the old header
+         as packed stream of empty folder (Copy method, no files).
+         Such folders are removed by normal update. */
+      const UInt64 dataEndPos = GetAppendDataEndPos(*db);
+      const UInt64 arcEndPos = GetAppendArcEndPos(*db);
+      if (arcEndPos < dataEndPos)
+        return E_FAIL;
+      if (arcEndPos != dataEndPos)
+      {
+        const UInt64 size = arcEndPos - dataEndPos;
+        CFolder &folder = newDatabase.Folders.AddNew();
+        folder.Coders.SetSize(1);
+        CCoderInfo &coder = folder.Coders[0];
+        coder.MethodID = k_Copy;
+        coder.NumStreams = 1;
+        folder.PackStreams.SetSize(1);
+        folder.PackStreams[0] = 0;
+        newDatabase.PackSizes.Add(size);
+        newDatabase.CoderUnpackSizes.Add(size);
+        newDatabase.NumUnpackStreamsVector.Add(0);
+      }
+    }
+  }
+
   lps->ProgressOffset = 0;
 
   {
@@ -2400,26 +2567,7 @@ HRESULT Update(
             db->GetFolderStreamPos(folderIndex, 0), packSize, lps))
         lps->ProgressOffset += packSize;
 
-        const unsigned folderIndex_New = newDatabase.Folders.Size();
-        CFolder &folder = newDatabase.Folders.AddNew();
-        // v23.01: we copy FolderCrc, if FolderCrc was used
-        if (db->FolderCRCs.ValidAndDefined(folderIndex))
-          newDatabase.FolderUnpackCRCs.SetItem(folderIndex_New,
-              true, db->FolderCRCs.Vals[folderIndex]);
-
-        db->ParseFolderInfo(folderIndex, folder);
-        const CNum startIndex = db->FoStartPackStreamIndex[folderIndex];
-        FOR_VECTOR (j, folder.PackStreams)
-        {
-          newDatabase.PackSizes.Add(db->GetStreamPackSize(startIndex + j));
-          // newDatabase.PackCRCsDefined.Add(db.PackCRCsDefined[startIndex + j]);
-          // newDatabase.PackCRCs.Add(db.PackCRCs[startIndex + j]);
-        }
-
-        size_t indexStart = db->FoToCoderUnpackSizes[folderIndex];
-        const size_t indexEnd = db->FoToCoderUnpackSizes[folderIndex + 1];
-        for (; indexStart < indexEnd; indexStart++)
-          newDatabase.CoderUnpackSizes.Add(db->CoderUnpackSizes.ConstData()[indexStart]);
+        AddOldFolder(*db, folderIndex, newDatabase);
       }
       else
       {
@@ -2655,45 +2803,7 @@ HRESULT Update(
       }
       
       newDatabase.NumUnpackStreamsVector.Add(rep.NumCopyFiles);
-      
-      CNum indexInFolder = 0;
-      for (CNum fi = db->FolderStartFileIndex[folderIndex]; indexInFolder < numUnpackStreams; fi++)
-      {
-        if (db->Files[fi].HasStream)
-        {
-          indexInFolder++;
-          const int updateIndex = fileIndexToUpdateIndexMap[fi];
-          if (updateIndex >= 0)
-          {
-            const CUpdateItem &ui = updateItems[(unsigned)updateIndex];
-            if (ui.NewData)
-              continue;
-
-            UString name;
-            CFileItem file;
-            CFileItem2 file2;
-            GetFile(*db, fi, file, file2);
-
-            if (ui.NewProps)
-            {
-              UpdateItem_To_FileItem2(ui, file2);
-              file.IsDir = ui.IsDir;
-              name = ui.Name;
-            }
-            else
-              db->GetPath(fi, name);
-
-            /*
-            file.Parent = ui.ParentFolderIndex;
-            if (ui.TreeFolderIndex >= 0)
-              treeFolderToArcIndex[ui.TreeFolderIndex] = newDatabase.Files.Size();
-            if (totalSecureDataSize != 0)
-              newDatabase.SecureIDs.Add(ui.SecureIndex);
-            */
-            newDatabase.AddFile(file, file2, name);
-          }
-        }
-      }
+      AddOldFolderFiles(*db, folderIndex, fileIndexToUpdateIndexMap, updateItems, newDatabase);
     }
 
 
@@ -3085,4 +3195,39 @@ HRESULT Update(
   return S_OK;
 }
 
+
+UInt64 GetAppendDataEndPos(const CDbEx &db)
+{
+  UInt64 pos = db.ArcInfo.DataStartPosition;
+  if (db.NumFolders != 0)
+    pos += db.PackPositions[db.FoStartPackStreamIndex[db.NumFolders]];
+  return pos;
+}
+
+HRESULT CAppendRollback::Save(IInStream *inStream, const CDbEx &db, ISequentialOutStream *outStream)
+{
+  _stream.Release();
+  Z7_DECL_CMyComPtr_QI_FROM(IOutStream, stream, outStream)
+  if (!stream)
+    return E_NOTIMPL;
+  _startPos = db.ArcInfo.StartPosition;
+  RINOK(InStream_GetSize_SeekToEnd(inStream, _fileSize))
+  if (_fileSize < GetAppendArcEndPos(db))
+    return E_NOTIMPL;
+  RINOK(InStream_SeekSet(inStream, _startPos))
+  RINOK(ReadStream_FALSE(inStream, _startHeader, sizeof(_startHeader)))
+  _stream = stream;
+  return S_OK;
+}
+
+HRESULT CAppendRollback::Restore()
+{
+  if (!_stream)
+    return S_OK;
+  // the start header can be rewritten already, if the error was at the end
+  RINOK(_stream->Seek((Int64)_startPos, STREAM_SEEK_SET, NULL))
+  RINOK(WriteStream(_stream, _startHeader, sizeof(_startHeader)))
+  return _stream->SetSize(_fileSize);
+}
+
 }}
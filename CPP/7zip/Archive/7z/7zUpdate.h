@@ -102,6 +102,7 @@ struct CUpdateOptions
   
   bool RemoveSfxBlock;
   bool MultiThreadMixer;
+  bool AppendMode; // outStream is open archive file: old folders are kept in place
 
   bool Need_CTime;
   bool Need_ATime;
@@ -142,6 +143,7 @@ struct CUpdateOptions
       UseTypeSorting(true),
       RemoveSfxBlock(false),
       MultiThreadMixer(true),
+      AppendMode(false),
       Need_CTime(false),
       Need_ATime(false),
       Need_MTime(false),
@@ -162,6 +164,30 @@ HRESULT Update(
     ISequentialOutStream *seqOutStream,
     IArchiveUpdateCallback *updateCallback,
     const CUpdateOptions &options);
+
+/*
+  In append mode new data and new header are written after the end of old archive,
+  and the old header is kept as data of empty folder (without files).
+  So the start header is the only place of old archive that is changed,
+  and the archive is valid after a crash at any point.
+  CAppendRollback saves the start header and the size of archive.
+  Restore() writes them back, so failed or aborted append leaves the old archive.
+*/
+
+UInt64 GetAppendDataEndPos(const CDbEx &db);
+inline UInt64 GetAppendArcEndPos(const CDbEx &db) { return db.ArcInfo.StartPosition + db.PhySize; }
+
+class CAppendRollback
+{
+  CMyComPtr<IOutStream> _stream;
+  UInt64 _startPos;
+  UInt64 _fileSize;
+  Byte _startHeader[32];
+public:
+  HRESULT Save(IInStream *inStream, const CDbEx &db, ISequentialOutStream *outStream);
+  HRESULT Restore();
+};
+
 }}
 
 #endif
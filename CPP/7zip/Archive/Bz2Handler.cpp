@@ -4,6 +4,7 @@
 
 #include "../../Common/ComTry.h"
 
+#include "../Common/LimitedStreams.h"
 #include "../Common/ProgressUtils.h"
 #include "../Common/RegisterArc.h"
 #include "../Common/StreamUtils.h"
@@ -14,14 +15,34 @@
 
 #include "Common/DummyOutStream.h"
 #include "Common/HandlerOut.h"
+#include "Common/SeekIndex.h"
 
 using namespace NWindows;
 
 namespace NArchive {
 namespace NBz2 {
 
-Z7_CLASS_IMP_CHandler_IInArchive_3(
+/*
+  Seek points index for IInArchiveGetStream:
+  bzip2 blocks are independent, so the point is created at the start of each block
+  (block signature). The point stores the bit position of block signature and
+  the state of bzip2 stream before that block.
+  The index is built by stream reading (and Seek(STREAM_SEEK_END) reads whole stream),
+  so next reads from any position require the decoding of one block only.
+*/
+
+struct CSeekPoint
+{
+  UInt64 PackBitPos;
+  UInt64 UnpackPos;
+  UInt32 BlockSizeMax; // (BlockSizeMax == 0) means the start of bzip2 stream
+  UInt32 CombinedCrc;
+};
+
+Z7_CLASS_IMP_CHandler_IInArchive_5(
   IArchiveOpenSeq,
+  IInArchiveGetStream,
+  IInArchiveSeekIndex,
   IOutArchive,
   ISetProperties
 )
@@ -44,6 +65,18 @@ Z7_CLASS_IMP_CHandler_IInArchive_3(
   UInt64 _numBlocks;
 
   CSingleMethodProps _props;
+
+  HRESULT ReadSeekIndex2(ISequentialInStream *stream);
+public:
+  CRecordVector<CSeekPoint> SeekPoints;
+  bool SeekUnpackSize_Defined;
+  UInt64 SeekUnpackSize;
+  UInt64 PhySize;
+
+  IInStream *GetInStream() const { return _stream; }
+  bool NeedSeekPoint(UInt64 unpackPos) const { return unpackPos > SeekPoints.Back().UnpackPos; }
+  unsigned FindSeekPoint(UInt64 unpackPos) const;
+  void InitSeekPoints();
 };
 
 static const Byte kProps[] =
@@ -135,7 +168,7 @@ Z7_COM7F_IMF(CHandler::Open(IInStream *stream, const UInt64 *, IArchiveOpenCallb
     _seqStream = stream;
     _needSeekToStart = true;
   }
-  return S_OK;
+  return InStream_GetSize_SeekToEnd(stream, PhySize);
   COM_TRY_END
 }
 
@@ -162,12 +195,372 @@ Z7_COM7F_IMF(CHandler::Close())
 
   _packSize = 0;
 
+  SeekPoints.Clear();
+  SeekUnpackSize_Defined = false;
+  SeekUnpackSize = 0;
+  PhySize = 0;
+
   _seqStream.Release();
   _stream.Release();
   return S_OK;
 }
 
 
+unsigned CHandler::FindSeekPoint(UInt64 unpackPos) const
+{
+  unsigned left = 0, right = SeekPoints.Size();
+  for (;;)
+  {
+    const unsigned mid = (left + right) / 2;
+    if (mid == left)
+      return left;
+    if (unpackPos < SeekPoints[mid].UnpackPos)
+      right = mid;
+    else
+      left = mid;
+  }
+}
+
+
+Z7_CLASS_IMP_IInStream(
+  CInStream
+)
+  UInt64 _virtPos;
+  UInt64 _unpackPos;
+  UInt64 _startBitPos;
+  bool _isReady;
+  bool _wasFinished;
+  
+  CMyComPtr2<ISequentialInStream, CLimitedInStream> _limitedStream;
+  CMyComPtr2<ISequentialInStream, NCompress::NBZip2::CDecoder> _decoder;
+  CByteBuffer _skipBuf;
+
+  HRESULT Restart(const CSeekPoint &sp);
+  HRESULT Decode(Byte *data, UInt32 size, UInt32 &processedSize);
+  HRESULT SkipTo(UInt64 pos);
+public:
+  CMyComPtr2<IInArchive, CHandler> _handlerSpec;
+  IArchiveOpenCallback *Progress;
+
+  void Init()
+  {
+    _virtPos = 0;
+    _isReady = false;
+    Progress = NULL;
+  }
+  HRESULT ReadToEnd();
+};
+
+
+HRESULT CInStream::Restart(const CSeekPoint &sp)
+{
+  _isReady = false;
+  _wasFinished = false;
+  const UInt64 bytePos = sp.PackBitPos >> 3;
+  const UInt64 phySize = _handlerSpec->PhySize;
+  if (bytePos > phySize)
+    return E_FAIL;
+  _limitedStream.Create_if_Empty();
+  _limitedStream->SetStream(_handlerSpec->GetInStream());
+  RINOK(_limitedStream->InitAndSeek(bytePos, phySize - bytePos))
+  _decoder.Create_if_Empty();
+  _decoder->Base.DecodeAllStreams = true;
+  _decoder->StopAtBlockStart = true;
+  RINOK(_decoder->InitBlockResume(_limitedStream, (unsigned)sp.PackBitPos & 7,
+      sp.BlockSizeMax, sp.CombinedCrc))
+  _startBitPos = bytePos << 3;
+  _unpackPos = sp.UnpackPos;
+  _isReady = true;
+  return S_OK;
+}
+
+
+HRESULT CInStream::Decode(Byte *data, UInt32 size, UInt32 &processedSize)
+{
+  processedSize = 0;
+  while (size != 0 && !_wasFinished)
+  {
+    if (_decoder->IsAtBlockStart() && _handlerSpec->NeedSeekPoint(_unpackPos))
+    {
+      CSeekPoint sp;
+      sp.PackBitPos = _startBitPos + _decoder->GetInputProcessedBits();
+      sp.UnpackPos = _unpackPos;
+      sp.BlockSizeMax = _decoder->Base.blockSizeMax;
+      sp.CombinedCrc = _decoder->Base.CombinedCrc.GetDigest();
+      _handlerSpec->SeekPoints.Add(sp);
+    }
+    UInt32 cur = 0;
+    const HRESULT res = _decoder.Interface()->Read(data, size, &cur);
+    if (res != S_OK)
+    {
+      _isReady = false;
+      return res;
+    }
+    if (cur == 0)
+    {
+      // it's the end of the last bzip2 stream.
+      if (!_handlerSpec->SeekUnpackSize_Defined)
+      {
+        _handlerSpec->SeekUnpackSize = _unpackPos;
+        _handlerSpec->SeekUnpackSize_Defined = true;
+      }
+      _wasFinished = true;
+      break;
+    }
+    _unpackPos += cur;
+    data += cur;
+    size -= cur;
+    processedSize += cur;
+  }
+  return S_OK;
+}
+
+
+HRESULT CInStream::SkipTo(UInt64 pos)
+{
+  const UInt32 kSkipBufSize = 1 << 16;
+  while (_unpackPos < pos && !_wasFinished)
+  {
+    if (_skipBuf.Size() == 0)
+      _skipBuf.Alloc(kSkipBufSize);
+    UInt32 cur = kSkipBufSize;
+    const UInt64 rem = pos - _unpackPos;
+    if (cur > rem)
+      cur = (UInt32)rem;
+    RINOK(Decode(_skipBuf, cur, cur))
+    if (cur == 0)
+      break;
+    if (Progress)
+    {
+      const UInt64 packSize = (_startBitPos + _decoder->GetInputProcessedBits()) >> 3;
+      RINOK(Progress->SetCompleted(NULL, &packSize))
+    }
+  }
+  return S_OK;
+}
+
+
+HRESULT CInStream::ReadToEnd()
+{
+  if (_handlerSpec->SeekUnpackSize_Defined)
+    return S_OK;
+  // we read the stream to the end. It also creates the seek points.
+  const CSeekPoint &sp = _handlerSpec->SeekPoints.Back();
+  if (!_isReady || sp.UnpackPos > _unpackPos)
+  {
+    RINOK(Restart(sp))
+  }
+  RINOK(SkipTo((UInt64)(Int64)-1))
+  if (!_handlerSpec->SeekUnpackSize_Defined)
+    return E_FAIL;
+  return S_OK;
+}
+
+
+Z7_COM7F_IMF(CInStream::Read(void *data, UInt32 size, UInt32 *processedSize))
+{
+  COM_TRY_BEGIN
+
+  if (processedSize)
+    *processedSize = 0;
+  if (_handlerSpec->SeekUnpackSize_Defined)
+  {
+    if (_virtPos >= _handlerSpec->SeekUnpackSize)
+      return S_OK;
+    const UInt64 rem = _handlerSpec->SeekUnpackSize - _virtPos;
+    if (size > rem)
+      size = (UInt32)rem;
+  }
+  if (size == 0)
+    return S_OK;
+
+  {
+    const CSeekPoint &sp = _handlerSpec->SeekPoints[_handlerSpec->FindSeekPoint(_virtPos)];
+    if (!_isReady || _virtPos < _unpackPos || sp.UnpackPos > _unpackPos)
+    {
+      RINOK(Restart(sp))
+    }
+  }
+  RINOK(SkipTo(_virtPos))
+  if (_unpackPos != _virtPos)
+    return S_OK;
+
+  UInt32 cur;
+  const HRESULT res = Decode((Byte *)data, size, cur);
+  _virtPos += cur;
+  if (processedSize)
+    *processedSize = cur;
+  return res;
+
+  COM_TRY_END
+}
+
+
+Z7_COM7F_IMF(CInStream::Seek(Int64 offset, UInt32 seekOrigin, UInt64 *newPosition))
+{
+  COM_TRY_BEGIN
+
+  switch (seekOrigin)
+  {
+    case STREAM_SEEK_SET: break;
+    case STREAM_SEEK_CUR: offset += _virtPos; break;
+    case STREAM_SEEK_END:
+    {
+      RINOK(ReadToEnd())
+      offset += _handlerSpec->SeekUnpackSize;
+      break;
+    }
+    default: return STG_E_INVALIDFUNCTION;
+  }
+  if (offset < 0)
+    return HRESULT_WIN32_ERROR_NEGATIVE_SEEK;
+  _virtPos = (UInt64)offset;
+  if (newPosition)
+    *newPosition = (UInt64)offset;
+  return S_OK;
+
+  COM_TRY_END
+}
+
+
+Z7_COM7F_IMF(CHandler::GetStream(UInt32 index, ISequentialInStream **stream))
+{
+  COM_TRY_BEGIN
+  *stream = NULL;
+  if (index != 0)
+    return E_INVALIDARG;
+  if (!_stream)
+    return S_FALSE;
+  InitSeekPoints();
+  CMyComPtr2<ISequentialInStream, CInStream> spec;
+  spec.Create_if_Empty();
+  spec->_handlerSpec.SetFromCls(this);
+  spec->Init();
+  *stream = spec.Detach();
+  return S_OK;
+  COM_TRY_END
+}
+
+
+void CHandler::InitSeekPoints()
+{
+  if (SeekPoints.IsEmpty())
+  {
+    CSeekPoint sp;
+    sp.PackBitPos = 0;
+    sp.UnpackPos = 0;
+    sp.BlockSizeMax = 0;
+    sp.CombinedCrc = 0;
+    SeekPoints.Add(sp);
+  }
+}
+
+
+/*
+  record of seek point in index file:
+    PackBitPos   (UInt64)
+    UnpackPos    (UInt64)
+    BlockSizeMax (UInt32)
+    CombinedCrc  (UInt32)
+*/
+
+HRESULT CHandler::ReadSeekIndex2(ISequentialInStream *stream)
+{
+  NSeekIndex::CReader reader(stream);
+  UInt64 unpackSize;
+  UInt32 numPoints;
+  RINOK(reader.ReadHeader(NSeekIndex::k_Format_BZip2, _stream, unpackSize, numPoints))
+  if (numPoints == 0)
+    return S_FALSE;
+  // the index is loaded just after Open(), so we can replace the points
+  SeekPoints.Clear();
+  SeekPoints.Reserve(numPoints);
+  for (UInt32 i = 0; i < numPoints; i++)
+  {
+    CSeekPoint sp;
+    RINOK(reader.ReadUInt64(sp.PackBitPos))
+    RINOK(reader.ReadUInt64(sp.UnpackPos))
+    RINOK(reader.ReadUInt32(sp.BlockSizeMax))
+    RINOK(reader.ReadUInt32(sp.CombinedCrc))
+    if ((sp.PackBitPos >> 3) > PhySize
+        || sp.UnpackPos > unpackSize
+        || sp.BlockSizeMax > NCompress::NBZip2::kBlockSizeMax)
+      return S_FALSE;
+    if (i == 0)
+    {
+      if (sp.PackBitPos != 0 || sp.UnpackPos != 0 || sp.BlockSizeMax != 0)
+        return S_FALSE;
+    }
+    else
+    {
+      const CSeekPoint &prev = SeekPoints.Back();
+      if (sp.PackBitPos <= prev.PackBitPos || sp.UnpackPos <= prev.UnpackPos)
+        return S_FALSE;
+    }
+    SeekPoints.AddInReserved(sp);
+  }
+  RINOK(reader.Finish())
+  SeekUnpackSize = unpackSize;
+  SeekUnpackSize_Defined = true;
+  return S_OK;
+}
+
+
+Z7_COM7F_IMF(CHandler::ReadSeekIndex(ISequentialInStream *stream))
+{
+  COM_TRY_BEGIN
+  if (!_stream)
+    return S_FALSE;
+  const HRESULT res = ReadSeekIndex2(stream);
+  if (res != S_OK)
+    SeekPoints.Clear();
+  return res;
+  COM_TRY_END
+}
+
+
+Z7_COM7F_IMF(CHandler::BuildSeekIndex(IArchiveOpenCallback *callback))
+{
+  COM_TRY_BEGIN
+  if (!_stream)
+    return S_FALSE;
+  if (SeekUnpackSize_Defined)
+    return S_OK;
+  InitSeekPoints();
+  CMyComPtr2<ISequentialInStream, CInStream> spec;
+  spec.Create_if_Empty();
+  spec->_handlerSpec.SetFromCls(this);
+  spec->Init();
+  spec->Progress = callback;
+  if (callback)
+  {
+    RINOK(callback->SetTotal(NULL, &PhySize))
+  }
+  return spec->ReadToEnd();
+  COM_TRY_END
+}
+
+
+Z7_COM7F_IMF(CHandler::WriteSeekIndex(ISequentialOutStream *stream))
+{
+  COM_TRY_BEGIN
+  if (!_stream || !SeekUnpackSize_Defined)
+    return S_FALSE;
+  NSeekIndex::CWriter writer(stream);
+  RINOK(writer.WriteHeader(NSeekIndex::k_Format_BZip2, _stream, SeekUnpackSize, SeekPoints.Size()))
+  FOR_VECTOR (i, SeekPoints)
+  {
+    const CSeekPoint &sp = SeekPoints[i];
+    RINOK(writer.WriteUInt64(sp.PackBitPos))
+    RINOK(writer.WriteUInt64(sp.UnpackPos))
+    RINOK(writer.WriteUInt32(sp.BlockSizeMax))
+    RINOK(writer.WriteUInt32(sp.CombinedCrc))
+  }
+  return writer.Finish();
+  COM_TRY_END
+}
+
+
 Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
     Int32 testMode, IArchiveExtractCallback *extractCallback))
 {
@@ -112,6 +112,44 @@ bool CCommonMethodProps::SetCommonProperty(const UString &name, const PROPVARIAN
 }
 
 
+HRESULT CDecoderMethodProps::SetProperties(const wchar_t * const *names, const PROPVARIANT *values, UInt32 numProps)
+{
+  Init();
+  for (UInt32 i = 0; i < numProps; i++)
+  {
+    UString name = names[i];
+    name.MakeLower_Ascii();
+    if (name.IsEmpty())
+      return E_INVALIDARG;
+    HRESULT hres;
+    if (!SetCommonProperty(name, values[i], hres))
+      return E_INVALIDARG;
+    RINOK(hres)
+  }
+  return S_OK;
+}
+
+
+UInt32 CDecoderMethodProps::Get_NumThreads_for_MemUsage(UInt64 threadMemUsage) const
+{
+  #ifdef Z7_ST
+  UNUSED_VAR(threadMemUsage)
+  return 1;
+  #else
+  UInt32 numThreads = _numThreads;
+  if (threadMemUsage != 0)
+  {
+    const UInt64 num = _memUsage_Decompress / threadMemUsage;
+    if (numThreads > num)
+      numThreads = (UInt32)num;
+  }
+  if (numThreads == 0)
+    numThreads = 1;
+  return numThreads;
+  #endif
+}
+
+
 #ifndef Z7_EXTRACT_ONLY
 
 static void SetMethodProp32(CMethodProps &m, PROPID propID, UInt32 value)
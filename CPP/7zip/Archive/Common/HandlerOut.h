@@ -63,6 +63,19 @@ public:
 };
 
 
+/* CDecoderMethodProps is used by handlers that support only
+   (mt) and (memuse) properties for multithreaded extraction. */
+
+class CDecoderMethodProps: public CCommonMethodProps
+{
+public:
+  void Init() { InitCommon(); }
+  HRESULT SetProperties(const wchar_t * const *names, const PROPVARIANT *values, UInt32 numProps);
+  // it returns the number of threads limited by (_memUsage_Decompress)
+  UInt32 Get_NumThreads_for_MemUsage(UInt64 threadMemUsage) const;
+};
+
+
 #ifndef Z7_EXTRACT_ONLY
 
 class CMultiMethodProps: public CCommonMethodProps
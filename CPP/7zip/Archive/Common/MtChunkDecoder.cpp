@@ -0,0 +1,115 @@
+// MtChunkDecoder.cpp
+
+#include "StdAfx.h"
+
+#ifndef Z7_ST
+#include "../../../Windows/System.h"
+#endif
+
+#include "MtChunkDecoder.h"
+
+namespace NArchive {
+
+static void DecodeChunk(IMtChunkDecoderCallback *callback, unsigned threadIndex, CMtChunk &chunk)
+{
+  try
+  {
+    chunk.Res = callback->MtChunk_Decode(threadIndex, chunk);
+  }
+  catch(...) { chunk.Res = E_OUTOFMEMORY; }
+}
+
+#ifndef Z7_ST
+void CMtChunkDecoder::CThread::Execute()
+{
+  DecodeChunk(Callback, ThreadIndex, Chunk);
+}
+#endif
+
+CMtChunkDecoder::CMtChunkDecoder():
+  #ifndef Z7_ST
+    NumThreads(NWindows::NSystem::GetNumberOfProcessors())
+  #else
+    NumThreads(1)
+  #endif
+  {}
+
+
+HRESULT CMtChunkDecoder::Decode(IMtChunkDecoderCallback *callback, UInt64 numChunks)
+{
+  #ifndef Z7_ST
+  if (NumThreads > 1 && numChunks > 1)
+  {
+    unsigned numThreads = NumThreads;
+    if (numThreads > numChunks)
+      numThreads = (unsigned)numChunks;
+    while (_threads.Size() < numThreads)
+    {
+      CThread &t = _threads.AddNew();
+      t.ThreadIndex = _threads.Size() - 1;
+      const WRes wres = t.Create();
+      if (wres != 0)
+      {
+        _threads.DeleteBack();
+        if (_threads.Size() < 2)
+          break;
+        numThreads = _threads.Size();
+      }
+    }
+    if (numThreads > _threads.Size())
+      numThreads = _threads.Size();
+
+    if (numThreads > 1)
+    {
+      /* chunk (i) is processed by thread (i % numThreads).
+         So the thread that contains next chunk for writing is known,
+         and we can read new chunk to that thread after writing. */
+      HRESULT res = S_OK;
+      HRESULT readRes = S_OK;
+      UInt64 readIndex = 0;
+      UInt64 writeIndex = 0;
+      for (;;)
+      {
+        while (res == S_OK
+            && readRes == S_OK
+            && readIndex != numChunks
+            && readIndex - writeIndex < numThreads)
+        {
+          CThread &t = _threads[(unsigned)(readIndex % numThreads)];
+          t.Chunk.Index = readIndex;
+          readRes = callback->MtChunk_Read(t.Chunk);
+          if (readRes != S_OK)
+            break;
+          t.Callback = callback;
+          const WRes wres = t.Start();
+          if (wres != 0)
+          {
+            readRes = HRESULT_FROM_WIN32(wres);
+            break;
+          }
+          readIndex++;
+        }
+        // the chunks before failed chunk are written as in single-thread mode
+        if (writeIndex == readIndex)
+          return res != S_OK ? res : readRes;
+        CThread &t = _threads[(unsigned)(writeIndex % numThreads)];
+        t.WaitExecuteFinish();
+        if (res == S_OK)
+          res = callback->MtChunk_Write(t.Chunk);
+        writeIndex++;
+      }
+    }
+  }
+  #endif
+
+  for (UInt64 i = 0; i < numChunks; i++)
+  {
+    _chunk.Index = i;
+    RINOK(callback->MtChunk_Read(_chunk))
+    DecodeChunk(callback, 0, _chunk);
+    RINOK(callback->MtChunk_Write(_chunk))
+  }
+  return S_OK;
+}
+
+}
@@ -0,0 +1,77 @@
+// MtChunkDecoder.h
+
+#ifndef ZIP7_INC_MT_CHUNK_DECODER_H
+#define ZIP7_INC_MT_CHUNK_DECODER_H
+
+#include "../../../Common/MyBuffer2.h"
+#include "../../../Common/MyVector.h"
+#include "../../../Common/MyWindows.h"
+
+#ifndef Z7_ST
+#include "../../Common/VirtThread.h"
+#endif
+
+namespace NArchive {
+
+/*
+  CMtChunkDecoder decodes the sequence of independently compressed chunks
+  (WIM chunks, SquashFS blocks, DMG blocks) in several threads:
+    MtChunk_Read()   is called in main thread in order of chunks.
+                     It reads packed data of chunk (chunk.Index) to (chunk.PackBuf).
+    MtChunk_Decode() is called in worker thread.
+                     It unpacks data from (chunk.PackBuf) to (chunk.UnpackBuf).
+                     Its result is stored to (chunk.Res).
+    MtChunk_Write()  is called in main thread in order of chunks.
+  Only (NumThreads) chunks are in memory at same time.
+  If (NumThreads <= 1), all calls are in main thread.
+*/
+
+struct CMtChunk
+{
+  UInt64 Index;
+  size_t PackSize;
+  size_t UnpackSize;
+  HRESULT Res;
+  UInt32 Param; // it can be set by MtChunk_Read() for MtChunk_Decode()
+  CMidBuffer PackBuf;
+  CMidBuffer UnpackBuf;
+};
+
+Z7_PURE_INTERFACES_BEGIN
+DECLARE_INTERFACE(IMtChunkDecoderCallback)
+{
+  virtual HRESULT MtChunk_Read(CMtChunk &chunk) = 0;
+  virtual HRESULT MtChunk_Decode(unsigned threadIndex, CMtChunk &chunk) = 0;
+  virtual HRESULT MtChunk_Write(CMtChunk &chunk) = 0;
+};
+Z7_PURE_INTERFACES_END
+
+
+class CMtChunkDecoder
+{
+  #ifndef Z7_ST
+  struct CThread Z7_final: public CVirtThread
+  {
+    IMtChunkDecoderCallback *Callback;
+    unsigned ThreadIndex;
+    CMtChunk Chunk;
+
+    void Execute() Z7_override;
+    ~CThread() { CVirtThread::WaitThreadFinish(); }
+  };
+  CObjectVector<CThread> _threads;
+  #endif
+
+  CMtChunk _chunk;
+
+  Z7_CLASS_NO_COPY(CMtChunkDecoder)
+public:
+  unsigned NumThreads;
+
+  CMtChunkDecoder();
+  HRESULT Decode(IMtChunkDecoderCallback *callback, UInt64 numChunks);
+};
+
+}
+
+#endif
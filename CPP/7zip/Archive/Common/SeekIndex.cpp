@@ -0,0 +1,168 @@
+// SeekIndex.cpp
+
+#include "StdAfx.h"
+
+#include <string.h>
+
+#include "../../../../C/7zCrc.h"
+#include "../../../../C/CpuArch.h"
+
+#include "../../Common/StreamUtils.h"
+
+#include "SeekIndex.h"
+
+namespace NArchive {
+namespace NSeekIndex {
+
+static const unsigned kHeaderSize = 4 + 4 + 8 + 4 + 8 + 4;
+static const unsigned kTailSize = 1 << 10;
+static const Byte kSignature[4] = { '7', 'z', 'S', 'I' };
+
+HRESULT GetTailCrc(IInStream *stream, UInt64 &phySize, UInt32 &tailCrc)
+{
+  RINOK(InStream_GetSize_SeekToEnd(stream, phySize))
+  Byte buf[kTailSize];
+  size_t size = kTailSize;
+  if (size > phySize)
+    size = (size_t)phySize;
+  RINOK(InStream_SeekSet(stream, phySize - size))
+  RINOK(ReadStream_FALSE(stream, buf, size))
+  tailCrc = CrcCalc(buf, size);
+  return S_OK;
+}
+
+
+CWriter::CWriter(ISequentialOutStream *stream):
+    _stream(stream),
+    _crc(CRC_INIT_VAL),
+    _pos(0)
+    {}
+
+HRESULT CWriter::FlushBuf()
+{
+  const size_t pos = _pos;
+  _pos = 0;
+  return WriteStream(_stream, _buf, pos);
+}
+
+HRESULT CWriter::WriteBytes(const void *data, size_t size)
+{
+  _crc = CrcUpdate(_crc, data, size);
+  while (size != 0)
+  {
+    if (_pos == sizeof(_buf))
+    {
+      RINOK(FlushBuf())
+    }
+    size_t cur = sizeof(_buf) - _pos;
+    if (cur > size)
+      cur = size;
+    memcpy(_buf + _pos, data, cur);
+    _pos += cur;
+    data = (const Byte *)data + cur;
+    size -= cur;
+  }
+  return S_OK;
+}
+
+HRESULT CWriter::WriteUInt32(UInt32 v)
+{
+  Byte buf[4];
+  SetUi32(buf, v)
+  return WriteBytes(buf, 4);
+}
+
+HRESULT CWriter::WriteUInt64(UInt64 v)
+{
+  Byte buf[8];
+  SetUi64(buf, v)
+  return WriteBytes(buf, 8);
+}
+
+HRESULT CWriter::WriteHeader(Byte format, IInStream *arcStream, UInt64 unpackSize, UInt32 numPoints)
+{
+  UInt64 phySize;
+  UInt32 tailCrc;
+  RINOK(GetTailCrc(arcStream, phySize, tailCrc))
+  Byte buf[kHeaderSize];
+  memcpy(buf, kSignature, 4);
+  buf[4] = format;
+  buf[5] = 0;
+  buf[6] = 0;
+  buf[7] = 0;
+  SetUi64(buf + 8, phySize)
+  SetUi32(buf + 16, tailCrc)
+  SetUi64(buf + 20, unpackSize)
+  SetUi32(buf + 28, numPoints)
+  return WriteBytes(buf, kHeaderSize);
+}
+
+HRESULT CWriter::Finish()
+{
+  RINOK(WriteUInt32(CRC_GET_DIGEST(_crc)))
+  return FlushBuf();
+}
+
+
+CReader::CReader(ISequentialInStream *stream):
+    _stream(stream),
+    _crc(CRC_INIT_VAL)
+    {}
+
+HRESULT CReader::ReadBytes(void *data, size_t size)
+{
+  RINOK(ReadStream_FALSE(_stream, data, size))
+  _crc = CrcUpdate(_crc, data, size);
+  return S_OK;
+}
+
+HRESULT CReader::ReadUInt32(UInt32 &v)
+{
+  Byte buf[4];
+  RINOK(ReadBytes(buf, 4))
+  v = GetUi32(buf);
+  return S_OK;
+}
+
+HRESULT CReader::ReadUInt64(UInt64 &v)
+{
+  Byte buf[8];
+  RINOK(ReadBytes(buf, 8))
+  v = GetUi64(buf);
+  return S_OK;
+}
+
+HRESULT CReader::ReadHeader(Byte format, IInStream *arcStream, UInt64 &unpackSize, UInt32 &numPoints)
+{
+  Byte buf[kHeaderSize];
+  RINOK(ReadBytes(buf, kHeaderSize))
+  if (memcmp(buf, kSignature, 4) != 0
+      || buf[4] != format
+      || buf[5] != 0)
+    return S_FALSE;
+  UInt64 phySize;
+  UInt32 tailCrc;
+  RINOK(GetTailCrc(arcStream, phySize, tailCrc))
+  if (GetUi64(buf + 8) != phySize
+      || GetUi32(buf + 16) != tailCrc)
+    return S_FALSE;
+  unpackSize = GetUi64(buf + 20);
+  numPoints = GetUi32(buf + 28);
+  return S_OK;
+}
+
+HRESULT CReader::Finish()
+{
+  const UInt32 crc = CRC_GET_DIGEST(_crc);
+  UInt32 v;
+  RINOK(ReadUInt32(v))
+  if (v != crc)
+    return S_FALSE;
+  // the index must be followed by the end of file
+  Byte b;
+  size_t processed = 1;
+  RINOK(ReadStream(_stream, &b, &processed))
+  return processed == 0 ? S_OK : S_FALSE;
+}
+
+}}
@@ -0,0 +1,70 @@
+// SeekIndex.h
+
+#ifndef ZIP7_INC_ARCHIVE_SEEK_INDEX_H
+#define ZIP7_INC_ARCHIVE_SEEK_INDEX_H
+
+#include "../../IStream.h"
+
+namespace NArchive {
+namespace NSeekIndex {
+
+/*
+The file of seek points index is stored beside the archive (archive name + ".7zidx").
+  Signature   "7zSI" (4 bytes)
+  Format      (1 byte) : k_Format_*
+  Version     (1 byte) : 0
+  Reserved    (2 bytes)
+  PhySize     (UInt64) : the size of archive file
+  TailCrc     (UInt32) : CRC of last (kTailSize) bytes of archive file
+  UnpackSize  (UInt64)
+  NumPoints   (UInt32)
+  Points      : format specific records
+  Crc         (UInt32) : CRC of all previous bytes
+All numbers are little-endian.
+(PhySize) and (TailCrc) are checked to detect the index of another (or changed) archive.
+*/
+
+const char * const k_FileExtension = ".7zidx";
+
+const Byte k_Format_Gzip = 1;
+const Byte k_Format_BZip2 = 2;
+
+HRESULT GetTailCrc(IInStream *stream, UInt64 &phySize, UInt32 &tailCrc);
+
+class CWriter
+{
+  ISequentialOutStream *_stream;
+  UInt32 _crc;
+  size_t _pos;
+  Byte _buf[1 << 12];
+
+  HRESULT FlushBuf();
+public:
+  CWriter(ISequentialOutStream *stream);
+  HRESULT WriteBytes(const void *data, size_t size);
+  HRESULT WriteByte(Byte b) { return WriteBytes(&b, 1); }
+  HRESULT WriteUInt32(UInt32 v);
+  HRESULT WriteUInt64(UInt64 v);
+  HRESULT WriteHeader(Byte format, IInStream *arcStream, UInt64 unpackSize, UInt32 numPoints);
+  HRESULT Finish();
+};
+
+// the functions of CReader return S_FALSE, if the index file is incorrect
+
+class CReader
+{
+  ISequentialInStream *_stream;
+  UInt32 _crc;
+public:
+  CReader(ISequentialInStream *stream);
+  HRESULT ReadBytes(void *data, size_t size);
+  HRESULT ReadByte(Byte &b) { return ReadBytes(&b, 1); }
+  HRESULT ReadUInt32(UInt32 &v);
+  HRESULT ReadUInt64(UInt64 &v);
+  HRESULT ReadHeader(Byte format, IInStream *arcStream, UInt64 &unpackSize, UInt32 &numPoints);
+  HRESULT Finish();
+};
+
+}}
+
+#endif
@@ -13,6 +13,7 @@
 
 #include "../../Windows/PropVariantUtils.h"
 
+#include "../Common/CachedInStream.h"
 #include "../Common/LimitedStreams.h"
 #include "../Common/ProgressUtils.h"
 #include "../Common/RegisterArc.h"
@@ -175,6 +176,8 @@ Z7_CLASS_IMP_CHandler_IInArchive_1(
 )
   CRecordVector<CItem> _items;
   CMyComPtr<IInStream> _stream;
+  // the streams from GetStream() keep the reference to data
+  CMyComPtr<IUnknown> _dataRef;
   Byte *_data;
   UInt32 _size;
   UInt32 _headersSize;
@@ -188,20 +191,6 @@ Z7_CLASS_IMP_CHandler_IInArchive_1(
   unsigned _method;
   unsigned _blockSizeLog;
 
-  // Current file
-
-  NCompress::NZlib::CDecoder *_zlibDecoderSpec;
-  CMyComPtr<ICompressCoder> _zlibDecoder;
-
-  CBufInStream *_inStreamSpec;
-  CMyComPtr<ISequentialInStream> _inStream;
-
-  CBufPtrSeqOutStream *_outStreamSpec;
-  CMyComPtr<ISequentialOutStream> _outStream;
-
-  UInt32 _curBlocksOffset;
-  UInt32 _curNumBlocks;
-
   HRESULT OpenDir(int parent, UInt32 baseOffsetBase, unsigned level);
   HRESULT Open2(IInStream *inStream);
   AString GetPath(unsigned index) const;
@@ -222,7 +211,6 @@ Z7_CLASS_IMP_CHandler_IInArchive_1(
 public:
   CHandler(): _data(NULL) {}
   ~CHandler() { Free(); }
-  HRESULT ReadBlock(UInt64 blockIndex, Byte *dest, size_t blockSize);
 };
 
 static const Byte kProps[] =
@@ -321,9 +309,12 @@ HRESULT CHandler::Open2(IInStream *inStream)
     _h.Size = (UInt32)size;
     RINOK(InStream_SeekSet(inStream, kHeaderSize))
   }
-  _data = (Byte *)MidAlloc(_h.Size);
-  if (!_data)
-    return E_OUTOFMEMORY;
+  {
+    CReferenceBuf *refBuf = new CReferenceBuf;
+    _dataRef = refBuf;
+    refBuf->Buf.Alloc(_h.Size);
+    _data = refBuf->Buf;
+  }
   memcpy(_data, buf, kHeaderSize);
   size_t processed = _h.Size - kHeaderSize;
   RINOK(ReadStream(inStream, _data + kHeaderSize, &processed))
@@ -462,7 +453,7 @@ Z7_COM7F_IMF(CHandler::Open(IInStream *stream, const UInt64 *, IArchiveOpenCallb
 
 void CHandler::Free()
 {
-  MidFree(_data);
+  _dataRef.Release();
   _data = NULL;
 }
 
@@ -549,51 +540,59 @@ Z7_COM7F_IMF(CHandler::GetProperty(UInt32 index, PROPID propID, PROPVARIANT *val
   COM_TRY_END
 }
 
+/*
+  CCramfsInStream doesn't use the state of handler,
+  so the blocks can be unpacked in prefetch thread.
+*/
+
 class CCramfsInStream: public CCachedInStream
 {
   HRESULT ReadBlock(UInt64 blockIndex, Byte *dest, size_t blockSize) Z7_override;
+
+  CMyComPtr2<ICompressCoder, NCompress::NZlib::CDecoder> _zlibDecoder;
+  CMyComPtr2<ISequentialInStream, CBufInStream> _inStream;
+  CMyComPtr2<ISequentialOutStream, CBufPtrSeqOutStream> _outStream;
 public:
-  CHandler *Handler;
+  CMyComPtr<IUnknown> DataRef;
+  const Byte *Data;
+  UInt32 Size;
+  UInt32 BlocksOffset;
+  UInt32 NumBlocks;
+  unsigned Method;
+  bool be;
+
+  #ifndef Z7_ST
+  CCramfsInStream() { EnablePrefetch(); }
+  ~CCramfsInStream() { StopPrefetch(); }
+  #endif
 };
 
 HRESULT CCramfsInStream::ReadBlock(UInt64 blockIndex, Byte *dest, size_t blockSize)
 {
-  return Handler->ReadBlock(blockIndex, dest, blockSize);
-}
-
-HRESULT CHandler::ReadBlock(UInt64 blockIndex, Byte *dest, size_t blockSize)
-{
-  if (_method == k_Flags_Method_ZLIB)
-  {
-    if (!_zlibDecoder)
-    {
-      _zlibDecoderSpec = new NCompress::NZlib::CDecoder();
-      _zlibDecoder = _zlibDecoderSpec;
-    }
-  }
+  if (Method == k_Flags_Method_ZLIB)
+    _zlibDecoder.Create_if_Empty();
   else
   {
-    if (_method != k_Flags_Method_LZMA)
+    if (Method != k_Flags_Method_LZMA)
     {
       // probably we must support no-compression archives here.
       return E_NOTIMPL;
     }
   }
 
-  const bool be = _h.be;
-  const Byte *p2 = _data + (_curBlocksOffset + (UInt32)blockIndex * 4);
-  const UInt32 start = (blockIndex == 0 ? _curBlocksOffset + _curNumBlocks * 4: Get32(p2 - 4));
+  const Byte *p2 = Data + (BlocksOffset + (UInt32)blockIndex * 4);
+  const UInt32 start = (blockIndex == 0 ? BlocksOffset + NumBlocks * 4: Get32(p2 - 4));
   const UInt32 end = Get32(p2);
-  if (end < start || end > _size)
+  if (end < start || end > Size)
     return S_FALSE;
   const UInt32 inSize = end - start;
 
-  if (_method == k_Flags_Method_LZMA)
+  if (Method == k_Flags_Method_LZMA)
   {
     const unsigned kLzmaHeaderSize = LZMA_PROPS_SIZE + 4;
     if (inSize < kLzmaHeaderSize)
       return S_FALSE;
-    const Byte *p = _data + start;
+    const Byte *p = Data + start;
     UInt32 destSize32 = GetUi32(p + LZMA_PROPS_SIZE);
     if (destSize32 > blockSize)
       return S_FALSE;
@@ -611,21 +610,13 @@ HRESULT CHandler::ReadBlock(UInt64 blockIndex, Byte *dest, size_t blockSize)
     return S_OK;
   }
 
-  if (!_inStream)
-  {
-    _inStreamSpec = new CBufInStream();
-    _inStream = _inStreamSpec;
-  }
-  if (!_outStream)
-  {
-    _outStreamSpec = new CBufPtrSeqOutStream();
-    _outStream = _outStreamSpec;
-  }
-  _inStreamSpec->Init(_data + start, inSize);
-  _outStreamSpec->Init(dest, blockSize);
-  RINOK(_zlibDecoder->Code(_inStream, _outStream, NULL, NULL, NULL))
-  return (inSize == _zlibDecoderSpec->GetInputProcessedSize() &&
-      _outStreamSpec->GetPos() == blockSize) ? S_OK : S_FALSE;
+  _inStream.Create_if_Empty();
+  _outStream.Create_if_Empty();
+  _inStream->Init(Data + start, inSize);
+  _outStream->Init(dest, blockSize);
+  RINOK(_zlibDecoder.Interface()->Code(_inStream, _outStream, NULL, NULL, NULL))
+  return (inSize == _zlibDecoder->GetInputProcessedSize() &&
+      _outStream->GetPos() == blockSize) ? S_OK : S_FALSE;
 }
 
 Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
@@ -762,9 +753,13 @@ Z7_COM7F_IMF(CHandler::GetStream(UInt32 index, ISequentialInStream **stream))
 
   CCramfsInStream *streamSpec = new CCramfsInStream;
   CMyComPtr<IInStream> streamTemp = streamSpec;
-  _curNumBlocks = numBlocks;
-  _curBlocksOffset = offset;
-  streamSpec->Handler = this;
+  streamSpec->DataRef = _dataRef;
+  streamSpec->Data = _data;
+  streamSpec->Size = _size;
+  streamSpec->BlocksOffset = offset;
+  streamSpec->NumBlocks = numBlocks;
+  streamSpec->Method = _method;
+  streamSpec->be = be;
   if (!streamSpec->Alloc(_blockSizeLog, 21 - _blockSizeLog))
     return E_OUTOFMEMORY;
   streamSpec->Init(size);
@@ -9,6 +9,10 @@
 #include "../../../C/Alloc.h"
 #endif
 
+#if !defined(_WIN32) && !defined(Z7_ST)
+#include "../../../C/Threads.h"
+#endif
+
 #include "../../Common/ComTry.h"
 
 #include "../../Windows/NtCheck.h"
@@ -77,6 +81,15 @@ static __attribute__((constructor)) void Init_ForceToUTF8()
   // printf("\nDLLExports2.cpp::Init_ForceToUTF8 =%d\n", g_ForceToUTF8 ? 1 : 0);
 }
 
+#ifndef Z7_ST
+// idle workers of thread pool must exit before the code of library is unmapped
+static __attribute__((destructor)) void Free_ThreadPool();
+static __attribute__((destructor)) void Free_ThreadPool()
+{
+  ThreadPool_Shutdown();
+}
+#endif
+
 #endif // _WIN32
 
 
@@ -109,10 +122,8 @@ STDAPI SetLargePageMode();
 STDAPI SetLargePageMode()
 {
   #if defined(Z7_LARGE_PAGES)
-  #ifdef _WIN32
   SetLargePageSize();
   #endif
-  #endif
   return S_OK;
 }
 
@@ -26,6 +26,8 @@
 #include "../Compress/XzDecoder.h"
 #include "../Compress/ZlibDecoder.h"
 
+#include "Common/HandlerOut.h"
+#include "Common/MtChunkDecoder.h"
 #include "Common/OutStreamWithCRC.h"
 
 // #define DMG_SHOW_RAW
@@ -313,8 +315,9 @@ void CForkPair::Print(AString &s, const char *name) const
 }
 
 
-Z7_CLASS_IMP_CHandler_IInArchive_1(
-  IInArchiveGetStream
+Z7_CLASS_IMP_CHandler_IInArchive_2(
+  IInArchiveGetStream,
+  ISetProperties
 )
   bool _masterCrcError;
   bool _headersError;
@@ -346,6 +349,8 @@ Z7_CLASS_IMP_CHandler_IInArchive_1(
   CObjectVector<CExtraFile> _extras;
 #endif
 
+  CDecoderMethodProps _props;
+
   HRESULT ReadData(IInStream *stream, const CForkPair &pair, CByteBuffer &buf);
   bool ParseBlob(const CByteBuffer &data);
   HRESULT Open2(IInStream *stream, IArchiveOpenCallback *openArchiveCallback);
@@ -1790,6 +1795,222 @@ HRESULT CDecoders::Code(ISequentialInStream *inStream, ISequentialOutStream *out
 }
 
 
+// compressed blocks that are not larger than that size can be unpacked in worker threads
+static const size_t k_MtBlockSize_MAX = (size_t)1 << 26;
+
+/*
+  CBlocksUnpacker unpacks the blocks of one file.
+  Compressed blocks are unpacked by CMtChunkDecoder in several threads.
+  Another blocks and big blocks are processed in MtChunk_Write() in main thread.
+*/
+
+class CBlocksUnpacker Z7_final: public IMtChunkDecoderCallback
+{
+  CDecoders _decoders;
+  CObjectVector<CDecoders> _mtDecoders;
+  CMyComPtr2_Create<ICompressCoder, NCompress::CCopyCoder> _copyCoder;
+  CMyComPtr2_Create<ISequentialInStream, CLimitedSequentialInStream> _inStream;
+  CAlignedBuffer1 _zeroBuf;
+  bool _useMt;
+
+  bool CanBeMtBlock(unsigned blockIndex) const
+  {
+    const CBlock &block = File->Blocks[blockIndex];
+    return block.NeedAllocateBuffer()
+        && block.PackSize <= k_MtBlockSize_MAX
+        && File->GetUnpackSize_of_Block(blockIndex) <= k_MtBlockSize_MAX;
+  }
+
+  bool IsMtBlock(unsigned blockIndex) const
+  {
+    return _useMt && CanBeMtBlock(blockIndex);
+  }
+
+  HRESULT MtChunk_Read(CMtChunk &chunk) Z7_override;
+  HRESULT MtChunk_Decode(unsigned threadIndex, CMtChunk &chunk) Z7_override;
+  HRESULT MtChunk_Write(CMtChunk &chunk) Z7_override;
+public:
+  CMtChunkDecoder MtDecoder;
+  const CDecoderMethodProps *Props;
+  IInStream *Stream;
+  UInt64 StartPos;
+  const CFile *File;
+  CLocalProgress *Lps;
+  ISequentialOutStream *OutStream;
+  CLimitedSequentialOutStream *OutStreamSpec;
+  COutStreamWithCRC *OutCrcStream;
+  bool NeedCrc;
+  Int32 OpRes;
+  UInt64 UnpPos;
+  UInt64 PackPos;
+  UInt64 Total_PackSize;
+  UInt64 Total_UnpackSize;
+
+  static const size_t kZeroBufSize = 1 << 14;
+
+  CBlocksUnpacker(): _zeroBuf(kZeroBufSize), _useMt(false)
+  {
+    memset(_zeroBuf, 0, kZeroBufSize);
+  }
+  
+  HRESULT Unpack();
+};
+
+
+HRESULT CBlocksUnpacker::MtChunk_Read(CMtChunk &chunk)
+{
+  chunk.PackSize = 0;
+  chunk.UnpackSize = 0;
+  const unsigned blockIndex = (unsigned)chunk.Index;
+  if (!IsMtBlock(blockIndex))
+    return S_OK;
+  const CBlock &block = File->Blocks[blockIndex];
+  const size_t packSize = (size_t)block.PackSize;
+  chunk.PackBuf.AllocAtLeast(packSize);
+  if (!chunk.PackBuf.IsAllocated())
+    return E_OUTOFMEMORY;
+  RINOK(InStream_SeekSet(Stream, StartPos + block.PackPos))
+  // if the stream is truncated, the decoder will return data error
+  chunk.PackSize = packSize;
+  return ReadStream(Stream, chunk.PackBuf, &chunk.PackSize);
+}
+
+
+HRESULT CBlocksUnpacker::MtChunk_Decode(unsigned threadIndex, CMtChunk &chunk)
+{
+  const unsigned blockIndex = (unsigned)chunk.Index;
+  if (!IsMtBlock(blockIndex))
+    return S_OK;
+  const UInt64 unpSize = File->GetUnpackSize_of_Block(blockIndex);
+  chunk.UnpackBuf.AllocAtLeast((size_t)unpSize);
+  if (!chunk.UnpackBuf.IsAllocated())
+    return E_OUTOFMEMORY;
+  CMyComPtr2_Create<ISequentialInStream, CBufInStream> inStream;
+  inStream->Init(chunk.PackBuf, chunk.PackSize);
+  CMyComPtr2_Create<ISequentialOutStream, CBufPtrSeqOutStream> outStream;
+  outStream->Init(chunk.UnpackBuf, (size_t)unpSize);
+  const HRESULT res = _mtDecoders[threadIndex].Code(inStream, outStream, File->Blocks[blockIndex], &unpSize, NULL);
+  chunk.UnpackSize = outStream->GetPos();
+  return res;
+}
+
+
+HRESULT CBlocksUnpacker::MtChunk_Write(CMtChunk &chunk)
+{
+  const unsigned blockIndex = (unsigned)chunk.Index;
+  
+  Lps->InSize = Total_PackSize + PackPos;
+  Lps->OutSize = Total_UnpackSize + UnpPos;
+  RINOK(Lps->SetCur())
+
+  const CBlock &block = File->Blocks[blockIndex];
+  // if (!block.ThereAreDataInBlock()) continue;
+
+  PackPos += block.PackSize;
+  if (block.UnpPos != UnpPos)
+  {
+    OpRes = NExtract::NOperationResult::kHeadersError;
+    // S_FALSE stops the processing of next blocks
+    return S_FALSE;
+  }
+
+  const UInt64 unpSize = File->GetUnpackSize_of_Block(blockIndex);
+
+  OutStreamSpec->Init(unpSize);
+  HRESULT res = S_OK;
+
+  OutCrcStream->EnableCalc(NeedCrc && block.NeedCrc());
+
+  if (block.IsZeroMethod())
+  {
+    if (block.PackSize != 0)
+      OpRes = NExtract::NOperationResult::kUnsupportedMethod;
+  }
+  else if (IsMtBlock(blockIndex))
+  {
+    res = chunk.Res;
+    RINOK(WriteStream(OutStream, chunk.UnpackBuf, chunk.UnpackSize))
+  }
+  else
+  {
+    RINOK(InStream_SeekSet(Stream, StartPos + block.PackPos))
+    _inStream->Init(block.PackSize);
+    if (block.Type == METHOD_COPY)
+    {
+      if (unpSize != block.PackSize)
+        OpRes = NExtract::NOperationResult::kUnsupportedMethod;
+      else
+        res = _copyCoder.Interface()->Code(_inStream, OutStream, NULL, NULL, Lps);
+    }
+    else
+      res = _decoders.Code(_inStream, OutStream, block, &unpSize, Lps);
+  }
+
+  if (res != S_OK)
+  {
+    if (res != S_FALSE)
+    {
+      if (res != E_NOTIMPL)
+        return res;
+      OpRes = NExtract::NOperationResult::kUnsupportedMethod;
+    }
+    if (OpRes == NExtract::NOperationResult::kOK)
+      OpRes = NExtract::NOperationResult::kDataError;
+  }
+  
+  UnpPos += unpSize;
+  
+  if (!OutStreamSpec->IsFinishedOK())
+  {
+    if (!block.IsZeroMethod() && OpRes == NExtract::NOperationResult::kOK)
+      OpRes = NExtract::NOperationResult::kDataError;
+
+    for (unsigned k = 0;;)
+    {
+      const UInt64 rem = OutStreamSpec->GetRem();
+      if (rem == 0)
+        break;
+      size_t size = kZeroBufSize;
+      if (size > rem)
+        size = (size_t)rem;
+      RINOK(WriteStream(OutStream, _zeroBuf, size))
+      k++;
+      if ((k & 0xfff) == 0)
+      {
+        Lps->OutSize = Total_UnpackSize + UnpPos - OutStreamSpec->GetRem();
+        RINOK(Lps->SetCur())
+      }
+    }
+  }
+  return S_OK;
+}
+
+
+HRESULT CBlocksUnpacker::Unpack()
+{
+  UnpPos = 0;
+  PackPos = 0;
+  _inStream->SetStream(Stream);
+  {
+    // each thread keeps packed and unpacked data of one block
+    UInt64 threadMemUsage = 0;
+    FOR_VECTOR (i, File->Blocks)
+      if (CanBeMtBlock(i))
+      {
+        const UInt64 mem = File->Blocks[i].PackSize + File->GetUnpackSize_of_Block(i);
+        if (threadMemUsage < mem)
+          threadMemUsage = mem;
+      }
+    MtDecoder.NumThreads = Props->Get_NumThreads_for_MemUsage(threadMemUsage);
+  }
+  _useMt = (MtDecoder.NumThreads > 1);
+  while (_mtDecoders.Size() < MtDecoder.NumThreads)
+    _mtDecoders.AddNew();
+  const HRESULT res = MtDecoder.Decode(this, File->Blocks.Size());
+  return res == S_FALSE ? S_OK : res;
+}
+
+
 Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
     Int32 testMode, IArchiveExtractCallback *extractCallback))
 {
@@ -1818,16 +2039,12 @@ Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
   }
   RINOK(extractCallback->SetTotal(totalSize))
 
-  const size_t kZeroBufSize = 1 << 14;
-  CAlignedBuffer1 zeroBuf(kZeroBufSize);
-  memset(zeroBuf, 0, kZeroBufSize);
-  
-  CDecoders decoders;
-  CMyComPtr2_Create<ICompressCoder, NCompress::CCopyCoder> copyCoder;
+  CBlocksUnpacker unpacker;
   CMyComPtr2_Create<ICompressProgressInfo, CLocalProgress> lps;
   lps->Init(extractCallback, false);
-  CMyComPtr2_Create<ISequentialInStream, CLimitedSequentialInStream> inStream;
-  inStream->SetStream(_inStream);
+  unpacker.Props = &_props;
+  unpacker.Stream = _inStream;
+  unpacker.Lps = lps.ClsPtr();
 
   UInt64 total_PackSize = 0;
   UInt64 total_UnpackSize = 0;
@@ -1887,87 +2104,18 @@ Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
         CMyComPtr2_Create<ISequentialOutStream, CLimitedSequentialOutStream> outStream;
         outStream->SetStream(outCrcStream);
         
-        UInt64 unpPos = 0;
-        UInt64 packPos = 0;
-
-        FOR_VECTOR (blockIndex, item.Blocks)
-        {
-          lps->InSize = total_PackSize + packPos;
-          lps->OutSize = total_UnpackSize + unpPos;
-          RINOK(lps->SetCur())
-
-          const CBlock &block = item.Blocks[blockIndex];
-          // if (!block.ThereAreDataInBlock()) continue;
-
-          packPos += block.PackSize;
-          if (block.UnpPos != unpPos)
-          {
-            opRes = NExtract::NOperationResult::kHeadersError;
-            break;
-          }
-
-          RINOK(InStream_SeekSet(_inStream, _startPos + _dataForkPair.Offset + item.StartPackPos + block.PackPos))
-          inStream->Init(block.PackSize);
-
-          const UInt64 unpSize = item.GetUnpackSize_of_Block(blockIndex);
-
-          outStream->Init(unpSize);
-          HRESULT res = S_OK;
-
-          outCrcStream->EnableCalc(needCrc && block.NeedCrc());
-
-          if (block.IsZeroMethod())
-          {
-            if (block.PackSize != 0)
-              opRes = NExtract::NOperationResult::kUnsupportedMethod;
-          }
-          else if (block.Type == METHOD_COPY)
-          {
-            if (unpSize != block.PackSize)
-              opRes = NExtract::NOperationResult::kUnsupportedMethod;
-            else
-              res = copyCoder.Interface()->Code(inStream, outStream, NULL, NULL, lps);
-          }
-          else
-            res = decoders.Code(inStream, outStream, block, &unpSize, lps);
-
-          if (res != S_OK)
-          {
-            if (res != S_FALSE)
-            {
-              if (res != E_NOTIMPL)
-                return res;
-              opRes = NExtract::NOperationResult::kUnsupportedMethod;
-            }
-            if (opRes == NExtract::NOperationResult::kOK)
-              opRes = NExtract::NOperationResult::kDataError;
-          }
-          
-          unpPos += unpSize;
-          
-          if (!outStream->IsFinishedOK())
-          {
-            if (!block.IsZeroMethod() && opRes == NExtract::NOperationResult::kOK)
-              opRes = NExtract::NOperationResult::kDataError;
-
-            for (unsigned k = 0;;)
-            {
-              const UInt64 rem = outStream->GetRem();
-              if (rem == 0)
-                break;
-              size_t size = kZeroBufSize;
-              if (size > rem)
-                size = (size_t)rem;
-              RINOK(WriteStream(outStream, zeroBuf, size))
-              k++;
-              if ((k & 0xfff) == 0)
-              {
-                lps->OutSize = total_UnpackSize + unpPos - outStream->GetRem();
-                RINOK(lps->SetCur())
-              }
-            }
-          }
-        }
+        unpacker.File = &item;
+        unpacker.StartPos = _startPos + _dataForkPair.Offset + item.StartPackPos;
+        unpacker.OutStream = outStream;
+        unpacker.OutStreamSpec = outStream.ClsPtr();
+        unpacker.OutCrcStream = outCrcStream.ClsPtr();
+        unpacker.NeedCrc = needCrc;
+        unpacker.OpRes = opRes;
+        unpacker.Total_PackSize = total_PackSize;
+        unpacker.Total_UnpackSize = total_UnpackSize;
+        RINOK(unpacker.Unpack())
+        opRes = unpacker.OpRes;
+        
         if (needCrc && opRes == NExtract::NOperationResult::kOK)
         {
           if (outCrcStream->GetCRC() != item.Checksum.GetCrc32())
@@ -2272,6 +2420,12 @@ Z7_COM7F_IMF(CInStream::Seek(Int64 offset, UInt32 seekOrigin, UInt64 *newPositio
   return S_OK;
 }
 
+Z7_COM7F_IMF(CHandler::SetProperties(const wchar_t * const *names, const PROPVARIANT *values, UInt32 numProps))
+{
+  return _props.SetProperties(names, values, numProps);
+}
+
+
 Z7_COM7F_IMF(CHandler::GetStream(UInt32 index, ISequentialInStream **stream))
 {
   COM_TRY_BEGIN
@@ -4,6 +4,7 @@
 
 // #include  <stdio.h>
 
+#include "../../../C/7zCrc.h"
 #include "../../../C/CpuArch.h"
 
 #include "../../Common/ComTry.h"
@@ -13,6 +14,7 @@
 #include "../../Windows/PropVariantUtils.h"
 #include "../../Windows/TimeUtils.h"
 
+#include "../Common/LimitedStreams.h"
 #include "../Common/ProgressUtils.h"
 #include "../Common/RegisterArc.h"
 #include "../Common/StreamUtils.h"
@@ -24,6 +26,7 @@
 #include "Common/HandlerOut.h"
 #include "Common/InStreamWithCRC.h"
 #include "Common/OutStreamWithCRC.h"
+#include "Common/SeekIndex.h"
 
 #define Get32(p) GetUi32(p)
 
@@ -446,8 +449,30 @@ HRESULT CItem::WriteFooter(ISequentialOutStream *stream)
   return WriteStream(stream, buf, 8);
 }
 
-Z7_CLASS_IMP_CHandler_IInArchive_3(
+/*
+  Seek points index for IInArchiveGetStream (zran-style):
+  the point is created at the start of gzip member or at the start of deflate block,
+  if the distance from previous point is not smaller than kSeekPointSpan.
+  The point at the start of deflate block stores the history (last 32 KiB of unpacked data),
+  that is required to resume the decoding from that point.
+  The index is built by stream reading (and Seek(STREAM_SEEK_END) reads whole stream),
+  so next reads from any position require only short decoding from nearest point.
+*/
+
+static const UInt32 kSeekPointSpan = (UInt32)1 << 24;
+
+struct CSeekPoint
+{
+  UInt64 PackBitPos;
+  UInt64 UnpackPos;
+  bool IsMemberStart;
+  CByteBuffer History;
+};
+
+Z7_CLASS_IMP_CHandler_IInArchive_5(
   IArchiveOpenSeq,
+  IInArchiveGetStream,
+  IInArchiveSeekIndex,
   IOutArchive,
   ISetProperties
 )
@@ -473,7 +498,12 @@ Z7_CLASS_IMP_CHandler_IInArchive_3(
   CSingleMethodProps _props;
   CHandlerTimeOptions _timeOptions;
 
+  HRESULT ReadSeekIndex2(ISequentialInStream *stream);
 public:
+  CObjectVector<CSeekPoint> SeekPoints;
+  bool SeekUnpackSize_Defined;
+  UInt64 SeekUnpackSize;
+
   CHandler():
       _isArc(false)
       {}
@@ -482,6 +512,13 @@ public:
   {
     _decoder.Create_if_Empty();
   }
+
+  IInStream *GetInStream() const { return _stream; }
+  UInt64 GetPhySize() const { return _packSize; }
+  bool NeedSeekPoint(UInt64 unpackPos) const
+    { return unpackPos >= SeekPoints.Back().UnpackPos + kSeekPointSpan; }
+  unsigned FindSeekPoint(UInt64 unpackPos) const;
+  void InitSeekPoints();
 };
 
 static const Byte kProps[] =
@@ -663,12 +700,453 @@ Z7_COM7F_IMF(CHandler::Close())
   _packSize = 0;
   _headerSize = 0;
   
+  SeekPoints.Clear();
+  SeekUnpackSize_Defined = false;
+  SeekUnpackSize = 0;
+
   _stream.Release();
   if (_decoder)
     _decoder->ReleaseInStream();
   return S_OK;
 }
 
+
+unsigned CHandler::FindSeekPoint(UInt64 unpackPos) const
+{
+  unsigned left = 0, right = SeekPoints.Size();
+  for (;;)
+  {
+    const unsigned mid = (left + right) / 2;
+    if (mid == left)
+      return left;
+    if (unpackPos < SeekPoints[mid].UnpackPos)
+      right = mid;
+    else
+      left = mid;
+  }
+}
+
+
+Z7_CLASS_IMP_IInStream(
+  CInStream
+)
+  UInt64 _virtPos;
+  UInt64 _unpackPos;
+  UInt64 _startBitPos;
+  UInt64 _memberUnpackPos;
+  UInt32 _historySize;
+  UInt32 _crc;
+  bool _isReady;
+  bool _wasFinished;
+  bool _needHeader;
+  bool _crc_Defined;
+  
+  CMyComPtr2<ISequentialInStream, CLimitedInStream> _limitedStream;
+  CMyComPtr2<ICompressCoder, NDecoder::CCOMCoder> _decoder;
+  CByteBuffer _skipBuf;
+
+  HRESULT Restart(const CSeekPoint &sp);
+  HRESULT Decode2(Byte *data, UInt32 size, UInt32 &processedSize);
+  HRESULT Decode(Byte *data, UInt32 size, UInt32 &processedSize);
+  HRESULT SkipTo(UInt64 pos);
+public:
+  CMyComPtr2<IInArchive, CHandler> _handlerSpec;
+  IArchiveOpenCallback *Progress;
+
+  void Init()
+  {
+    _virtPos = 0;
+    _isReady = false;
+    Progress = NULL;
+  }
+  HRESULT ReadToEnd();
+};
+
+
+HRESULT CInStream::Restart(const CSeekPoint &sp)
+{
+  _isReady = false;
+  _wasFinished = false;
+  const UInt64 bytePos = sp.PackBitPos >> 3;
+  const UInt64 phySize = _handlerSpec->GetPhySize();
+  if (bytePos > phySize)
+    return E_FAIL;
+  _limitedStream.Create_if_Empty();
+  _limitedStream->SetStream(_handlerSpec->GetInStream());
+  RINOK(_limitedStream->InitAndSeek(bytePos, phySize - bytePos))
+  _decoder.Create_if_Empty();
+  _decoder->SetInStream(_limitedStream);
+  RINOK(_decoder->InitInStream(true))
+  _startBitPos = bytePos << 3;
+  _unpackPos = sp.UnpackPos;
+  _needHeader = sp.IsMemberStart;
+  if (!sp.IsMemberStart)
+  {
+    _historySize = (UInt32)sp.History.Size();
+    _crc_Defined = false;
+    RINOK(_decoder->InitResume(sp.History, _historySize, (unsigned)sp.PackBitPos & 7))
+  }
+  _isReady = true;
+  return S_OK;
+}
+
+
+HRESULT CInStream::Decode2(Byte *data, UInt32 size, UInt32 &processedSize)
+{
+  processedSize = 0;
+  
+  for (;;)
+  {
+    if (_wasFinished)
+      return S_OK;
+    
+    if (_needHeader)
+    {
+      const UInt64 packBitPos = _startBitPos + _decoder->GetInputProcessedBits();
+      if (_handlerSpec->NeedSeekPoint(_unpackPos))
+      {
+        CSeekPoint &sp = _handlerSpec->SeekPoints.AddNew();
+        sp.PackBitPos = packBitPos;
+        sp.UnpackPos = _unpackPos;
+        sp.IsMemberStart = true;
+      }
+      CItem item;
+      const HRESULT res = item.ReadHeader(_decoder.ClsPtr());
+      if (res != S_OK || _decoder->InputEofError())
+      {
+        if (res != S_OK && res != S_FALSE)
+          return res;
+        if (packBitPos == 0)
+          return S_FALSE;
+        // there is no more gzip members. So it's the end of unpacked data.
+        if (!_handlerSpec->SeekUnpackSize_Defined)
+        {
+          _handlerSpec->SeekUnpackSize = _unpackPos;
+          _handlerSpec->SeekUnpackSize_Defined = true;
+        }
+        _wasFinished = true;
+        return S_OK;
+      }
+      RINOK(_decoder->InitResume(NULL, 0, 0))
+      _historySize = 0;
+      _memberUnpackPos = _unpackPos;
+      _crc = CRC_INIT_VAL;
+      _crc_Defined = true;
+      _needHeader = false;
+      continue;
+    }
+
+    if (_decoder->IsFinished())
+    {
+      _decoder->AlignToByte();
+      CItem item;
+      RINOK(item.ReadFooter1(_decoder.ClsPtr()))
+      // we can check CRC, only if the member was decoded from its start
+      if (_crc_Defined)
+        if (item.Crc != CRC_GET_DIGEST(_crc) ||
+            item.Size32 != (UInt32)(_unpackPos - _memberUnpackPos))
+          return S_FALSE;
+      _needHeader = true;
+      continue;
+    }
+
+    if (size == 0)
+      return S_OK;
+
+    if (_decoder->IsAtBlockStart() && _handlerSpec->NeedSeekPoint(_unpackPos))
+    {
+      CSeekPoint &sp = _handlerSpec->SeekPoints.AddNew();
+      sp.PackBitPos = _startBitPos + _decoder->GetInputProcessedBits();
+      sp.UnpackPos = _unpackPos;
+      sp.IsMemberStart = false;
+      sp.History.Alloc(_historySize);
+      _decoder->GetHistory(sp.History, _historySize);
+    }
+    
+    const UInt64 inBits = _decoder->GetInputProcessedBits();
+    UInt32 cur;
+    RINOK(_decoder->ReadToMem(data, size, cur, true))
+    if (_decoder->InputEofError())
+      return S_FALSE;
+    if (cur == 0 && inBits == _decoder->GetInputProcessedBits() && !_decoder->IsFinished())
+      return S_FALSE;
+    if (_crc_Defined)
+      _crc = CrcUpdate(_crc, data, cur);
+    _unpackPos += cur;
+    _historySize += cur;
+    if (_historySize > kHistorySize32)
+      _historySize = kHistorySize32;
+    data += cur;
+    size -= cur;
+    processedSize += cur;
+  }
+}
+
+
+HRESULT CInStream::Decode(Byte *data, UInt32 size, UInt32 &processedSize)
+{
+  HRESULT res;
+  try
+  {
+    res = Decode2(data, size, processedSize);
+  }
+  catch(const CInBufferException &e) { res = e.ErrorCode; }
+  if (res != S_OK)
+    _isReady = false;
+  return res;
+}
+
+
+HRESULT CInStream::SkipTo(UInt64 pos)
+{
+  const UInt32 kSkipBufSize = 1 << 16;
+  while (_unpackPos < pos && !_wasFinished)
+  {
+    if (_skipBuf.Size() == 0)
+      _skipBuf.Alloc(kSkipBufSize);
+    UInt32 cur = kSkipBufSize;
+    const UInt64 rem = pos - _unpackPos;
+    if (cur > rem)
+      cur = (UInt32)rem;
+    RINOK(Decode(_skipBuf, cur, cur))
+    if (cur == 0)
+      break;
+    if (Progress)
+    {
+      const UInt64 packSize = (_startBitPos + _decoder->GetInputProcessedBits()) >> 3;
+      RINOK(Progress->SetCompleted(NULL, &packSize))
+    }
+  }
+  return S_OK;
+}
+
+
+HRESULT CInStream::ReadToEnd()
+{
+  if (_handlerSpec->SeekUnpackSize_Defined)
+    return S_OK;
+  // we read the stream to the end. It also creates the seek points.
+  const CSeekPoint &sp = _handlerSpec->SeekPoints.Back();
+  if (!_isReady || sp.UnpackPos > _unpackPos)
+  {
+    RINOK(Restart(sp))
+  }
+  RINOK(SkipTo((UInt64)(Int64)-1))
+  if (!_handlerSpec->SeekUnpackSize_Defined)
+    return E_FAIL;
+  return S_OK;
+}
+
+
+Z7_COM7F_IMF(CInStream::Read(void *data, UInt32 size, UInt32 *processedSize))
+{
+  COM_TRY_BEGIN
+
+  if (processedSize)
+    *processedSize = 0;
+  if (_handlerSpec->SeekUnpackSize_Defined)
+  {
+    if (_virtPos >= _handlerSpec->SeekUnpackSize)
+      return S_OK;
+    const UInt64 rem = _handlerSpec->SeekUnpackSize - _virtPos;
+    if (size > rem)
+      size = (UInt32)rem;
+  }
+  if (size == 0)
+    return S_OK;
+
+  {
+    const CSeekPoint &sp = _handlerSpec->SeekPoints[_handlerSpec->FindSeekPoint(_virtPos)];
+    if (!_isReady || _virtPos < _unpackPos || sp.UnpackPos > _unpackPos)
+    {
+      RINOK(Restart(sp))
+    }
+  }
+  RINOK(SkipTo(_virtPos))
+  if (_unpackPos != _virtPos)
+    return S_OK;
+
+  UInt32 cur;
+  const HRESULT res = Decode((Byte *)data, size, cur);
+  _virtPos += cur;
+  if (processedSize)
+    *processedSize = cur;
+  return res;
+
+  COM_TRY_END
+}
+
+
+Z7_COM7F_IMF(CInStream::Seek(Int64 offset, UInt32 seekOrigin, UInt64 *newPosition))
+{
+  COM_TRY_BEGIN
+
+  switch (seekOrigin)
+  {
+    case STREAM_SEEK_SET: break;
+    case STREAM_SEEK_CUR: offset += _virtPos; break;
+    case STREAM_SEEK_END:
+    {
+      RINOK(ReadToEnd())
+      offset += _handlerSpec->SeekUnpackSize;
+      break;
+    }
+    default: return STG_E_INVALIDFUNCTION;
+  }
+  if (offset < 0)
+    return HRESULT_WIN32_ERROR_NEGATIVE_SEEK;
+  _virtPos = (UInt64)offset;
+  if (newPosition)
+    *newPosition = (UInt64)offset;
+  return S_OK;
+
+  COM_TRY_END
+}
+
+
+Z7_COM7F_IMF(CHandler::GetStream(UInt32 index, ISequentialInStream **stream))
+{
+  COM_TRY_BEGIN
+  *stream = NULL;
+  if (index != 0)
+    return E_INVALIDARG;
+  if (!_stream)
+    return S_FALSE;
+  InitSeekPoints();
+  CMyComPtr2<ISequentialInStream, CInStream> spec;
+  spec.Create_if_Empty();
+  spec->_handlerSpec.SetFromCls(this);
+  spec->Init();
+  *stream = spec.Detach();
+  return S_OK;
+  COM_TRY_END
+}
+
+
+void CHandler::InitSeekPoints()
+{
+  if (SeekPoints.IsEmpty())
+  {
+    CSeekPoint &sp = SeekPoints.AddNew();
+    sp.PackBitPos = 0;
+    sp.UnpackPos = 0;
+    sp.IsMemberStart = true;
+  }
+}
+
+
+/*
+  record of seek point in index file:
+    PackBitPos  (UInt64)
+    UnpackPos   (UInt64)
+    IsMemberStart (1 byte)
+    HistorySize (UInt32) : it's 0 for member start point
+    History     (HistorySize bytes)
+*/
+
+HRESULT CHandler::ReadSeekIndex2(ISequentialInStream *stream)
+{
+  NSeekIndex::CReader reader(stream);
+  UInt64 unpackSize;
+  UInt32 numPoints;
+  RINOK(reader.ReadHeader(NSeekIndex::k_Format_Gzip, _stream, unpackSize, numPoints))
+  if (numPoints == 0)
+    return S_FALSE;
+  // the index is loaded just after Open(), so we can replace the points
+  SeekPoints.Clear();
+  CObjectVector<CSeekPoint> &points = SeekPoints;
+  for (UInt32 i = 0; i < numPoints; i++)
+  {
+    CSeekPoint &sp = points.AddNew();
+    Byte isMemberStart;
+    UInt32 historySize;
+    RINOK(reader.ReadUInt64(sp.PackBitPos))
+    RINOK(reader.ReadUInt64(sp.UnpackPos))
+    RINOK(reader.ReadByte(isMemberStart))
+    RINOK(reader.ReadUInt32(historySize))
+    sp.IsMemberStart = (isMemberStart != 0);
+    if (isMemberStart > 1
+        || historySize > kHistorySize32
+        || (sp.IsMemberStart && historySize != 0)
+        || (sp.PackBitPos >> 3) > _packSize
+        || sp.UnpackPos > unpackSize)
+      return S_FALSE;
+    if (i == 0)
+    {
+      if (sp.PackBitPos != 0 || sp.UnpackPos != 0 || !sp.IsMemberStart)
+        return S_FALSE;
+    }
+    else
+    {
+      const CSeekPoint &prev = points[i - 1];
+      if (sp.PackBitPos <= prev.PackBitPos || sp.UnpackPos <= prev.UnpackPos)
+        return S_FALSE;
+    }
+    sp.History.Alloc(historySize);
+    RINOK(reader.ReadBytes(sp.History, historySize))
+  }
+  RINOK(reader.Finish())
+  SeekUnpackSize = unpackSize;
+  SeekUnpackSize_Defined = true;
+  return S_OK;
+}
+
+
+Z7_COM7F_IMF(CHandler::ReadSeekIndex(ISequentialInStream *stream))
+{
+  COM_TRY_BEGIN
+  if (!_stream)
+    return S_FALSE;
+  const HRESULT res = ReadSeekIndex2(stream);
+  if (res != S_OK)
+    SeekPoints.Clear();
+  return res;
+  COM_TRY_END
+}
+
+
+Z7_COM7F_IMF(CHandler::BuildSeekIndex(IArchiveOpenCallback *callback))
+{
+  COM_TRY_BEGIN
+  if (!_stream)
+    return S_FALSE;
+  if (SeekUnpackSize_Defined)
+    return S_OK;
+  InitSeekPoints();
+  CMyComPtr2<ISequentialInStream, CInStream> spec;
+  spec.Create_if_Empty();
+  spec->_handlerSpec.SetFromCls(this);
+  spec->Init();
+  spec->Progress = callback;
+  if (callback)
+  {
+    RINOK(callback->SetTotal(NULL, &_packSize))
+  }
+  return spec->ReadToEnd();
+  COM_TRY_END
+}
+
+
+Z7_COM7F_IMF(CHandler::WriteSeekIndex(ISequentialOutStream *stream))
+{
+  COM_TRY_BEGIN
+  if (!_stream || !SeekUnpackSize_Defined)
+    return S_FALSE;
+  NSeekIndex::CWriter writer(stream);
+  RINOK(writer.WriteHeader(NSeekIndex::k_Format_Gzip, _stream, SeekUnpackSize, SeekPoints.Size()))
+  FOR_VECTOR (i, SeekPoints)
+  {
+    const CSeekPoint &sp = SeekPoints[i];
+    RINOK(writer.WriteUInt64(sp.PackBitPos))
+    RINOK(writer.WriteUInt64(sp.UnpackPos))
+    RINOK(writer.WriteByte((Byte)(sp.IsMemberStart ? 1 : 0)))
+    RINOK(writer.WriteUInt32((UInt32)sp.History.Size()))
+    RINOK(writer.WriteBytes(sp.History, sp.History.Size()))
+  }
+  return writer.Finish();
+  COM_TRY_END
+}
+
 Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
     Int32 testMode, IArchiveExtractCallback *extractCallback))
 {
@@ -146,6 +146,18 @@ namespace NArchive
         // , kMemError
       };
     }
+
+    namespace NStage
+    {
+      enum
+      {
+        kDecode = 0,
+        kFilter,
+        kCrc,
+        kWrite,
+        kNumStages
+      };
+    }
   }
 
   namespace NEventIndexType
@@ -259,6 +271,27 @@ Z7_IFACE_CONSTR_ARCHIVE_SUB(IArchiveExtractCallbackMessage, IProgress, 0x21)
   x(ReportExtractResult(UInt32 indexType, UInt32 index, Int32 opRes))
 Z7_IFACE_CONSTR_ARCHIVE(IArchiveExtractCallbackMessage2, 0x22)
 
+/*
+IArchiveExtractCallbackStat can be requested from IArchiveExtractCallback object
+  by Extract() function to report the time spent in each stage of extraction.
+IsStageStatEnabled()
+  *enabled != 0 : the callback wants stage statistics.
+     The handler can switch to slower code path (for example, single-thread
+     coder mixer in 7z handler), so that the times of stages don't overlap.
+ReportStageStat()
+  is called after Extract() for each stage (NExtract::NStage):
+    kDecode : decoders including the reading of packed data
+    kFilter : filters (BCJ, Delta, ...)
+    kCrc    : CRC / hash checking of unpacked data
+    kWrite  : writing to the stream from GetStream()
+  time : wall time in microseconds
+  size : number of bytes processed by the stage
+*/
+#define Z7_IFACEM_IArchiveExtractCallbackStat(x) \
+  x(IsStageStatEnabled(Int32 *enabled)) \
+  x(ReportStageStat(UInt32 stage, UInt64 time, UInt64 size))
+Z7_IFACE_CONSTR_ARCHIVE(IArchiveExtractCallbackStat, 0x23)
+
 #define Z7_IFACEM_IArchiveOpenVolumeCallback(x) \
   x(GetProperty(PROPID propID, PROPVARIANT *value)) \
   x(GetStream(const wchar_t *name, IInStream **inStream))
@@ -269,6 +302,27 @@ Z7_IFACE_CONSTR_ARCHIVE(IArchiveOpenVolumeCallback, 0x30)
   x(GetStream(UInt32 index, ISequentialInStream **stream))
 Z7_IFACE_CONSTR_ARCHIVE(IInArchiveGetStream, 0x40)
 
+/*
+IInArchiveSeekIndex is supported by handlers of compressed streams (gzip, bzip2),
+  where IInArchiveGetStream returns seekable stream that uses the index of seek points.
+  The full index can be built once, and then it can be stored beside the archive.
+  The handler doesn't report kpidMainSubfile, because the opening of unpacked stream
+  as archive can require the decoding of whole stream. So the caller opens
+  the stream from GetStream(0) as archive, only if nested type was requested.
+
+ReadSeekIndex()  : loads stored index.
+    returns S_FALSE, if the index doesn't match open archive.
+BuildSeekIndex() : builds full index. It decodes whole stream.
+WriteSeekIndex() : writes full index.
+    returns S_FALSE, if the index is not full.
+*/
+
+#define Z7_IFACEM_IInArchiveSeekIndex(x) \
+  x(ReadSeekIndex(ISequentialInStream *stream)) \
+  x(BuildSeekIndex(IArchiveOpenCallback *callback)) \
+  x(WriteSeekIndex(ISequentialOutStream *stream))
+Z7_IFACE_CONSTR_ARCHIVE(IInArchiveSeekIndex, 0x41)
+
 #define Z7_IFACEM_IArchiveOpenSetSubArchiveName(x) \
   x(SetSubArchiveName(const wchar_t *name))
 Z7_IFACE_CONSTR_ARCHIVE(IArchiveOpenSetSubArchiveName, 0x50)
@@ -533,6 +587,27 @@ UpdateItems()
 
 Z7_IFACE_CONSTR_ARCHIVE(IOutArchive, 0xA0)
 
+/*
+IOutArchiveAppend::SetAppendMode()
+  The caller can call it before UpdateItems(), if all items of open archive
+  are kept with old data, and only new items are added or properties are changed.
+  If (appendMode != 0) and the handler returns S_OK, the caller passes
+  the stream of same archive file opened for writing to UpdateItems().
+  Then the handler doesn't write old data, it writes new data and new headers
+  after old archive, and then it rewrites the start header.
+  So the old archive stays valid, if the process is terminated before that.
+  If UpdateItems() fails (including E_ABORT), the handler restores
+  the original bytes and size of archive file.
+  return:
+    S_OK      : append mode is supported for open archive
+    E_NOTIMPL : append mode is not supported, the caller must use normal update
+*/
+
+#define Z7_IFACEM_IOutArchiveAppend(x) \
+  x(SetAppendMode(Int32 appendMode))
+
+Z7_IFACE_CONSTR_ARCHIVE(IOutArchiveAppend, 0xA1)
+
 
 /*
 ISetProperties::SetProperties()
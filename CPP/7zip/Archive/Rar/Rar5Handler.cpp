@@ -16,6 +16,7 @@
 #include "../../IPassword.h"
 
 #include "../../Common/FilterCoder.h"
+#include "../../Common/FilterThread.h"
 #include "../../Common/LimitedStreams.h"
 #include "../../Common/MethodProps.h"
 #include "../../Common/ProgressUtils.h"
@@ -1021,8 +1022,12 @@ struct CUnpacker
 
   CByteBuffer _tempBuf;
   CLinkFile *linkFile;
+  UInt32 NumThreads;
+ #ifndef Z7_ST
+  CFilterThread _filterThread;
+ #endif
 
-  CUnpacker(): linkFile(NULL) { SolidAllowed = false; NeedCrc = true; }
+  CUnpacker(): linkFile(NULL), NumThreads(1) { SolidAllowed = false; NeedCrc = true; }
 
   HRESULT Create(DECL_EXTERNAL_CODECS_LOC_VARS
       const CItem &item, bool isSolid, bool &wrongPassword);
@@ -1138,6 +1143,9 @@ HRESULT CUnpacker::Code(const CItem &item, const CItem &lastItem, UInt64 packSiz
 
   bool isCryptoMode = false;
   ISequentialInStream *inStream;
+ #ifndef Z7_ST
+  CFilterThread_Releaser filterThreadReleaser;
+ #endif
 
   if (item.IsEncrypted())
   {
@@ -1146,6 +1154,21 @@ HRESULT CUnpacker::Code(const CItem &item, const CItem &lastItem, UInt64 packSiz
     filterStreamSpec->SetOutStreamSize(NULL);
     inStream = filterStream;
     isCryptoMode = true;
+   #ifndef Z7_ST
+    // (volsInStream) is limited by packed size of item, and we don't read
+    // the filter stream after decoder. So read-ahead in filter thread is allowed.
+    if (NumThreads > 1 && packSize >= kFilterThread_MinPackSize)
+    {
+      const HRESULT res = _filterThread.StartStream(filterStream, filterThreadReleaser.BinderInStream);
+      if (res != S_OK)
+      {
+        filterStreamSpec->ReleaseInStream();
+        return res;
+      }
+      filterThreadReleaser.Thread = &_filterThread;
+      inStream = filterThreadReleaser.BinderInStream;
+    }
+   #endif
   }
   else
     inStream = volsInStream;
@@ -1170,6 +1193,15 @@ HRESULT CUnpacker::Code(const CItem &item, const CItem &lastItem, UInt64 packSiz
     // res = res;
   }
 
+  #ifndef Z7_ST
+  {
+    // filter thread must finish the reading from (volsInStream) before we release it
+    const HRESULT res2 = filterThreadReleaser.Release();
+    if (res == S_OK)
+      res = res2;
+  }
+  #endif
+
   if (isCryptoMode)
     filterStreamSpec->ReleaseInStream();
 
@@ -3025,6 +3057,9 @@ Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
 
   CUnpacker unpacker;
   unpacker.NeedCrc = _needChecksumCheck;
+ #ifndef Z7_ST
+  unpacker.NumThreads = _numThreads;
+ #endif
   CMyComPtr2_Create<ISequentialInStream, CVolsInStream> volsInStream;
   CMyComPtr2_Create<ICompressProgressInfo, CLocalProgress> lps;
   lps->Init(extractCallback, false);
@@ -3328,6 +3363,9 @@ CHandler::CHandler()
 
 void CHandler::InitDefaults()
 {
+ #ifndef Z7_ST
+  _numThreads = NWindows::NSystem::GetNumberOfProcessors();
+ #endif
   _needChecksumCheck = true;
   _memUsage_WasSet = false;
   _memUsage_Decompress = (UInt64)1 << 32;
@@ -3348,6 +3386,11 @@ Z7_COM7F_IMF(CHandler::SetProperties(const wchar_t * const *names, const PROPVAR
 
     if (name.IsPrefixedBy_Ascii_NoCase("mt"))
     {
+      #ifndef Z7_ST
+      _numThreads = NWindows::NSystem::GetNumberOfProcessors();
+      bool force = false;
+      RINOK(ParseMtProp2(name.Ptr(2), prop, _numThreads, force))
+      #endif
     }
     else if (name.IsPrefixedBy_Ascii_NoCase("memx"))
     {
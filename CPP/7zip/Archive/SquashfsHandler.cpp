@@ -17,6 +17,7 @@
 #include "../../Windows/PropVariantUtils.h"
 #include "../../Windows/TimeUtils.h"
 
+#include "../Common/CachedInStream.h"
 #include "../Common/CWrappers.h"
 #include "../Common/LimitedStreams.h"
 #include "../Common/ProgressUtils.h"
@@ -28,6 +29,15 @@
 #include "../Compress/ZlibDecoder.h"
 // #include "../Compress/LzmaDecoder.h"
 
+#include "Common/HandlerOut.h"
+#include "Common/MtChunkDecoder.h"
+
+#ifndef Z7_ST
+#define MT_LOCK NWindows::NSynchronization::CCriticalSectionLock lock(_cs);
+#else
+#define MT_LOCK
+#endif
+
 namespace NArchive {
 namespace NSquashfs {
 
@@ -837,8 +847,35 @@ struct CFrag
 };
 
 
-Z7_CLASS_IMP_CHandler_IInArchive_1(
-  IInArchiveGetStream
+// decoders for unpacking from buffer to buffer
+struct CBlockDecoder
+{
+  CMyComPtr2<ICompressCoder, NCompress::NZlib::CDecoder> ZlibDecoder;
+  CXzUnpacker Xz;
+  CZstdDecHandle Zstd;
+
+  CBlockDecoder(): Zstd(NULL)
+  {
+    XzUnpacker_Construct(&Xz, &g_Alloc);
+  }
+  ~CBlockDecoder()
+  {
+    XzUnpacker_Free(&Xz);
+    if (Zstd)
+      ZstdDec_Destroy(Zstd);
+  }
+
+  /* (destLen) : the size of (dest) buffer at input,
+                 the size of unpacked data at output */
+  HRESULT Decode(UInt32 method, bool noPropsLZMA, UInt32 lzmaDicSize,
+      const Byte *src, UInt32 inSize, Byte *dest, SizeT &destLen);
+};
+
+class CBlocksUnpacker;
+
+Z7_CLASS_IMP_CHandler_IInArchive_2(
+  IInArchiveGetStream,
+  ISetProperties
 )
   bool _noPropsLZMA;
   bool _needCheckLzma;
@@ -860,7 +897,7 @@ Z7_CLASS_IMP_CHandler_IInArchive_1(
   IArchiveOpenCallback *_openCallback;
 
   UInt32 _openCodePage;
-  int _nodeIndex;
+  CDecoderMethodProps _props;
   CRecordVector<bool> _blockCompressed;
   CRecordVector<UInt64> _blockOffsets;
   
@@ -875,12 +912,18 @@ Z7_CLASS_IMP_CHandler_IInArchive_1(
 
   // CMyComPtr2<ICompressCoder, NCompress::NLzma::CDecoder> _lzmaDecoder;
   CMyComPtr2<ICompressCoder, NCompress::NZlib::CDecoder> _zlibDecoder;
-  
-  CXzUnpacker _xz;
-  CZstdDecHandle _zstd;
+  CBlockDecoder _blockDecoder;
 
   CByteBuffer _inputBuffer;
 
+  #ifndef Z7_ST
+  /* (_cs) protects the archive stream and the unpacking state of handler.
+     CSquashfsInStream can call ReadBlock() from prefetch thread. */
+  NWindows::NSynchronization::CCriticalSection _cs;
+  #endif
+
+  friend class CBlocksUnpacker;
+
   void ClearCache()
   {
     _cachedBlockStartPos = 0;
@@ -893,6 +936,7 @@ Z7_CLASS_IMP_CHandler_IInArchive_1(
     return InStream_SeekSet(_stream, offset);
   }
 
+  UInt32 GetBlockMethod(Byte firstByte);
   HRESULT Decompress(ISequentialOutStream *outStream, Byte *outBuf, bool *outBufWasWritten, UInt32 *outBufWasWrittenSize,
       UInt32 inSize, UInt32 outSizeMax);
   HRESULT ReadMetadataBlock(UInt32 &packSize);
@@ -905,26 +949,16 @@ Z7_CLASS_IMP_CHandler_IInArchive_1(
   HRESULT Open2(IInStream *inStream);
   AString GetPath(unsigned index) const;
   bool GetPackSize(unsigned index, UInt64 &res, bool fillOffsets);
+  void Clear();
 
 public:
-  CHandler();
-  ~CHandler()
-  {
-    XzUnpacker_Free(&_xz);
-    if (_zstd)
-      ZstdDec_Destroy(_zstd);
-  }
-
-  HRESULT ReadBlock(UInt64 blockIndex, Byte *dest, size_t blockSize);
+  HRESULT ReadBlock(const CNode &node,
+      const CRecordVector<bool> &blockCompressed,
+      const CRecordVector<UInt64> &blockOffsets,
+      UInt64 blockIndex, Byte *dest, size_t blockSize);
 };
 
 
-CHandler::CHandler():
-    _zstd(NULL)
-{
-  XzUnpacker_Construct(&_xz, &g_Alloc);
-}
-
 static const Byte kProps[] =
 {
   kpidPath,
@@ -1114,34 +1148,173 @@ static HRESULT LzoDecode(Byte *dest, SizeT *destLen, const Byte *src, SizeT *src
   }
 }
 
-HRESULT CHandler::Decompress(ISequentialOutStream *outStream, Byte *outBuf, bool *outBufWasWritten, UInt32 *outBufWasWrittenSize, UInt32 inSize, UInt32 outSizeMax)
+HRESULT CBlockDecoder::Decode(UInt32 method, bool noPropsLZMA, UInt32 lzmaDicSize,
+    const Byte *src, UInt32 inSize, Byte *dest, SizeT &destLen)
 {
-  if (outBuf)
+  const SizeT outSizeMax = destLen;
+  SizeT srcLen = inSize;
+
+  if (method == kMethod_ZLIB)
   {
-    *outBufWasWritten = false;
-    *outBufWasWrittenSize = 0;
+    CMyComPtr2_Create<ISequentialInStream, CBufInStream> inStream;
+    inStream->Init(src, inSize);
+    CMyComPtr2_Create<ISequentialOutStream, CBufPtrSeqOutStream> outStream;
+    outStream->Init(dest, outSizeMax);
+    ZlibDecoder.Create_if_Empty();
+    RINOK(ZlibDecoder.Interface()->Code(inStream, outStream, NULL, NULL, NULL))
+    if (ZlibDecoder->GetInputProcessedSize() != inSize)
+      return S_FALSE;
+    destLen = outStream->GetPos();
+    return S_OK;
   }
-  UInt32 method = _h.Method;
-  if (_h.SeveralMethods)
+
+  if (method == kMethod_LZO)
   {
-    Byte b;
-    RINOK(ReadStream_FALSE(_stream, &b, 1))
-    RINOK(_stream->Seek(-1, STREAM_SEEK_CUR, NULL))
-    method = (b == 0x5D ? kMethod_LZMA : kMethod_ZLIB);
+    RINOK(LzoDecode(dest, &destLen, src, &srcLen))
+  }
+  else if (method == kMethod_LZMA)
+  {
+    Byte props[5];
+
+    if (noPropsLZMA)
+    {
+      props[0] = 0x5D;
+      SetUi32(&props[1], lzmaDicSize)
+    }
+    else
+    {
+      const UInt32 kPropsSize = LZMA_PROPS_SIZE + 8;
+      if (inSize < kPropsSize)
+        return S_FALSE;
+      memcpy(props, src, LZMA_PROPS_SIZE);
+      UInt64 outSize = GetUi64(src + LZMA_PROPS_SIZE);
+      if (outSize > outSizeMax)
+        return S_FALSE;
+      destLen = (SizeT)outSize;
+      src += kPropsSize;
+      inSize -= kPropsSize;
+      srcLen = inSize;
+    }
+
+    ELzmaStatus status;
+    SRes res = LzmaDecode(dest, &destLen,
+        src, &srcLen,
+        props, LZMA_PROPS_SIZE,
+        LZMA_FINISH_END,
+        &status, &g_Alloc);
+    if (res != 0)
+      return SResToHRESULT(res);
+    if (status != LZMA_STATUS_FINISHED_WITH_MARK
+        && status != LZMA_STATUS_MAYBE_FINISHED_WITHOUT_MARK)
+      return S_FALSE;
   }
+  else if (method == kMethod_ZSTD)
+  {
+    if (!Zstd)
+    {
+      Zstd = ZstdDec_Create(&g_AlignedAlloc, &g_AlignedAlloc);
+      if (!Zstd)
+        return E_OUTOFMEMORY;
+    }
+
+    CZstdDecState state;
+    ZstdDecState_Clear(&state);
 
+    state.inBuf = src;
+    state.inLim = srcLen; //  + 1; for debug
+    // state.outStep = outSizeMax;
+    
+    state.outBuf_fromCaller = dest;
+    state.outBufSize_fromCaller = outSizeMax;
+    // state.mustBeFinished = True;
+
+    ZstdDec_Init(Zstd);
+    SRes sres;
+    for (;;)
+    {
+      sres = ZstdDec_Decode(Zstd, &state);
+      if (sres != SZ_OK)
+        break;
+      if (state.inLim == state.inPos
+          && (state.status == ZSTD_STATUS_NEEDS_MORE_INPUT ||
+              state.status == ZSTD_STATUS_FINISHED_FRAME))
+        break;
+      // sres = sres;
+      // break; // for debug
+    }
+
+    CZstdDecResInfo info;
+    // ZstdDecInfo_Clear(&stat);
+    // stat->InSize = state.inPos;
+    ZstdDec_GetResInfo(Zstd, &state, sres, &info);
+    sres = info.decode_SRes;
+    if (sres == SZ_OK)
+    {
+      if (state.status != ZSTD_STATUS_FINISHED_FRAME
+          // ||stat.UnexpededEnd
+          || info.extraSize != 0
+          || state.inLim != state.inPos)
+        sres = SZ_ERROR_DATA;
+    }
+    if (sres != SZ_OK)
+      return SResToHRESULT(sres);
+    if (state.winPos > outSizeMax)
+      return E_FAIL;
+    // memcpy(dest, state.dic, state.dicPos);
+    destLen = state.winPos;
+  }
+  else
+  {
+    ECoderStatus status;
+    const SRes res = XzUnpacker_CodeFull(&Xz,
+        dest, &destLen,
+        src, &srcLen,
+        CODER_FINISH_END, &status);
+    if (res != 0)
+      return SResToHRESULT(res);
+    if (status != CODER_STATUS_NEEDS_MORE_INPUT || !XzUnpacker_IsStreamWasFinished(&Xz))
+      return S_FALSE;
+  }
+  
+  if (inSize != srcLen)
+    return S_FALSE;
+  return S_OK;
+}
+
+
+UInt32 CHandler::GetBlockMethod(Byte firstByte)
+{
+  UInt32 method = _h.Method;
+  if (_h.SeveralMethods)
+    method = (firstByte == 0x5D ? kMethod_LZMA : kMethod_ZLIB);
   if (method == kMethod_ZLIB && _needCheckLzma)
   {
-    Byte b;
-    RINOK(ReadStream_FALSE(_stream, &b, 1))
-    RINOK(_stream->Seek(-1, STREAM_SEEK_CUR, NULL))
-    if (b == 0)
+    if (firstByte == 0)
     {
       _noPropsLZMA = true;
       method = _h.Method = kMethod_LZMA;
     }
     _needCheckLzma = false;
   }
+  return method;
+}
+
+
+HRESULT CHandler::Decompress(ISequentialOutStream *outStream, Byte *outBuf, bool *outBufWasWritten, UInt32 *outBufWasWrittenSize, UInt32 inSize, UInt32 outSizeMax)
+{
+  if (outBuf)
+  {
+    *outBufWasWritten = false;
+    *outBufWasWrittenSize = 0;
+  }
+  UInt32 method = _h.Method;
+  if (_h.SeveralMethods || (method == kMethod_ZLIB && _needCheckLzma))
+  {
+    Byte b;
+    RINOK(ReadStream_FALSE(_stream, &b, 1))
+    RINOK(_stream->Seek(-1, STREAM_SEEK_CUR, NULL))
+    method = GetBlockMethod(b);
+  }
   
   if (method == kMethod_ZLIB)
   {
@@ -1194,121 +1367,8 @@ HRESULT CHandler::Decompress(ISequentialOutStream *outStream, Byte *outBuf, bool
         return E_OUTOFMEMORY;
     }
     
-    SizeT destLen = outSizeMax, srcLen = inSize;
-
-    if (method == kMethod_LZO)
-    {
-      RINOK(LzoDecode(dest, &destLen, _inputBuffer, &srcLen))
-    }
-    else if (method == kMethod_LZMA)
-    {
-      Byte props[5];
-      const Byte *src = _inputBuffer;
-
-      if (_noPropsLZMA)
-      {
-        props[0] = 0x5D;
-        SetUi32(&props[1], _h.BlockSize)
-      }
-      else
-      {
-        const UInt32 kPropsSize = LZMA_PROPS_SIZE + 8;
-        if (inSize < kPropsSize)
-          return S_FALSE;
-        memcpy(props, src, LZMA_PROPS_SIZE);
-        UInt64 outSize = GetUi64(src + LZMA_PROPS_SIZE);
-        if (outSize > outSizeMax)
-          return S_FALSE;
-        destLen = (SizeT)outSize;
-        src += kPropsSize;
-        inSize -= kPropsSize;
-        srcLen = inSize;
-      }
-
-      ELzmaStatus status;
-      SRes res = LzmaDecode(dest, &destLen,
-          src, &srcLen,
-          props, LZMA_PROPS_SIZE,
-          LZMA_FINISH_END,
-          &status, &g_Alloc);
-      if (res != 0)
-        return SResToHRESULT(res);
-      if (status != LZMA_STATUS_FINISHED_WITH_MARK
-          && status != LZMA_STATUS_MAYBE_FINISHED_WITHOUT_MARK)
-        return S_FALSE;
-    }
-    else if (method == kMethod_ZSTD)
-    {
-      const Byte *src = _inputBuffer;
-
-      if (!_zstd)
-      {
-        _zstd = ZstdDec_Create(&g_AlignedAlloc, &g_AlignedAlloc);
-        if (!_zstd)
-          return E_OUTOFMEMORY;
-      }
-
-      CZstdDecState state;
-      ZstdDecState_Clear(&state);
-
-      state.inBuf = src;
-      state.inLim = srcLen; //  + 1; for debug
-      // state.outStep = outSizeMax;
-      
-      state.outBuf_fromCaller = dest;
-      state.outBufSize_fromCaller = outSizeMax;
-      // state.mustBeFinished = True;
-
-      ZstdDec_Init(_zstd);
-      SRes sres;
-      for (;;)
-      {
-        sres = ZstdDec_Decode(_zstd, &state);
-        if (sres != SZ_OK)
-          break;
-        if (state.inLim == state.inPos
-            && (state.status == ZSTD_STATUS_NEEDS_MORE_INPUT ||
-                state.status == ZSTD_STATUS_FINISHED_FRAME))
-          break;
-        // sres = sres;
-        // break; // for debug
-      }
-
-      CZstdDecResInfo info;
-      // ZstdDecInfo_Clear(&stat);
-      // stat->InSize = state.inPos;
-      ZstdDec_GetResInfo(_zstd, &state, sres, &info);
-      sres = info.decode_SRes;
-      if (sres == SZ_OK)
-      {
-        if (state.status != ZSTD_STATUS_FINISHED_FRAME
-            // ||stat.UnexpededEnd
-            || info.extraSize != 0
-            || state.inLim != state.inPos)
-          sres = SZ_ERROR_DATA;
-      }
-      if (sres != SZ_OK)
-        return SResToHRESULT(sres);
-      if (state.winPos > outSizeMax)
-        return E_FAIL;
-      // memcpy(dest, state.dic, state.dicPos);
-      destLen = state.winPos;
-    }
-    else
-    {
-      ECoderStatus status;
-      const SRes res = XzUnpacker_CodeFull(&_xz,
-          dest, &destLen,
-          _inputBuffer, &srcLen,
-          CODER_FINISH_END, &status);
-      if (res != 0)
-        return SResToHRESULT(res);
-      if (status != CODER_STATUS_NEEDS_MORE_INPUT || !XzUnpacker_IsStreamWasFinished(&_xz))
-        return S_FALSE;
-    }
-    
-    if (inSize != srcLen)
-      return S_FALSE;
+    SizeT destLen = outSizeMax;
+    RINOK(_blockDecoder.Decode(method, _noPropsLZMA, _h.BlockSize, _inputBuffer, inSize, dest, destLen))
     if (outBuf)
     {
       *outBufWasWritten = true;
@@ -1799,7 +1859,8 @@ Z7_COM7F_IMF(CHandler::Open(IInStream *stream, const UInt64 *, IArchiveOpenCallb
 {
   COM_TRY_BEGIN
   {
-    Close();
+    MT_LOCK
+    Clear();
     _limitedInStream->SetStream(stream);
     HRESULT res;
     try
@@ -1809,12 +1870,12 @@ Z7_COM7F_IMF(CHandler::Open(IInStream *stream, const UInt64 *, IArchiveOpenCallb
     }
     catch(...)
     {
-      Close();
+      Clear();
       throw;
     }
     if (res != S_OK)
     {
-      Close();
+      Clear();
       return res;
     }
     _stream = stream;
@@ -1824,6 +1885,13 @@ Z7_COM7F_IMF(CHandler::Open(IInStream *stream, const UInt64 *, IArchiveOpenCallb
 }
 
 Z7_COM7F_IMF(CHandler::Close())
+{
+  MT_LOCK
+  Clear();
+  return S_OK;
+}
+
+void CHandler::Clear()
 {
   _openCodePage = CP_UTF8;
   _sizeCalculated = 0;
@@ -1844,8 +1912,6 @@ Z7_COM7F_IMF(CHandler::Close())
 
   _cachedBlock.Free();
   ClearCache();
-
-  return S_OK;
 }
 
 bool CHandler::GetPackSize(unsigned index, UInt64 &totalPack, bool fillOffsets)
@@ -2119,35 +2185,61 @@ Z7_COM7F_IMF(CHandler::GetProperty(UInt32 index, PROPID propID, PROPVARIANT *val
   COM_TRY_END
 }
 
+/*
+  CSquashfsInStream keeps the block table of file,
+  so the blocks can be unpacked in prefetch thread,
+  while the handler is used for another files.
+*/
+
 class CSquashfsInStream: public CCachedInStream
 {
   HRESULT ReadBlock(UInt64 blockIndex, Byte *dest, size_t blockSize) Z7_override;
 public:
   CHandler *Handler;
+  CMyComPtr<IInArchive> HandlerRef;
+  CNode Node;
+  CRecordVector<bool> BlockCompressed;
+  CRecordVector<UInt64> BlockOffsets;
+
+  #ifndef Z7_ST
+  CSquashfsInStream() { EnablePrefetch(); }
+  ~CSquashfsInStream() { StopPrefetch(); }
+  #endif
 };
 
 HRESULT CSquashfsInStream::ReadBlock(UInt64 blockIndex, Byte *dest, size_t blockSize)
 {
-  return Handler->ReadBlock(blockIndex, dest, blockSize);
+  return Handler->ReadBlock(Node, BlockCompressed, BlockOffsets, blockIndex, dest, blockSize);
 }
 
-HRESULT CHandler::ReadBlock(UInt64 blockIndex, Byte *dest, size_t blockSize)
+HRESULT CHandler::ReadBlock(const CNode &node,
+    const CRecordVector<bool> &blockCompressed,
+    const CRecordVector<UInt64> &blockOffsets,
+    UInt64 blockIndex, Byte *dest, size_t blockSize)
 {
-  const CNode &node = _nodes[_nodeIndex];
+  MT_LOCK
+  // the archive could be closed after GetStream()
+  if (!_stream)
+    return E_FAIL;
+  if (_cachedBlock.Size() != _h.BlockSize)
+  {
+    ClearCache();
+    _cachedBlock.Alloc(_h.BlockSize);
+  }
   UInt64 blockOffset;
   UInt32 packBlockSize;
   UInt32 offsetInBlock = 0;
   bool compressed;
-  if (blockIndex < _blockCompressed.Size())
+  if (blockIndex < blockCompressed.Size())
   {
-    compressed = _blockCompressed[(unsigned)blockIndex];
-    blockOffset = _blockOffsets[(unsigned)blockIndex];
-    packBlockSize = (UInt32)(_blockOffsets[(unsigned)blockIndex + 1] - blockOffset);
+    compressed = blockCompressed[(unsigned)blockIndex];
+    blockOffset = blockOffsets[(unsigned)blockIndex];
+    packBlockSize = (UInt32)(blockOffsets[(unsigned)blockIndex + 1] - blockOffset);
     blockOffset += node.StartBlock;
   }
   else
   {
-    if (!node.ThereAreFrags())
+    if (!node.ThereAreFrags() || node.Frag >= _frags.Size())
       return S_FALSE;
     const CFrag &frag = _frags[node.Frag];
     offsetInBlock = node.Offset;
@@ -2199,6 +2291,137 @@ HRESULT CHandler::ReadBlock(UInt64 blockIndex, Byte *dest, size_t blockSize)
   return S_OK;
 }
 
+/*
+  CBlocksUnpacker unpacks the data blocks of file in several threads.
+  The tail of file in fragment block is unpacked by CHandler::ReadBlock().
+*/
+
+class CBlocksUnpacker Z7_final: public IMtChunkDecoderCallback
+{
+  CObjectVector<CBlockDecoder> _decoders;
+  CByteBuffer _tailBuf;
+  const CNode *_node;
+  UInt64 _packPos;
+  UInt64 _unpackPos;
+
+  HRESULT MtChunk_Read(CMtChunk &chunk) Z7_override;
+  HRESULT MtChunk_Decode(unsigned threadIndex, CMtChunk &chunk) Z7_override;
+  HRESULT MtChunk_Write(CMtChunk &chunk) Z7_override;
+public:
+  CMtChunkDecoder MtDecoder;
+  CHandler *Handler;
+  ISequentialOutStream *OutStream;
+  CLocalProgress *Lps;
+  UInt64 Total_PackSize;
+  UInt64 Total_UnpackSize;
+
+  // it returns S_FALSE for data error, and E_NOTIMPL for unsupported method
+  HRESULT Unpack(unsigned nodeIndex);
+};
+
+
+HRESULT CBlocksUnpacker::MtChunk_Read(CMtChunk &chunk)
+{
+  const unsigned blockIndex = (unsigned)chunk.Index;
+  const UInt64 blockOffset = Handler->_blockOffsets[blockIndex];
+  const UInt32 packBlockSize = (UInt32)(Handler->_blockOffsets[blockIndex + 1] - blockOffset);
+  const UInt32 blockSize = Handler->_h.BlockSize;
+  {
+    const UInt64 rem = _node->FileSize - ((UInt64)blockIndex << Handler->_h.BlockSizeLog);
+    chunk.UnpackSize = (rem < blockSize ? (size_t)rem : blockSize);
+  }
+  chunk.PackSize = packBlockSize;
+  chunk.Param = 0;
+  if (packBlockSize == 0)
+    return S_OK;
+  const bool compressed = Handler->_blockCompressed[blockIndex];
+  if (!compressed && packBlockSize > blockSize)
+    return S_FALSE;
+  chunk.PackBuf.AllocAtLeast(packBlockSize);
+  if (!chunk.PackBuf.IsAllocated())
+    return E_OUTOFMEMORY;
+  #ifndef Z7_ST
+  NWindows::NSynchronization::CCriticalSectionLock lock(Handler->_cs);
+  #endif
+  RINOK(Handler->Seek2(blockOffset + _node->StartBlock))
+  RINOK(ReadStream_FALSE(Handler->_stream, chunk.PackBuf, packBlockSize))
+  if (compressed)
+    chunk.Param = Handler->GetBlockMethod(chunk.PackBuf[0]);
+  return S_OK;
+}
+
+
+HRESULT CBlocksUnpacker::MtChunk_Decode(unsigned threadIndex, CMtChunk &chunk)
+{
+  const UInt32 blockSize = Handler->_h.BlockSize;
+  chunk.UnpackBuf.AllocAtLeast(blockSize);
+  if (!chunk.UnpackBuf.IsAllocated())
+    return E_OUTOFMEMORY;
+  if (chunk.PackSize == 0)
+  {
+    // sparse file
+    memset(chunk.UnpackBuf, 0, chunk.UnpackSize);
+    return S_OK;
+  }
+  if (chunk.Param == 0)
+  {
+    if (chunk.PackSize < chunk.UnpackSize)
+      return S_FALSE;
+    memcpy(chunk.UnpackBuf, chunk.PackBuf, chunk.UnpackSize);
+    return S_OK;
+  }
+  SizeT destLen = blockSize;
+  RINOK(_decoders[threadIndex].Decode(chunk.Param, Handler->_noPropsLZMA, blockSize,
+      chunk.PackBuf, (UInt32)chunk.PackSize, chunk.UnpackBuf, destLen))
+  if (destLen < chunk.UnpackSize)
+    return S_FALSE;
+  return S_OK;
+}
+
+
+HRESULT CBlocksUnpacker::MtChunk_Write(CMtChunk &chunk)
+{
+  RINOK(chunk.Res)
+  if (OutStream)
+  {
+    RINOK(WriteStream(OutStream, chunk.UnpackBuf, chunk.UnpackSize))
+  }
+  _packPos += chunk.PackSize;
+  _unpackPos += chunk.UnpackSize;
+  Lps->InSize = Total_PackSize + _packPos;
+  Lps->OutSize = Total_UnpackSize + _unpackPos;
+  return Lps->SetCur();
+}
+
+
+HRESULT CBlocksUnpacker::Unpack(unsigned nodeIndex)
+{
+  _node = &Handler->_nodes[nodeIndex];
+  _packPos = 0;
+  _unpackPos = 0;
+  while (_decoders.Size() < MtDecoder.NumThreads)
+    _decoders.AddNew();
+  const unsigned numBlocks = Handler->_blockCompressed.Size();
+  RINOK(MtDecoder.Decode(this, numBlocks))
+  const UInt64 rem = _node->FileSize - _unpackPos;
+  if (rem != 0)
+  {
+    // the tail in fragment block
+    const UInt32 blockSize = Handler->_h.BlockSize;
+    if (rem > blockSize)
+      return S_FALSE;
+    _tailBuf.AllocAtLeast(blockSize);
+    RINOK(Handler->ReadBlock(*_node, Handler->_blockCompressed, Handler->_blockOffsets,
+        numBlocks, _tailBuf, (size_t)rem))
+    if (OutStream)
+    {
+      RINOK(WriteStream(OutStream, _tailBuf, (size_t)rem))
+    }
+  }
+  return S_OK;
+}
+
+
 Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
     Int32 testMode, IArchiveExtractCallback *extractCallback))
 {
@@ -2225,6 +2448,12 @@ Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
   lps->Init(extractCallback, false);
   CMyComPtr2_Create<ICompressCoder, NCompress::CCopyCoder> copyCoder;
 
+  CBlocksUnpacker unpacker;
+  unpacker.Handler = this;
+  unpacker.Lps = lps.ClsPtr();
+  // each thread keeps packed and unpacked block, and the decoder can use dictionary of block size
+  unpacker.MtDecoder.NumThreads = _props.Get_NumThreads_for_MemUsage((UInt64)_h.BlockSize * 3);
+
   for (i = 0;; i++)
   {
     lps->InSize = totalPackSize;
@@ -2262,6 +2491,25 @@ Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
     RINOK(extractCallback->PrepareOperation(askMode))
 
     res = NExtract::NOperationResult::kDataError;
+
+    if (unpacker.MtDecoder.NumThreads > 1
+        && !node.IsLink()
+        && node.FileSize != 0
+        && GetPackSize(index, packSize, true)
+        && _blockCompressed.Size() > 1)
+    {
+      unpacker.OutStream = outStream;
+      unpacker.Total_PackSize = totalPackSize - packSize;
+      unpacker.Total_UnpackSize = totalSize - unpackSize;
+      const HRESULT hres = unpacker.Unpack(item.Node);
+      if (hres == S_OK)
+        res = NExtract::NOperationResult::kOK;
+      else if (hres == E_NOTIMPL)
+        res = NExtract::NOperationResult::kUnsupportedMethod;
+      else if (hres != S_FALSE)
+        return hres;
+    }
+    else
     {
       CMyComPtr<ISequentialInStream> inSeqStream;
       HRESULT hres = GetStream(index, &inSeqStream);
@@ -2301,6 +2549,12 @@ Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
 }
 
 
+Z7_COM7F_IMF(CHandler::SetProperties(const wchar_t * const *names, const PROPVARIANT *values, UInt32 numProps))
+{
+  return _props.SetProperties(names, values, numProps);
+}
+
+
 Z7_COM7F_IMF(CHandler::GetStream(UInt32 index, ISequentialInStream **stream))
 {
   COM_TRY_BEGIN
@@ -2329,18 +2583,13 @@ Z7_COM7F_IMF(CHandler::GetStream(UInt32 index, ISequentialInStream **stream))
   if (!GetPackSize(index, packSize, true))
     return S_FALSE;
 
-  _nodeIndex = item.Node;
-
-  size_t cacheSize = _h.BlockSize;
-  if (_cachedBlock.Size() != cacheSize)
-  {
-    ClearCache();
-    _cachedBlock.Alloc(cacheSize);
-  }
-
   CSquashfsInStream *streamSpec = new CSquashfsInStream;
   CMyComPtr<IInStream> streamTemp = streamSpec;
   streamSpec->Handler = this;
+  streamSpec->HandlerRef = this;
+  streamSpec->Node = node;
+  streamSpec->BlockCompressed = _blockCompressed;
+  streamSpec->BlockOffsets = _blockOffsets;
   unsigned cacheSizeLog = 22;
   if (cacheSizeLog <= _h.BlockSizeLog)
     cacheSizeLog = _h.BlockSizeLog + 1;
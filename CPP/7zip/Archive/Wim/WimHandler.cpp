@@ -1061,6 +1061,9 @@ Z7_COM7F_IMF(CHandler::Extract(const UInt32 *indices, UInt32 numItems,
   int prevSuccessStreamIndex = -1;
 
   CUnpacker unpacker;
+  #ifndef Z7_ST
+  unpacker.SetNumThreads(_numThreads);
+  #endif
 
   CMyComPtr2_Create<ICompressProgressInfo, CLocalProgress> lps;
   lps->Init(extractCallback, false);
@@ -1193,6 +1196,23 @@ Z7_COM7F_IMF(CHandler::SetProperties(const wchar_t * const *names, const PROPVAR
       // some clients write 'x' property. So we support it
       UInt32 level = 0;
       RINOK(ParsePropToUInt32(name.Ptr(1), prop, level))
+      _level = level;
+    }
+    else if (name.IsEqualTo("m") || name.IsEqualTo("0"))
+    {
+      if (prop.vt != VT_BSTR)
+        return E_INVALIDARG;
+      const UString m = prop.bstrVal;
+      if (m.IsEqualTo_Ascii_NoCase("copy"))
+        _method = 0;
+      else if (m.IsEqualTo_Ascii_NoCase("xpress"))
+        _method = NMethod::kXPRESS;
+      else if (m.IsEqualTo_Ascii_NoCase("lzx"))
+        _method = NMethod::kLZX;
+      else if (m.IsEqualTo_Ascii_NoCase("lzms"))
+        return E_NOTIMPL; // we have no LZMS encoder
+      else
+        return E_INVALIDARG;
     }
     else if (name.IsEqualTo("is"))
     {
@@ -1207,6 +1227,11 @@ Z7_COM7F_IMF(CHandler::SetProperties(const wchar_t * const *names, const PROPVAR
     }
     else if (name.IsPrefixedBy_Ascii_NoCase("mt"))
     {
+      #ifndef Z7_ST
+      _numThreads = NWindows::NSystem::GetNumberOfProcessors();
+      bool force = false;
+      RINOK(ParseMtProp2(name.Ptr(2), prop, _numThreads, force))
+      #endif
     }
     else if (name.IsPrefixedBy_Ascii_NoCase("memuse"))
     {
@@ -52,8 +52,19 @@ Z7_CLASS_IMP_CHandler_IInArchive_5(
 
   CHandlerTimeOptions _timeOptions;
 
+  UInt32 _level;
+  unsigned _method;  // NMethod::kXPRESS, NMethod::kLZX or 0 (copy)
+  #ifndef Z7_ST
+  UInt32 _numThreads;
+  #endif
+
   void InitDefaults()
   {
+    _level = 5;
+    _method = 0;
+    #ifndef Z7_ST
+    _numThreads = NWindows::NSystem::GetNumberOfProcessors();
+    #endif
     _disable_Sha1Check = false;
     _set_use_ShowImageNumber = false;
     _set_showImageNumber = false;
@@ -2,6 +2,12 @@
 
 #include "StdAfx.h"
 
+#include "../../../../C/Alloc.h"
+#ifndef Z7_ST
+#include "../../../../C/MtCoder.h"
+#endif
+
+#include "../../../Common/AutoPtr.h"
 #include "../../../Common/ComTry.h"
 #include "../../../Common/IntToString.h"
 #include "../../../Common/MyBuffer2.h"
@@ -12,11 +18,15 @@
 #include "../../../Windows/PropVariant.h"
 #include "../../../Windows/TimeUtils.h"
 
+#include "../../Common/CWrappers.h"
 #include "../../Common/LimitedStreams.h"
 #include "../../Common/ProgressUtils.h"
 #include "../../Common/StreamUtils.h"
 #include "../../Common/UniqBlocks.h"
 
+#include "../../Compress/LzxEncoder.h"
+#include "../../Compress/XpressEncoder.h"
+
 #include "../../Crypto/RandGen.h"
 #include "../../Crypto/Sha1Cls.h"
 
@@ -658,14 +668,16 @@ static void AddTag_String_IfEmpty(CXmlItem &parentItem, const char *name, const
 }
 
 
-void CHeader::SetDefaultFields(bool useLZX)
+void CHeader::SetDefaultFields(unsigned method)
 {
   Version = k_Version_NonSolid;
   Flags = NHeaderFlags::kReparsePointFixup;
   ChunkSize = 0;
-  if (useLZX)
+  if (method != 0)
   {
-    Flags |= NHeaderFlags::kCompression | NHeaderFlags::kLZX;
+    Flags |= NHeaderFlags::kCompression | (method == NMethod::kLZX ?
+        NHeaderFlags::kLZX :
+        NHeaderFlags::kXPRESS);
     ChunkSize = kChunkSize;
     ChunkSizeBits = kChunkSizeBits;
   }
@@ -688,6 +700,295 @@ static void AddTrees(CObjectVector<CDir> &trees, CObjectVector<CMetaItem> &metaI
 }
 
 
+/*
+  CChunksEncoder writes the compressed (XPRESS or LZX) resource:
+    the table of chunk offsets, and then chunks.
+  WIM chunks are independent, so we compress the blocks of chunks in threads with MtCoder.
+  The size of stream must be known before writing, and the table is written after data.
+*/
+
+static const unsigned kNumChunksInBlock_Log = 5;
+
+struct CChunksBlock
+{
+  CMidBuffer Buf;
+  size_t Size;
+  unsigned NumChunks;
+  UInt32 ChunkSizes[1 << kNumChunksInBlock_Log];
+};
+
+struct CChunkCoder
+{
+  NCompress::NXpress::CEncoder Xpress;
+  NCompress::NLzx::CEncoder Lzx;
+
+  void SetLevel(UInt32 level)
+  {
+    Xpress.SetLevel(level);
+    Lzx.SetLevel(level);
+  }
+};
+
+class CChunksEncoder
+{
+  unsigned _chunkSizeBits;
+  unsigned _method;
+  UInt32 _level;
+  UInt32 _numThreads;
+  HRESULT _writeRes;
+  ISequentialOutStream *_outStream;
+  UInt64 _packSize;
+  CRecordVector<UInt64> _chunkOffsets;
+  CObjectVector<CChunkCoder> _encoders;
+  CObjectVector<CChunksBlock> _blocks;
+  #ifndef Z7_ST
+  CMtCoder _mtCoder;
+  #endif
+
+  size_t GetBlockSize() const { return (size_t)1 << (_chunkSizeBits + kNumChunksInBlock_Log); }
+  HRESULT WriteBlock(const CChunksBlock &block);
+public:
+  void EncodeBlock(unsigned coderIndex, CChunksBlock &block, const Byte *src, size_t srcSize);
+
+  #ifndef Z7_ST
+  static SRes MtCallback_Code(void *pp, unsigned coderIndex, unsigned outBufIndex,
+      const Byte *src, size_t srcSize, int finished);
+  static SRes MtCallback_Write(void *pp, unsigned outBufIndex);
+  #endif
+
+  CChunksEncoder(unsigned method, unsigned chunkSizeBits, UInt32 level, UInt32 numThreads);
+  ~CChunksEncoder();
+
+  HRESULT Encode(ISequentialInStream *inStream, IOutStream *outStream,
+      UInt64 unpackSize, ICompressProgressInfo *progress,
+      UInt64 &packSizeRes, UInt64 &unpackSizeRes);
+};
+
+
+CChunksEncoder::CChunksEncoder(unsigned method, unsigned chunkSizeBits, UInt32 level, UInt32 numThreads):
+    _chunkSizeBits(chunkSizeBits),
+    _method(method),
+    _level(level),
+    _numThreads(numThreads)
+{
+  #ifndef Z7_ST
+  if (_numThreads > MTCODER_THREADS_MAX)
+    _numThreads = MTCODER_THREADS_MAX;
+  MtCoder_Construct(&_mtCoder);
+  #else
+  _numThreads = 1;
+  #endif
+  const unsigned numEncoders = (unsigned)_numThreads;
+  for (unsigned i = 0; i < numEncoders; i++)
+    _encoders.AddNew().SetLevel(level);
+}
+
+CChunksEncoder::~CChunksEncoder()
+{
+  #ifndef Z7_ST
+  MtCoder_Destruct(&_mtCoder);
+  #endif
+}
+
+
+void CChunksEncoder::EncodeBlock(unsigned coderIndex, CChunksBlock &block, const Byte *src, size_t srcSize)
+{
+  CChunkCoder &enc = _encoders[coderIndex];
+  const size_t chunkSize = (size_t)1 << _chunkSizeBits;
+  block.Size = 0;
+  block.NumChunks = 0;
+  for (size_t pos = 0; pos < srcSize;)
+  {
+    size_t cur = srcSize - pos;
+    if (cur > chunkSize)
+      cur = chunkSize;
+    Byte *dest = block.Buf + block.Size;
+    size_t packSize = (_method == NMethod::kLZX) ?
+        enc.Lzx.Encode(src + pos, cur, dest, cur) :
+        enc.Xpress.Encode(src + pos, cur, dest, cur);
+    if (packSize == 0)
+    {
+      // the chunk is stored, if (packSize == unpackSize)
+      memcpy(dest, src + pos, cur);
+      packSize = cur;
+    }
+    block.ChunkSizes[block.NumChunks++] = (UInt32)packSize;
+    block.Size += packSize;
+    pos += cur;
+  }
+}
+
+
+HRESULT CChunksEncoder::WriteBlock(const CChunksBlock &block)
+{
+  for (unsigned i = 0; i < block.NumChunks; i++)
+  {
+    _chunkOffsets.Add(_packSize);
+    _packSize += block.ChunkSizes[i];
+  }
+  return WriteStream(_outStream, block.Buf, block.Size);
+}
+
+
+#ifndef Z7_ST
+
+SRes CChunksEncoder::MtCallback_Code(void *pp, unsigned coderIndex, unsigned outBufIndex,
+    const Byte *src, size_t srcSize, int /* finished */)
+{
+  CChunksEncoder *p = (CChunksEncoder *)pp;
+  try
+  {
+    CChunksBlock &block = p->_blocks[outBufIndex];
+    block.Buf.AllocAtLeast(p->GetBlockSize());
+    if (!block.Buf.IsAllocated())
+      return SZ_ERROR_MEM;
+    p->EncodeBlock(coderIndex, block, src, srcSize);
+  }
+  catch(...) { return SZ_ERROR_MEM; }
+  return SZ_OK;
+}
+
+SRes CChunksEncoder::MtCallback_Write(void *pp, unsigned outBufIndex)
+{
+  CChunksEncoder *p = (CChunksEncoder *)pp;
+  const HRESULT res = p->WriteBlock(p->_blocks[outBufIndex]);
+  if (res == S_OK)
+    return SZ_OK;
+  p->_writeRes = res;
+  return SZ_ERROR_WRITE;
+}
+
+#endif
+
+
+HRESULT CChunksEncoder::Encode(ISequentialInStream *inStream, IOutStream *outStream,
+    UInt64 unpackSize, ICompressProgressInfo *progress,
+    UInt64 &packSizeRes, UInt64 &unpackSizeRes)
+{
+  packSizeRes = 0;
+  unpackSizeRes = 0;
+  _outStream = outStream;
+  _writeRes = S_OK;
+  _packSize = 0;
+  _chunkOffsets.Clear();
+
+  const UInt64 numChunks = (unpackSize + ((UInt32)1 << _chunkSizeBits) - 1) >> _chunkSizeBits;
+  if (numChunks == 0)
+    return E_INVALIDARG;
+  const unsigned entrySizeShifts = (unpackSize < ((UInt64)1 << 32) ? 2 : 3);
+  const UInt64 tableSize = (numChunks - 1) << entrySizeShifts;
+
+  UInt64 startPos;
+  RINOK(outStream->Seek(0, STREAM_SEEK_CUR, &startPos))
+  {
+    // we reserve the space for the table
+    const size_t kBufSize = 1 << 12;
+    Byte buf[kBufSize];
+    memset(buf, 0, kBufSize);
+    for (UInt64 rem = tableSize; rem != 0;)
+    {
+      const size_t cur = rem < kBufSize ? (size_t)rem : kBufSize;
+      RINOK(WriteStream(outStream, buf, cur))
+      rem -= cur;
+    }
+  }
+
+  const size_t blockSize = GetBlockSize();
+
+  #ifndef Z7_ST
+  if (_numThreads > 1 && unpackSize > blockSize)
+  {
+    CSeqInStreamWrap inWrap;
+    CCompressProgressWrap progressWrap;
+    inWrap.Init(inStream);
+    progressWrap.Init(progress);
+
+    while (_blocks.Size() < MTCODER_BLOCKS_MAX)
+      _blocks.AddNew();
+
+    IMtCoderCallback2 vt;
+    vt.Code = MtCallback_Code;
+    vt.Write = MtCallback_Write;
+
+    _mtCoder.allocBig = &g_BigAlloc;
+    _mtCoder.progress = progress ? &progressWrap.vt : NULL;
+    _mtCoder.inStream = &inWrap.vt;
+    _mtCoder.inData = NULL;
+    _mtCoder.inDataSize = 0;
+    _mtCoder.mtCallback = &vt;
+    _mtCoder.mtCallbackObject = this;
+    _mtCoder.blockSize = blockSize;
+    _mtCoder.numThreadsMax = (unsigned)_numThreads;
+    _mtCoder.expectedDataSize = unpackSize;
+
+    const SRes res = MtCoder_Code(&_mtCoder);
+    RINOK(inWrap.Res)
+    RINOK(_writeRes)
+    if (res != SZ_OK && progressWrap.Res != S_OK)
+      return progressWrap.Res;
+    RINOK(SResToHRESULT(res))
+    unpackSizeRes = inWrap.Processed;
+  }
+  else
+  #endif
+  {
+    if (_blocks.IsEmpty())
+      _blocks.AddNew();
+    CChunksBlock &block = _blocks[0];
+    CMidBuffer inBuf;
+    inBuf.Alloc(blockSize);
+    block.Buf.AllocAtLeast(blockSize);
+    if (!inBuf.IsAllocated() || !block.Buf.IsAllocated())
+      return E_OUTOFMEMORY;
+    for (;;)
+    {
+      size_t size = blockSize;
+      RINOK(ReadStream(inStream, inBuf, &size))
+      if (size == 0)
+        break;
+      EncodeBlock(0, block, inBuf, size);
+      RINOK(WriteBlock(block))
+      unpackSizeRes += size;
+      if (progress)
+      {
+        RINOK(progress->SetRatioInfo(&unpackSizeRes, &_packSize))
+      }
+      if (size != blockSize)
+        break;
+    }
+  }
+
+  if (unpackSizeRes != unpackSize || _chunkOffsets.Size() != numChunks)
+    return S_OK;
+  
+  {
+    RINOK(outStream->Seek((Int64)startPos, STREAM_SEEK_SET, NULL))
+    const size_t kBufSize = 1 << 12;
+    Byte buf[kBufSize];
+    size_t pos = 0;
+    for (unsigned i = 1; i < _chunkOffsets.Size(); i++)
+    {
+      const UInt64 v = _chunkOffsets[i];
+      if (entrySizeShifts == 2)
+        SetUi32(buf + pos, (UInt32)v)
+      else
+        SetUi64(buf + pos, v)
+      pos += (size_t)1 << entrySizeShifts;
+      if (pos == kBufSize)
+      {
+        RINOK(WriteStream(outStream, buf, pos))
+        pos = 0;
+      }
+    }
+    RINOK(WriteStream(outStream, buf, pos))
+    RINOK(outStream->Seek((Int64)(startPos + tableSize + _packSize), STREAM_SEEK_SET, NULL))
+  }
+
+  packSizeRes = tableSize + _packSize;
+  return S_OK;
+}
+
+
 #define IS_LETTER_CHAR(c) (((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z'))
 
 
@@ -1359,7 +1660,7 @@ Z7_COM7F_IMF(CHandler::UpdateItems(ISequentialOutStream *outSeqStream, UInt32 nu
   // use useResourceCompression only if CHeader::Flags compression is also set
 
   CHeader header;
-  header.SetDefaultFields(false);
+  header.SetDefaultFields(_method);
 
   if (isUpdate)
   {
@@ -1368,8 +1669,33 @@ Z7_COM7F_IMF(CHandler::UpdateItems(ISequentialOutStream *outSeqStream, UInt32 nu
     header.Version = srcHeader.Version;
     header.ChunkSize = srcHeader.ChunkSize;
     header.ChunkSizeBits = srcHeader.ChunkSizeBits;
+    if (_method != 0 && !srcHeader.IsCompressed())
+    {
+      // old resources are not compressed, so we can set new method
+      header.Flags |= NHeaderFlags::kCompression | (_method == NMethod::kLZX ?
+          NHeaderFlags::kLZX :
+          NHeaderFlags::kXPRESS);
+      header.ChunkSize = kChunkSize;
+      header.ChunkSizeBits = kChunkSizeBits;
+    }
   }
 
+  // new data streams can be compressed only with XPRESS or LZX (32 KiB window)
+  CMyUniquePtr<CChunksEncoder> chunksEncoder(
+      (_method != 0
+        && header.GetMethod() == _method
+        && header.ChunkSize == ((UInt32)1 << header.ChunkSizeBits)
+        && header.ChunkSize <= (_method == NMethod::kLZX ?
+            NCompress::NLzx::kEncoderChunkSizeMax :
+            NCompress::NXpress::kEncoderChunkSizeMax)) ?
+      new CChunksEncoder(_method, header.ChunkSizeBits, _level,
+        #ifndef Z7_ST
+          _numThreads
+        #else
+          1
+        #endif
+        ) : NULL);
+
   CMyComPtr<IStreamSetRestriction> setRestriction;
   outSeqStream->QueryInterface(IID_IStreamSetRestriction, (void **)&setRestriction);
   if (setRestriction)
@@ -1697,10 +2023,31 @@ Z7_COM7F_IMF(CHandler::UpdateItems(ISequentialOutStream *outSeqStream, UInt32 nu
           }
         }
         
-        if (needWritePass)
+        UInt64 packSize = 0;
+        bool isCompressed = false;
+
+        if (needWritePass && chunksEncoder.get() && inSeekStream && size != 0)
+        {
+          // the size is known from first pass
+          UInt64 unpackSize;
+          RINOK(chunksEncoder->Encode(inShaStream, outStream, size, lps, packSize, unpackSize))
+          if (packSize != 0)
+            isCompressed = true;
+          else
+          {
+            // the size of stream was changed after first pass
+            RINOK(outStream->Seek((Int64)curPos, STREAM_SEEK_SET, NULL))
+            RINOK(outStream->SetSize(curPos))
+            RINOK(InStream_SeekToBegin(inSeekStream))
+            inShaStream->Init();
+          }
+        }
+
+        if (needWritePass && !isCompressed)
         {
           RINOK(copyCoder.Interface()->Code(inShaStream, outStream, NULL, NULL, lps))
           size = copyCoder->TotalSize;
+          packSize = offsetBlockSize + size;
         }
        
         if (size != 0)
@@ -1708,7 +2055,6 @@ Z7_COM7F_IMF(CHandler::UpdateItems(ISequentialOutStream *outSeqStream, UInt32 nu
           if (needWritePass)
           {
             Byte hash[kHashSize];
-            const UInt64 packSize = offsetBlockSize + size;
             inShaStream->Final(hash);
             
             index = AddUniqHash(streams.ConstData(), sortedHashes, hash, (int)streams.Size());
@@ -1727,10 +2073,8 @@ Z7_COM7F_IMF(CHandler::UpdateItems(ISequentialOutStream *outSeqStream, UInt32 nu
               s.Resource.Offset = curPos;
               s.Resource.UnpackSize = size;
               s.Resource.Flags = 0;
-              /*
-              if (useResourceCompression)
-              s.Resource.Flags = NResourceFlags::Compressed;
-              */
+              if (isCompressed)
+                s.Resource.Flags = NResourceFlags::kCompressed;
               s.PartNumber = 1;
               s.RefCount = 1;
               memcpy(s.Hash, hash, kHashSize);
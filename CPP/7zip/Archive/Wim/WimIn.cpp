@@ -50,41 +50,73 @@ static bool inline GetLog_val_min_dest(const UInt32 val, unsigned i, unsigned &d
 }
 
 
-HRESULT CUnpacker::UnpackChunk(
-    ISequentialInStream *inStream,
-    unsigned method, unsigned chunkSizeBits,
-    size_t inSize, size_t outSize,
-    ISequentialOutStream *outStream)
+static const unsigned kChunkInputPadSize = 32;
+static const unsigned kChunkOutputPadSize = MyMax(
+    NCompress::NLzx::kAdditionalOutputBufSize,
+    NCompress::NXpress::kAdditionalOutputBufSize);
+
+HRESULT CChunkDecoders::Decode(unsigned method, unsigned chunkSizeBits,
+    Byte *packData, size_t inSize,
+    Byte *unpackData, size_t outSize, size_t &unpackedSize)
 {
-  if (inSize == outSize)
-  {
-  }
-  else if (method == NMethod::kXPRESS)
+  unpackedSize = 0;
+  memset(packData + inSize, 0xff, kChunkInputPadSize);
+  
+  if (method == NMethod::kXPRESS)
   {
+    const HRESULT res = NCompress::NXpress::Decode_WithExceedWrite(packData, inSize, unpackData, outSize);
+    if (res == S_OK)
+      unpackedSize = outSize;
+    return res;
   }
-  else if (method == NMethod::kLZX)
+  
+  if (method == NMethod::kLZX)
   {
     lzxDecoder.Create_if_Empty();
     lzxDecoder->Set_WimMode(true);
+    HRESULT res = lzxDecoder->Set_ExternalWindow_DictBits(unpackData, chunkSizeBits);
+    if (res != S_OK)
+      return E_NOTIMPL;
+    lzxDecoder->Set_KeepHistoryForNext(false);
+    lzxDecoder->Set_KeepHistory(false);
+    res = lzxDecoder->Code_WithExceedReadWrite(packData, inSize, (UInt32)outSize);
+    unpackedSize = lzxDecoder->GetUnpackSize();
+    if (res == S_OK && !lzxDecoder->WasBlockFinished())
+      res = S_FALSE;
+    return res;
   }
-  else if (method == NMethod::kLZMS)
-  {
-    lzmsDecoder.Create_if_Empty();
-  }
-  else
+  
+  if (method != NMethod::kLZMS)
+    return E_NOTIMPL;
+  lzmsDecoder.Create_if_Empty();
+  const HRESULT res = lzmsDecoder->Code(packData, inSize, unpackData, outSize);
+  unpackedSize = lzmsDecoder->GetUnpackSize();
+  return res;
+}
+
+
+static bool IsSupportedMethod(unsigned method)
+{
+  return method == NMethod::kXPRESS
+      || method == NMethod::kLZX
+      || method == NMethod::kLZMS;
+}
+
+
+HRESULT CUnpacker::UnpackChunk(
+    ISequentialInStream *inStream,
+    unsigned method, unsigned chunkSizeBits,
+    size_t inSize, size_t outSize,
+    ISequentialOutStream *outStream)
+{
+  if (inSize != outSize && !IsSupportedMethod(method))
     return E_NOTIMPL;
 
   const size_t chunkSize = (size_t)1 << chunkSizeBits;
 
-  {
-    const unsigned
-        kAdditionalOutputBufSize = MyMax(NCompress::NLzx::
-        kAdditionalOutputBufSize,        NCompress::NXpress::
-        kAdditionalOutputBufSize);
-    unpackBuf.EnsureCapacity(chunkSize + kAdditionalOutputBufSize);
-    if (!unpackBuf.Data)
-      return E_OUTOFMEMORY;
-  }
+  unpackBuf.EnsureCapacity(chunkSize + kChunkOutputPadSize);
+  if (!unpackBuf.Data)
+    return E_OUTOFMEMORY;
   
   HRESULT res = S_FALSE;
   size_t unpackedSize = 0;
@@ -97,39 +129,15 @@ HRESULT CUnpacker::UnpackChunk(
   }
   else if (inSize < chunkSize)
   {
-    const unsigned kAdditionalInputSize = 32;
-    packBuf.EnsureCapacity(chunkSize + kAdditionalInputSize);
+    packBuf.EnsureCapacity(chunkSize + kChunkInputPadSize);
     if (!packBuf.Data)
       return E_OUTOFMEMORY;
     
     RINOK(ReadStream_FALSE(inStream, packBuf.Data, inSize))
-    memset(packBuf.Data + inSize, 0xff, kAdditionalInputSize);
 
     TotalPacked += inSize;
     
-    if (method == NMethod::kXPRESS)
-    {
-      res = NCompress::NXpress::Decode_WithExceedWrite(packBuf.Data, inSize, unpackBuf.Data, outSize);
-      if (res == S_OK)
-        unpackedSize = outSize;
-    }
-    else if (method == NMethod::kLZX)
-    {
-      res = lzxDecoder->Set_ExternalWindow_DictBits(unpackBuf.Data, chunkSizeBits);
-      if (res != S_OK)
-        return E_NOTIMPL;
-      lzxDecoder->Set_KeepHistoryForNext(false);
-      lzxDecoder->Set_KeepHistory(false);
-      res = lzxDecoder->Code_WithExceedReadWrite(packBuf.Data, inSize, (UInt32)outSize);
-      unpackedSize = lzxDecoder->GetUnpackSize();
-      if (res == S_OK && !lzxDecoder->WasBlockFinished())
-        res = S_FALSE;
-    }
-    else
-    {
-      res = lzmsDecoder->Code(packBuf.Data, inSize, unpackBuf.Data, outSize);
-      unpackedSize = lzmsDecoder->GetUnpackSize();
-    }
+    res = decoders.Decode(method, chunkSizeBits, packBuf.Data, inSize, unpackBuf.Data, outSize, unpackedSize);
   }
   
   if (unpackedSize != outSize)
@@ -152,6 +160,130 @@ HRESULT CUnpacker::UnpackChunk(
 }
 
 
+#ifndef Z7_ST
+
+// it unpacks the chunks of non-solid resource in several threads
+
+class CMtChunksUnpacker Z7_final: public IMtChunkDecoderCallback
+{
+public:
+  CUnpacker *Unpacker;
+  IInStream *InStream;
+  ISequentialOutStream *OutStream;
+  ICompressProgressInfo *Progress;
+  const Byte *SizesBuf;
+  UInt64 BaseOffset;
+  UInt64 PackDataSize;
+  UInt64 UnpackSize;
+  size_t NumChunks;
+  unsigned EntrySizeShifts;
+  unsigned Method;
+  unsigned ChunkSizeBits;
+
+  UInt64 PackOffset;
+  UInt64 OutProcessed;
+
+  HRESULT MtChunk_Read(CMtChunk &chunk) Z7_override;
+  HRESULT MtChunk_Decode(unsigned threadIndex, CMtChunk &chunk) Z7_override;
+  HRESULT MtChunk_Write(CMtChunk &chunk) Z7_override;
+};
+
+
+HRESULT CMtChunksUnpacker::MtChunk_Read(CMtChunk &chunk)
+{
+  const size_t i = (size_t)chunk.Index;
+  UInt64 nextOffset = PackDataSize;
+  if (i + 1 < NumChunks)
+  {
+    const Byte *p = SizesBuf + (i << EntrySizeShifts);
+    nextOffset = (EntrySizeShifts == 2) ? Get32(p): Get64(p);
+  }
+  if (nextOffset < PackOffset)
+    return S_FALSE;
+  const UInt64 inSize64 = nextOffset - PackOffset;
+  
+  const size_t chunkSize = (size_t)1 << ChunkSizeBits;
+  size_t outSize = chunkSize;
+  {
+    const UInt64 rem = UnpackSize - ((UInt64)i << ChunkSizeBits);
+    if (outSize > rem)
+      outSize = (size_t)rem;
+  }
+  chunk.UnpackSize = outSize;
+  chunk.PackSize = 0;
+  chunk.Res = S_OK;
+
+  // a chunk that is not smaller than (chunkSize) is unpacked with data error
+  if (inSize64 == outSize || inSize64 < chunkSize)
+  {
+    const size_t inSize = (size_t)inSize64;
+    chunk.PackBuf.AllocAtLeast(chunkSize + kChunkInputPadSize);
+    if (!chunk.PackBuf.IsAllocated())
+      return E_OUTOFMEMORY;
+    RINOK(InStream_SeekSet(InStream, BaseOffset + PackOffset))
+    size_t processed = inSize;
+    RINOK(ReadStream(InStream, chunk.PackBuf, &processed))
+    Unpacker->TotalPacked += processed;
+    chunk.PackSize = processed;
+    if (processed != inSize)
+    {
+      if (inSize != outSize)
+        return S_FALSE;
+      chunk.Res = S_FALSE;
+    }
+  }
+  else
+    chunk.Res = S_FALSE;
+
+  PackOffset = nextOffset;
+  return S_OK;
+}
+
+
+HRESULT CMtChunksUnpacker::MtChunk_Decode(unsigned threadIndex, CMtChunk &chunk)
+{
+  const size_t outSize = chunk.UnpackSize;
+  chunk.UnpackBuf.AllocAtLeast(((size_t)1 << ChunkSizeBits) + kChunkOutputPadSize);
+  if (!chunk.UnpackBuf.IsAllocated())
+    return E_OUTOFMEMORY;
+  
+  HRESULT res = chunk.Res;
+  size_t unpackedSize = 0;
+  
+  if (chunk.PackSize == outSize || res != S_OK)
+  {
+    unpackedSize = chunk.PackSize;
+    memcpy(chunk.UnpackBuf, chunk.PackBuf, unpackedSize);
+  }
+  else
+    res = Unpacker->mtDecoders[threadIndex].Decode(Method, ChunkSizeBits,
+        chunk.PackBuf, chunk.PackSize, chunk.UnpackBuf, outSize, unpackedSize);
+
+  if (unpackedSize != outSize)
+  {
+    if (res == S_OK || unpackedSize > outSize)
+      res = S_FALSE;
+    else
+      memset(chunk.UnpackBuf + unpackedSize, 0, outSize - unpackedSize);
+  }
+  return res;
+}
+
+
+HRESULT CMtChunksUnpacker::MtChunk_Write(CMtChunk &chunk)
+{
+  if (Progress)
+  {
+    RINOK(Progress->SetRatioInfo(&Unpacker->TotalPacked, &OutProcessed))
+  }
+  RINOK(WriteStream(OutStream, chunk.UnpackBuf, chunk.UnpackSize))
+  OutProcessed += chunk.UnpackSize;
+  return chunk.Res;
+}
+
+#endif
+
+
 HRESULT CUnpacker::Unpack2(
     IInStream *inStream,
     const CResource &resource,
@@ -319,6 +451,30 @@ HRESULT CUnpacker::Unpack2(
   _solidIndex = -1;
   _unpackedChunkIndex = 0;
 
+  #ifndef Z7_ST
+  if (mtChunkDecoder.NumThreads > 1 && numChunks > 1)
+  {
+    while (mtDecoders.Size() < mtChunkDecoder.NumThreads)
+      mtDecoders.AddNew();
+    CMtChunksUnpacker mt;
+    mt.Unpacker = this;
+    mt.InStream = inStream;
+    mt.OutStream = outStream;
+    mt.Progress = progress;
+    mt.SizesBuf = sizesBuf;
+    mt.BaseOffset = baseOffset;
+    mt.PackDataSize = packDataSize;
+    mt.UnpackSize = unpackSize;
+    mt.NumChunks = numChunks;
+    mt.EntrySizeShifts = entrySizeShifts;
+    mt.Method = header.GetMethod();
+    mt.ChunkSizeBits = chunkSizeBits;
+    mt.PackOffset = 0;
+    mt.OutProcessed = 0;
+    return mtChunkDecoder.Decode(&mt, numChunks);
+  }
+  #endif
+
   UInt64 outProcessed = 0;
   UInt64 offset = 0;
   
@@ -17,6 +17,8 @@
 
 #include "../IArchive.h"
 
+#include "../Common/MtChunkDecoder.h"
+
 namespace NArchive {
 namespace NWim {
 
@@ -267,7 +269,7 @@ struct CHeader
   CResource MetadataResource;
   CResource IntegrityResource;
 
-  void SetDefaultFields(bool useLZX);
+  void SetDefaultFields(unsigned method);
 
   void WriteTo(Byte *p) const;
   HRESULT Parse(const Byte *p, UInt64 &phySize);
@@ -596,12 +598,32 @@ struct CMidBuf
 };
 
 
-class CUnpacker
+// decoders for one thread
+struct CChunkDecoders
 {
-  CMyComPtr2<ICompressCoder, NCompress::CCopyCoder> copyCoder;
   CMyUniquePtr<NCompress::NLzx::CDecoder> lzxDecoder;
   CMyUniquePtr<NCompress::NLzms::CDecoder> lzmsDecoder;
 
+  CChunkDecoders(): lzmsDecoder(NULL) {}
+
+  /* (packData) and (unpackData) buffers must be allocated with
+     additional sizes (kChunkInputPadSize) and (kChunkOutputPadSize) */
+  HRESULT Decode(unsigned method, unsigned chunkSizeBits,
+      Byte *packData, size_t inSize,
+      Byte *unpackData, size_t outSize, size_t &unpackedSize);
+};
+
+
+class CUnpacker
+{
+  CMyComPtr2<ICompressCoder, NCompress::CCopyCoder> copyCoder;
+  CChunkDecoders decoders;
+  #ifndef Z7_ST
+  CObjectVector<CChunkDecoders> mtDecoders;
+  CMtChunkDecoder mtChunkDecoder;
+  friend class CMtChunksUnpacker;
+  #endif
+
   CByteBuffer sizesBuf;
 
   CMidBuf packBuf;
@@ -629,12 +651,15 @@ public:
   UInt64 TotalPacked;
 
   CUnpacker():
-      lzmsDecoder(NULL),
       _solidIndex(-1),
       _unpackedChunkIndex(0),
       TotalPacked(0)
       {}
 
+  #ifndef Z7_ST
+  void SetNumThreads(UInt32 numThreads) { mtChunkDecoder.NumThreads = numThreads; }
+  #endif
+
   HRESULT Unpack(
       IInStream *inStream,
       const CResource &res,
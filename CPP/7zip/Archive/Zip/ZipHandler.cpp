@@ -12,6 +12,7 @@
 #include "../../IPassword.h"
 
 #include "../../Common/FilterCoder.h"
+#include "../../Common/FilterThread.h"
 #include "../../Common/LimitedStreams.h"
 #include "../../Common/ProgressUtils.h"
 #include "../../Common/StreamObjects.h"
@@ -864,6 +865,9 @@ class CZipDecoder
   CObjectVector<CMethodItem> methodItems;
 
   CLzmaDecoder *lzmaDecoderSpec;
+  #ifndef Z7_ST
+  CFilterThread _filterThread;
+  #endif
 public:
   CZipDecoder():
       lzmaDecoderSpec(NULL)
@@ -984,6 +988,9 @@ HRESULT CZipDecoder::Decode(
   
   CFilterCoder::C_InStream_Releaser inStreamReleaser;
   CFilterCoder::C_Filter_Releaser filterReleaser;
+  #ifndef Z7_ST
+  CFilterThread_Releaser filterThreadReleaser;
+  #endif
 
   bool needCRC = true;
   bool wzAesMode = false;
@@ -1386,10 +1393,25 @@ HRESULT CZipDecoder::Decode(
           
           RINOK(filterStream->Init_NoSubFilterInit())
           // RINOK(filterStream->SetOutStreamSize(NULL));
+
+          #ifndef Z7_ST
+          // WzAes decoder reads the filter stream up to the end (for MAC check),
+          // so read-ahead in filter thread doesn't change the result.
+          if (wzAesMode && numThreads > 1 && coderPackSize >= kFilterThread_MinPackSize)
+          {
+            RINOK(_filterThread.StartStream(filterStream, filterThreadReleaser.BinderInStream))
+            filterThreadReleaser.Thread = &_filterThread;
+          }
+          #endif
         }
 
         try {
-        result = coder->Code(readFromFilter ?
+        result = coder->Code(
+            #ifndef Z7_ST
+            filterThreadReleaser.BinderInStream ?
+              filterThreadReleaser.BinderInStream.Interface() :
+            #endif
+            readFromFilter ?
               filterStream.Interface() :
               inStream.Interface(),
             outStream,
@@ -1508,11 +1530,21 @@ HRESULT CZipDecoder::Decode(
     const UInt64 packSize = inStream->GetSize();
     bool thereAreData = false;
     // read to the end from filter or from packed stream
-    if (SkipStreamData(readFromFilter ?
-          filterStream.Interface() :
-          inStream.Interface(),
+    if (SkipStreamData(
+          #ifndef Z7_ST
+          filterThreadReleaser.BinderInStream ?
+            filterThreadReleaser.BinderInStream.Interface() :
+          #endif
+          readFromFilter ?
+            filterStream.Interface() :
+            inStream.Interface(),
         compressProgress, packSize, unpackSize, thereAreData) != S_OK)
       authOk = false;
+    #ifndef Z7_ST
+    // filter thread must finish the filter processing before MAC check
+    if (filterThreadReleaser.Release() != S_OK)
+      authOk = false;
+    #endif
     if (needReminderCheck && thereAreData)
       dataAfterEnd = true;
 
@@ -1069,6 +1069,9 @@ bool CInArchive::ReadExtra(const CLocalItem &item, unsigned extraSize, CExtraBlo
     CItem *cdItem)
 {
   extra.Clear();
+  // sub-blocks (except of Zip64) are copied to (extra.Raw) in original format
+  extra.Raw.Alloc(extraSize);
+  size_t rawSize = 0;
   
   while (extraSize >= 4)
   {
@@ -1086,6 +1089,7 @@ bool CInArchive::ReadExtra(const CLocalItem &item, unsigned extraSize, CExtraBlo
       HeadersWarning = true;
       extra.Error = true;
       Skip(extraSize);
+      extra.Raw.ChangeSize_KeepData(rawSize, rawSize);
       return false;
     }
  
@@ -1157,8 +1161,12 @@ bool CInArchive::ReadExtra(const CLocalItem &item, unsigned extraSize, CExtraBlo
     }
     else
     {
-      ReadBuffer(subBlock.Data, size);
-      extra.SubBlocks.Add(subBlock);
+      Byte *p = (Byte *)extra.Raw + rawSize;
+      SetUi32(p, pair)
+      SafeRead(p + 4, size);
+      rawSize += 4 + size;
+      subBlock.Size = size;
+      subBlock.Data = p + 4;
       if (subBlock.ID == NFileHeader::NExtraID::kIzUnicodeName)
       {
         if (!subBlock.CheckIzUnicode(item.Name))
@@ -1177,6 +1185,8 @@ bool CInArchive::ReadExtra(const CLocalItem &item, unsigned extraSize, CExtraBlo
     Skip(extraSize);
   }
 
+  if (rawSize != extra.Raw.Size())
+    extra.Raw.ChangeSize_KeepData(rawSize, rawSize);
   return true;
 }
 
@@ -1897,6 +1907,16 @@ HRESULT CInArchive::TryReadCd(CObjectVector<CItemEx> &items, const CCdInfo &cdIn
   const UInt64 *totalFilesPtr = &numFileExpected;
   bool isCorrect_NumEntries = (cdInfo.IsFromEcd64 || numFileExpected >= ((UInt32)1 << 16));
 
+  {
+    // each cd item uses at least 46 bytes, so we can trust (NumEntries) limited by (cdSize)
+    UInt64 numReserve = cdSize / 46;
+    if (numReserve > numFileExpected)
+      numReserve = numFileExpected;
+    if (numReserve > ((UInt32)1 << 26))
+      numReserve = (UInt32)1 << 26;
+    items.Reserve((unsigned)numReserve);
+  }
+
   while (_cnt < cdSize)
   {
     CanStartNewVol = true;
@@ -3446,6 +3466,17 @@ HRESULT CInArchive::Open(IInStream *stream, const UInt64 *searchLimit,
 }
 
 
+bool CInArchive::GetItemPos_in_BaseStream(const CItemEx &item, bool seekPackData, UInt64 &pos) const
+{
+  if (IsMultiVol || (UseDisk_in_SingleVol && item.Disk != EcdVolIndex))
+    return false;
+  pos = item.LocalHeaderPos;
+  if (seekPackData)
+    pos += item.LocalFullHeaderSize;
+  pos = (UInt64)((Int64)pos + ArcInfo.Base);
+  return true;
+}
+
 HRESULT CInArchive::GetItemStream(const CItemEx &item, bool seekPackData, CMyComPtr<ISequentialInStream> &stream)
 {
   stream.Release();
@@ -422,6 +422,9 @@ public:
   HRESULT Read_LocalItem_After_CdItem_Full(CItemEx &item);
 
   HRESULT GetItemStream(const CItemEx &item, bool seekPackData, CMyComPtr<ISequentialInStream> &stream);
+  /* it returns false, if item data is not stored in single stream of archive.
+     (pos) is position of item in (GetBaseStream()) */
+  bool GetItemPos_in_BaseStream(const CItemEx &item, bool seekPackData, UInt64 &pos) const;
 
   IInStream *GetBaseStream() { return StreamRef; }
 
@@ -53,14 +53,14 @@ void CExtraSubBlock::PrintInfo(AString &s) const
       s += pair.Name;
       if (ID == NExtraID::kUnixTime)
       {
-        if (Data.Size() >= 1)
+        if (Size >= 1)
         {
           s.Add_Colon();
           const Byte flags = Data[0];
           if (flags & 1) s.Add_Char('M');
           if (flags & 2) s.Add_Char('A');
           if (flags & 4) s.Add_Char('C');
-          const UInt32 size = (UInt32)(Data.Size()) - 1;
+          const UInt32 size = Size - 1;
           if (size % 4 == 0)
           {
             s.Add_Colon();
@@ -69,13 +69,13 @@ void CExtraSubBlock::PrintInfo(AString &s) const
         }
       }
       /*
-      if (ID == NExtraID::kApkAlign && Data.Size() >= 2)
+      if (ID == NExtraID::kApkAlign && Size >= 2)
       {
         char sz[32];
         sz[0] = ':';
         ConvertUInt32ToHex(GetUi16(Data), sz + 1);
         s += sz;
-        for (unsigned j = 2; j < Data.Size(); j++)
+        for (unsigned j = 2; j < Size; j++)
         {
           char sz[32];
           sz[0] = '-';
@@ -112,18 +112,54 @@ void CExtraBlock::PrintInfo(AString &s) const
       s += "_ERROR";
   }
 
-  FOR_VECTOR (i, SubBlocks)
+  CExtraSubBlock sb;
+  for (size_t pos = 0; GetNextSubBlock(pos, sb);)
   {
     s.Add_Space_if_NotEmpty();
-    SubBlocks[i].PrintInfo(s);
+    sb.PrintInfo(s);
   }
 }
 
 
+void CExtraBlock::AddSubBlock(UInt32 id, const Byte *data, unsigned size)
+{
+  const size_t oldSize = Raw.Size();
+  Raw.ChangeSize_KeepData(oldSize + 4 + size, oldSize);
+  Byte *p = (Byte *)Raw + oldSize;
+  SetUi16(p, (UInt16)id)
+  SetUi16(p + 2, (UInt16)size)
+  if (size != 0)
+    memcpy(p + 4, data, size);
+}
+
+
+void CExtraBlock::RemoveUnknownSubBlocks()
+{
+  size_t dest = 0;
+  CExtraSubBlock sb;
+  for (size_t pos = 0; GetNextSubBlock(pos, sb);)
+  {
+    switch (sb.ID)
+    {
+      case NExtraID::kStrongEncrypt:
+      case NExtraID::kWzAES:
+      {
+        const size_t size = 4 + (size_t)sb.Size;
+        memmove((Byte *)Raw + dest, sb.Data - 4, size);
+        dest += size;
+        break;
+      }
+      default: break;
+    }
+  }
+  Raw.ChangeSize_KeepData(dest, dest);
+}
+
+
 bool CExtraSubBlock::ExtractNtfsTime(unsigned index, FILETIME &ft) const
 {
   ft.dwHighDateTime = ft.dwLowDateTime = 0;
-  UInt32 size = (UInt32)Data.Size();
+  UInt32 size = Size;
   if (ID != NExtraID::kNTFS || size < 32)
     return false;
   const Byte *p = (const Byte *)Data;
@@ -162,7 +198,7 @@ bool CExtraSubBlock::Extract_UnixTime(bool isCentral, unsigned index, UInt32 &re
   */
 
   res = 0;
-  UInt32 size = (UInt32)Data.Size();
+  UInt32 size = Size;
   if (ID != NExtraID::kUnixTime || size < 5)
     return false;
   const Byte *p = (const Byte *)Data;
@@ -200,7 +236,7 @@ bool CExtraSubBlock::Extract_Unix01_Time(unsigned index, UInt32 &res) const
 {
   res = 0;
   const unsigned offset = index * 4;
-  if (Data.Size() < offset + 4)
+  if (Size < offset + 4)
     return false;
   if (ID != NExtraID::kUnix0 &&
       ID != NExtraID::kUnix1)
@@ -216,7 +252,7 @@ bool CExtraSubBlock::Extract_Unix_Time(unsigned index, UInt32 &res) const
 {
   res = 0;
   const unsigned offset = index * 4;
-  if (ID != NExtraID::kUnix0 || Data.Size() < offset)
+  if (ID != NExtraID::kUnix0 || Size < offset)
     return false;
   const Byte *p = (const Byte *)Data + offset;
   res = GetUi32(p);
@@ -226,9 +262,9 @@ bool CExtraSubBlock::Extract_Unix_Time(unsigned index, UInt32 &res) const
 
 bool CExtraBlock::GetNtfsTime(unsigned index, FILETIME &ft) const
 {
-  FOR_VECTOR (i, SubBlocks)
+  CExtraSubBlock sb;
+  for (size_t pos = 0; GetNextSubBlock(pos, sb);)
   {
-    const CExtraSubBlock &sb = SubBlocks[i];
     if (sb.ID == NFileHeader::NExtraID::kNTFS)
       return sb.ExtractNtfsTime(index, ft);
   }
@@ -237,10 +273,10 @@ bool CExtraBlock::GetNtfsTime(unsigned index, FILETIME &ft) const
 
 bool CExtraBlock::GetUnixTime(bool isCentral, unsigned index, UInt32 &res) const
 {
+  CExtraSubBlock sb;
   {
-    FOR_VECTOR (i, SubBlocks)
+    for (size_t pos = 0; GetNextSubBlock(pos, sb);)
     {
-      const CExtraSubBlock &sb = SubBlocks[i];
       if (sb.ID == NFileHeader::NExtraID::kUnixTime)
         return sb.Extract_UnixTime(isCentral, index, res);
     }
@@ -254,9 +290,8 @@ bool CExtraBlock::GetUnixTime(bool isCentral, unsigned index, UInt32 &res) const
   }
   
   {
-    FOR_VECTOR (i, SubBlocks)
+    for (size_t pos = 0; GetNextSubBlock(pos, sb);)
     {
-      const CExtraSubBlock &sb = SubBlocks[i];
       if (sb.ID == NFileHeader::NExtraID::kUnix0 ||
           sb.ID == NFileHeader::NExtraID::kUnix1)
         return sb.Extract_Unix01_Time(index, res);
@@ -385,7 +420,7 @@ bool CItem::GetPosixAttrib(UInt32 &attrib) const
 
 bool CExtraSubBlock::CheckIzUnicode(const AString &s) const
 {
-  size_t size = Data.Size();
+  size_t size = Size;
   if (size < 1 + 4)
     return false;
   const Byte *p = (const Byte *)Data;
@@ -413,19 +448,19 @@ void CItem::GetUnicodeString(UString &res, const AString &s, bool isComment, boo
       const unsigned id = isComment ?
           NFileHeader::NExtraID::kIzUnicodeComment:
           NFileHeader::NExtraID::kIzUnicodeName;
-      const CObjectVector<CExtraSubBlock> &subBlocks = GetMainExtra().SubBlocks;
+      const CExtraBlock &extra = GetMainExtra();
+      CExtraSubBlock sb;
       
-      FOR_VECTOR (i, subBlocks)
+      for (size_t pos = 0; extra.GetNextSubBlock(pos, sb);)
       {
-        const CExtraSubBlock &sb = subBlocks[i];
         if (sb.ID == id)
         {
           if (sb.CheckIzUnicode(s))
           {
             // const unsigned kIzUnicodeHeaderSize = 5;
             if (Convert_UTF8_Buf_To_Unicode(
-                (const char *)(const void *)(const Byte *)sb.Data + 5,
-                sb.Data.Size() - 5, res))
+                (const char *)(const void *)(sb.Data + 5),
+                sb.Size - 5, res))
               return;
           }
           break;
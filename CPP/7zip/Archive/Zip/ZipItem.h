@@ -25,10 +25,13 @@ struct CVersion
   Byte HostOS;
 };
 
+// it's view of sub-block data stored in CExtraBlock::Raw
+
 struct CExtraSubBlock
 {
   UInt32 ID;
-  CByteBuffer Data;
+  UInt32 Size;
+  const Byte *Data;
 
   bool ExtractNtfsTime(unsigned index, FILETIME &ft) const;
   bool Extract_UnixTime(bool isCentral, unsigned index, UInt32 &res) const;
@@ -57,7 +60,7 @@ struct CWzAesExtra
   {
     if (sb.ID != NFileHeader::NExtraID::kWzAES)
       return false;
-    if (sb.Data.Size() < k_WzAesExtra_Size)
+    if (sb.Size < k_WzAesExtra_Size)
       return false;
     const Byte *p = (const Byte *)sb.Data;
     VendorVersion = GetUi16(p);
@@ -69,11 +72,8 @@ struct CWzAesExtra
     return true;
   }
   
-  void SetSubBlock(CExtraSubBlock &sb) const
+  void GetData(Byte *p) const
   {
-    sb.Data.Alloc(k_WzAesExtra_Size);
-    sb.ID = NFileHeader::NExtraID::kWzAES;
-    Byte *p = (Byte *)sb.Data;
     p[0] = (Byte)VendorVersion;
     p[1] = (Byte)(VendorVersion >> 8);
     p[2] = 'A';
@@ -111,7 +111,7 @@ struct CStrongCryptoExtra
     if (sb.ID != NFileHeader::NExtraID::kStrongEncrypt)
       return false;
     const Byte *p = (const Byte *)sb.Data;
-    if (sb.Data.Size() < 8)
+    if (sb.Size < 8)
       return false;
     Format = GetUi16(p + 0);
     AlgId  = GetUi16(p + 2);
@@ -124,9 +124,14 @@ struct CStrongCryptoExtra
 };
 
 
+/* CExtraBlock stores all sub-blocks (except of Zip64) in one buffer
+   in same format as in zip headers: (ID:16, Size:16, Data[Size]).
+   Central directory of big archives can contain millions of items,
+   so we don't want another heap allocations for each sub-block. */
+
 struct CExtraBlock
 {
-  CObjectVector<CExtraSubBlock> SubBlocks;
+  CByteBuffer Raw;
   bool Error;
   bool MinorError;
   bool IsZip64;
@@ -136,22 +141,35 @@ struct CExtraBlock
 
   void Clear()
   {
-    SubBlocks.Clear();
+    Raw.Free();
     IsZip64 = false;
   }
   
-  size_t GetSize() const
+  size_t GetSize() const { return Raw.Size(); }
+
+  bool GetNextSubBlock(size_t &pos, CExtraSubBlock &sb) const
   {
-    size_t res = 0;
-    FOR_VECTOR (i, SubBlocks)
-      res += SubBlocks[i].Data.Size() + 2 + 2;
-    return res;
+    const size_t rem = Raw.Size() - pos;
+    if (rem < 4)
+      return false;
+    const Byte *p = (const Byte *)Raw + pos;
+    const UInt32 size = GetUi16(p + 2);
+    if (size > rem - 4)
+      return false;
+    sb.ID = GetUi16(p);
+    sb.Size = size;
+    sb.Data = p + 4;
+    pos += 4 + size;
+    return true;
   }
+
+  void AddSubBlock(UInt32 id, const Byte *data, unsigned size);
   
   bool GetWzAes(CWzAesExtra &e) const
   {
-    FOR_VECTOR (i, SubBlocks)
-      if (e.ParseFromSubBlock(SubBlocks[i]))
+    CExtraSubBlock sb;
+    for (size_t pos = 0; GetNextSubBlock(pos, sb);)
+      if (e.ParseFromSubBlock(sb))
         return true;
     return false;
   }
@@ -164,8 +182,9 @@ struct CExtraBlock
 
   bool GetStrongCrypto(CStrongCryptoExtra &e) const
   {
-    FOR_VECTOR (i, SubBlocks)
-      if (e.ParseFromSubBlock(SubBlocks[i]))
+    CExtraSubBlock sb;
+    for (size_t pos = 0; GetNextSubBlock(pos, sb);)
+      if (e.ParseFromSubBlock(sb))
         return true;
     return false;
   }
@@ -183,21 +202,7 @@ struct CExtraBlock
 
   void PrintInfo(AString &s) const;
 
-  void RemoveUnknownSubBlocks()
-  {
-    for (unsigned i = SubBlocks.Size(); i != 0;)
-    {
-      i--;
-      switch (SubBlocks[i].ID)
-      {
-        case NFileHeader::NExtraID::kStrongEncrypt:
-        case NFileHeader::NExtraID::kWzAES:
-          break;
-        default:
-          SubBlocks.Delete(i);
-      }
-    }
-  }
+  void RemoveUnknownSubBlocks();
 };
 
 
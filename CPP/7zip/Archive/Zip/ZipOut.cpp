@@ -87,13 +87,7 @@ void COutArchive::Write64(UInt64 val)
 
 void COutArchive::WriteExtra(const CExtraBlock &extra)
 {
-  FOR_VECTOR (i, extra.SubBlocks)
-  {
-    const CExtraSubBlock &subBlock = extra.SubBlocks[i];
-    Write16((UInt16)subBlock.ID);
-    Write16((UInt16)subBlock.Data.Size());
-    WriteBytes(subBlock.Data, (UInt16)subBlock.Data.Size());
-  }
+  WriteBytes(extra.Raw, extra.Raw.Size());
 }
 
 void COutArchive::WriteCommonItemInfo(const CLocalItem &item, bool isZip64)
@@ -65,10 +65,10 @@ static void AddAesExtra(CItem &item, Byte aesKeyMode, UInt16 method)
   wzAesField.Method = method;
   item.Method = NFileHeader::NCompressionMethod::kWzAES;
   item.Crc = 0;
-  CExtraSubBlock sb;
-  wzAesField.SetSubBlock(sb);
-  item.LocalExtra.SubBlocks.Add(sb);
-  item.CentralExtra.SubBlocks.Add(sb);
+  Byte data[k_WzAesExtra_Size];
+  wzAesField.GetData(data);
+  item.LocalExtra.AddSubBlock(NFileHeader::NExtraID::kWzAES, data, k_WzAesExtra_Size);
+  item.CentralExtra.AddSubBlock(NFileHeader::NExtraID::kWzAES, data, k_WzAesExtra_Size);
 }
 
 
@@ -470,16 +470,41 @@ static HRESULT UpdateItemOldData(
     rangeSize = itemEx.GetLocalFullSize();
   }
 
+  complexity += rangeSize;
+
+  CMyComPtr<ISequentialOutStream> outStream;
+  archive.CreateStreamForCopying(outStream);
+
+  {
+    /* CCacheOutStream can copy old data by file system without reading,
+       and it joins the ranges of neighbour old items to one copy operation */
+    Z7_DECL_CMyComPtr_QI_FROM(IOutStreamCopyFrom, copyFrom, outStream)
+    UInt64 inPos;
+    if (copyFrom && inArchive->GetItemPos_in_BaseStream(itemEx, ui.NewProps, inPos))
+    {
+      UInt64 processed = 0;
+      const HRESULT res = copyFrom->CopyFrom(inArchive->GetBaseStream(), inPos, rangeSize, &processed);
+      if (res != S_FALSE)
+      {
+        archive.MoveCurPos(rangeSize);
+        RINOK(res)
+        if (processed != rangeSize)
+          return E_FAIL;
+        if (progress)
+        {
+          RINOK(progress->SetRatioInfo(&rangeSize, &rangeSize))
+        }
+        return S_OK;
+      }
+    }
+  }
+
   CMyComPtr<ISequentialInStream> packStream;
 
   RINOK(inArchive->GetItemStream(itemEx, ui.NewProps, packStream))
   if (!packStream)
     return E_NOTIMPL;
 
-  complexity += rangeSize;
-
-  CMyComPtr<ISequentialOutStream> outStream;
-  archive.CreateStreamForCopying(outStream);
   HRESULT res = NCompress::CopyStream_ExactSize(packStream, outStream, rangeSize, progress);
   archive.MoveCurPos(rangeSize);
   return res;
@@ -757,6 +782,11 @@ static HRESULT Update2St(
   lps->OutSize = packSizeTotal;
   RINOK(lps->SetCur())
 
+  if (opCallback)
+  {
+    RINOK(opCallback->ReportOperation(NEventIndexType::kNoIndex, (UInt32)(Int32)-1, NUpdateNotifyOp::kHeader))
+  }
+
   RINOK(archive.WriteCentralDir(items, comment))
 
   /*
@@ -1557,6 +1587,11 @@ static HRESULT Update2(
   
   RINOK(mtCompressProgressMixer.SetRatioInfo(0, NULL, NULL))
 
+  if (opCallback)
+  {
+    RINOK(opCallback->ReportOperation(NEventIndexType::kNoIndex, (UInt32)(Int32)-1, NUpdateNotifyOp::kHeader))
+  }
+
   RINOK(archive.WriteCentralDir(items, comment))
 
   /*
@@ -1621,10 +1656,11 @@ static const size_t kCacheBlockSize = 1 << 20;
 static const size_t kCacheSize = kCacheBlockSize << 2;
 static const size_t kCacheMask = kCacheSize - 1;
 
-Z7_CLASS_IMP_NOQIB_2(
+Z7_CLASS_IMP_NOQIB_3(
   CCacheOutStream
   , IOutStream
   , IStreamSetRestriction
+  , IOutStreamCopyFrom
 )
   Z7_IFACE_COM7_IMP(ISequentialOutStream)
 
@@ -1632,6 +1668,13 @@ Z7_CLASS_IMP_NOQIB_2(
   CMyComPtr<ISequentialOutStream> _seqStream;
   CMyComPtr<IOutStream> _stream;
   CMyComPtr<IStreamSetRestriction> _setRestriction;
+  CMyComPtr<IOutStreamCopyFrom> _copyFrom;
+  // the pending copy of old data: it's written at (_copyOutPos) before any another write
+  CMyComPtr<IInStream> _copyInStream;
+  UInt64 _copyInPos;
+  UInt64 _copyOutPos;
+  UInt64 _copySize;
+  bool _copyFrom_Disabled;
   Byte *_cache;
   size_t _cachedSize;
   UInt64 _cachedPos;
@@ -1645,6 +1688,7 @@ Z7_CLASS_IMP_NOQIB_2(
   HRESULT FlushFromCache(size_t size);
   HRESULT FlushNonRestrictedBlocks();
   HRESULT FlushCache();
+  HRESULT FlushCopy();
   HRESULT SetRestriction_ForWrite(size_t writeSize) const;
 
   HRESULT SeekPhy(UInt64 pos)
@@ -1691,8 +1735,15 @@ HRESULT CCacheOutStream::Init(ISequentialOutStream *seqStream, IOutStream *strea
   _seqStream = seqStream;
   _stream = stream;
   _setRestriction = setRestriction;
+  _copyFrom.Release();
+  _copyInStream.Release();
+  _copySize = 0;
+  _copyFrom_Disabled = false;
   if (_stream)
   {
+    // the copying is not compatible with restricted writing to volumes
+    if (!_setRestriction)
+      _stream.QueryInterface(IID_IOutStreamCopyFrom, &_copyFrom);
     RINOK(_stream->Seek(0, STREAM_SEEK_CUR, &_virtPos))
     RINOK(_stream->Seek(0, STREAM_SEEK_END, &_virtSize))
     RINOK(_stream->Seek((Int64)_virtPos, STREAM_SEEK_SET, &_virtPos))
@@ -1807,10 +1858,65 @@ HRESULT CCacheOutStream::FlushCache()
   return FlushFromCache(_cachedSize);
 }
 
+/* it writes the pending copy of old data.
+   The cache is empty here, because CopyFrom() flushes the cache,
+   and any write after CopyFrom() calls FlushCopy() before. */
+HRESULT CCacheOutStream::FlushCopy()
+{
+  if (_copySize == 0)
+    return S_OK;
+  if (_hres != S_OK)
+    return _hres;
+  if (_cachedSize != 0)
+    return E_FAIL;
+  _hres = SeekPhy(_copyOutPos);
+  RINOK(_hres)
+  if (!_copyFrom_Disabled)
+  {
+    UInt64 processed = 0;
+    _hres = _copyFrom->CopyFrom(_copyInStream, _copyInPos, _copySize, &processed);
+    _phyPos += processed;
+    _copyInPos += processed;
+    _copySize -= processed;
+    if (_hres == S_FALSE)
+    {
+      _hres = S_OK;
+      _copyFrom_Disabled = true;
+    }
+    RINOK(_hres)
+  }
+  if (_copySize != 0)
+  {
+    // the file system doesn't support fast copying. So we copy via cache buffer
+    _hres = InStream_SeekSet(_copyInStream, _copyInPos);
+    while (_hres == S_OK && _copySize != 0)
+    {
+      size_t cur = kCacheBlockSize;
+      if (cur > _copySize)
+        cur = (size_t)_copySize;
+      _hres = ReadStream_FALSE(_copyInStream, _cache, cur);
+      if (_hres == S_OK)
+        _hres = WriteStream(_seqStream, _cache, cur);
+      if (_hres == S_OK)
+      {
+        _phyPos += cur;
+        _copyInPos += cur;
+        _copySize -= cur;
+      }
+    }
+    RINOK(_hres)
+  }
+  if (_phySize < _phyPos)
+    _phySize = _phyPos;
+  _copyInStream.Release();
+  return S_OK;
+}
+
 HRESULT CCacheOutStream::FinalFlush()
 {
   _restrict_begin = 0;
   _restrict_end = 0;
+  RINOK(FlushCopy())
   RINOK(FlushCache())
   if (_stream && _hres == S_OK)
   {
@@ -1837,6 +1943,8 @@ Z7_COM7F_IMF(CCacheOutStream::Write(const void *data, UInt32 size, UInt32 *proce
   if (_hres != S_OK)
     return _hres;
 
+  RINOK(FlushCopy())
+
   if (_cachedSize != 0)
   if (_virtPos < _cachedPos ||
       _virtPos > _cachedPos + _cachedSize)
@@ -1949,6 +2057,8 @@ Z7_COM7F_IMF(CCacheOutStream::SetSize(UInt64 newSize))
   if (_hres != S_OK)
     return _hres;
 
+  RINOK(FlushCopy())
+
   if (newSize <= _cachedPos || _cachedSize == 0)
   {
     _cachedSize = 0;
@@ -2026,6 +2136,41 @@ Z7_COM7F_IMF(CCacheOutStream::SetRestriction(UInt64 begin, UInt64 end))
 }
 
 
+/* it doesn't copy the data immediately: it joins neighbour ranges
+   of old items, and the joined range is copied by FlushCopy() later. */
+Z7_COM7F_IMF(CCacheOutStream::CopyFrom(IInStream *inStream, UInt64 inPos, UInt64 size, UInt64 *processedSize))
+{
+  *processedSize = 0;
+  if (_hres != S_OK)
+    return _hres;
+  if (!_copyFrom || _virtPos != _virtSize)
+    return S_FALSE;
+  if (size == 0)
+    return S_OK;
+  if (_copySize != 0
+      && (inStream != _copyInStream
+        || inPos != _copyInPos + _copySize
+        || _virtPos != _copyOutPos + _copySize))
+  {
+    RINOK(FlushCopy())
+  }
+  if (_copySize == 0)
+  {
+    // the data before copied range must be written before
+    _hres = FlushCache();
+    RINOK(_hres)
+    _copyInStream = inStream;
+    _copyInPos = inPos;
+    _copyOutPos = _virtPos;
+  }
+  _copySize += size;
+  _virtPos += size;
+  _virtSize = _virtPos;
+  *processedSize = size;
+  return S_OK;
+}
+
+
 
 HRESULT Update(
     DECL_EXTERNAL_CODECS_LOC_VARS
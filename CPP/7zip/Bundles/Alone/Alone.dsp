@@ -674,6 +674,14 @@ SOURCE=..\..\Common\FilterCoder.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\Common\FilterThread.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Common\FilterThread.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\Common\InBuffer.cpp
 # End Source File
 # Begin Source File
@@ -1087,6 +1095,60 @@ SOURCE=..\..\Compress\LzmaRegister.cpp
 # PROP Default_Filter ""
 # Begin Source File
 
+SOURCE=..\..\Compress\Ppmd2Decoder.cpp
+
+!IF  "$(CFG)" == "Alone - Win32 Release"
+
+# ADD CPP /O2
+# SUBTRACT CPP /YX /Yc /Yu
+
+!ELSEIF  "$(CFG)" == "Alone - Win32 Debug"
+
+!ELSEIF  "$(CFG)" == "Alone - Win32 ReleaseU"
+
+# ADD CPP /O2
+# SUBTRACT CPP /YX /Yc /Yu
+
+!ELSEIF  "$(CFG)" == "Alone - Win32 DebugU"
+
+!ENDIF 
+
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Compress\Ppmd2Decoder.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Compress\Ppmd2Encoder.cpp
+
+!IF  "$(CFG)" == "Alone - Win32 Release"
+
+# ADD CPP /O2
+# SUBTRACT CPP /YX /Yc /Yu
+
+!ELSEIF  "$(CFG)" == "Alone - Win32 Debug"
+
+!ELSEIF  "$(CFG)" == "Alone - Win32 ReleaseU"
+
+# ADD CPP /O2
+# SUBTRACT CPP /YX /Yc /Yu
+
+!ELSEIF  "$(CFG)" == "Alone - Win32 DebugU"
+
+!ENDIF 
+
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Compress\Ppmd2Encoder.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Compress\Ppmd2Register.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\Compress\PpmdDecoder.cpp
 
 !IF  "$(CFG)" == "Alone - Win32 Release"
@@ -1310,6 +1372,10 @@ SOURCE=..\..\Compress\ByteSwap.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\Compress\DedupCoder.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\Compress\DeltaFilter.cpp
 # End Source File
 # Begin Source File
@@ -1661,6 +1727,14 @@ SOURCE=..\..\Archive\Common\ParseProperties.cpp
 
 SOURCE=..\..\Archive\Common\ParseProperties.h
 # End Source File
+# Begin Source File
+
+SOURCE=..\..\Archive\Common\SeekIndex.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Archive\Common\SeekIndex.h
+# End Source File
 # End Group
 # Begin Group "cab"
 
@@ -36,11 +36,13 @@ WIN_OBJS = \
   $O\TimeUtils.obj \
 
 7ZIP_COMMON_OBJS = \
+  $O\CachedInStream.obj \
   $O\CreateCoder.obj \
   $O\CWrappers.obj \
   $O\InBuffer.obj \
   $O\InOutTempBuffer.obj \
   $O\FilterCoder.obj \
+  $O\FilterThread.obj \
   $O\LimitedStreams.obj \
   $O\LockedStream.obj \
   $O\MemBlocks.obj \
@@ -111,11 +113,13 @@ AR_COMMON_OBJS = \
   $O\FindSignature.obj \
   $O\InStreamWithCRC.obj \
   $O\ItemNameUtils.obj \
+  $O\MtChunkDecoder.obj \
   $O\MultiStream.obj \
   $O\OutStreamWithCRC.obj \
   $O\OutStreamWithSha1.obj \
   $O\HandlerOut.obj \
   $O\ParseProperties.obj \
+  $O\SeekIndex.obj \
 
 7Z_OBJS = \
   $O\7zCompressionMode.obj \
@@ -204,6 +208,7 @@ COMPRESS_OBJS = \
   $O\BZip2Register.obj \
   $O\CopyCoder.obj \
   $O\CopyRegister.obj \
+  $O\DedupCoder.obj \
   $O\Deflate64Register.obj \
   $O\DeflateDecoder.obj \
   $O\DeflateEncoder.obj \
@@ -221,6 +226,10 @@ COMPRESS_OBJS = \
   $O\LzmsDecoder.obj \
   $O\LzOutWindow.obj \
   $O\LzxDecoder.obj \
+  $O\LzxEncoder.obj \
+  $O\Ppmd2Decoder.obj \
+  $O\Ppmd2Encoder.obj \
+  $O\Ppmd2Register.obj \
   $O\PpmdDecoder.obj \
   $O\PpmdEncoder.obj \
   $O\PpmdRegister.obj \
@@ -234,6 +243,7 @@ COMPRESS_OBJS = \
   $O\RarCodecsRegister.obj \
   $O\ShrinkDecoder.obj \
   $O\XpressDecoder.obj \
+  $O\XpressEncoder.obj \
   $O\XzDecoder.obj \
   $O\XzEncoder.obj \
   $O\ZlibDecoder.obj \
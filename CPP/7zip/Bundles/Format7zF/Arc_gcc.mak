@@ -31,6 +31,7 @@ MT_OBJS = \
   $O/MemBlocks.o \
   $O/OutMemStream.o \
   $O/ProgressMt.o \
+  $O/FilterThread.o \
   $O/StreamBinder.o \
   $O/Synchronization.o \
   $O/VirtThread.o \
@@ -78,6 +79,7 @@ WIN_OBJS = \
   $O/TimeUtils.o \
 
 7ZIP_COMMON_OBJS = \
+  $O/CachedInStream.o \
   $O/CreateCoder.o \
   $O/CWrappers.o \
   $O/InBuffer.o \
@@ -151,11 +153,13 @@ AR_COMMON_OBJS = \
   $O/FindSignature.o \
   $O/InStreamWithCRC.o \
   $O/ItemNameUtils.o \
+  $O/MtChunkDecoder.o \
   $O/MultiStream.o \
   $O/OutStreamWithCRC.o \
   $O/OutStreamWithSha1.o \
   $O/HandlerOut.o \
   $O/ParseProperties.o \
+  $O/SeekIndex.o \
 
 
 7Z_OBJS = \
@@ -249,6 +253,7 @@ COMPRESS_OBJS = \
   $O/BZip2Register.o \
   $O/CopyCoder.o \
   $O/CopyRegister.o \
+  $O/DedupCoder.o \
   $O/Deflate64Register.o \
   $O/DeflateDecoder.o \
   $O/DeflateEncoder.o \
@@ -266,6 +271,10 @@ COMPRESS_OBJS = \
   $O/LzmsDecoder.o \
   $O/LzOutWindow.o \
   $O/LzxDecoder.o \
+  $O/LzxEncoder.o \
+  $O/Ppmd2Decoder.o \
+  $O/Ppmd2Encoder.o \
+  $O/Ppmd2Register.o \
   $O/PpmdDecoder.o \
   $O/PpmdEncoder.o \
   $O/PpmdRegister.o \
@@ -273,6 +282,7 @@ COMPRESS_OBJS = \
   $O/QuantumDecoder.o \
   $O/ShrinkDecoder.o \
   $O/XpressDecoder.o \
+  $O/XpressEncoder.o \
   $O/XzDecoder.o \
   $O/XzEncoder.o \
   $O/ZlibDecoder.o \
@@ -886,6 +886,10 @@ SOURCE=..\..\Compress\CopyRegister.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\Compress\DedupCoder.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\Compress\DeltaFilter.cpp
 # End Source File
 # Begin Source File
@@ -930,6 +934,46 @@ SOURCE=..\..\Compress\LzmaRegister.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\Compress\Ppmd2Decoder.cpp
+
+!IF  "$(CFG)" == "7z - Win32 Release"
+
+# ADD CPP /O2
+# SUBTRACT CPP /YX /Yc /Yu
+
+!ELSEIF  "$(CFG)" == "7z - Win32 Debug"
+
+!ENDIF 
+
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Compress\Ppmd2Decoder.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Compress\Ppmd2Encoder.cpp
+
+!IF  "$(CFG)" == "7z - Win32 Release"
+
+# ADD CPP /O2
+# SUBTRACT CPP /YX /Yc /Yu
+
+!ELSEIF  "$(CFG)" == "7z - Win32 Debug"
+
+!ENDIF 
+
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Compress\Ppmd2Encoder.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Compress\Ppmd2Register.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\Compress\PpmdDecoder.cpp
 
 !IF  "$(CFG)" == "7z - Win32 Release"
@@ -996,6 +1040,14 @@ SOURCE=..\..\Compress\LzxDecoder.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\Compress\LzxEncoder.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Compress\LzxEncoder.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\Compress\QuantumDecoder.cpp
 # End Source File
 # Begin Source File
@@ -1079,6 +1131,14 @@ SOURCE=..\..\Compress\XpressDecoder.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\Compress\XpressEncoder.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Compress\XpressEncoder.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\Compress\XzDecoder.cpp
 # End Source File
 # Begin Source File
@@ -1367,6 +1427,14 @@ SOURCE=..\..\Crypto\ZipStrong.h
 # PROP Default_Filter ""
 # Begin Source File
 
+SOURCE=..\..\Common\CachedInStream.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Common\CachedInStream.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\Common\CreateCoder.cpp
 # End Source File
 # Begin Source File
@@ -1391,6 +1459,14 @@ SOURCE=..\..\Common\FilterCoder.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\Common\FilterThread.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Common\FilterThread.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\Common\InBuffer.cpp
 # End Source File
 # Begin Source File
@@ -2674,6 +2750,14 @@ SOURCE=..\..\Archive\Common\ItemNameUtils.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\Archive\Common\MtChunkDecoder.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Archive\Common\MtChunkDecoder.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\Archive\Common\MultiStream.cpp
 # End Source File
 # Begin Source File
@@ -2704,6 +2788,14 @@ SOURCE=..\..\Archive\Common\ParseProperties.cpp
 
 SOURCE=..\..\Archive\Common\ParseProperties.h
 # End Source File
+# Begin Source File
+
+SOURCE=..\..\Archive\Common\SeekIndex.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Archive\Common\SeekIndex.h
+# End Source File
 # End Group
 # Begin Group "Iso"
 
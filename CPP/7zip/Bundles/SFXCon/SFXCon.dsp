@@ -301,6 +301,10 @@ SOURCE=..\..\Compress\CopyRegister.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\Compress\DedupCoder.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\Compress\DeltaFilter.cpp
 # End Source File
 # Begin Source File
@@ -329,6 +333,18 @@ SOURCE=..\..\Compress\LzmaRegister.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\Compress\Ppmd2Decoder.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Compress\Ppmd2Decoder.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\Compress\Ppmd2Register.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\Compress\PpmdDecoder.cpp
 # End Source File
 # Begin Source File
@@ -0,0 +1,406 @@
+// CachedInStream.cpp
+
+#include "StdAfx.h"
+
+#include "../../../C/Alloc.h"
+
+#include "CachedInStream.h"
+
+static const UInt64 kEmptyTag = (UInt64)(Int64)-1;
+// the block that is unpacked now has (kLoadingFlag) in its tag
+static const UInt64 kLoadingFlag = (UInt64)1 << 63;
+
+static const unsigned kNumWaysLog = 2;
+// the number of sequential block transitions that enables prefetch
+static const unsigned kNumSeqBlocks_Prefetch = 2;
+#ifndef Z7_ST
+// the size of data that is prefetched after current block
+static const unsigned kPrefetchSizeLog = 20;
+#endif
+
+CCachedInStream::CCachedInStream():
+    _tags(NULL),
+    _marks(NULL),
+    _data(NULL)
+  #ifndef Z7_ST
+    , _prefetchEnabled(false)
+    , _prefetchStop(false)
+    , _prefetchBusy(false)
+    , _prefetchError(false)
+    , _prefetchPos(0)
+    , _prefetchLim(0)
+  #endif
+  {}
+
+CCachedInStream::~CCachedInStream()
+{
+  #ifndef Z7_ST
+  StopPrefetch();
+  #endif
+  Free();
+}
+
+void CCachedInStream::Free() throw()
+{
+  #ifndef Z7_ST
+  WaitPrefetch();
+  #endif
+  MyFree(_tags);
+  _tags = NULL;
+  MyFree(_marks);
+  _marks = NULL;
+  MidFree(_data);
+  _data = NULL;
+}
+
+bool CCachedInStream::Alloc(unsigned blockSizeLog, unsigned numBlocksLog) throw()
+{
+  #ifndef Z7_ST
+  WaitPrefetch();
+  #endif
+  unsigned sizeLog = blockSizeLog + numBlocksLog;
+  if (sizeLog >= sizeof(size_t) * 8)
+    return false;
+  size_t dataSize = (size_t)1 << sizeLog;
+  if (!_data || dataSize != _dataSize)
+  {
+    MidFree(_data);
+    _data = (Byte *)MidAlloc(dataSize);
+    if (!_data)
+      return false;
+    _dataSize = dataSize;
+  }
+  if (!_tags || numBlocksLog != _numBlocksLog)
+  {
+    MyFree(_tags);
+    MyFree(_marks);
+    _tags = (UInt64 *)MyAlloc(sizeof(UInt64) << numBlocksLog);
+    _marks = (UInt64 *)MyAlloc(sizeof(UInt64) << numBlocksLog);
+    if (!_tags || !_marks)
+    {
+      MyFree(_tags);
+      _tags = NULL;
+      MyFree(_marks);
+      _marks = NULL;
+      return false;
+    }
+    _numBlocksLog = numBlocksLog;
+  }
+  _blockSizeLog = blockSizeLog;
+  _numWaysLog = numBlocksLog < kNumWaysLog ? numBlocksLog : kNumWaysLog;
+  return true;
+}
+
+void CCachedInStream::Init(UInt64 size) throw()
+{
+  #ifndef Z7_ST
+  WaitPrefetch();
+  _prefetchError = false;
+  #endif
+  _size = size;
+  _pos = 0;
+  _mark = 0;
+  _lastBlock = kEmptyTag;
+  _numSeqBlocks = 0;
+  const size_t numBlocks = (size_t)1 << _numBlocksLog;
+  for (size_t i = 0; i < numBlocks; i++)
+  {
+    _tags[i] = kEmptyTag;
+    _marks[i] = 0;
+  }
+}
+
+size_t CCachedInStream::GetBlockSize(UInt64 blockIndex) const
+{
+  const UInt64 rem = _size - (blockIndex << _blockSizeLog);
+  size_t blockSize = (size_t)1 << _blockSizeLog;
+  if (blockSize > rem)
+    blockSize = (size_t)rem;
+  return blockSize;
+}
+
+// it returns the slot that contains the block or the block that is being unpacked
+int CCachedInStream::FindSlot(UInt64 blockIndex) const
+{
+  const size_t numWays = (size_t)1 << _numWaysLog;
+  const size_t setMask = ((size_t)1 << (_numBlocksLog - _numWaysLog)) - 1;
+  const size_t start = ((size_t)blockIndex & setMask) << _numWaysLog;
+  for (size_t i = start; i < start + numWays; i++)
+    if ((_tags[i] & ~kLoadingFlag) == blockIndex)
+      return (int)i;
+  return -1;
+}
+
+// it returns the empty slot or least recently used slot of the set
+int CCachedInStream::FindVictim(UInt64 blockIndex) const
+{
+  const size_t numWays = (size_t)1 << _numWaysLog;
+  const size_t setMask = ((size_t)1 << (_numBlocksLog - _numWaysLog)) - 1;
+  const size_t start = ((size_t)blockIndex & setMask) << _numWaysLog;
+  int victim = -1;
+  for (size_t i = start; i < start + numWays; i++)
+  {
+    const UInt64 tag = _tags[i];
+    if (tag == kEmptyTag)
+      return (int)i;
+    if ((tag & kLoadingFlag) != 0)
+      continue;
+    if (victim < 0 || _marks[i] < _marks[(unsigned)victim])
+      victim = (int)i;
+  }
+  return victim;
+}
+
+HRESULT CCachedInStream::ReadBlock_Safe(UInt64 blockIndex, Byte *dest, size_t blockSize)
+{
+  #ifndef Z7_ST
+  NWindows::NSynchronization::CCriticalSectionLock lock(_readCs);
+  #endif
+  try
+  {
+    return ReadBlock(blockIndex, dest, blockSize);
+  }
+  catch(...) { return E_OUTOFMEMORY; }
+}
+
+
+#ifndef Z7_ST
+
+THREAD_FUNC_DECL CCachedInStream::PrefetchThread(void *p)
+{
+  ((CCachedInStream *)p)->PrefetchLoop();
+  return THREAD_FUNC_RET_ZERO;
+}
+
+void CCachedInStream::PrefetchLoop()
+{
+  for (;;)
+  {
+    _prefetchEvent.Lock();
+    _cs.Enter();
+    for (;;)
+    {
+      if (_prefetchStop)
+      {
+        _cs.Leave();
+        return;
+      }
+      if (_prefetchPos >= _prefetchLim)
+        break;
+      const UInt64 blockIndex = _prefetchPos++;
+      if (FindSlot(blockIndex) >= 0)
+        continue;
+      const int slot = FindVictim(blockIndex);
+      if (slot < 0)
+        break;
+      _tags[(unsigned)slot] = blockIndex | kLoadingFlag;
+      _prefetchBusy = true;
+      _cs.Leave();
+      const HRESULT res = ReadBlock_Safe(blockIndex,
+          _data + ((size_t)(unsigned)slot << _blockSizeLog), GetBlockSize(blockIndex));
+      _cs.Enter();
+      _prefetchBusy = false;
+      if (res == S_OK)
+      {
+        _tags[(unsigned)slot] = blockIndex;
+        // the prefetched block must not be replaced before the reading
+        _marks[(unsigned)slot] = ++_mark;
+      }
+      else
+      {
+        // the error will be reported by ReadBlock() call from Read()
+        _tags[(unsigned)slot] = kEmptyTag;
+        _prefetchError = true;
+        _prefetchLim = _prefetchPos;
+      }
+      _loadedEvent.Set();
+    }
+    _cs.Leave();
+  }
+}
+
+// it's called with locked (_cs)
+void CCachedInStream::StartPrefetch(UInt64 blockIndex)
+{
+  if (_prefetchError)
+    return;
+  if (!_thread.IsCreated())
+  {
+    if (_prefetchEvent.CreateIfNotCreated_Reset() != 0
+        || _loadedEvent.CreateIfNotCreated_Reset() != 0
+        || _thread.Create(PrefetchThread, this) != 0)
+    {
+      _prefetchEnabled = false;
+      return;
+    }
+  }
+  UInt64 numBlocks = (UInt64)1 << _numBlocksLog >> 2;
+  if (_blockSizeLog < kPrefetchSizeLog
+      && numBlocks > ((UInt64)1 << (kPrefetchSizeLog - _blockSizeLog)))
+    numBlocks = (UInt64)1 << (kPrefetchSizeLog - _blockSizeLog);
+  if (numBlocks == 0)
+    numBlocks = 1;
+  UInt64 lim = blockIndex + 1 + numBlocks;
+  {
+    const UInt64 numFileBlocks = (_size + ((UInt64)1 << _blockSizeLog) - 1) >> _blockSizeLog;
+    if (lim > numFileBlocks)
+      lim = numFileBlocks;
+  }
+  if (_prefetchPos <= blockIndex)
+    _prefetchPos = blockIndex + 1;
+  if (_prefetchLim < lim)
+    _prefetchLim = lim;
+  if (_prefetchPos < _prefetchLim)
+    _prefetchEvent.Set();
+}
+
+void CCachedInStream::WaitPrefetch()
+{
+  if (!_thread.IsCreated())
+    return;
+  _cs.Enter();
+  _prefetchLim = _prefetchPos;
+  while (_prefetchBusy)
+  {
+    _cs.Leave();
+    _loadedEvent.Lock();
+    _cs.Enter();
+  }
+  _cs.Leave();
+}
+
+void CCachedInStream::StopPrefetch() throw()
+{
+  if (!_thread.IsCreated())
+    return;
+  _cs.Enter();
+  _prefetchStop = true;
+  _cs.Leave();
+  _prefetchEvent.Set();
+  _thread.Wait_Close();
+}
+
+#endif
+
+
+Z7_COM7F_IMF(CCachedInStream::Read(void *data, UInt32 size, UInt32 *processedSize))
+{
+  if (processedSize)
+    *processedSize = 0;
+  if (size == 0)
+    return S_OK;
+  if (_pos >= _size)
+    return S_OK;
+
+  {
+    const UInt64 rem = _size - _pos;
+    if (size > rem)
+      size = (UInt32)rem;
+  }
+
+  #ifndef Z7_ST
+  NWindows::NSynchronization::CCriticalSectionLock lock(_cs);
+  #endif
+
+  while (size != 0)
+  {
+    const UInt64 blockIndex = _pos >> _blockSizeLog;
+
+    if (blockIndex != _lastBlock)
+    {
+      if (blockIndex == _lastBlock + 1)
+      {
+        if (_numSeqBlocks < kNumSeqBlocks_Prefetch)
+          _numSeqBlocks++;
+      }
+      else
+      {
+        _numSeqBlocks = 0;
+        #ifndef Z7_ST
+        // the blocks that are not loaded yet will not be prefetched
+        _prefetchLim = _prefetchPos;
+        #endif
+      }
+      _lastBlock = blockIndex;
+      #ifndef Z7_ST
+      if (_prefetchEnabled && _numSeqBlocks >= kNumSeqBlocks_Prefetch)
+        StartPrefetch(blockIndex);
+      #endif
+    }
+
+    int slot;
+    for (;;)
+    {
+      slot = FindSlot(blockIndex);
+      if (slot < 0)
+        break;
+      if ((_tags[(unsigned)slot] & kLoadingFlag) == 0)
+        break;
+      #ifndef Z7_ST
+      // the block is being unpacked in prefetch thread
+      _cs.Leave();
+      _loadedEvent.Lock();
+      _cs.Enter();
+      #endif
+    }
+
+    if (slot < 0)
+    {
+      slot = FindVictim(blockIndex);
+      if (slot < 0)
+        return E_FAIL;
+      _tags[(unsigned)slot] = blockIndex | kLoadingFlag;
+      #ifndef Z7_ST
+      _cs.Leave();
+      #endif
+      const HRESULT res = ReadBlock_Safe(blockIndex,
+          _data + ((size_t)(unsigned)slot << _blockSizeLog), GetBlockSize(blockIndex));
+      #ifndef Z7_ST
+      _cs.Enter();
+      #endif
+      if (res != S_OK)
+      {
+        _tags[(unsigned)slot] = kEmptyTag;
+        return res;
+      }
+      _tags[(unsigned)slot] = blockIndex;
+    }
+
+    _marks[(unsigned)slot] = ++_mark;
+
+    const size_t kBlockSize = (size_t)1 << _blockSizeLog;
+    const size_t offset = (size_t)_pos & (kBlockSize - 1);
+    UInt32 cur = size;
+    const size_t rem = kBlockSize - offset;
+    if (cur > rem)
+      cur = (UInt32)rem;
+
+    memcpy(data, _data + ((size_t)(unsigned)slot << _blockSizeLog) + offset, cur);
+
+    if (processedSize)
+      *processedSize += cur;
+    data = (void *)((const Byte *)data + cur);
+    _pos += cur;
+    size -= cur;
+  }
+
+  return S_OK;
+}
+
+
+Z7_COM7F_IMF(CCachedInStream::Seek(Int64 offset, UInt32 seekOrigin, UInt64 *newPosition))
+{
+  switch (seekOrigin)
+  {
+    case STREAM_SEEK_SET: break;
+    case STREAM_SEEK_CUR: offset += _pos; break;
+    case STREAM_SEEK_END: offset += _size; break;
+    default: return STG_E_INVALIDFUNCTION;
+  }
+  if (offset < 0)
+    return HRESULT_WIN32_ERROR_NEGATIVE_SEEK;
+  _pos = (UInt64)offset;
+  if (newPosition)
+    *newPosition = (UInt64)offset;
+  return S_OK;
+}
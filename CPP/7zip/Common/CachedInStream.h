@@ -0,0 +1,86 @@
+// CachedInStream.h
+
+#ifndef ZIP7_INC_CACHED_IN_STREAM_H
+#define ZIP7_INC_CACHED_IN_STREAM_H
+
+#include "../../Common/MyCom.h"
+
+#ifndef Z7_ST
+#include "../../Windows/Synchronization.h"
+#include "../../Windows/Thread.h"
+#endif
+
+#include "../IStream.h"
+
+/*
+  CCachedInStream is the stream that is divided to blocks.
+  Child class unpacks blocks in ReadBlock().
+
+  The cache is set-associative:
+    the block can be stored only to one of (kNumWays) slots of its set,
+    and the least recently used slot of the set is replaced.
+
+  If sequential reading is detected, the next blocks can be
+  unpacked in prefetch thread, if child class calls EnablePrefetch().
+  Then ReadBlock() can be called from another thread, but the calls
+  of ReadBlock() are never concurrent.
+  The child class with enabled prefetch must call StopPrefetch() in its destructor.
+*/
+
+class CCachedInStream:
+  public IInStream,
+  public CMyUnknownImp
+{
+  Z7_IFACES_IMP_UNK_2(ISequentialInStream, IInStream)
+
+  UInt64 *_tags;
+  UInt64 *_marks; // the marks of last access for LRU replacement
+  Byte *_data;
+  size_t _dataSize;
+  unsigned _blockSizeLog;
+  unsigned _numBlocksLog;
+  unsigned _numWaysLog;
+  UInt64 _size;
+  UInt64 _pos;
+  UInt64 _mark;
+  UInt64 _lastBlock;
+  unsigned _numSeqBlocks;
+
+  #ifndef Z7_ST
+  bool _prefetchEnabled;
+  bool _prefetchStop;
+  bool _prefetchBusy;
+  bool _prefetchError;
+  UInt64 _prefetchPos;
+  UInt64 _prefetchLim;
+  NWindows::CThread _thread;
+  NWindows::NSynchronization::CCriticalSection _cs;
+  NWindows::NSynchronization::CCriticalSection _readCs;
+  NWindows::NSynchronization::CAutoResetEvent _prefetchEvent;
+  NWindows::NSynchronization::CAutoResetEvent _loadedEvent;
+
+  static THREAD_FUNC_DECL PrefetchThread(void *p);
+  void PrefetchLoop();
+  void StartPrefetch(UInt64 blockIndex);
+  void WaitPrefetch();
+  #endif
+
+  size_t GetBlockSize(UInt64 blockIndex) const;
+  int FindSlot(UInt64 blockIndex) const;
+  int FindVictim(UInt64 blockIndex) const;
+  HRESULT ReadBlock_Safe(UInt64 blockIndex, Byte *dest, size_t blockSize);
+protected:
+  virtual HRESULT ReadBlock(UInt64 blockIndex, Byte *dest, size_t blockSize) = 0;
+  #ifndef Z7_ST
+  void EnablePrefetch() { _prefetchEnabled = true; }
+  void StopPrefetch() throw();
+  #endif
+public:
+  CCachedInStream();
+  virtual ~CCachedInStream(); // the destructor must be virtual (Release() calls it) !!!
+  void Free() throw();
+  bool Alloc(unsigned blockSizeLog, unsigned numBlocksLog) throw();
+  void Init(UInt64 size) throw();
+};
+
+#endif
@@ -81,7 +81,8 @@ CInFileStream::CInFileStream():
   _info_WasLoaded(false),
   SupportHardLinks(false),
   Callback(NULL),
-  CallbackRef(0)
+  CallbackRef(0),
+  IoStat(NULL)
 {
 }
 
@@ -192,7 +193,10 @@ Z7_COM7F_IMF(CInFileStream::Read(void *data, UInt32 size, UInt32 *processedSize)
   #endif
 
   UInt32 realProcessedSize;
+  const UInt64 startTime = IoStat ? IoStat_GetTime_us() : 0;
   const bool result = File.ReadPart(data, size, realProcessedSize);
+  if (IoStat)
+    IoStat->AddCall(NIoStat::kRead, realProcessedSize, startTime);
   if (processedSize)
     *processedSize = realProcessedSize;
 
@@ -208,7 +212,10 @@ Z7_COM7F_IMF(CInFileStream::Read(void *data, UInt32 size, UInt32 *processedSize)
   
   if (processedSize)
     *processedSize = 0;
+  const UInt64 startTime = IoStat ? IoStat_GetTime_us() : 0;
   const ssize_t res = File.read_part(data, (size_t)size);
+  if (IoStat)
+    IoStat->AddCall(NIoStat::kRead, res != -1 ? (UInt64)res : 0, startTime);
   if (res != -1)
   {
     if (processedSize)
@@ -420,6 +427,16 @@ Z7_COM7F_IMF(CInFileStream::GetSize(UInt64 *size))
   return ConvertBoolToHRESULT(File.GetLength(*size));
 }
 
+Z7_COM7F_IMF(CInFileStream::GetFileHandle(UInt64 *handle))
+{
+ #ifdef _WIN32
+  *handle = (UInt64)(UINT_PTR)File.GetHandle();
+ #else
+  *handle = (UInt64)(Int64)File.GetHandle();
+ #endif
+  return S_OK;
+}
+
 #ifdef Z7_FILE_STREAMS_USE_WIN_FILE
 
 Z7_COM7F_IMF(CInFileStream::GetProps(UInt64 *size, FILETIME *cTime, FILETIME *aTime, FILETIME *mTime, UInt32 *attrib))
@@ -804,7 +821,10 @@ Z7_COM7F_IMF(COutFileStream::Write(const void *data, UInt32 size, UInt32 *proces
   #ifdef Z7_FILE_STREAMS_USE_WIN_FILE
 
   UInt32 realProcessedSize;
+  const UInt64 startTime = IoStat ? IoStat_GetTime_us() : 0;
   const bool result = File.Write(data, size, realProcessedSize);
+  if (IoStat)
+    IoStat->AddCall(NIoStat::kWrite, realProcessedSize, startTime);
   ProcessedSize += realProcessedSize;
   if (processedSize)
     *processedSize = realProcessedSize;
@@ -815,7 +835,10 @@ Z7_COM7F_IMF(COutFileStream::Write(const void *data, UInt32 size, UInt32 *proces
   if (processedSize)
     *processedSize = 0;
   size_t realProcessedSize;
+  const UInt64 startTime = IoStat ? IoStat_GetTime_us() : 0;
   const ssize_t res = File.write_full(data, (size_t)size, realProcessedSize);
+  if (IoStat)
+    IoStat->AddCall(NIoStat::kWrite, realProcessedSize, startTime);
   ProcessedSize += realProcessedSize;
   if (processedSize)
     *processedSize = (UInt32)realProcessedSize;
@@ -861,6 +884,41 @@ HRESULT COutFileStream::GetSize(UInt64 *size)
   return ConvertBoolToHRESULT(File.GetLength(*size));
 }
 
+Z7_COM7F_IMF(COutFileStream::Flush())
+{
+  return ConvertBoolToHRESULT(File.Flush());
+}
+
+Z7_COM7F_IMF(COutFileStream::CopyFrom(IInStream *inStream, UInt64 inPos, UInt64 size, UInt64 *processedSize))
+{
+  *processedSize = 0;
+ #if defined(__linux__) && !defined(Z7_FILE_STREAMS_USE_WIN_FILE)
+  Z7_DECL_CMyComPtr_QI_FROM(IStreamGetFileHandle, getHandle, inStream)
+  if (!getHandle)
+    return S_FALSE;
+  UInt64 handle;
+  if (getHandle->GetFileHandle(&handle) != S_OK)
+    return S_FALSE;
+  UInt64 processed = 0;
+  const bool res = File.CopyRangeFrom((int)(Int64)handle, inPos, size, processed);
+  ProcessedSize += processed;
+  *processedSize = processed;
+  if (res)
+    return S_OK;
+  const DWORD error = GetLastError();
+  // these errors mean that kernel or file system doesn't support fast copying
+  if (error == ENOSYS || error == EXDEV || error == EINVAL
+      || error == EOPNOTSUPP || error == EBADF || error == 0)
+    return S_FALSE;
+  return HRESULT_FROM_WIN32(error);
+ #else
+  UNUSED_VAR(inStream)
+  UNUSED_VAR(inPos)
+  UNUSED_VAR(size)
+  return S_FALSE;
+ #endif
+}
+
 #ifdef UNDER_CE
 
 Z7_COM7F_IMF(CStdOutFileStream::Write(const void *data, UInt32 size, UInt32 *processedSize))
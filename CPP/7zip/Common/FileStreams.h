@@ -14,6 +14,7 @@
 
 #include "../IStream.h"
 
+#include "IoStat.h"
 #include "UniqBlocks.h"
 
 
@@ -44,15 +45,17 @@ Z7_class_final(CInFileStream) :
   public IStreamGetProps,
   public IStreamGetProps2,
   public IStreamGetProp,
+  public IStreamGetFileHandle,
   public CMyUnknownImp
 {
-  Z7_COM_UNKNOWN_IMP_6(
+  Z7_COM_UNKNOWN_IMP_7(
       IInStream,
       ISequentialInStream,
       IStreamGetSize,
       IStreamGetProps,
       IStreamGetProps2,
-      IStreamGetProp)
+      IStreamGetProp,
+      IStreamGetFileHandle)
 
   Z7_IFACE_COM7_IMP(ISequentialInStream)
   Z7_IFACE_COM7_IMP(IInStream)
@@ -63,6 +66,7 @@ private:
 public:
   Z7_IFACE_COM7_IMP(IStreamGetProps2)
   Z7_IFACE_COM7_IMP(IStreamGetProp)
+  Z7_IFACE_COM7_IMP(IStreamGetFileHandle)
 
 private:
   NWindows::NFile::NIO::CInFile File;
@@ -96,6 +100,7 @@ public:
   bool SupportHardLinks;
   IInFileStream_Callback *Callback;
   UINT_PTR CallbackRef;
+  CIoStat *IoStat;
 
   CInFileStream();
   ~CInFileStream();
@@ -136,9 +141,11 @@ Z7_CLASS_IMP_NOQIB_1(
 };
 
 
-Z7_CLASS_IMP_COM_1(
+Z7_CLASS_IMP_COM_3(
   COutFileStream
   , IOutStream
+  , IOutStreamCopyFrom
+  , IOutStreamFlush
 )
   Z7_IFACE_COM7_IMP(ISequentialOutStream)
 public:
@@ -172,6 +179,9 @@ public:
   HRESULT Close();
   
   UInt64 ProcessedSize;
+  CIoStat *IoStat;
+
+  COutFileStream(): IoStat(NULL) {}
 
   bool SetTime(const CFiTime *cTime, const CFiTime *aTime, const CFiTime *mTime)
   {
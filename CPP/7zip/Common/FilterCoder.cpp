@@ -81,10 +81,22 @@ CFilterCoder::CFilterCoder(bool encodeMode):
     _encodeMode(encodeMode),
     _outSize_Defined(false),
     _outSize(0),
-    _nowPos64(0)
+    _nowPos64(0),
+    Stat(NULL)
   {}
 
 
+UInt32 CFilterCoder::CallFilter(Byte *data, UInt32 size)
+{
+  if (!Stat)
+    return Filter->Filter(data, size);
+  const UInt64 startTime = IoStat_GetTime_us();
+  const UInt32 res = Filter->Filter(data, size);
+  Stat->Add(startTime, size);
+  return res;
+}
+
+
 Z7_COM7F_IMF(CFilterCoder::Code(ISequentialInStream *inStream, ISequentialOutStream *outStream,
     const UInt64 * /* inSize */, const UInt64 *outSize, ICompressProgressInfo *progress))
 {
@@ -169,7 +181,7 @@ Z7_COM7F_IMF(CFilterCoder::Code(ISequentialInStream *inStream, ISequentialOutStr
            (aligment_size  >= 16)
          }
       */
-      const UInt32 cur = Filter->Filter(_buf + filterPos, readPos - filterPos);
+      const UInt32 cur = CallFilter(_buf + filterPos, readPos - filterPos);
       if (cur == 0)
         break;
       const UInt32 f = filterPos + cur;
@@ -197,7 +209,7 @@ Z7_COM7F_IMF(CFilterCoder::Code(ISequentialInStream *inStream, ISequentialOutStr
           buf[readPos] = 0;
         while (++readPos != f);
         // (readPos) now is (size_of_real_input_data + size_of_zero_pad)
-        if (cur != Filter->Filter(buf + filterPos, cur))
+        if (cur != CallFilter(buf + filterPos, cur))
           return E_FAIL;
       }
       filterPos = f;
@@ -358,7 +370,7 @@ Z7_COM7F_IMF(CFilterCoder::Write(const void *data, UInt32 size, UInt32 *processe
     }
 
     // _bufPos == _bufSize
-    _convSize = Filter->Filter(_buf, _bufPos);
+    _convSize = CallFilter(_buf, _bufPos);
     
     if (_convSize == 0)
       break;
@@ -380,7 +392,7 @@ Z7_COM7F_IMF(CFilterCoder::OutStreamFinish())
     RINOK(Flush2())
     if (_bufPos == 0)
       break;
-    const UInt32 convSize = Filter->Filter(_buf, _bufPos);
+    const UInt32 convSize = CallFilter(_buf, _bufPos);
     _convSize = convSize;
     UInt32 bufPos = _bufPos;
     if (convSize == 0)
@@ -402,7 +414,7 @@ Z7_COM7F_IMF(CFilterCoder::OutStreamFinish())
       for (; bufPos < convSize; bufPos++)
         buf[bufPos] = 0;
       _bufPos = bufPos;
-      _convSize = Filter->Filter(_buf, bufPos);
+      _convSize = CallFilter(_buf, bufPos);
       if (_convSize != _bufPos)
         return E_FAIL;
     }
@@ -499,7 +511,7 @@ Z7_COM7F_IMF(CFilterCoder::Read(void *data, UInt32 size, UInt32 *processedSize))
       RINOK(res)
     }
     
-    const UInt32 convSize = Filter->Filter(_buf, _bufPos);
+    const UInt32 convSize = CallFilter(_buf, _bufPos);
     _convSize = convSize;
     
     UInt32 bufPos = _bufPos;
@@ -525,7 +537,7 @@ Z7_COM7F_IMF(CFilterCoder::Read(void *data, UInt32 size, UInt32 *processedSize))
         buf[bufPos] = 0;
       while (++bufPos != convSize);
       _bufPos = bufPos;
-      _convSize = Filter->Filter(_buf, convSize);
+      _convSize = CallFilter(_buf, convSize);
       if (_convSize != _bufPos)
         return E_FAIL;
     }
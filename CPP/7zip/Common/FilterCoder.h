@@ -8,6 +8,8 @@
 #include "../../Common/MyCom.h"
 #include "../ICoder.h"
 
+#include "IoStat.h"
+
 #ifndef Z7_NO_CRYPTO
 #include "../IPassword.h"
 #endif
@@ -88,6 +90,7 @@ class CFilterCoder Z7_final :
   HRESULT Alloc();
   HRESULT Init_and_Alloc();
   HRESULT Flush2();
+  UInt32 CallFilter(Byte *data, UInt32 size);
 
   #ifndef Z7_NO_CRYPTO
   CMyComPtr<ICryptoSetPassword> _setPassword;
@@ -106,6 +109,7 @@ class CFilterCoder Z7_final :
 
 public:
   CMyComPtr<ICompressFilter> Filter;
+  CStageStatItem *Stat; // optional: time of Filter() calls
 
   CFilterCoder(bool encodeMode);
 
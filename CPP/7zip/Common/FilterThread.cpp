@@ -0,0 +1,61 @@
+// FilterThread.cpp
+
+#include "StdAfx.h"
+
+#ifndef Z7_ST
+
+#include "FilterThread.h"
+#include "StreamUtils.h"
+
+static const size_t kFilterThread_BufSize = (size_t)1 << 18;
+
+void CFilterThread::Execute()
+{
+  _result = S_OK;
+  for (;;)
+  {
+    UInt32 size = 0;
+    HRESULT res = _inStream->Read(_buf, (UInt32)kFilterThread_BufSize, &size);
+    if (res == S_OK)
+    {
+      if (size == 0)
+        break;
+      res = WriteStream(_outStream, _buf, size);
+      if (res == k_My_HRESULT_WritingWasCut)
+        break;
+    }
+    if (res != S_OK)
+    {
+      _result = res;
+      break;
+    }
+  }
+  _inStream.Release();
+  _outStream.Release();
+}
+
+HRESULT CFilterThread::StartStream(ISequentialInStream *inStream, CMyComPtr<ISequentialInStream> &binderInStream)
+{
+  _buf.AllocAtLeast(kFilterThread_BufSize);
+  if (!_buf.IsAllocated())
+    return E_OUTOFMEMORY;
+  RINOK_WRes(Create())
+  RINOK(_binder.Create_ReInit())
+  _binder.CreateStreams2(binderInStream, _outStream);
+  _inStream = inStream;
+  _result = S_OK;
+  RINOK_WRes(Start())
+  _isStarted = true;
+  return S_OK;
+}
+
+HRESULT CFilterThread::WaitFinish()
+{
+  if (!_isStarted)
+    return S_OK;
+  _isStarted = false;
+  RINOK_WRes(WaitExecuteFinish())
+  return _result;
+}
+
+#endif
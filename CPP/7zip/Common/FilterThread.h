@@ -0,0 +1,66 @@
+// FilterThread.h
+
+#ifndef ZIP7_INC_FILTER_THREAD_H
+#define ZIP7_INC_FILTER_THREAD_H
+
+#ifndef Z7_ST
+
+#include "../../Common/MyBuffer2.h"
+#include "../../Common/MyCom.h"
+
+#include "StreamBinder.h"
+#include "VirtThread.h"
+
+/*
+  CFilterThread reads decrypted data from filter stream in separate thread
+  and sends it to decoder via CStreamBinder.
+  So decryption of next block and decompression of current block work in parallel.
+  The thread reads the filter stream ahead of decoder up to the end of stream.
+  So the caller can use it only if the filter stream is limited by packed size of item,
+  and if the caller doesn't read the filter stream after decoder.
+*/
+
+// it's not useful to start the thread for small items
+const UInt64 kFilterThread_MinPackSize = (UInt64)1 << 20;
+
+class CFilterThread Z7_final: public CVirtThread
+{
+  CStreamBinder _binder;
+  CMyComPtr<ISequentialInStream> _inStream;
+  CMyComPtr<ISequentialOutStream> _outStream;
+  CMidBuffer _buf;
+  HRESULT _result;
+  bool _isStarted;
+public:
+  CFilterThread(): _isStarted(false) {}
+  ~CFilterThread() Z7_DESTRUCTOR_override { CVirtThread::WaitThreadFinish(); }
+  void Execute() Z7_override;
+
+  HRESULT StartStream(ISequentialInStream *inStream, CMyComPtr<ISequentialInStream> &binderInStream);
+  HRESULT WaitFinish();
+};
+
+
+// it closes reading from binder, and it waits finishing of thread
+
+struct CFilterThread_Releaser
+{
+  CFilterThread *Thread;
+  CMyComPtr<ISequentialInStream> BinderInStream;
+  
+  CFilterThread_Releaser(): Thread(NULL) {}
+  HRESULT Release()
+  {
+    BinderInStream.Release();
+    if (!Thread)
+      return S_OK;
+    CFilterThread *t = Thread;
+    Thread = NULL;
+    return t->WaitFinish();
+  }
+  ~CFilterThread_Releaser() { Release(); }
+};
+
+#endif
+
+#endif
@@ -0,0 +1,124 @@
+// IoStat.h
+
+#ifndef ZIP7_INC_IO_STAT_H
+#define ZIP7_INC_IO_STAT_H
+
+#ifndef _WIN32
+#include <time.h>
+#endif
+
+#include "../../Common/MyTypes.h"
+#include "../../Common/MyWindows.h"
+
+#ifndef Z7_ST
+#include "../../Windows/Synchronization.h"
+#endif
+
+/* Optional statistics of file I/O system calls.
+   File streams (CInFileStream, COutFileStream) update it,
+   if (IoStat) pointer is set. It's used for (-bt) switch. */
+
+// returns monotonic wall clock time in microseconds
+inline UInt64 IoStat_GetTime_us()
+{
+ #ifdef _WIN32
+  LARGE_INTEGER v, f;
+  if (::QueryPerformanceCounter(&v) && ::QueryPerformanceFrequency(&f) && f.QuadPart != 0)
+  {
+    const UInt64 freq = (UInt64)f.QuadPart;
+    const UInt64 val = (UInt64)v.QuadPart;
+    return val / freq * 1000000 + val % freq * 1000000 / freq;
+  }
+ #else
+  struct timespec ts;
+  if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+    return (UInt64)ts.tv_sec * 1000000 + (UInt64)ts.tv_nsec / 1000;
+ #endif
+  return 0;
+}
+
+namespace NIoStat
+{
+  enum EEnum
+  {
+    kRead,
+    kWrite,
+    kOpen,  // open / create of file
+    kClose, // close of file and setting of file attributes
+
+    kNumKinds
+  };
+}
+
+struct CIoStatItem
+{
+  UInt64 NumCalls;
+  UInt64 Size;
+  UInt64 Time;    // in microseconds
+  UInt64 MaxTime; // the longest call (stall)
+
+  void Clear()
+  {
+    NumCalls = 0;
+    Size = 0;
+    Time = 0;
+    MaxTime = 0;
+  }
+};
+
+// time and size of one stage of data processing (decoder, filter, CRC).
+// It's updated from one thread only, so no lock is required.
+struct CStageStatItem
+{
+  UInt64 Time; // in microseconds
+  UInt64 Size;
+
+  void Clear()
+  {
+    Time = 0;
+    Size = 0;
+  }
+
+  CStageStatItem() { Clear(); }
+
+  void Add(UInt64 startTime, UInt64 size)
+  {
+    Time += IoStat_GetTime_us() - startTime;
+    Size += size;
+  }
+};
+
+class CIoStat
+{
+ #ifndef Z7_ST
+  NWindows::NSynchronization::CCriticalSection _cs;
+ #endif
+public:
+  CIoStatItem Items[NIoStat::kNumKinds];
+
+  void Clear()
+  {
+    for (unsigned i = 0; i < NIoStat::kNumKinds; i++)
+      Items[i].Clear();
+  }
+
+  CIoStat() { Clear(); }
+
+  // (startTime) is value of IoStat_GetTime_us() before the call.
+  // The streams can be used from different threads, so we use lock here.
+  void AddCall(unsigned kind, UInt64 size, UInt64 startTime)
+  {
+    const UInt64 t = IoStat_GetTime_us() - startTime;
+   #ifndef Z7_ST
+    NWindows::NSynchronization::CCriticalSectionLock lock(_cs);
+   #endif
+    CIoStatItem &item = Items[kind];
+    item.NumCalls++;
+    item.Size += size;
+    item.Time += t;
+    if (item.MaxTime < t)
+      item.MaxTime = t;
+  }
+};
+
+#endif
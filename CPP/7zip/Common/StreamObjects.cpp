@@ -172,119 +172,3 @@ Z7_COM7F_IMF(CSequentialOutStreamSizeCount::Write(const void *data, UInt32 size,
     *processedSize = realProcessedSize;
   return result;
 }
-
-static const UInt64 kEmptyTag = (UInt64)(Int64)-1;
-
-void CCachedInStream::Free() throw()
-{
-  MyFree(_tags);
-  _tags = NULL;
-  MidFree(_data);
-  _data = NULL;
-}
-
-bool CCachedInStream::Alloc(unsigned blockSizeLog, unsigned numBlocksLog) throw()
-{
-  unsigned sizeLog = blockSizeLog + numBlocksLog;
-  if (sizeLog >= sizeof(size_t) * 8)
-    return false;
-  size_t dataSize = (size_t)1 << sizeLog;
-  if (!_data || dataSize != _dataSize)
-  {
-    MidFree(_data);
-    _data = (Byte *)MidAlloc(dataSize);
-    if (!_data)
-      return false;
-    _dataSize = dataSize;
-  }
-  if (!_tags || numBlocksLog != _numBlocksLog)
-  {
-    MyFree(_tags);
-    _tags = (UInt64 *)MyAlloc(sizeof(UInt64) << numBlocksLog);
-    if (!_tags)
-      return false;
-    _numBlocksLog = numBlocksLog;
-  }
-  _blockSizeLog = blockSizeLog;
-  return true;
-}
-
-void CCachedInStream::Init(UInt64 size) throw()
-{
-  _size = size;
-  _pos = 0;
-  const size_t numBlocks = (size_t)1 << _numBlocksLog;
-  for (size_t i = 0; i < numBlocks; i++)
-    _tags[i] = kEmptyTag;
-}
-
-Z7_COM7F_IMF(CCachedInStream::Read(void *data, UInt32 size, UInt32 *processedSize))
-{
-  if (processedSize)
-    *processedSize = 0;
-  if (size == 0)
-    return S_OK;
-  if (_pos >= _size)
-    return S_OK;
-
-  {
-    const UInt64 rem = _size - _pos;
-    if (size > rem)
-      size = (UInt32)rem;
-  }
-
-  while (size != 0)
-  {
-    const UInt64 cacheTag = _pos >> _blockSizeLog;
-    const size_t cacheIndex = (size_t)cacheTag & (((size_t)1 << _numBlocksLog) - 1);
-    Byte *p = _data + (cacheIndex << _blockSizeLog);
-
-    if (_tags[cacheIndex] != cacheTag)
-    {
-      _tags[cacheIndex] = kEmptyTag;
-      const UInt64 remInBlock = _size - (cacheTag << _blockSizeLog);
-      size_t blockSize = (size_t)1 << _blockSizeLog;
-      if (blockSize > remInBlock)
-        blockSize = (size_t)remInBlock;
-      
-      RINOK(ReadBlock(cacheTag, p, blockSize))
-      
-      _tags[cacheIndex] = cacheTag;
-    }
-    
-    const size_t kBlockSize = (size_t)1 << _blockSizeLog;
-    const size_t offset = (size_t)_pos & (kBlockSize - 1);
-    UInt32 cur = size;
-    const size_t rem = kBlockSize - offset;
-    if (cur > rem)
-      cur = (UInt32)rem;
-    
-    memcpy(data, p + offset, cur);
-    
-    if (processedSize)
-      *processedSize += cur;
-    data = (void *)((const Byte *)data + cur);
-    _pos += cur;
-    size -= cur;
-  }
-
-  return S_OK;
-}
-
- 
-Z7_COM7F_IMF(CCachedInStream::Seek(Int64 offset, UInt32 seekOrigin, UInt64 *newPosition))
-{
-  switch (seekOrigin)
-  {
-    case STREAM_SEEK_SET: break;
-    case STREAM_SEEK_CUR: offset += _pos; break;
-    case STREAM_SEEK_END: offset += _size; break;
-    default: return STG_E_INVALIDFUNCTION;
-  }
-  if (offset < 0)
-    return HRESULT_WIN32_ERROR_NEGATIVE_SEEK;
-  _pos = (UInt64)offset;
-  if (newPosition)
-    *newPosition = (UInt64)offset;
-  return S_OK;
-}
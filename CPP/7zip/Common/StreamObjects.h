@@ -119,28 +119,4 @@ public:
   UInt64 GetSize() const { return _size; }
 };
 
-
-class CCachedInStream:
-  public IInStream,
-  public CMyUnknownImp
-{
-  Z7_IFACES_IMP_UNK_2(ISequentialInStream, IInStream)
-
-  UInt64 *_tags;
-  Byte *_data;
-  size_t _dataSize;
-  unsigned _blockSizeLog;
-  unsigned _numBlocksLog;
-  UInt64 _size;
-  UInt64 _pos;
-protected:
-  virtual HRESULT ReadBlock(UInt64 blockIndex, Byte *dest, size_t blockSize) = 0;
-public:
-  CCachedInStream(): _tags(NULL), _data(NULL) {}
-  virtual ~CCachedInStream() { Free(); } // the destructor must be virtual (Release() calls it) !!!
-  void Free() throw();
-  bool Alloc(unsigned blockSizeLog, unsigned numBlocksLog) throw();
-  void Init(UInt64 size) throw();
-};
-
 #endif
@@ -24,6 +24,7 @@ class CBZip2CombinedCrc
 public:
   CBZip2CombinedCrc(): _value(0) {}
   void Init() { _value = 0; }
+  void Init(UInt32 digest) { _value = digest; }
   void Update(UInt32 v) { _value = ((_value << 1) | (_value >> 31)) ^ v; }
   UInt32 GetDigest() const { return _value ; }
 };
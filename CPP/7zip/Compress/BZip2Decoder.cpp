@@ -880,6 +880,9 @@ CDecoder::CDecoder():
     _inBuf(NULL),
     _inProcessed(0)
 {
+  #ifndef Z7_NO_READ_FROM_CODER
+  StopAtBlockStart = false;
+  #endif
   #ifndef Z7_ST
   MtMode = false;
   NeedWaitScout = false;
@@ -1600,6 +1603,9 @@ Z7_COM7F_IMF(CDecoder::Read(void *data, UInt32 size, UInt32 *processedSize))
     
     if (_blockFinished && Base.state == STATE_BLOCK_SIGNATURE)
     {
+      if (StopAtBlockStart && *processedSize != 0)
+        return S_OK;
+
       ErrorResult = ReadBlockSignature();
       
       if (ErrorResult != S_OK)
@@ -1667,6 +1673,38 @@ Z7_COM7F_IMF(CDecoder::Read(void *data, UInt32 size, UInt32 *processedSize))
 
 
 
+HRESULT CDecoder::InitBlockResume(ISequentialInStream *inStream, unsigned numSkipBits,
+    UInt32 blockSizeMax, UInt32 combinedCrc)
+{
+  SetInStream(inStream);
+  RINOK(SetOutStreamSize(NULL))
+  if (blockSizeMax == 0)
+    return S_OK;
+  Base.state = STATE_BLOCK_SIGNATURE;
+  Base.state2 = 0;
+  Base.IsBz = true;
+  Base.NumStreams = 1;
+  Base.blockSizeMax = blockSizeMax;
+  Base.CombinedCrc.Init(combinedCrc);
+  if (numSkipBits != 0)
+  {
+    RINOK(ReadInput())
+    if (Base._buf == Base._lim)
+      return S_FALSE;
+    Base._value = (UInt32)*Base._buf++ << (24 + numSkipBits);
+    Base._numBits = 8 - numSkipBits;
+  }
+  return S_OK;
+}
+
+
+bool CDecoder::IsAtBlockStart() const
+{
+  return _blockFinished && Base.state == STATE_BLOCK_SIGNATURE;
+}
+
+
+
 // ---------- NSIS ----------
 
 Z7_COM7F_IMF(CNsisDecoder::Read(void *data, UInt32 size, UInt32 *processedSize))
@@ -284,7 +284,7 @@ public:
   bool NeedWaitScout;
   bool MtMode;
 
-  NWindows::CThread Thread;
+  NWindows::CPoolThread Thread;
   NWindows::NSynchronization::CAutoResetEvent DecoderEvent;
   NWindows::NSynchronization::CAutoResetEvent ScoutEvent;
   // HRESULT ScoutRes;
@@ -368,6 +368,25 @@ public:
   UInt64 GetNumStreams() const { return Base.NumStreams; }
   UInt64 GetNumBlocks() const { return Base.NumBlocks; }
 
+  #ifndef Z7_NO_READ_FROM_CODER
+  /* Random access support (it's used for seek points index in bz2 handler).
+     InitBlockResume() prepares the decoder to Read() from new (inStream):
+       if (blockSizeMax == 0), it reads from the start of bzip2 stream.
+       if (blockSizeMax != 0), it reads from the block signature that starts at
+         (numSkipBits) bit offset in first byte of (inStream), and
+         (blockSizeMax) and (combinedCrc) are the state of bzip2 stream before that block.
+     If (StopAtBlockStart) is set, Read() stops at the start of next block,
+       if some data was already returned.
+     IsAtBlockStart() returns true, if the decoder is at the start of block signature.
+       The seek point can be created at that position. */
+  bool StopAtBlockStart;
+  HRESULT InitBlockResume(ISequentialInStream *inStream, unsigned numSkipBits,
+      UInt32 blockSizeMax, UInt32 combinedCrc);
+  bool IsAtBlockStart() const;
+  UInt64 GetInputProcessedBits() const
+    { return ((_inProcessed + (size_t)(Base._buf - _inBuf)) << 3) - Base._numBits; }
+  #endif
+
   CDecoder();
   virtual ~CDecoder();
 };
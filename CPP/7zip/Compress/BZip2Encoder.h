@@ -119,7 +119,7 @@ public:
   bool m_OptimizeNumTables;
   CEncoder *Encoder;
  #ifndef Z7_ST
-  NWindows::CThread Thread;
+  NWindows::CPoolThread Thread;
 
   NWindows::NSynchronization::CAutoResetEvent StreamWasFinishedEvent;
   NWindows::NSynchronization::CAutoResetEvent WaitingWasStartedEvent;
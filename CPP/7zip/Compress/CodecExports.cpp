@@ -5,6 +5,10 @@
 #include "../../../C/CpuArch.h"
 #include "../../../C/7zVersion.h"
 
+#if !defined(_WIN32) && !defined(Z7_ST)
+#include "../../../C/Threads.h"
+#endif
+
 #include "../../Common/ComTry.h"
 #include "../../Common/MyCom.h"
 
@@ -21,6 +25,16 @@ extern const CCodecInfo *g_Codecs[];
 extern unsigned g_NumHashers;
 extern const CHasherInfo *g_Hashers[];
 
+#if !defined(_WIN32) && !defined(Z7_ST)
+// codec plugin can be unloaded with dlclose(), while its pool has idle workers.
+// In Windows, idle workers hold a reference to the module, so it is not unloaded.
+static __attribute__((destructor)) void CodecExports_Free_ThreadPool();
+static __attribute__((destructor)) void CodecExports_Free_ThreadPool()
+{
+  ThreadPool_Shutdown();
+}
+#endif
+
 static void SetPropFromAscii(const char *s, PROPVARIANT *prop) throw()
 {
   const UINT len = (UINT)strlen(s);
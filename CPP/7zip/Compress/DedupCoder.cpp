@@ -0,0 +1,650 @@
+// DedupCoder.cpp
+
+#include "StdAfx.h"
+
+#include <string.h>
+
+#include "../../../C/7zCrc.h"
+#include "../../../C/Alloc.h"
+
+#include "../../Common/MyCom.h"
+
+#include "../ICoder.h"
+
+#include "../Common/InBuffer.h"
+#include "../Common/RegisterCodec.h"
+#include "../Common/StreamUtils.h"
+
+namespace NCompress {
+namespace NDedup {
+
+/*
+Dedup is long range deduplication coder.
+It's intended to be used before LZMA/LZMA2 for data that contains
+duplicated blocks at distances that are larger than dictionary of main coder.
+
+Properties: 1 byte (b): window = (2 | (b & 1)) << (b / 2 + 15)
+
+Stream is sequence of records. Each record starts with varint (7 bits per byte, little-endian):
+  header = (len << 1) | isCopy
+  header == 0        : end of stream
+  isCopy == 0        : (len) literal bytes follow. These bytes are appended to history.
+  isCopy == 1        : varint (dist) follows. Decoder copies (len) bytes from history
+                       starting at (dist) bytes before the end of history.
+                       History is not changed by copy record.
+                       (len <= dist <= window) and (dist <= size of history).
+
+History contains only literal bytes. So (window) limits the size of unique data,
+and duplicates can be found at any distance in original data.
+The decoder needs (window) bytes of memory (or the size of output, if it's smaller).
+*/
+
+static const unsigned kPropMax = 48;
+static const UInt32 kWindowMin = (UInt32)1 << 16;
+
+static UInt64 PropToWindow(unsigned b)
+{
+  return (UInt64)(2 | (b & 1)) << (b / 2 + 15);
+}
+
+static const size_t kBufSize = (size_t)1 << 20;
+
+static bool ReadNumber(CInBuffer &s, UInt64 &res)
+{
+  UInt64 v = 0;
+  for (unsigned shift = 0;; shift += 7)
+  {
+    Byte b;
+    if (!s.ReadByte(b))
+      return false;
+    if (shift == 63 && b > 1)
+      return false;
+    v |= (UInt64)(b & 0x7F) << shift;
+    if ((b & 0x80) == 0)
+    {
+      res = v;
+      return true;
+    }
+  }
+}
+
+
+#ifndef Z7_EXTRACT_ONLY
+
+// content-defined chunks: (kChunkMin <= size <= kChunkMax), average size is about (kChunkMin + (1 << kChunkAvgBits))
+static const size_t kChunkMin = (size_t)1 << 11;
+static const size_t kChunkMax = (size_t)1 << 16;
+static const unsigned kChunkAvgBits = 13;
+
+static const size_t kInBufSize = (size_t)1 << 22;
+static const UInt32 kLitRecordMax = (UInt32)1 << 20;
+static const unsigned kNumProbes = 8;
+static const unsigned kIndexBitsMax = 22;
+
+static UInt64 g_Gear[256];
+
+static struct CGearTableInit { CGearTableInit()
+{
+  // splitmix64
+  UInt64 x = 0;
+  for (unsigned i = 0; i < 256; i++)
+  {
+    x += 0x9E3779B97F4A7C15;
+    UInt64 z = x;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+    g_Gear[i] = z ^ (z >> 31);
+  }
+}} g_GearTableInit;
+
+// gear rolling hash: high bits of (h) depend on last 64 bytes
+static size_t FindChunkEnd(const Byte *p, size_t size)
+{
+  if (size <= kChunkMin)
+    return size;
+  UInt64 h = 0;
+  size_t i = kChunkMin - 64;
+  for (; i < kChunkMin; i++)
+    h = (h << 1) + g_Gear[p[i]];
+  for (; i < size; i++)
+  {
+    h = (h << 1) + g_Gear[p[i]];
+    if ((h >> (64 - kChunkAvgBits)) == 0)
+      return i + 1;
+  }
+  return size;
+}
+
+struct CIndexItem
+{
+  UInt64 Pos;  // position in history
+  UInt32 Crc;
+  UInt32 Size; // 0 for empty item
+};
+
+Z7_CLASS_IMP_COM_3(
+  CEncoder
+  , ICompressCoder
+  , ICompressSetCoderProperties
+  , ICompressWriteCoderProperties
+)
+  Byte *_inBuf;
+  Byte *_outBuf;
+  size_t _outPos;
+  ISequentialOutStream *_outStream;
+  UInt64 _outProcessed;
+
+  Byte *_ring;
+  size_t _ringSize;
+  CIndexItem *_index;
+  UInt32 _indexMask;
+
+  size_t _window;    // from properties
+  size_t _windowCur; // for current stream
+  UInt64 _windowProp;
+  UInt64 _reduceSize;
+  UInt64 _litPos;
+
+  UInt64 _pendLen;  // size of pending record
+  UInt64 _pendDist; // 0 for pending literal record
+
+  HRESULT FlushOut();
+  HRESULT WriteOut(const Byte *data, size_t size);
+  HRESULT WriteNumber(UInt64 v);
+  HRESULT WritePending();
+  bool RingEquals(UInt64 pos, const Byte *data, size_t size) const;
+  bool RingAppend(const Byte *data, size_t size);
+  HRESULT ProcessChunk(const Byte *data, size_t size);
+  void FreeBufs();
+public:
+  CEncoder();
+  ~CEncoder();
+};
+
+static const UInt64 kWindowDefault = (sizeof(size_t) > 4 ? ((UInt64)1 << 30) : ((UInt64)1 << 28));
+static const UInt64 kWindowMax = (sizeof(size_t) > 4 ? ((UInt64)1 << 40) : ((UInt64)1 << 30));
+
+CEncoder::CEncoder():
+    _inBuf(NULL),
+    _outBuf(NULL),
+    _ring(NULL),
+    _ringSize(0),
+    _index(NULL),
+    _indexMask(0),
+    _window((size_t)kWindowDefault),
+    _windowCur((size_t)kWindowDefault),
+    _windowProp(kWindowDefault),
+    _reduceSize((UInt64)(Int64)-1),
+    _litPos(0)
+    {}
+
+void CEncoder::FreeBufs()
+{
+  ::MidFree(_ring);
+  _ring = NULL;
+  _ringSize = 0;
+  ::MidFree(_index);
+  _index = NULL;
+  _indexMask = 0;
+}
+
+CEncoder::~CEncoder()
+{
+  FreeBufs();
+  ::MidFree(_inBuf);
+  ::MidFree(_outBuf);
+}
+
+Z7_COM7F_IMF(CEncoder::SetCoderProperties(const PROPID *propIDs, const PROPVARIANT *coderProps, UInt32 numProps))
+{
+  UInt64 window = kWindowDefault;
+  UInt64 reduceSize = (UInt64)(Int64)-1;
+  for (UInt32 i = 0; i < numProps; i++)
+  {
+    const PROPVARIANT &prop = coderProps[i];
+    const PROPID propID = propIDs[i];
+    if (propID > NCoderPropID::kReduceSize)
+      continue;
+    if (propID == NCoderPropID::kReduceSize)
+    {
+      if (prop.vt == VT_UI8)
+        reduceSize = prop.uhVal.QuadPart;
+      continue;
+    }
+    if (propID == NCoderPropID::kDictionarySize)
+    {
+      if (prop.vt == VT_UI8)
+        window = prop.uhVal.QuadPart;
+      else if (prop.vt == VT_UI4)
+        window = prop.ulVal;
+      else
+        return E_INVALIDARG;
+      if (window < kWindowMin)
+        return E_INVALIDARG;
+      continue;
+    }
+    if (prop.vt != VT_UI4)
+      return E_INVALIDARG;
+    switch (propID)
+    {
+      case NCoderPropID::kNumThreads: break;
+      case NCoderPropID::kLevel: break;
+      default: return E_INVALIDARG;
+    }
+  }
+  if (window > kWindowMax)
+    window = kWindowMax;
+  _window = (size_t)window;
+  _windowProp = window;
+  _reduceSize = reduceSize;
+  return S_OK;
+}
+
+Z7_COM7F_IMF(CEncoder::WriteCoderProperties(ISequentialOutStream *outStream))
+{
+  /* 7z encoder calls WriteCoderProperties() also after Code().
+     So we can write the size of history that was really used. */
+  unsigned b;
+  for (b = 0; b < kPropMax && PropToWindow(b) < _windowProp; b++);
+  const Byte prop = (Byte)b;
+  return WriteStream(outStream, &prop, 1);
+}
+
+HRESULT CEncoder::FlushOut()
+{
+  if (_outPos == 0)
+    return S_OK;
+  _outProcessed += _outPos;
+  const size_t size = _outPos;
+  _outPos = 0;
+  return WriteStream(_outStream, _outBuf, size);
+}
+
+HRESULT CEncoder::WriteOut(const Byte *data, size_t size)
+{
+  while (size != 0)
+  {
+    size_t cur = kBufSize - _outPos;
+    if (cur > size)
+      cur = size;
+    memcpy(_outBuf + _outPos, data, cur);
+    _outPos += cur;
+    data += cur;
+    size -= cur;
+    if (_outPos == kBufSize)
+    {
+      RINOK(FlushOut())
+    }
+  }
+  return S_OK;
+}
+
+HRESULT CEncoder::WriteNumber(UInt64 v)
+{
+  Byte buf[10];
+  unsigned i = 0;
+  for (; v >= 0x80; v >>= 7)
+    buf[i++] = (Byte)(v | 0x80);
+  buf[i++] = (Byte)v;
+  return WriteOut(buf, i);
+}
+
+HRESULT CEncoder::WritePending()
+{
+  const UInt64 len = _pendLen;
+  if (len == 0)
+    return S_OK;
+  _pendLen = 0;
+  if (_pendDist != 0)
+  {
+    RINOK(WriteNumber((len << 1) | 1))
+    return WriteNumber(_pendDist);
+  }
+  RINOK(WriteNumber(len << 1))
+  // pending literal bytes are last (len) bytes of history
+  const size_t pos = (size_t)((_litPos - len) % _ringSize);
+  const size_t rem = _ringSize - pos;
+  if (rem >= len)
+    return WriteOut(_ring + pos, (size_t)len);
+  RINOK(WriteOut(_ring + pos, rem))
+  return WriteOut(_ring, (size_t)len - rem);
+}
+
+bool CEncoder::RingEquals(UInt64 pos, const Byte *data, size_t size) const
+{
+  const size_t rp = (size_t)(pos % _ringSize);
+  const size_t rem = _ringSize - rp;
+  if (rem >= size)
+    return memcmp(_ring + rp, data, size) == 0;
+  return memcmp(_ring + rp, data, rem) == 0
+      && memcmp(_ring, data + rem, size - rem) == 0;
+}
+
+bool CEncoder::RingAppend(const Byte *data, size_t size)
+{
+  if (_litPos + size > _ringSize && _ringSize < _windowCur)
+  {
+    // history was not wrapped still, so we can grow the buffer
+    size_t newSize = _ringSize * 2;
+    if (newSize < kBufSize)
+      newSize = kBufSize;
+    if (newSize < _litPos + size)
+      newSize = (size_t)_litPos + size;
+    if (newSize > _windowCur)
+      newSize = _windowCur;
+    Byte *ring = (Byte *)::MidAlloc(newSize);
+    if (!ring)
+      return false;
+    if (_litPos != 0)
+      memcpy(ring, _ring, (size_t)_litPos);
+    ::MidFree(_ring);
+    _ring = ring;
+    _ringSize = newSize;
+  }
+  const size_t pos = (size_t)(_litPos % _ringSize);
+  const size_t rem = _ringSize - pos;
+  if (rem >= size)
+    memcpy(_ring + pos, data, size);
+  else
+  {
+    memcpy(_ring + pos, data, rem);
+    memcpy(_ring, data + rem, size - rem);
+  }
+  _litPos += size;
+  return true;
+}
+
+HRESULT CEncoder::ProcessChunk(const Byte *data, size_t size)
+{
+  const UInt32 crc = CrcCalc(data, size);
+  CIndexItem *items = _index;
+  const UInt32 mask = _indexMask;
+  const UInt32 hash = crc ^ (UInt32)(size * 0x9E3779B1);
+
+  CIndexItem *dest = NULL;
+  CIndexItem *oldest = NULL;
+  for (unsigned i = 0; i < kNumProbes; i++)
+  {
+    CIndexItem &item = items[(hash + i) & mask];
+    if (item.Size == 0)
+    {
+      dest = &item;
+      break;
+    }
+    if (item.Crc == crc && item.Size == size
+        && _litPos - item.Pos <= _ringSize
+        && RingEquals(item.Pos, data, size))
+    {
+      const UInt64 dist = _litPos - item.Pos;
+      if (_pendLen != 0 && _pendDist != 0 && _pendDist - _pendLen == dist)
+      {
+        // this copy continues the previous copy
+        _pendLen += size;
+        return S_OK;
+      }
+      RINOK(WritePending())
+      _pendLen = size;
+      _pendDist = dist;
+      return S_OK;
+    }
+    if (!oldest || oldest->Pos > item.Pos)
+      oldest = &item;
+  }
+  // we replace oldest item, if there is no free item
+  if (!dest)
+    dest = oldest;
+
+  // pending literal bytes must be still in history, when we write them
+  if (_pendLen != 0 && (_pendDist != 0
+      || _pendLen + size > kLitRecordMax
+      || _pendLen + size > _windowCur))
+  {
+    RINOK(WritePending())
+  }
+  const UInt64 pos = _litPos;
+  if (!RingAppend(data, size))
+    return E_OUTOFMEMORY;
+  _pendDist = 0;
+  _pendLen += size;
+  dest->Pos = pos;
+  dest->Crc = crc;
+  dest->Size = (UInt32)size;
+  return S_OK;
+}
+
+Z7_COM7F_IMF(CEncoder::Code(ISequentialInStream *inStream, ISequentialOutStream *outStream,
+    const UInt64 * /* inSize */, const UInt64 * /* outSize */, ICompressProgressInfo *progress))
+{
+  size_t window = _window;
+  if (window > _reduceSize)
+  {
+    window = (size_t)_reduceSize;
+    if (window < kWindowMin)
+      window = kWindowMin;
+  }
+
+  {
+    unsigned numBits = 10;
+    while (numBits < kIndexBitsMax && ((UInt64)1 << numBits) < (window >> (kChunkAvgBits - 1)))
+      numBits++;
+    const UInt32 mask = ((UInt32)1 << numBits) - 1;
+    if (!_index || _indexMask != mask)
+    {
+      FreeBufs();
+      _index = (CIndexItem *)::MidAlloc(((size_t)mask + 1) * sizeof(CIndexItem));
+      if (!_index)
+        return E_OUTOFMEMORY;
+      _indexMask = mask;
+    }
+    memset(_index, 0, ((size_t)mask + 1) * sizeof(CIndexItem));
+  }
+  if (_ringSize > window)
+  {
+    ::MidFree(_ring);
+    _ring = NULL;
+    _ringSize = 0;
+  }
+
+  if (!_inBuf)
+  {
+    _inBuf = (Byte *)::MidAlloc(kInBufSize);
+    if (!_inBuf)
+      return E_OUTOFMEMORY;
+  }
+  if (!_outBuf)
+  {
+    _outBuf = (Byte *)::MidAlloc(kBufSize);
+    if (!_outBuf)
+      return E_OUTOFMEMORY;
+  }
+
+  _windowCur = window;
+  _windowProp = window;
+  _litPos = 0;
+  _pendLen = 0;
+  _pendDist = 0;
+  _outPos = 0;
+  _outProcessed = 0;
+  _outStream = outStream;
+
+  UInt64 inProcessed = 0;
+  size_t avail = 0;
+  bool finished = false;
+
+  while (!finished)
+  {
+    {
+      size_t size = kInBufSize - avail;
+      const size_t sizeRequested = size;
+      RINOK(ReadStream(inStream, _inBuf + avail, &size))
+      finished = (size != sizeRequested);
+      avail += size;
+      inProcessed += size;
+    }
+    size_t pos = 0;
+    while (finished ? pos != avail : avail - pos >= kChunkMax)
+    {
+      size_t rem = avail - pos;
+      if (rem > kChunkMax)
+        rem = kChunkMax;
+      const size_t size = FindChunkEnd(_inBuf + pos, rem);
+      RINOK(ProcessChunk(_inBuf + pos, size))
+      pos += size;
+    }
+    avail -= pos;
+    memmove(_inBuf, _inBuf + pos, avail);
+    if (progress)
+    {
+      const UInt64 outProcessed = _outProcessed + _outPos;
+      const UInt64 inCur = inProcessed - avail;
+      RINOK(progress->SetRatioInfo(&inCur, &outProcessed))
+    }
+  }
+
+  RINOK(WritePending())
+  RINOK(WriteNumber(0))
+  RINOK(FlushOut())
+
+  _windowProp = _litPos < window ? _litPos : window;
+  return S_OK;
+}
+
+#endif
+
+
+
+Z7_CLASS_IMP_COM_2(
+  CDecoder
+  , ICompressCoder
+  , ICompressSetDecoderProperties2
+)
+  Byte *_ring;
+  size_t _ringSize;
+  UInt64 _window;
+  bool _propsWereSet;
+public:
+  CDecoder(): _ring(NULL), _ringSize(0), _window(0), _propsWereSet(false) {}
+  ~CDecoder() { ::MidFree(_ring); }
+};
+
+Z7_COM7F_IMF(CDecoder::SetDecoderProperties2(const Byte *props, UInt32 size))
+{
+  if (size != 1)
+    return E_NOTIMPL;
+  if (props[0] > kPropMax)
+    return E_NOTIMPL;
+  _window = PropToWindow(props[0]);
+  _propsWereSet = true;
+  return S_OK;
+}
+
+Z7_COM7F_IMF(CDecoder::Code(ISequentialInStream *inStream, ISequentialOutStream *outStream,
+    const UInt64 * /* inSize */, const UInt64 *outSize, ICompressProgressInfo *progress))
+{
+  if (!_propsWereSet)
+    return E_NOTIMPL;
+  UInt64 window = _window;
+  // history can't be larger than output
+  if (outSize && window > *outSize)
+    window = *outSize;
+  if (window < kWindowMin)
+    window = kWindowMin;
+  if (window > (size_t)0 - 1)
+    return E_OUTOFMEMORY;
+  if (!_ring || _ringSize != window)
+  {
+    ::MidFree(_ring);
+    _ringSize = 0;
+    _ring = (Byte *)::MidAlloc((size_t)window);
+    if (!_ring)
+      return E_OUTOFMEMORY;
+    _ringSize = (size_t)window;
+  }
+
+  try {
+
+  CInBuffer inBuffer;
+  if (!inBuffer.Create(kBufSize))
+    return E_OUTOFMEMORY;
+  inBuffer.SetStream(inStream);
+  inBuffer.Init();
+
+  const size_t ringSize = _ringSize;
+  Byte * const ring = _ring;
+  UInt64 litPos = 0;
+  UInt64 outProcessed = 0;
+  UInt64 progressPos = 0;
+
+  for (;;)
+  {
+    UInt64 header;
+    if (!ReadNumber(inBuffer, header))
+      return S_FALSE;
+    if (header == 0)
+      break;
+    const UInt64 len = header >> 1;
+    if (len == 0 || (outSize && len > *outSize - outProcessed))
+      return S_FALSE;
+    UInt64 rem = len;
+
+    if (header & 1)
+    {
+      UInt64 dist;
+      if (!ReadNumber(inBuffer, dist))
+        return S_FALSE;
+      if (dist < len || dist > litPos || dist > ringSize)
+        return S_FALSE;
+      size_t pos = (size_t)((litPos - dist) % ringSize);
+      do
+      {
+        size_t cur = ringSize - pos;
+        if (cur > rem)
+          cur = (size_t)rem;
+        RINOK(WriteStream(outStream, ring + pos, cur))
+        rem -= cur;
+        pos = 0;
+      }
+      while (rem != 0);
+    }
+    else
+    {
+      do
+      {
+        const size_t pos = (size_t)(litPos % ringSize);
+        size_t cur = ringSize - pos;
+        if (cur > rem)
+          cur = (size_t)rem;
+        if (inBuffer.ReadBytes(ring + pos, cur) != cur)
+          return S_FALSE;
+        RINOK(WriteStream(outStream, ring + pos, cur))
+        litPos += cur;
+        rem -= cur;
+      }
+      while (rem != 0);
+    }
+
+    outProcessed += len;
+    if (progress && outProcessed - progressPos >= ((UInt32)1 << 22))
+    {
+      progressPos = outProcessed;
+      const UInt64 inProcessed = inBuffer.GetProcessedSize();
+      RINOK(progress->SetRatioInfo(&inProcessed, &outProcessed))
+    }
+  }
+
+  if (outSize && *outSize != outProcessed)
+    return S_FALSE;
+  return S_OK;
+
+  }
+  catch(const CInBufferException &e) { return e.ErrorCode; }
+  catch(...) { return S_FALSE; }
+}
+
+REGISTER_CODEC_E(Dedup,
+    CDecoder(),
+    CEncoder(),
+    0x3FFD010644E40001,
+    "Dedup")
+
+}}
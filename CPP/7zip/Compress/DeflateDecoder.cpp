@@ -565,4 +565,51 @@ HRESULT CCoder::CodeResume(ISequentialOutStream *outStream, const UInt64 *outSiz
   return CodeReal(outStream, progress);
 }
 
+
+HRESULT CCoder::InitResume(const Byte *history, UInt32 historySize, unsigned numSkipBits)
+{
+  if (!m_OutWindowStream.Create(_deflate64Mode ? kHistorySize64: kHistorySize32))
+    return E_OUTOFMEMORY;
+  HRESULT res = S_OK;
+  DEFLATE_TRY_BEGIN
+  m_OutWindowStream.SetStream(NULL);
+  m_OutWindowStream.SetMemStream(NULL);
+  m_OutWindowStream.Init(false);
+  // the history data is not written to any stream. It's only stored in window.
+  m_OutWindowStream.PutBytes(history, historySize);
+  m_OutWindowStream.FlushWithCheck();
+  if (numSkipBits != 0)
+    ReadBits(numSkipBits);
+  DEFLATE_TRY_END(res)
+  RINOK(res)
+  if (m_InBitStream.ExtraBitsWereRead())
+    return S_FALSE;
+  _keepHistory = true;
+  _outSizeDefined = false;
+  _outSize = 0;
+  _outStartPos = m_OutWindowStream.GetProcessedSize();
+  _remainLen = kLenIdNeedInit;
+  return S_OK;
+}
+
+
+HRESULT CCoder::ReadToMem(Byte *data, UInt32 size, UInt32 &processedSize, bool stopAtBlockStart)
+{
+  processedSize = 0;
+  const UInt64 outPos = GetOutProcessedCur();
+  HRESULT res;
+  DEFLATE_TRY_BEGIN
+  m_OutWindowStream.SetMemStream(data);
+  res = CodeSpec(size, false, stopAtBlockStart ? 1 : 0);
+  DEFLATE_TRY_END(res)
+  {
+    const HRESULT res2 = Flush();
+    if (res2 != S_OK)
+      res = res2;
+  }
+  processedSize = (UInt32)(GetOutProcessedCur() - outPos);
+  m_OutWindowStream.SetMemStream(NULL);
+  return res;
+}
+
 }}}
@@ -144,6 +144,22 @@ public:
 
   // size of virtual input stream processed
   UInt64 GetInputProcessedSize() const { return m_InBitStream.GetProcessedSize(); }
+
+  // number of virtual input bits processed
+  UInt64 GetInputProcessedBits() const { return m_InBitStream.GetProcessedBits(); }
+
+  /* Random access support (it's used for seek points index in gz handler).
+     InitResume() prepares the decoder to decode from the start of some deflate block.
+       InitInStream(true) must be called before for new position in input stream.
+       (history) : the unpacked data before that block (up to 32 KiB).
+       (numSkipBits) : the bit offset of block start in first byte of input stream.
+     IsAtBlockStart() returns true, if the decoder is at the start of new (not final) block.
+       The seek point can be created at that position with GetHistory() data. */
+  HRESULT InitResume(const Byte *history, UInt32 historySize, unsigned numSkipBits);
+  bool IsAtBlockStart() const { return _remainLen == 0 && _needReadTable && !m_FinalBlock; }
+  void GetHistory(Byte *dest, UInt32 size) const { m_OutWindowStream.GetHistory(dest, size); }
+  // if (stopAtBlockStart), it stops at the start of next block after some input was processed
+  HRESULT ReadToMem(Byte *data, UInt32 size, UInt32 &processedSize, bool stopAtBlockStart);
 };
 
 class CCOMCoder     : public CCoder { public: CCOMCoder(): CCoder(false) {} };
@@ -97,6 +97,20 @@ public:
       pos += _bufSize;
     return _buf[pos];
   }
+
+  // it copies (size) last written bytes to (dest). (size <= _bufSize)
+  void GetHistory(Byte *dest, UInt32 size) const
+  {
+    const UInt32 pos = _pos;
+    if (size > pos)
+    {
+      const UInt32 rem = size - pos;
+      memcpy(dest, _buf + _bufSize - rem, rem);
+      dest += rem;
+      size = pos;
+    }
+    memcpy(dest, _buf + pos - size, size);
+  }
 };
 
 #endif
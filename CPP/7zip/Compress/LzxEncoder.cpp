@@ -0,0 +1,496 @@
+// LzxEncoder.cpp
+
+#include "StdAfx.h"
+
+#include <string.h>
+
+#include "../../../C/CpuArch.h"
+#include "../../../C/HuffEnc.h"
+
+#include "Lzx.h"
+#include "LzxEncoder.h"
+
+namespace NCompress {
+namespace NLzx {
+
+static const unsigned kNumDictBits = 15;
+static const unsigned kNumPosSlots_Enc = kNumDictBits * 2;
+static const unsigned kNumMainSyms = 256 + kNumPosSlots_Enc * kNumLenSlots;
+// the largest (dist + kNumReps - 1) must be coded with (kNumPosSlots_Enc) slots
+static const UInt32 kDistMax = ((UInt32)1 << kNumDictBits) - kNumReps;
+
+static const unsigned kNumHashBytes = 3;
+static const unsigned kNumHashBits = 15;
+static const UInt32 kHashSize = (UInt32)1 << kNumHashBits;
+
+static const size_t kSrcSizeMin = 64;
+
+static const UInt32 kX86TranslationSize = 12000000;
+
+// item: (literal) or ((len << 16) | code)
+// code: (rep index) or (dist + kNumReps - 1)
+
+CEncoder::CEncoder():
+    _base(1),
+    _curBase(1),
+    _numCycles(16),
+    _lazy(true)
+  {}
+
+void CEncoder::SetLevel(UInt32 level)
+{
+  _lazy = (level >= 3);
+  _numCycles =
+      level <= 1 ? 4 :
+      level <= 4 ? 8 :
+      level <= 6 ? 16 :
+      level <= 8 ? 64 : 256;
+}
+
+void CEncoder::Alloc()
+{
+  if (!_hash)
+  {
+    _hash.Alloc(kHashSize);
+    _prev.Alloc(kEncoderChunkSizeMax);
+    _items.Alloc(kEncoderChunkSizeMax);
+    _buf.Alloc(kEncoderChunkSizeMax);
+    Normalize();
+  }
+}
+
+void CEncoder::Normalize()
+{
+  memset(_hash, 0, kHashSize * sizeof(UInt32));
+  _base = 1;
+}
+
+
+#define HASH_CALC(p) ((((UInt32)(p)[0] | ((UInt32)(p)[1] << 8) | ((UInt32)(p)[2] << 16)) * 0x9E3779B1) >> (32 - kNumHashBits))
+
+static unsigned GetNumBits(UInt32 v)
+{
+  unsigned n = 0;
+  while ((v >>= 1) != 0)
+    n++;
+  return n;
+}
+
+// (code >= kNumReps)
+static unsigned GetPosSlot(UInt32 code)
+{
+  const unsigned n = GetNumBits(code);
+  return n * 2 + ((code >> (n - 1)) & 1);
+}
+
+
+/* The decoder (WIM mode) translates the targets of E8 (call) instructions
+   from absolute to relative form. So we do the reverse translation here. */
+
+static void x86_Filter_Encode(Byte *data, size_t size)
+{
+  const size_t kResidue = 10;
+  if (size <= kResidue)
+    return;
+  const size_t lim = size - kResidue;
+  for (size_t i = 0; i < lim;)
+  {
+    if (data[i] != 0xE8)
+    {
+      i++;
+      continue;
+    }
+    Byte *p = data + i + 1;
+    const Int32 rel = (Int32)GetUi32(p);
+    const Int32 pos = (Int32)i;
+    if (rel >= -pos && rel < (Int32)kX86TranslationSize)
+    {
+      const Int32 v = (rel < (Int32)kX86TranslationSize - pos) ?
+          rel + pos :
+          rel - (Int32)kX86TranslationSize;
+      SetUi32(p, (UInt32)v)
+    }
+    i += 5;
+  }
+}
+
+
+// it finds longest match at (pos) and inserts (pos) to hash chain
+
+UInt32 CEncoder::FindMatch(const Byte *src, size_t srcSize, size_t pos, UInt32 &distRes)
+{
+  if (srcSize - pos < kNumHashBytes)
+    return 0;
+  const Byte *cur = src + pos;
+  const UInt32 base = _curBase;
+  const UInt32 cur32 = base + (UInt32)pos;
+  const UInt32 h = HASH_CALC(cur);
+  UInt32 m = _hash[h];
+  _hash[h] = cur32;
+  _prev[pos] = m;
+  UInt32 lenLimit = (UInt32)(srcSize - pos);
+  if (lenLimit > kMatchMaxLen)
+    lenLimit = kMatchMaxLen;
+  UInt32 lenRes = 0;
+  for (UInt32 cycles = _numCycles; m >= base && cycles != 0; cycles--)
+  {
+    const UInt32 dist = cur32 - m;
+    if (dist > kDistMax)
+      break;
+    const Byte *p = cur - dist;
+    m = _prev[pos - dist];
+    if (p[lenRes] != cur[lenRes] || p[0] != cur[0])
+      continue;
+    UInt32 len = 1;
+    while (len != lenLimit && p[len] == cur[len])
+      len++;
+    if (len > lenRes)
+    {
+      lenRes = len;
+      distRes = dist;
+      if (len == lenLimit)
+        break;
+    }
+  }
+  if (lenRes < kNumHashBytes)
+    return 0;
+  // short match with big distance is not better than literals
+  if (lenRes == kNumHashBytes && distRes > ((UInt32)1 << 12))
+    return 0;
+  return lenRes;
+}
+
+
+// it returns the length of match (or 0) and the (code) for item
+
+UInt32 CEncoder::GetMatch(const Byte *src, size_t srcSize, size_t pos, const UInt32 *reps, UInt32 &code)
+{
+  UInt32 dist = 0;
+  const UInt32 len = FindMatch(src, srcSize, pos, dist);
+  code = dist + kNumReps - 1;
+
+  UInt32 lenLimit = (UInt32)(srcSize - pos);
+  if (lenLimit > kMatchMaxLen)
+    lenLimit = kMatchMaxLen;
+  if (lenLimit < kMatchMinLen)
+    return len;
+  UInt32 repLen = 0;
+  unsigned repIndex = 0;
+  const Byte *cur = src + pos;
+  for (unsigned i = 0; i < kNumReps; i++)
+  {
+    const UInt32 rep = reps[i];
+    if (rep > pos)
+      continue;
+    const Byte *p = cur - rep;
+    if (p[0] != cur[0] || p[1] != cur[1])
+      continue;
+    UInt32 k = kMatchMinLen;
+    while (k != lenLimit && p[k] == cur[k])
+      k++;
+    if (k > repLen)
+    {
+      repLen = k;
+      repIndex = i;
+    }
+  }
+  // rep match is cheaper than new match of same length
+  if (repLen != 0 && repLen + 1 >= len)
+  {
+    code = repIndex;
+    return repLen;
+  }
+  return len;
+}
+
+
+struct CBitWriter
+{
+  Byte *Cur;
+  UInt32 Buf;
+  unsigned Count;
+
+  // (num <= 16)
+  void WriteBits(UInt32 val, unsigned num)
+  {
+    Buf = (Buf << num) | val;
+    Count += num;
+    if (Count >= 16)
+    {
+      Count -= 16;
+      SetUi16(Cur, (UInt16)(Buf >> Count))
+      Cur += 2;
+    }
+  }
+
+  void Flush()
+  {
+    if (Count != 0)
+    {
+      SetUi16(Cur, (UInt16)(Buf << (16 - Count)))
+      Cur += 2;
+      Count = 0;
+    }
+  }
+};
+
+
+// level item: (sym) | (extra << 5)
+
+static const unsigned kLevelItem_SymBits = 5;
+
+/* it writes (levels) with pretree.
+   The levels of previous block are zeros, because each chunk contains one block. */
+
+static bool WriteTable(CBitWriter &bw, const Byte *levels, unsigned numLevels, const Byte *lim)
+{
+  UInt16 items[kNumMainSyms];
+  unsigned numItems = 0;
+  UInt32 freqs[kLevelTableSize];
+  memset(freqs, 0, sizeof(freqs));
+
+  for (unsigned i = 0; i < numLevels;)
+  {
+    const unsigned v = levels[i];
+    unsigned num = 1;
+    while (i + num < numLevels && levels[i + num] == v)
+      num++;
+    if (v == 0 && num >= kLevelSym_Zero1_Start)
+    {
+      unsigned sym;
+      if (num >= kLevelSym_Zero2_Start)
+      {
+        const unsigned kMax = kLevelSym_Zero2_Start + (1 << kLevelSym_Zero2_NumBits) - 1;
+        if (num > kMax)
+          num = kMax;
+        sym = kLevelSym_Zero2 | ((num - kLevelSym_Zero2_Start) << kLevelItem_SymBits);
+      }
+      else
+        sym = kLevelSym_Zero1 | ((num - kLevelSym_Zero1_Start) << kLevelItem_SymBits);
+      items[numItems++] = (UInt16)sym;
+      freqs[sym & ((1 << kLevelItem_SymBits) - 1)]++;
+      i += num;
+      continue;
+    }
+    // delta from the level of previous block (0)
+    const unsigned delta = (kNumHuffmanBits + 1 - v) % (kNumHuffmanBits + 1);
+    if (num >= kLevelSym_Same_Start)
+    {
+      const unsigned kMax = kLevelSym_Same_Start + (1 << kLevelSym_Same_NumBits) - 1;
+      if (num > kMax)
+        num = kMax;
+      items[numItems++] = (UInt16)(kLevelSym_Same | ((num - kLevelSym_Same_Start) << kLevelItem_SymBits));
+      freqs[kLevelSym_Same]++;
+    }
+    else
+      num = 1;
+    items[numItems++] = (UInt16)delta;
+    freqs[delta]++;
+    i += num;
+  }
+
+  UInt32 codes[kLevelTableSize];
+  Byte lens[kLevelTableSize];
+  Huffman_Generate(freqs, codes, lens, kLevelTableSize, (1 << kNumLevelBits) - 1);
+
+  for (unsigned k = 0; k < kLevelTableSize; k++)
+    bw.WriteBits(lens[k], kNumLevelBits);
+
+  for (unsigned k = 0; k < numItems; k++)
+  {
+    if (bw.Cur > lim)
+      return false;
+    const unsigned item = items[k];
+    const unsigned sym = item & ((1 << kLevelItem_SymBits) - 1);
+    bw.WriteBits(codes[sym], lens[sym]);
+    const unsigned extra = item >> kLevelItem_SymBits;
+    if (sym == kLevelSym_Zero1)
+      bw.WriteBits(extra, kLevelSym_Zero1_NumBits);
+    else if (sym == kLevelSym_Zero2)
+      bw.WriteBits(extra, kLevelSym_Zero2_NumBits);
+    else if (sym == kLevelSym_Same)
+      bw.WriteBits(extra, kLevelSym_Same_NumBits);
+  }
+  return true;
+}
+
+
+size_t CEncoder::Encode(const Byte *src, size_t srcSize, Byte *dest, size_t destSize)
+{
+  if (srcSize < kSrcSizeMin || srcSize > kEncoderChunkSizeMax || destSize < srcSize)
+    return 0;
+
+  Alloc();
+  if (_base > (UInt32)0 - (UInt32)kEncoderChunkSizeMax * 2)
+    Normalize();
+  _curBase = _base;
+  _base += (UInt32)srcSize;
+
+  memcpy(_buf, src, srcSize);
+  x86_Filter_Encode(_buf, srcSize);
+  src = _buf;
+
+  UInt32 *items = _items;
+  size_t numItems = 0;
+
+  UInt32 mainFreqs[kNumMainSyms];
+  UInt32 lenFreqs[kNumLenSymbols];
+  memset(mainFreqs, 0, sizeof(mainFreqs));
+  memset(lenFreqs, 0, sizeof(lenFreqs));
+
+  {
+    UInt32 reps[kNumReps] = { 1, 1, 1 };
+    UInt32 curCode = 0;
+    UInt32 curLen = GetMatch(src, srcSize, 0, reps, curCode);
+    size_t pos = 0;
+
+    while (pos < srcSize)
+    {
+      if (curLen == 0)
+      {
+        const unsigned b = src[pos];
+        items[numItems++] = b;
+        mainFreqs[b]++;
+        pos++;
+        if (pos < srcSize)
+          curLen = GetMatch(src, srcSize, pos, reps, curCode);
+        continue;
+      }
+
+      size_t insertPos = pos + 1;
+      if (_lazy && pos + 1 < srcSize && curLen < 32)
+      {
+        UInt32 nextCode = 0;
+        const UInt32 nextLen = GetMatch(src, srcSize, pos + 1, reps, nextCode);
+        insertPos++;
+        if (nextLen > curLen)
+        {
+          const unsigned b = src[pos];
+          items[numItems++] = b;
+          mainFreqs[b]++;
+          pos++;
+          curLen = nextLen;
+          curCode = nextCode;
+          continue;
+        }
+      }
+
+      {
+        const size_t end = pos + curLen;
+        for (; insertPos < end && insertPos + kNumHashBytes <= srcSize; insertPos++)
+        {
+          const UInt32 h = HASH_CALC(src + insertPos);
+          _prev[insertPos] = _hash[h];
+          _hash[h] = _curBase + (UInt32)insertPos;
+        }
+      }
+
+      unsigned posSlot;
+      if (curCode < kNumReps)
+      {
+        const UInt32 dist = reps[curCode];
+        reps[curCode] = reps[0];
+        reps[0] = dist;
+        posSlot = (unsigned)curCode;
+      }
+      else
+      {
+        reps[2] = reps[1];
+        reps[1] = reps[0];
+        reps[0] = curCode - (kNumReps - 1);
+        posSlot = GetPosSlot(curCode);
+      }
+
+      items[numItems++] = (curLen << 16) | curCode;
+      {
+        const UInt32 lenHeader = curLen - kMatchMinLen;
+        if (lenHeader < kNumLenSlots - 1)
+          mainFreqs[256 + posSlot * kNumLenSlots + lenHeader]++;
+        else
+        {
+          mainFreqs[256 + posSlot * kNumLenSlots + kNumLenSlots - 1]++;
+          lenFreqs[lenHeader - (kNumLenSlots - 1)]++;
+        }
+      }
+      pos += curLen;
+      curLen = 0;
+      if (pos < srcSize)
+        curLen = GetMatch(src, srcSize, pos, reps, curCode);
+    }
+  }
+
+  UInt32 mainCodes[kNumMainSyms];
+  Byte mainLevels[kNumMainSyms];
+  Huffman_Generate(mainFreqs, mainCodes, mainLevels, kNumMainSyms, kNumHuffmanBits);
+  UInt32 lenCodes[kNumLenSymbols];
+  Byte lenLevels[kNumLenSymbols];
+  Huffman_Generate(lenFreqs, lenCodes, lenLevels, kNumLenSymbols, kNumHuffmanBits);
+
+  /*
+    Bits are written by 16-bit words (little-endian) from high bit to low bit.
+    Each item is not larger than 45 bits, so we check the limit before each item.
+  */
+
+  const Byte *lim = dest + destSize - 8;
+  CBitWriter bw;
+  bw.Cur = dest;
+  bw.Buf = 0;
+  bw.Count = 0;
+
+  bw.WriteBits(kBlockType_Verbatim, kBlockType_NumBits);
+  // WIM mode: 1 bit is set, if the size of block is 32 KiB
+  if (srcSize == ((size_t)1 << kNumDictBits))
+    bw.WriteBits(1, 1);
+  else
+  {
+    bw.WriteBits(0, 1);
+    bw.WriteBits((UInt32)srcSize, 16);
+  }
+
+  if (!WriteTable(bw, mainLevels, 256, lim)
+      || !WriteTable(bw, mainLevels + 256, kNumMainSyms - 256, lim)
+      || !WriteTable(bw, lenLevels, kNumLenSymbols, lim))
+    return 0;
+
+  for (size_t i = 0; i < numItems; i++)
+  {
+    if (bw.Cur > lim)
+      return 0;
+    const UInt32 item = items[i];
+    if (item < 256)
+    {
+      bw.WriteBits(mainCodes[item], mainLevels[item]);
+      continue;
+    }
+    const UInt32 code = item & 0xFFFF;
+    const UInt32 lenHeader = (item >> 16) - kMatchMinLen;
+    const unsigned posSlot = (code < kNumReps) ? (unsigned)code : GetPosSlot(code);
+    {
+      const unsigned sym = 256 + posSlot * kNumLenSlots +
+          (lenHeader < kNumLenSlots - 1 ? (unsigned)lenHeader : kNumLenSlots - 1);
+      bw.WriteBits(mainCodes[sym], mainLevels[sym]);
+    }
+    if (lenHeader >= kNumLenSlots - 1)
+    {
+      const unsigned sym = (unsigned)lenHeader - (kNumLenSlots - 1);
+      bw.WriteBits(lenCodes[sym], lenLevels[sym]);
+    }
+    if (code >= kNumReps)
+    {
+      const unsigned numDirectBits = GetNumBits(code) - 1;
+      if (numDirectBits != 0)
+        bw.WriteBits(code & (((UInt32)1 << numDirectBits) - 1), numDirectBits);
+    }
+  }
+
+  if (bw.Cur > lim)
+    return 0;
+  bw.Flush();
+
+  const size_t size = (size_t)(bw.Cur - dest);
+  if (size >= srcSize)
+    return 0;
+  return size;
+}
+
+}}
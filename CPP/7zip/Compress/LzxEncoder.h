@@ -0,0 +1,45 @@
+// LzxEncoder.h
+
+#ifndef ZIP7_INC_LZX_ENCODER_H
+#define ZIP7_INC_LZX_ENCODER_H
+
+#include "../../Common/MyBuffer.h"
+
+namespace NCompress {
+namespace NLzx {
+
+/* LZX encoder for independent chunks (WIM).
+   The window size is 32 KiB. Each chunk is written as one verbatim block,
+   and x86 (E8) translation is applied as required by WIM LZX decoder. */
+
+const size_t kEncoderChunkSizeMax = (size_t)1 << 15;
+
+class CEncoder
+{
+  CObjArray<UInt32> _hash;
+  CObjArray<UInt32> _prev;
+  CObjArray<UInt32> _items;
+  CObjArray<Byte> _buf;
+  UInt32 _base;
+  UInt32 _curBase;
+  UInt32 _numCycles;
+  bool _lazy;
+
+  void Normalize();
+  UInt32 FindMatch(const Byte *src, size_t srcSize, size_t pos, UInt32 &dist);
+  UInt32 GetMatch(const Byte *src, size_t srcSize, size_t pos, const UInt32 *reps, UInt32 &code);
+public:
+  CEncoder();
+  void Alloc();
+  void SetLevel(UInt32 level);
+
+  /* returns the size of compressed data.
+     returns 0, if compressed data is not smaller than (srcSize),
+     (destSize) must be (srcSize) or more.
+     (srcSize <= kEncoderChunkSizeMax) */
+  size_t Encode(const Byte *src, size_t srcSize, Byte *dest, size_t destSize);
+};
+
+}}
+
+#endif
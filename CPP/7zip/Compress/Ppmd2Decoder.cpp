@@ -0,0 +1,396 @@
+// Ppmd2Decoder.cpp
+
+#include "StdAfx.h"
+
+#include <string.h>
+
+#include "../../../C/Alloc.h"
+#include "../../../C/CpuArch.h"
+
+#include "../Common/StreamUtils.h"
+
+#include "Ppmd2Decoder.h"
+
+namespace NCompress {
+namespace NPpmd2 {
+
+static const UInt32 kInBufSize = (UInt32)1 << 20;
+static const UInt32 kNumThreadsMax = 64;
+
+struct CByteInMem
+{
+  IByteIn vt;
+  const Byte *Cur;
+  const Byte *Lim;
+  bool Extra;
+};
+
+static Byte ByteInMem_Read(IByteInPtr pp)
+{
+  CByteInMem *p = Z7_CONTAINER_FROM_VTBL_CLS(pp, CByteInMem, vt);
+  if (p->Cur != p->Lim)
+    return *p->Cur++;
+  p->Extra = true;
+  return 0;
+}
+
+void CDecThread::Free()
+{
+  ::MidFree(InBuf);
+  InBuf = NULL;
+  ::MidFree(OutBuf);
+  OutBuf = NULL;
+  BufSize = 0;
+  Ppmd7_Free(&Ppmd, &g_BigAlloc);
+}
+
+HRESULT CDecThread::AllocInBuf(size_t blockSize)
+{
+  if (BufSize != blockSize)
+  {
+    ::MidFree(InBuf);
+    InBuf = NULL;
+    ::MidFree(OutBuf);
+    OutBuf = NULL;
+    BufSize = blockSize;
+  }
+  if (!InBuf)
+  {
+    InBuf = (Byte *)::MidAlloc(blockSize);
+    if (!InBuf)
+      return E_OUTOFMEMORY;
+  }
+  return S_OK;
+}
+
+HRESULT CDecThread::DecodeBlock(unsigned order, UInt32 memSize)
+{
+  if (IsStored)
+    return S_OK;
+  if (!OutBuf)
+  {
+    OutBuf = (Byte *)::MidAlloc(BufSize);
+    if (!OutBuf)
+      return E_OUTOFMEMORY;
+  }
+  if (!Ppmd7_Alloc(&Ppmd, memSize, &g_BigAlloc))
+    return E_OUTOFMEMORY;
+
+  CByteInMem inMem;
+  inMem.vt.Read = ByteInMem_Read;
+  inMem.Cur = InBuf;
+  inMem.Lim = InBuf + PackSize;
+  inMem.Extra = false;
+  Ppmd.rc.dec.Stream = &inMem.vt;
+
+  if (!Ppmd7z_RangeDec_Init(&Ppmd.rc.dec))
+    return S_FALSE;
+  Ppmd7_Init(&Ppmd, order);
+
+  Byte *buf = OutBuf;
+  const Byte *lim = buf + UnpackSize;
+  for (; buf != lim; buf++)
+  {
+    const int sym = Ppmd7z_DecodeSymbol(&Ppmd);
+    if (inMem.Extra || sym < 0)
+      return S_FALSE;
+    *buf = (Byte)sym;
+  }
+  if (inMem.Cur != inMem.Lim || !Ppmd7z_RangeDec_IsFinishedOK(&Ppmd.rc.dec))
+    return S_FALSE;
+  return S_OK;
+}
+
+
+CDecoder::CDecoder():
+    _order(0),
+    _memSize(0),
+    _blockSizeLog(0),
+    _propsWereSet(false),
+    _threads(NULL),
+    _numThreadsAllocated(0),
+    _numThreads(1),
+    _memLimit((UInt64)(Int64)-1)
+    {}
+
+CDecoder::~CDecoder()
+{
+  delete []_threads;
+}
+
+Z7_COM7F_IMF(CDecoder::SetDecoderProperties2(const Byte *props, UInt32 size))
+{
+  if (size < kPropSize)
+    return E_INVALIDARG;
+  const unsigned order = props[0];
+  const UInt32 memSize = GetUi32(props + 1);
+  const unsigned blockSizeLog = props[5];
+  if (order < PPMD7_MIN_ORDER ||
+      order > PPMD7_MAX_ORDER ||
+      memSize < PPMD7_MIN_MEM_SIZE ||
+      memSize > PPMD7_MAX_MEM_SIZE ||
+      blockSizeLog < kBlockSizeLog_Min ||
+      blockSizeLog > kBlockSizeLog_Max)
+    return E_NOTIMPL;
+  _order = (Byte)order;
+  _memSize = memSize;
+  _blockSizeLog = blockSizeLog;
+  _propsWereSet = true;
+  return S_OK;
+}
+
+#define RINOK_IN_STREAM \
+  if (_inStream.Extra) return (_inStream.Res != S_OK ? _inStream.Res : S_FALSE);
+
+HRESULT CDecoder::ReadNumber(UInt64 &v)
+{
+  v = 0;
+  for (unsigned shift = 0;; shift += 7)
+  {
+    const Byte b = _inStream.ReadByte();
+    RINOK_IN_STREAM
+    if (shift == 63 && b > 1)
+      return S_FALSE;
+    v |= (UInt64)(b & 0x7F) << shift;
+    if ((b & 0x80) == 0)
+      return S_OK;
+  }
+}
+
+HRESULT CDecoder::ReadBlock(CDecThread &t)
+{
+  t.UnpackSize = 0;
+  UInt64 header;
+  RINOK(ReadNumber(header))
+  if (header == 0)
+  {
+    _wasFinished = true;
+    return S_OK;
+  }
+  const UInt64 unpackSize = header >> 1;
+  if (unpackSize == 0
+      || unpackSize > ((UInt64)1 << _blockSizeLog)
+      || (_outSize && unpackSize > *_outSize - _readOutSize))
+    return S_FALSE;
+  t.IsStored = ((header & 1) != 0);
+  UInt64 packSize = unpackSize;
+  if (!t.IsStored)
+  {
+    RINOK(ReadNumber(packSize))
+    if (packSize == 0 || packSize >= unpackSize)
+      return S_FALSE;
+  }
+  RINOK(t.AllocInBuf((size_t)1 << _blockSizeLog))
+
+  Byte *dest = t.InBuf;
+  size_t rem = (size_t)packSize;
+  while (rem != 0)
+  {
+    if (_inStream.Cur == _inStream.Lim)
+    {
+      *dest++ = _inStream.ReadByteFromNewBlock();
+      RINOK_IN_STREAM
+      rem--;
+      continue;
+    }
+    size_t cur = (size_t)(_inStream.Lim - _inStream.Cur);
+    if (cur > rem)
+      cur = rem;
+    memcpy(dest, _inStream.Cur, cur);
+    _inStream.Cur += cur;
+    dest += cur;
+    rem -= cur;
+  }
+
+  t.UnpackSize = (size_t)unpackSize;
+  t.PackSize = (size_t)packSize;
+  t.BlockIndex = _numBlocksRead++;
+  t.InProcessed = _inStream.GetProcessed();
+  _readOutSize += unpackSize;
+  return S_OK;
+}
+
+
+/*
+  Each thread reads next block (under lock), decodes it, and then
+  it waits for its turn to write the block to output stream.
+  The write turn is passed in order of blocks with (CanWriteEvent) of slot (BlockIndex % _numSlots).
+  There can be no more than (_numSlots) blocks that were read and were not written,
+  so the events of slots can be reused safely.
+*/
+
+void CDecoder::ThreadLoop(CDecThread &t)
+{
+  for (;;)
+  {
+    {
+     #ifndef Z7_ST
+      NWindows::NSynchronization::CCriticalSectionLock lock(_cs);
+     #endif
+      if (_stopReading)
+        return;
+      const HRESULT res = ReadBlock(t);
+      if (res != S_OK || t.UnpackSize == 0)
+      {
+        _readRes = res;
+        _stopReading = true;
+        return;
+      }
+    }
+
+    HRESULT res = t.DecodeBlock(_order, _memSize);
+
+   #ifndef Z7_ST
+    const unsigned slot = (unsigned)(t.BlockIndex % _numSlots);
+    if (_mtMode)
+      _threads[slot].CanWriteEvent.Lock();
+   #endif
+
+    if (!_stopWriting)
+    {
+      if (res == S_OK)
+        res = WriteStream(_outStream, t.IsStored ? t.InBuf : t.OutBuf, t.UnpackSize);
+      if (res == S_OK)
+      {
+        _outProcessed += t.UnpackSize;
+        if (_progress)
+          res = _progress->SetRatioInfo(&t.InProcessed, &_outProcessed);
+      }
+      if (res != S_OK)
+      {
+        _writeRes = res;
+        _stopWriting = true;
+       #ifndef Z7_ST
+        NWindows::NSynchronization::CCriticalSectionLock lock(_cs);
+       #endif
+        _stopReading = true;
+      }
+    }
+
+   #ifndef Z7_ST
+    if (_mtMode)
+      _threads[slot + 1 == _numSlots ? 0 : slot + 1].CanWriteEvent.Set();
+   #endif
+  }
+}
+
+
+#ifndef Z7_ST
+
+static THREAD_FUNC_DECL DecThreadFunc(void *p)
+{
+  CDecThread *t = (CDecThread *)p;
+  t->Decoder->ThreadLoop(*t);
+  return THREAD_FUNC_RET_ZERO;
+}
+
+Z7_COM7F_IMF(CDecoder::SetNumberOfThreads(UInt32 numThreads))
+{
+  _numThreads = numThreads;
+  return S_OK;
+}
+
+Z7_COM7F_IMF(CDecoder::SetMemLimit(UInt64 memUsage))
+{
+  _memLimit = memUsage;
+  return S_OK;
+}
+
+#endif
+
+
+Z7_COM7F_IMF(CDecoder::Code(ISequentialInStream *inStream, ISequentialOutStream *outStream,
+    const UInt64 * /* inSize */, const UInt64 *outSize, ICompressProgressInfo *progress))
+{
+  if (!_propsWereSet)
+    return E_NOTIMPL;
+
+  UInt32 numThreads = 1;
+
+ #ifndef Z7_ST
+  numThreads = _numThreads;
+  if (numThreads > kNumThreadsMax)
+    numThreads = kNumThreadsMax;
+  if (outSize)
+  {
+    // we don't need more threads than blocks
+    const UInt64 numBlocks = (*outSize >> _blockSizeLog) + 1;
+    if (numThreads > numBlocks)
+      numThreads = (UInt32)numBlocks;
+  }
+  {
+    // each thread uses (InBuf + OutBuf + model)
+    const UInt64 threadMem = ((UInt64)2 << _blockSizeLog) + _memSize;
+    while (numThreads > 1 && threadMem * numThreads > _memLimit)
+      numThreads--;
+  }
+  if (numThreads < 1)
+    numThreads = 1;
+ #endif
+
+  if (!_threads || _numThreadsAllocated < numThreads)
+  {
+    delete []_threads;
+    _threads = NULL;
+    _numThreadsAllocated = 0;
+    _threads = new CDecThread[numThreads];
+    _numThreadsAllocated = numThreads;
+  }
+
+  if (!_inStream.Alloc(kInBufSize))
+    return E_OUTOFMEMORY;
+  _inStream.Stream = inStream;
+  _inStream.Init();
+
+  _outSize = outSize;
+  _readOutSize = 0;
+  _numBlocksRead = 0;
+  _stopReading = false;
+  _wasFinished = false;
+  _readRes = S_OK;
+
+  _outStream = outStream;
+  _progress = progress;
+  _outProcessed = 0;
+  _stopWriting = false;
+  _writeRes = S_OK;
+
+  unsigned i;
+  for (i = 0; i < numThreads; i++)
+    _threads[i].Decoder = this;
+
+ #ifndef Z7_ST
+  _mtMode = (numThreads > 1);
+  _numSlots = numThreads;
+  unsigned numCreated = 1;
+  if (_mtMode)
+  {
+    for (i = 0; i < numThreads; i++)
+    {
+      const WRes wres = _threads[i].CanWriteEvent.CreateIfNotCreated_Reset();
+      if (wres != 0)
+        return HRESULT_FROM_WIN32(wres);
+    }
+    _threads[0].CanWriteEvent.Set();
+    // if we can't create some thread, the remaining threads still work correctly
+    for (; numCreated < numThreads; numCreated++)
+      if (_threads[numCreated].Thread.Create(DecThreadFunc, &_threads[numCreated]) != 0)
+        break;
+  }
+ #endif
+
+  ThreadLoop(_threads[0]);
+
+ #ifndef Z7_ST
+  for (i = 1; i < numCreated; i++)
+    _threads[i].Thread.Wait_Close();
+ #endif
+
+  RINOK(_writeRes)
+  RINOK(_readRes)
+  if (!_wasFinished || (outSize && *outSize != _outProcessed))
+    return S_FALSE;
+  return S_OK;
+}
+
+}}
@@ -0,0 +1,142 @@
+// Ppmd2Decoder.h
+
+#ifndef ZIP7_INC_COMPRESS_PPMD2_DECODER_H
+#define ZIP7_INC_COMPRESS_PPMD2_DECODER_H
+
+#include "../../../C/Ppmd7.h"
+
+#include "../../Common/MyCom.h"
+
+#include "../ICoder.h"
+
+#include "../Common/CWrappers.h"
+
+#ifndef Z7_ST
+#include "../../Windows/Synchronization.h"
+#include "../../Windows/Thread.h"
+#endif
+
+namespace NCompress {
+namespace NPpmd2 {
+
+/*
+PPMD2 is block-parallel version of PPMD (PPMdH with 7z range coder).
+Each block is coded with new model, so blocks can be encoded and decoded in parallel.
+
+Properties (6 bytes): order (1 byte), MemSize (UInt32), log2(maxBlockSize) (1 byte)
+
+Stream is sequence of blocks. Each block starts with varint (7 bits per byte, little-endian):
+  header = (unpackSize << 1) | isStored
+  header == 0  : end of stream
+  isStored     : (unpackSize) bytes of data follow
+  !isStored    : varint (packSize) follows, and then (packSize) bytes of PPMD data.
+                 (packSize < unpackSize)
+(unpackSize <= maxBlockSize) for each block.
+*/
+
+const unsigned kPropSize = 6;
+const unsigned kBlockSizeLog_Min = 16;
+const unsigned kBlockSizeLog_Max = 30;
+// max size of block header
+const unsigned kBlockHeaderMax = 20;
+
+class CDecoder;
+
+class CDecThread
+{
+public:
+  CDecoder *Decoder;
+  Byte *InBuf;
+  Byte *OutBuf;
+  size_t BufSize;
+  CPpmd7 Ppmd;
+
+  // current block
+  UInt64 BlockIndex;
+  UInt64 InProcessed;
+  size_t UnpackSize;
+  size_t PackSize;
+  bool IsStored;
+
+ #ifndef Z7_ST
+  NWindows::CThread Thread;
+  // it's not member of this thread. We just need one event per thread
+  NWindows::NSynchronization::CAutoResetEvent CanWriteEvent;
+ #endif
+
+  CDecThread(): InBuf(NULL), OutBuf(NULL), BufSize(0) { Ppmd7_Construct(&Ppmd); }
+  ~CDecThread() { Free(); }
+  void Free();
+  HRESULT AllocInBuf(size_t blockSize);
+  HRESULT DecodeBlock(unsigned order, UInt32 memSize);
+};
+
+class CDecoder Z7_final:
+  public ICompressCoder,
+  public ICompressSetDecoderProperties2,
+ #ifndef Z7_ST
+  public ICompressSetCoderMt,
+  public ICompressSetMemLimit,
+ #endif
+  public CMyUnknownImp
+{
+  Z7_COM_QI_BEGIN2(ICompressCoder)
+  Z7_COM_QI_ENTRY(ICompressSetDecoderProperties2)
+ #ifndef Z7_ST
+  Z7_COM_QI_ENTRY(ICompressSetCoderMt)
+  Z7_COM_QI_ENTRY(ICompressSetMemLimit)
+ #endif
+  Z7_COM_QI_END
+  Z7_COM_ADDREF_RELEASE
+
+  Z7_IFACE_COM7_IMP(ICompressCoder)
+  Z7_IFACE_COM7_IMP(ICompressSetDecoderProperties2)
+ #ifndef Z7_ST
+  Z7_IFACE_COM7_IMP(ICompressSetCoderMt)
+  Z7_IFACE_COM7_IMP(ICompressSetMemLimit)
+ #endif
+
+  Byte _order;
+  UInt32 _memSize;
+  unsigned _blockSizeLog;
+  bool _propsWereSet;
+
+  CDecThread *_threads;
+  unsigned _numThreadsAllocated;
+  UInt32 _numThreads;
+  UInt64 _memLimit;
+
+  // these variables are protected by (_cs) in multi-threading mode
+  CByteInBufWrap _inStream;
+  const UInt64 *_outSize;
+  UInt64 _readOutSize;
+  UInt64 _numBlocksRead;
+  bool _stopReading;
+  bool _wasFinished;
+  HRESULT _readRes;
+
+  // these variables are used by thread that has write token
+  ISequentialOutStream *_outStream;
+  ICompressProgressInfo *_progress;
+  UInt64 _outProcessed;
+  bool _stopWriting;
+  HRESULT _writeRes;
+
+ #ifndef Z7_ST
+  bool _mtMode;
+  unsigned _numSlots;
+  NWindows::NSynchronization::CCriticalSection _cs;
+ #endif
+
+  HRESULT ReadNumber(UInt64 &v);
+  HRESULT ReadBlock(CDecThread &t);
+public:
+  void ThreadLoop(CDecThread &t);
+
+  CDecoder();
+  ~CDecoder();
+};
+
+}}
+
+#endif
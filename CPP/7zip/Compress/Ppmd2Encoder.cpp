@@ -0,0 +1,378 @@
+// Ppmd2Encoder.cpp
+
+#include "StdAfx.h"
+
+#include <string.h>
+
+#include "../../../C/Alloc.h"
+#include "../../../C/CpuArch.h"
+
+#include "../Common/CWrappers.h"
+#include "../Common/StreamUtils.h"
+
+#include "Ppmd2Decoder.h"
+#include "Ppmd2Encoder.h"
+
+namespace NCompress {
+namespace NPpmd2 {
+
+// default block size is (MemSize * 4) in [1 MiB, 256 MiB] range
+static const unsigned kBlockSizeLog_DefMin = 20;
+static const unsigned kBlockSizeLog_DefMax = 28;
+
+// we check overflow of output buffer after each step
+static const size_t kStepSize = (size_t)1 << 18;
+
+struct CByteOutMem
+{
+  IByteOut vt;
+  Byte *Cur;
+  const Byte *Lim;
+  bool Overflow;
+};
+
+static void ByteOutMem_Write(IByteOutPtr pp, Byte b)
+{
+  CByteOutMem *p = Z7_CONTAINER_FROM_VTBL_CLS(pp, CByteOutMem, vt);
+  if (p->Cur != p->Lim)
+    *p->Cur++ = b;
+  else
+    p->Overflow = true;
+}
+
+static unsigned WriteNumber(Byte *dest, UInt64 v)
+{
+  unsigned i = 0;
+  for (; v >= 0x80; v >>= 7)
+    dest[i++] = (Byte)(v | 0x80);
+  dest[i++] = (Byte)v;
+  return i;
+}
+
+CEncoder::CEncoder():
+    _reduceSize((UInt64)(Int64)-1),
+    _blockSizeLog(kBlockSizeLog_DefMin),
+    _numThreads(1),
+    _outStream(NULL),
+    _outBufSize(0)
+{
+  unsigned i;
+  for (i = 0; i < MTCODER_THREADS_MAX; i++)
+    _ppmds[i] = NULL;
+  for (i = 0; i < MTCODER_BLOCKS_MAX; i++)
+  {
+    _outBufs[i] = NULL;
+    _outBufsDataSizes[i] = 0;
+  }
+ #ifndef Z7_ST
+  _mtCoder_WasConstructed = false;
+ #endif
+  SetCoderProperties(NULL, NULL, 0);
+}
+
+void CEncoder::FreeOutBufs()
+{
+  for (unsigned i = 0; i < MTCODER_BLOCKS_MAX; i++)
+  {
+    ::MidFree(_outBufs[i]);
+    _outBufs[i] = NULL;
+  }
+  _outBufSize = 0;
+}
+
+CEncoder::~CEncoder()
+{
+ #ifndef Z7_ST
+  if (_mtCoder_WasConstructed)
+    MtCoder_Destruct(&_mtCoder);
+ #endif
+  FreeOutBufs();
+  for (unsigned i = 0; i < MTCODER_THREADS_MAX; i++)
+  {
+    CPpmd7 *ppmd = _ppmds[i];
+    if (ppmd)
+    {
+      Ppmd7_Free(ppmd, &g_BigAlloc);
+      delete ppmd;
+    }
+  }
+}
+
+Z7_COM7F_IMF(CEncoder::SetCoderProperties(const PROPID *propIDs, const PROPVARIANT *coderProps, UInt32 numProps))
+{
+  int level = -1;
+  NPpmd::CEncProps props;
+  UInt64 reduceSize = (UInt64)(Int64)-1;
+  UInt64 blockSize = 0;
+  UInt32 numThreads = 1;
+  for (UInt32 i = 0; i < numProps; i++)
+  {
+    const PROPVARIANT &prop = coderProps[i];
+    const PROPID propID = propIDs[i];
+    if (propID == NCoderPropID::kReduceSize)
+    {
+      if (prop.vt == VT_UI8)
+        reduceSize = prop.uhVal.QuadPart;
+    }
+    else if (propID == NCoderPropID::kBlockSize)
+    {
+      if (prop.vt == VT_UI8)
+        blockSize = prop.uhVal.QuadPart;
+      else if (prop.vt == VT_UI4)
+        blockSize = prop.ulVal;
+      else
+        return E_INVALIDARG;
+      continue;
+    }
+    else if (propID == NCoderPropID::kNumThreads)
+    {
+      if (prop.vt != VT_UI4)
+        return E_INVALIDARG;
+      numThreads = prop.ulVal;
+      if (numThreads < 1)
+        numThreads = 1;
+      continue;
+    }
+    RINOK(props.SetProp(propID, prop, level))
+  }
+
+  // the model is reset for each block, so block size limits the data size for one model
+  if (blockSize != 0 && props.ReduceSize > blockSize)
+    props.ReduceSize = (UInt32)blockSize;
+  props.Normalize(level);
+
+  if (blockSize == 0)
+  {
+    blockSize = (UInt64)props.MemSize << 2;
+    if (blockSize < ((UInt32)1 << kBlockSizeLog_DefMin)) blockSize = (UInt32)1 << kBlockSizeLog_DefMin;
+    if (blockSize > ((UInt32)1 << kBlockSizeLog_DefMax)) blockSize = (UInt32)1 << kBlockSizeLog_DefMax;
+  }
+  if (blockSize > reduceSize)
+    blockSize = reduceSize;
+  unsigned blockSizeLog = kBlockSizeLog_Min;
+  while (blockSizeLog < kBlockSizeLog_Max && ((UInt64)1 << blockSizeLog) < blockSize)
+    blockSizeLog++;
+
+  _props = props;
+  _reduceSize = reduceSize;
+  _blockSizeLog = blockSizeLog;
+  _numThreads = numThreads;
+  return S_OK;
+}
+
+Z7_COM7F_IMF(CEncoder::WriteCoderProperties(ISequentialOutStream *outStream))
+{
+  Byte props[kPropSize];
+  props[0] = (Byte)_props.Order;
+  SetUi32(props + 1, _props.MemSize)
+  props[5] = (Byte)_blockSizeLog;
+  return WriteStream(outStream, props, kPropSize);
+}
+
+
+SRes CEncoder::EncodeBlock(unsigned coderIndex, unsigned outBufIndex,
+    const Byte *src, size_t srcSize, ICompressProgressPtr progress)
+{
+  _outBufsDataSizes[outBufIndex] = 0;
+  if (srcSize == 0)
+    return SZ_OK;
+
+  Byte *dest = _outBufs[outBufIndex];
+  if (!dest)
+  {
+    dest = (Byte *)::MidAlloc(_outBufSize);
+    if (!dest)
+      return SZ_ERROR_MEM;
+    _outBufs[outBufIndex] = dest;
+  }
+
+  CPpmd7 *ppmd = _ppmds[coderIndex];
+  if (!ppmd)
+  {
+    ppmd = new CPpmd7;
+    Ppmd7_Construct(ppmd);
+    _ppmds[coderIndex] = ppmd;
+  }
+  if (!Ppmd7_Alloc(ppmd, _props.MemSize, &g_BigAlloc))
+    return SZ_ERROR_MEM;
+
+  /* we write packed data after space reserved for header.
+     If packed data is not smaller than source, we write stored block. */
+  CByteOutMem outMem;
+  outMem.vt.Write = ByteOutMem_Write;
+  outMem.Cur = dest + kBlockHeaderMax;
+  outMem.Lim = outMem.Cur + srcSize - 1;
+  outMem.Overflow = false;
+  ppmd->rc.enc.Stream = &outMem.vt;
+
+  Ppmd7z_Init_RangeEnc(ppmd);
+  Ppmd7_Init(ppmd, (unsigned)_props.Order);
+
+  for (size_t pos = 0; pos < srcSize;)
+  {
+    size_t cur = srcSize - pos;
+    if (cur > kStepSize)
+      cur = kStepSize;
+    Ppmd7z_EncodeSymbols(ppmd, src + pos, src + pos + cur);
+    pos += cur;
+    if (outMem.Overflow)
+      break;
+    if (progress)
+    {
+      RINOK(ICompressProgress_Progress(progress, pos, (size_t)(outMem.Cur - dest) - kBlockHeaderMax))
+    }
+  }
+
+  if (!outMem.Overflow)
+    Ppmd7z_Flush_RangeEnc(ppmd);
+
+  size_t headerSize;
+  if (outMem.Overflow)
+  {
+    headerSize = WriteNumber(dest, ((UInt64)srcSize << 1) | 1);
+    memcpy(dest + headerSize, src, srcSize);
+    _outBufsDataSizes[outBufIndex] = headerSize + srcSize;
+  }
+  else
+  {
+    const size_t packSize = (size_t)(outMem.Cur - dest) - kBlockHeaderMax;
+    Byte header[kBlockHeaderMax];
+    headerSize = WriteNumber(header, (UInt64)srcSize << 1);
+    headerSize += WriteNumber(header + headerSize, packSize);
+    memcpy(dest + kBlockHeaderMax - headerSize, header, headerSize);
+    memmove(dest, dest + kBlockHeaderMax - headerSize, headerSize + packSize);
+    _outBufsDataSizes[outBufIndex] = headerSize + packSize;
+  }
+  return SZ_OK;
+}
+
+SRes CEncoder::WriteBlock(unsigned outBufIndex)
+{
+  const size_t size = _outBufsDataSizes[outBufIndex];
+  if (size == 0)
+    return SZ_OK;
+  return ISeqOutStream_Write(_outStream, _outBufs[outBufIndex], size) == size ? SZ_OK : SZ_ERROR_WRITE;
+}
+
+
+#ifndef Z7_ST
+
+static SRes MtCallback_Code(void *p, unsigned coderIndex, unsigned outBufIndex,
+    const Byte *src, size_t srcSize, int /* finished */)
+{
+  CEncoder *me = (CEncoder *)p;
+  CMtProgressThunk progressThunk;
+  MtProgressThunk_CreateVTable(&progressThunk);
+  progressThunk.mtProgress = me->GetMtProgress();
+  MtProgressThunk_INIT(&progressThunk)
+  return me->EncodeBlock(coderIndex, outBufIndex, src, srcSize, &progressThunk.vt);
+}
+
+static SRes MtCallback_Write(void *p, unsigned outBufIndex)
+{
+  return ((CEncoder *)p)->WriteBlock(outBufIndex);
+}
+
+#endif
+
+
+#define RET_IF_WRAP_ERROR(wrapRes, sRes, sResErrorCode) \
+  if (wrapRes != S_OK /* && (sRes == SZ_OK || sRes == sResErrorCode) */) return wrapRes;
+
+Z7_COM7F_IMF(CEncoder::Code(ISequentialInStream *inStream, ISequentialOutStream *outStream,
+    const UInt64 * /* inSize */, const UInt64 * /* outSize */, ICompressProgressInfo *progress))
+{
+  CSeqInStreamWrap inWrap;
+  CSeqOutStreamWrap outWrap;
+  CCompressProgressWrap progressWrap;
+
+  inWrap.Init(inStream);
+  outWrap.Init(outStream);
+  progressWrap.Init(progress);
+
+  const size_t blockSize = (size_t)1 << _blockSizeLog;
+  if (_outBufSize != kBlockHeaderMax + blockSize)
+  {
+    FreeOutBufs();
+    _outBufSize = kBlockHeaderMax + blockSize;
+  }
+  _outStream = &outWrap.vt;
+
+  SRes res = SZ_OK;
+
+ #ifndef Z7_ST
+  if (_numThreads > 1 && _reduceSize > blockSize)
+  {
+    if (!_mtCoder_WasConstructed)
+    {
+      _mtCoder_WasConstructed = true;
+      MtCoder_Construct(&_mtCoder);
+    }
+
+    IMtCoderCallback2 vt;
+    vt.Code = MtCallback_Code;
+    vt.Write = MtCallback_Write;
+
+    _mtCoder.allocBig = &g_BigAlloc;
+    _mtCoder.progress = progress ? &progressWrap.vt : NULL;
+    _mtCoder.inStream = &inWrap.vt;
+    _mtCoder.inData = NULL;
+    _mtCoder.inDataSize = 0;
+    _mtCoder.mtCallback = &vt;
+    _mtCoder.mtCallbackObject = this;
+    _mtCoder.blockSize = blockSize;
+    _mtCoder.numThreadsMax = _numThreads;
+    _mtCoder.expectedDataSize = _reduceSize;
+
+    res = MtCoder_Code(&_mtCoder);
+  }
+  else
+ #endif
+  {
+    Byte *inBuf = (Byte *)::MidAlloc(blockSize);
+    if (!inBuf)
+      return E_OUTOFMEMORY;
+    UInt64 inProcessed = 0;
+    UInt64 outProcessed = 0;
+    for (;;)
+    {
+      size_t size = blockSize;
+      res = SeqInStream_ReadMax(&inWrap.vt, inBuf, &size);
+      if (res != SZ_OK || size == 0)
+        break;
+      res = EncodeBlock(0, 0, inBuf, size, NULL);
+      if (res != SZ_OK)
+        break;
+      res = WriteBlock(0);
+      if (res != SZ_OK)
+        break;
+      inProcessed += size;
+      outProcessed += _outBufsDataSizes[0];
+      if (progress)
+      {
+        res = ICompressProgress_Progress(&progressWrap.vt, inProcessed, outProcessed);
+        if (res != SZ_OK)
+          break;
+      }
+      if (size != blockSize)
+        break;
+    }
+    ::MidFree(inBuf);
+  }
+
+  if (res == SZ_OK)
+  {
+    // end marker
+    const Byte b = 0;
+    if (ISeqOutStream_Write(&outWrap.vt, &b, 1) != 1)
+      res = SZ_ERROR_WRITE;
+  }
+
+  RET_IF_WRAP_ERROR(inWrap.Res, res, SZ_ERROR_READ)
+  RET_IF_WRAP_ERROR(outWrap.Res, res, SZ_ERROR_WRITE)
+  RET_IF_WRAP_ERROR(progressWrap.Res, res, SZ_ERROR_PROGRESS)
+
+  return SResToHRESULT(res);
+}
+
+}}
@@ -0,0 +1,55 @@
+// Ppmd2Encoder.h
+
+#ifndef ZIP7_INC_COMPRESS_PPMD2_ENCODER_H
+#define ZIP7_INC_COMPRESS_PPMD2_ENCODER_H
+
+#include "../../../C/MtCoder.h"
+#include "../../../C/Ppmd7.h"
+
+#include "../../Common/MyCom.h"
+
+#include "../ICoder.h"
+
+#include "PpmdEncoder.h"
+
+namespace NCompress {
+namespace NPpmd2 {
+
+Z7_CLASS_IMP_COM_3(
+  CEncoder
+  , ICompressCoder
+  , ICompressSetCoderProperties
+  , ICompressWriteCoderProperties
+)
+  NPpmd::CEncProps _props;
+  UInt64 _reduceSize;
+  UInt32 _blockSize;
+  unsigned _blockSizeLog;
+  UInt32 _numThreads;
+
+  ISeqOutStreamPtr _outStream;
+  size_t _outBufSize;
+  CPpmd7 *_ppmds[MTCODER_THREADS_MAX];
+  Byte *_outBufs[MTCODER_BLOCKS_MAX];
+  size_t _outBufsDataSizes[MTCODER_BLOCKS_MAX];
+ #ifndef Z7_ST
+  bool _mtCoder_WasConstructed;
+  CMtCoder _mtCoder;
+ #endif
+
+  void FreeOutBufs();
+public:
+  SRes EncodeBlock(unsigned coderIndex, unsigned outBufIndex,
+      const Byte *src, size_t srcSize, ICompressProgressPtr progress);
+  SRes WriteBlock(unsigned outBufIndex);
+ #ifndef Z7_ST
+  CMtProgress *GetMtProgress() { return &_mtCoder.mtProgress; }
+ #endif
+
+  CEncoder();
+  ~CEncoder();
+};
+
+}}
+
+#endif
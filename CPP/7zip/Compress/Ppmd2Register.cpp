@@ -0,0 +1,22 @@
+// Ppmd2Register.cpp
+
+#include "StdAfx.h"
+
+#include "../Common/RegisterCodec.h"
+
+#include "Ppmd2Decoder.h"
+
+#ifndef Z7_EXTRACT_ONLY
+#include "Ppmd2Encoder.h"
+#endif
+
+namespace NCompress {
+namespace NPpmd2 {
+
+REGISTER_CODEC_E(PPMD2,
+    CDecoder(),
+    CEncoder(),
+    0x3FFD010644E40002,
+    "PPMD2")
+
+}}
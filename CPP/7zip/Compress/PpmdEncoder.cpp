@@ -52,75 +52,79 @@ CEncoder::~CEncoder()
   Ppmd7_Free(&_ppmd, &g_BigAlloc);
 }
 
-Z7_COM7F_IMF(CEncoder::SetCoderProperties(const PROPID *propIDs, const PROPVARIANT *coderProps, UInt32 numProps))
+HRESULT CEncProps::SetProp(PROPID propID, const PROPVARIANT &prop, int &level)
 {
-  int level = -1;
-  CEncProps props;
-  for (UInt32 i = 0; i < numProps; i++)
+  if (propID > NCoderPropID::kReduceSize)
+    return S_OK;
+  if (propID == NCoderPropID::kReduceSize)
   {
-    const PROPVARIANT &prop = coderProps[i];
-    const PROPID propID = propIDs[i];
-    if (propID > NCoderPropID::kReduceSize)
-      continue;
-    if (propID == NCoderPropID::kReduceSize)
-    {
-      if (prop.vt == VT_UI8 && prop.uhVal.QuadPart < (UInt32)(Int32)-1)
-        props.ReduceSize = (UInt32)prop.uhVal.QuadPart;
-      continue;
-    }
+    if (prop.vt == VT_UI8 && prop.uhVal.QuadPart < (UInt32)(Int32)-1)
+      ReduceSize = (UInt32)prop.uhVal.QuadPart;
+    return S_OK;
+  }
 
-    if (propID == NCoderPropID::kUsedMemorySize)
+  if (propID == NCoderPropID::kUsedMemorySize)
+  {
+    // here we have selected (4 GiB - 1 KiB) as replacement for (4 GiB) MEM_SIZE.
+    const UInt32 kPpmd_Default_4g = (UInt32)0 - ((UInt32)1 << 10);
+    UInt32 v;
+    if (prop.vt == VT_UI8)
     {
-      // here we have selected (4 GiB - 1 KiB) as replacement for (4 GiB) MEM_SIZE.
-      const UInt32 kPpmd_Default_4g = (UInt32)0 - ((UInt32)1 << 10);
-      UInt32 v;
-      if (prop.vt == VT_UI8)
-      {
-        // 21.03 : we support 64-bit values (for 4 GiB value)
-        const UInt64 v64 = prop.uhVal.QuadPart;
-        if (v64 > ((UInt64)1 << 32))
-          return E_INVALIDARG;
-        if (v64 == ((UInt64)1 << 32))
-          v = kPpmd_Default_4g;
-        else
-          v = (UInt32)v64;
-      }
-      else if (prop.vt == VT_UI4)
-        v = (UInt32)prop.ulVal;
-      else
+      // 21.03 : we support 64-bit values (for 4 GiB value)
+      const UInt64 v64 = prop.uhVal.QuadPart;
+      if (v64 > ((UInt64)1 << 32))
         return E_INVALIDARG;
-      if (v > PPMD7_MAX_MEM_SIZE)
+      if (v64 == ((UInt64)1 << 32))
         v = kPpmd_Default_4g;
-
-      /* here we restrict MEM_SIZE for Encoder.
-         It's for better performance of encoding and decoding.
-         The Decoder still supports more MEM_SIZE values. */
-      if (v < ((UInt32)1 << 16) || (v & 3) != 0)
-        return E_INVALIDARG;
-      // if (v < PPMD7_MIN_MEM_SIZE) return E_INVALIDARG; // (1 << 11)
-      /*
-        Supported MEM_SIZE range :
-        [ (1 << 11) , 0xFFFFFFFF - 12 * 3 ] - current 7-Zip's Ppmd7 constants
-        [ 1824      , 0xFFFFFFFF          ] - real limits of Ppmd7 code
-      */
-      props.MemSize = v;
-      continue;
+      else
+        v = (UInt32)v64;
     }
+    else if (prop.vt == VT_UI4)
+      v = (UInt32)prop.ulVal;
+    else
+      return E_INVALIDARG;
+    if (v > PPMD7_MAX_MEM_SIZE)
+      v = kPpmd_Default_4g;
 
-    if (prop.vt != VT_UI4)
+    /* here we restrict MEM_SIZE for Encoder.
+       It's for better performance of encoding and decoding.
+       The Decoder still supports more MEM_SIZE values. */
+    if (v < ((UInt32)1 << 16) || (v & 3) != 0)
       return E_INVALIDARG;
-    const UInt32 v = (UInt32)prop.ulVal;
-    switch (propID)
-    {
-      case NCoderPropID::kOrder:
-        if (v < 2 || v > 32)
-          return E_INVALIDARG;
-        props.Order = (Byte)v;
-        break;
-      case NCoderPropID::kNumThreads: break;
-      case NCoderPropID::kLevel: level = (int)v; break;
-      default: return E_INVALIDARG;
-    }
+    // if (v < PPMD7_MIN_MEM_SIZE) return E_INVALIDARG; // (1 << 11)
+    /*
+      Supported MEM_SIZE range :
+      [ (1 << 11) , 0xFFFFFFFF - 12 * 3 ] - current 7-Zip's Ppmd7 constants
+      [ 1824      , 0xFFFFFFFF          ] - real limits of Ppmd7 code
+    */
+    MemSize = v;
+    return S_OK;
+  }
+
+  if (prop.vt != VT_UI4)
+    return E_INVALIDARG;
+  const UInt32 v = (UInt32)prop.ulVal;
+  switch (propID)
+  {
+    case NCoderPropID::kOrder:
+      if (v < 2 || v > 32)
+        return E_INVALIDARG;
+      Order = (Byte)v;
+      break;
+    case NCoderPropID::kNumThreads: break;
+    case NCoderPropID::kLevel: level = (int)v; break;
+    default: return E_INVALIDARG;
+  }
+  return S_OK;
+}
+
+Z7_COM7F_IMF(CEncoder::SetCoderProperties(const PROPID *propIDs, const PROPVARIANT *coderProps, UInt32 numProps))
+{
+  int level = -1;
+  CEncProps props;
+  for (UInt32 i = 0; i < numProps; i++)
+  {
+    RINOK(props.SetProp(propIDs[i], coderProps[i], level))
   }
   props.Normalize(level);
   _props = props;
@@ -27,6 +27,7 @@ struct CEncProps
     Order = -1;
   }
   void Normalize(int level);
+  HRESULT SetProp(PROPID propID, const PROPVARIANT &prop, int &level);
 };
 
 Z7_CLASS_IMP_COM_3(
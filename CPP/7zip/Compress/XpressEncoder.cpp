@@ -0,0 +1,268 @@
+// XpressEncoder.cpp
+
+#include "StdAfx.h"
+
+#include <string.h>
+
+#include "../../../C/CpuArch.h"
+#include "../../../C/HuffEnc.h"
+
+#include "XpressEncoder.h"
+
+namespace NCompress {
+namespace NXpress {
+
+static const unsigned kNumHuffBits = 15;
+static const unsigned kNumLenBits = 4;
+static const unsigned kLenMask = (1 << kNumLenBits) - 1;
+static const unsigned kNumPosSlots = 16;
+static const unsigned kNumSyms = 256 + (kNumPosSlots << kNumLenBits);
+static const unsigned kHeaderSize = kNumSyms / 2;
+
+static const unsigned kMatchMinLen = 3;
+static const unsigned kNumHashBits = 15;
+static const UInt32 kHashSize = (UInt32)1 << kNumHashBits;
+
+// item: (literal) or ((len << 16) | dist)
+
+CEncoder::CEncoder():
+    _base(1),
+    _numCycles(16),
+    _lazy(true)
+  {}
+
+void CEncoder::SetLevel(UInt32 level)
+{
+  _lazy = (level >= 3);
+  _numCycles =
+      level <= 1 ? 4 :
+      level <= 4 ? 8 :
+      level <= 6 ? 16 :
+      level <= 8 ? 64 : 256;
+}
+
+void CEncoder::Alloc()
+{
+  if (!_hash)
+  {
+    _hash.Alloc(kHashSize);
+    _prev.Alloc(kEncoderChunkSizeMax);
+    _items.Alloc(kEncoderChunkSizeMax);
+    Normalize();
+  }
+}
+
+void CEncoder::Normalize()
+{
+  memset(_hash, 0, kHashSize * sizeof(UInt32));
+  _base = 1;
+}
+
+
+#define HASH_CALC(p) ((((UInt32)(p)[0] | ((UInt32)(p)[1] << 8) | ((UInt32)(p)[2] << 16)) * 0x9E3779B1) >> (32 - kNumHashBits))
+
+static unsigned GetNumDistBits(UInt32 dist)
+{
+  unsigned n = 0;
+  while ((dist >>= 1) != 0)
+    n++;
+  return n;
+}
+
+
+size_t CEncoder::Encode(const Byte *src, size_t srcSize, Byte *dest, size_t destSize)
+{
+  if (srcSize <= kHeaderSize + 4 || srcSize > kEncoderChunkSizeMax || destSize < srcSize)
+    return 0;
+
+  Alloc();
+  if (_base > (UInt32)0 - (UInt32)kEncoderChunkSizeMax * 2)
+    Normalize();
+
+  const UInt32 base = _base;
+  _base += (UInt32)srcSize;
+
+  UInt32 *hash = _hash;
+  UInt32 *prev = _prev;
+  UInt32 *items = _items;
+  size_t numItems = 0;
+
+  UInt32 freqs[kNumSyms];
+  memset(freqs, 0, sizeof(freqs));
+
+  {
+    const UInt32 numCycles = _numCycles;
+    UInt32 curLen = 0;
+    UInt32 curDist = 0;
+    size_t pos = 0;
+
+    #define INSERT_POS(ps) \
+      { const UInt32 h = HASH_CALC(src + (ps)); \
+        prev[ps] = hash[h]; hash[h] = base + (UInt32)(ps); }
+
+    // it finds longest match at (ps) and inserts (ps) to hash chain
+    #define FIND_MATCH(ps, lenRes, distRes) \
+    { \
+      lenRes = 0; \
+      if (srcSize - (ps) >= kMatchMinLen) \
+      { \
+        const Byte *cur = src + (ps); \
+        const UInt32 h = HASH_CALC(cur); \
+        UInt32 m = hash[h]; \
+        hash[h] = base + (UInt32)(ps); \
+        prev[ps] = m; \
+        const UInt32 lenLimit = (UInt32)(srcSize - (ps)); \
+        UInt32 cycles = numCycles; \
+        for (; m >= base && cycles != 0; cycles--) \
+        { \
+          const Byte *p = src + (m - base); \
+          m = prev[(size_t)(p - src)]; \
+          if (p[lenRes] != cur[lenRes] || p[0] != cur[0]) \
+            continue; \
+          UInt32 len = 1; \
+          while (len != lenLimit && p[len] == cur[len]) \
+            len++; \
+          if (len > lenRes) \
+          { \
+            lenRes = len; \
+            distRes = (UInt32)(cur - p); \
+            if (len == lenLimit) \
+              break; \
+          } \
+        } \
+        if (lenRes < kMatchMinLen) \
+          lenRes = 0; \
+      } \
+    }
+
+    FIND_MATCH(pos, curLen, curDist)
+
+    while (pos < srcSize)
+    {
+      if (curLen == 0)
+      {
+        const unsigned b = src[pos];
+        items[numItems++] = b;
+        freqs[b]++;
+        pos++;
+        if (pos < srcSize)
+          FIND_MATCH(pos, curLen, curDist)
+        continue;
+      }
+
+      size_t insertPos = pos + 1;
+      if (_lazy && pos + 1 < srcSize && curLen < 32)
+      {
+        UInt32 nextLen, nextDist = 0;
+        FIND_MATCH(pos + 1, nextLen, nextDist)
+        insertPos++;
+        if (nextLen > curLen)
+        {
+          const unsigned b = src[pos];
+          items[numItems++] = b;
+          freqs[b]++;
+          pos++;
+          curLen = nextLen;
+          curDist = nextDist;
+          continue;
+        }
+      }
+
+      {
+        const size_t end = pos + curLen;
+        const size_t insertLim = (srcSize >= kMatchMinLen ? srcSize - kMatchMinLen + 1 : 0);
+        for (; insertPos < end && insertPos < insertLim; insertPos++)
+          INSERT_POS(insertPos)
+      }
+
+      items[numItems++] = (curLen << 16) | curDist;
+      {
+        const UInt32 lenSlot = curLen - kMatchMinLen;
+        freqs[256 + (GetNumDistBits(curDist) << kNumLenBits) + (lenSlot < kLenMask ? lenSlot : kLenMask)]++;
+      }
+      pos += curLen;
+      curLen = 0;
+      if (pos < srcSize)
+        FIND_MATCH(pos, curLen, curDist)
+    }
+  }
+
+  // end marker
+  freqs[256]++;
+
+  UInt32 codes[kNumSyms];
+  Byte lens[kNumSyms];
+  Huffman_Generate(freqs, codes, lens, kNumSyms, kNumHuffBits);
+
+  {
+    for (unsigned i = 0; i < kHeaderSize; i++)
+      dest[i] = (Byte)(lens[(size_t)i * 2] | (lens[(size_t)i * 2 + 1] << 4));
+  }
+
+  /*
+    Bits are written by 16-bit words (little-endian).
+    Additional length bytes are written to the byte stream between these words.
+    The decoder reads next word, when it has used more than 16 bits from current pair of words.
+    So we reserve the place for next word only after overflow of 16 bits.
+  */
+
+  Byte *nextBits = dest + kHeaderSize;
+  Byte *nextBits2 = nextBits + 2;
+  Byte *nextByte = nextBits + 4;
+  const Byte *lim = dest + srcSize - 8;
+  UInt32 bitBuf = 0;
+  unsigned bitCount = 0;
+
+  #define WRITE_BITS(val, num) \
+    { bitBuf = (bitBuf << (num)) | (val); \
+      bitCount += (num); \
+      if (bitCount > 16) { \
+        bitCount -= 16; \
+        SetUi16(nextBits, (UInt16)(bitBuf >> bitCount)) \
+        nextBits = nextBits2; \
+        nextBits2 = nextByte; \
+        nextByte += 2; }}
+
+  for (size_t i = 0; i < numItems; i++)
+  {
+    if (nextByte > lim)
+      return 0;
+    const UInt32 item = items[i];
+    if (item < 256)
+    {
+      WRITE_BITS(codes[item], lens[item])
+      continue;
+    }
+    const UInt32 dist = item & 0xFFFF;
+    const UInt32 len = (item >> 16) - kMatchMinLen;
+    const unsigned numDistBits = GetNumDistBits(dist);
+    const unsigned sym = 256 + (numDistBits << kNumLenBits) + (len < kLenMask ? len : kLenMask);
+    WRITE_BITS(codes[sym], lens[sym])
+    if (len >= kLenMask)
+    {
+      if (len - kLenMask < 0xFF)
+        *nextByte++ = (Byte)(len - kLenMask);
+      else
+      {
+        *nextByte++ = 0xFF;
+        SetUi16(nextByte, (UInt16)len)
+        nextByte += 2;
+      }
+    }
+    if (numDistBits != 0)
+      WRITE_BITS(dist - ((UInt32)1 << numDistBits), numDistBits)
+  }
+
+  if (nextByte > lim)
+    return 0;
+  WRITE_BITS(codes[256], lens[256])
+  SetUi16(nextBits, (UInt16)(bitBuf << (16 - bitCount)))
+  SetUi16(nextBits2, 0)
+
+  const size_t size = (size_t)(nextByte - dest);
+  if (size >= srcSize)
+    return 0;
+  return size;
+}
+
+}}
@@ -0,0 +1,39 @@
+// XpressEncoder.h
+
+#ifndef ZIP7_INC_XPRESS_ENCODER_H
+#define ZIP7_INC_XPRESS_ENCODER_H
+
+#include "../../Common/MyBuffer.h"
+
+namespace NCompress {
+namespace NXpress {
+
+// XPRESS Huffman encoder for independent chunks (WIM).
+
+const size_t kEncoderChunkSizeMax = (size_t)1 << 16;
+
+class CEncoder
+{
+  CObjArray<UInt32> _hash;
+  CObjArray<UInt32> _prev;
+  CObjArray<UInt32> _items;
+  UInt32 _base;
+  UInt32 _numCycles;
+  bool _lazy;
+
+  void Normalize();
+public:
+  CEncoder();
+  void Alloc();
+  void SetLevel(UInt32 level);
+
+  /* returns the size of compressed data.
+     returns 0, if compressed data is not smaller than (srcSize),
+     (destSize) must be (srcSize) or more.
+     (srcSize <= kEncoderChunkSizeMax) */
+  size_t Encode(const Byte *src, size_t srcSize, Byte *dest, size_t destSize);
+};
+
+}}
+
+#endif
@@ -206,5 +206,42 @@ inputs:
 
 Z7_IFACE_CONSTR_STREAM(IStreamSetRestriction, 0x10)
 
+
+/*
+IStreamGetFileHandle::GetFileHandle(UInt64 *handle)
+  returns the OS file handle (file descriptor in posix) of file stream.
+  The caller can use it only for fast copying of data by OS.
+  The caller must not close the handle and must not change file position.
+
+IOutStreamCopyFrom::CopyFrom(IInStream *inStream, UInt64 inPos, UInt64 size, UInt64 *processedSize)
+  It copies (size) bytes from (inStream) at position (inPos)
+  to current position of output stream with fast OS functions
+  (reflink, copy_file_range), so the data is not read to user space.
+  The output position is moved by (*processedSize).
+  returns:
+    S_OK    : (*processedSize == size)
+    S_FALSE : fast copying is not possible for these streams now.
+              The caller can copy remaining (size - *processedSize) bytes
+              with Read() / Write() calls.
+    another code : error.
+
+IOutStreamFlush::Flush()
+  It writes all buffered data of stream to storage device (FlushFileBuffers / fsync).
+  The caller can use it to order the writes that must reach the disk
+  before another write, for example, before the rewriting of archive header.
+*/
+
+#define Z7_IFACEM_IStreamGetFileHandle(x) \
+  x(GetFileHandle(UInt64 *handle))
+Z7_IFACE_CONSTR_STREAM(IStreamGetFileHandle, 0x11)
+
+#define Z7_IFACEM_IOutStreamCopyFrom(x) \
+  x(CopyFrom(IInStream *inStream, UInt64 inPos, UInt64 size, UInt64 *processedSize))
+Z7_IFACE_CONSTR_STREAM(IOutStreamCopyFrom, 0x12)
+
+#define Z7_IFACEM_IOutStreamFlush(x) \
+  x(Flush())
+Z7_IFACE_CONSTR_STREAM(IOutStreamFlush, 0x13)
+
 Z7_PURE_INTERFACES_END
 #endif
@@ -328,9 +328,10 @@ struct CArcTime
 class CArchiveExtractCallback Z7_final:
   public IArchiveExtractCallback,
   public ICryptoGetTextPassword,
+  public IArchiveExtractCallbackStat,
   public CMyUnknownImp
 {
-  Z7_IFACES_IMP_UNK_2(IArchiveExtractCallback, ICryptoGetTextPassword)
+  Z7_IFACES_IMP_UNK_3(IArchiveExtractCallback, ICryptoGetTextPassword, IArchiveExtractCallbackStat)
   Z7_IFACE_COM7_IMP(IProgress)
 
   CMyComPtr<IInArchive> _archiveHandler;
@@ -355,6 +356,7 @@ public:
   UInt64 NumErrors;
   bool PasswordIsDefined;
   UString Password;
+  CStageStatItem Stages[NArchive::NExtract::NStage::kNumStages];
 
   CArchiveExtractCallback() : PasswordIsDefined(false) {}
 };
@@ -597,6 +599,52 @@ Z7_COM7F_IMF(CArchiveExtractCallback::CryptoGetTextPassword(BSTR *password))
 }
 
 
+// the handler calls it before extracting to check that we need the statistics
+Z7_COM7F_IMF(CArchiveExtractCallback::IsStageStatEnabled(Int32 *enabled))
+{
+  *enabled = 1;
+  return S_OK;
+}
+
+Z7_COM7F_IMF(CArchiveExtractCallback::ReportStageStat(UInt32 stage, UInt64 time, UInt64 size))
+{
+  if (stage < NArchive::NExtract::NStage::kNumStages)
+  {
+    Stages[stage].Time += time;
+    Stages[stage].Size += size;
+  }
+  return S_OK;
+}
+
+static const char * const k_StageNames[NArchive::NExtract::NStage::kNumStages] =
+{
+    "Decode"
+  , "Filter"
+  , "CRC"
+  , "Write"
+};
+
+static void PrintStageStat(const CStageStatItem *stages)
+{
+  for (unsigned i = 0; i < NArchive::NExtract::NStage::kNumStages; i++)
+  {
+    const CStageStatItem &item = stages[i];
+    if (item.Time == 0 && item.Size == 0)
+      continue;
+    char temp[32];
+    Print(k_StageNames[i]);
+    Print(" : ");
+    ConvertUInt64ToString(item.Time / 1000, temp);
+    Print(temp);
+    Print(" ms, ");
+    ConvertUInt64ToString(item.Size >> 10, temp);
+    Print(temp);
+    Print(" KB");
+    PrintNewLine();
+  }
+}
+
+
 
 //////////////////////////////////////////////////////////////
 // Archive Creating callback class
@@ -1138,6 +1186,7 @@ Z7_DIAGNOSTIC_IGNORE_CAST_FUNCTION
         PrintError("Extract Error");
         return 1;
       }
+      PrintStageStat(extractCallbackSpec->Stages);
     }
   }
 
@@ -102,6 +102,7 @@ enum Enum
   kDisableHeaders,
   kDisablePercents,
   kShowTime,
+  kShowStageTime,
   kLogLevel,
 
   kOutStream,
@@ -137,6 +138,7 @@ enum Enum
   // kHashGenFile,
   kHashDir,
   kExtractMemLimit,
+  kSeekIndex,
  
   kStdIn,
   kStdOut,
@@ -176,7 +178,8 @@ enum Enum
   kNameTrailReplace,
 
   kDeleteAfterCompressing,
-  kSetArcMTime
+  kSetArcMTime,
+  kAppendInPlace
 
   #ifndef Z7_NO_CRYPTO
   , kPassword
@@ -253,6 +256,7 @@ static const CSwitchForm kSwitchForms[] =
   { "ba", SWFRM_SIMPLE },
   { "bd", SWFRM_SIMPLE },
   { "bt", SWFRM_SIMPLE },
+  { "bts", SWFRM_SIMPLE },
   { "bb", SWFRM_STRING_SINGL(0) },
 
   { "bso", NSwitchType::kChar, false, 1, k_Stream_PostCharSet },
@@ -288,6 +292,7 @@ static const CSwitchForm kSwitchForms[] =
   // { "scrf", SWFRM_STRING_SINGL(1) },
   { "shd", SWFRM_STRING_SINGL(1) },
   { "smemx", SWFRM_STRING },
+  { "sidx", SWFRM_SIMPLE },
   
   { "si", SWFRM_STRING },
   { "so", SWFRM_SIMPLE },
@@ -327,7 +332,8 @@ static const CSwitchForm kSwitchForms[] =
   { "snt", SWFRM_MINUS },
   
   { "sdel", SWFRM_SIMPLE },
-  { "stl", SWFRM_SIMPLE }
+  { "stl", SWFRM_SIMPLE },
+  { "sap", SWFRM_SIMPLE }
 
   #ifndef Z7_NO_CRYPTO
   , { "p", SWFRM_STRING }
@@ -1037,7 +1043,11 @@ void CArcCmdLineParser::Parse1(const UStringVector &commandStrings,
   if (parser[NKey::kListTimestampUTC].ThereIs)
     g_Timestamp_Show_UTC = !parser[NKey::kListTimestampUTC].WithMinus;
   options.TechMode = parser[NKey::kTechMode].ThereIs;
+  options.WriteSeekIndex = parser[NKey::kSeekIndex].ThereIs;
   options.ShowTime = parser[NKey::kShowTime].ThereIs;
+  options.ShowStageTime = parser[NKey::kShowStageTime].ThereIs;
+  if (options.ShowStageTime)
+    options.ShowTime = true;
 
   if (parser[NKey::kDisablePercents].ThereIs)
     options.DisablePercents = true;
@@ -1103,9 +1113,7 @@ void CArcCmdLineParser::Parse1(const UStringVector &commandStrings,
           #endif
         )
     {
-      #ifdef _WIN32 // change it !
       SetLargePageSize();
-      #endif
       // note: this process also can inherit that Privilege from parent process
       g_LargePagesMode =
       #if defined(_WIN32) && !defined(UNDER_CE)
@@ -1668,6 +1676,7 @@ void CArcCmdLineParser::Parse2(CArcCmdLineOptions &options)
 
     updateOptions.DeleteAfterCompressing = parser[NKey::kDeleteAfterCompressing].ThereIs;
     updateOptions.SetArcMTime = parser[NKey::kSetArcMTime].ThereIs;
+    updateOptions.AppendInPlace = parser[NKey::kAppendInPlace].ThereIs;
 
     if (updateOptions.StdOutMode && updateOptions.EMailMode)
       throw CArcCmdLineException("stdout mode and email mode cannot be combined");
@@ -67,6 +67,8 @@ struct CArcCmdLineOptions
   bool ShowDialog;
   bool TechMode;
   bool ShowTime;
+  bool ShowStageTime;
+  bool WriteSeekIndex;
   CBoolPair ListPathSeparatorSlash;
 
   CBoolPair NtSecurity;
@@ -140,6 +142,8 @@ struct CArcCmdLineOptions
       ShowDialog(false),
       TechMode(false),
       ShowTime(false),
+      ShowStageTime(false),
+      WriteSeekIndex(false),
 
       ConsoleCodePage(-1),
 
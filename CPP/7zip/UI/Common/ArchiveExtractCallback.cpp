@@ -283,6 +283,10 @@ CArchiveExtractCallback::CArchiveExtractCallback():
     // Write_ATime(true),
     // Write_MTime(true),
     Is_elimPrefix_Mode(false),
+    IoStat(NULL),
+   #ifndef Z7_SFX
+    StageStat(NULL),
+   #endif
     _arc(NULL),
     _multiArchives(false)
 {
@@ -1477,8 +1481,13 @@ HRESULT CArchiveExtractCallback::GetExtractStream(CMyComPtr<ISequentialOutStream
 
   _outFileStreamSpec = new COutFileStream;
   CMyComPtr<IOutStream> outFileStream_Loc(_outFileStreamSpec);
+  _outFileStreamSpec->IoStat = IoStat;
   
-  if (!_outFileStreamSpec->Create_ALWAYS_or_Open_ALWAYS(fullProcessedPath, !_isSplit))
+  const UInt64 openStartTime = IoStat ? IoStat_GetTime_us() : 0;
+  const bool openRes = _outFileStreamSpec->Create_ALWAYS_or_Open_ALWAYS(fullProcessedPath, !_isSplit);
+  if (IoStat)
+    IoStat->AddCall(NIoStat::kOpen, 0, openStartTime);
+  if (!openRes)
   {
     // if (::GetLastError() != ERROR_FILE_EXISTS || !isSplit)
     {
@@ -2408,7 +2417,14 @@ Z7_COM7F_IMF(CArchiveExtractCallback::SetOperationResult(Int32 opRes))
 
   #endif // Z7_SFX
 
-  RINOK(CloseReparseAndFile())
+  {
+    const bool isFile = (IoStat && _outFileStream);
+    const UInt64 closeStartTime = isFile ? IoStat_GetTime_us() : 0;
+    const HRESULT res = CloseReparseAndFile();
+    if (isFile)
+      IoStat->AddCall(NIoStat::kClose, 0, closeStartTime);
+    RINOK(res)
+  }
   
   #ifdef Z7_USE_SECURITY_CODE
   if (!_stdOutMode && _extractMode && _ntOptions.NtSecurity.Val && _arc->GetRawProps)
@@ -2652,6 +2668,24 @@ Z7_COM7F_IMF(CArchiveExtractCallback::RequestMemoryUse(
       requiredSize, allowedSize, answerFlags);
 }
 
+
+Z7_COM7F_IMF(CArchiveExtractCallback::IsStageStatEnabled(Int32 *enabled))
+{
+  *enabled = BoolToInt(StageStat != NULL);
+  return S_OK;
+}
+
+Z7_COM7F_IMF(CArchiveExtractCallback::ReportStageStat(UInt32 stage, UInt64 time, UInt64 size))
+{
+  if (StageStat && stage < NArchive::NExtract::NStage::kNumStages)
+  {
+    CStageStatItem &item = StageStat[stage];
+    item.Time += time;
+    item.Size += size;
+  }
+  return S_OK;
+}
+
 #endif // Z7_SFX
 
 
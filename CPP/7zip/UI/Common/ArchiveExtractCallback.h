@@ -241,6 +241,7 @@ class CArchiveExtractCallback Z7_final:
   public IArchiveUpdateCallbackFile,
   public IArchiveGetDiskProperty,
   public IArchiveRequestMemoryUseCallback,
+  public IArchiveExtractCallbackStat,
 #endif
   public CMyUnknownImp
 {
@@ -252,6 +253,7 @@ class CArchiveExtractCallback Z7_final:
   Z7_COM_QI_ENTRY(IArchiveUpdateCallbackFile)
   Z7_COM_QI_ENTRY(IArchiveGetDiskProperty)
   Z7_COM_QI_ENTRY(IArchiveRequestMemoryUseCallback)
+  Z7_COM_QI_ENTRY(IArchiveExtractCallbackStat)
 #endif
   Z7_COM_QI_END
   Z7_COM_ADDREF_RELEASE
@@ -265,6 +267,7 @@ class CArchiveExtractCallback Z7_final:
   Z7_IFACE_COM7_IMP(IArchiveUpdateCallbackFile)
   Z7_IFACE_COM7_IMP(IArchiveGetDiskProperty)
   Z7_IFACE_COM7_IMP(IArchiveRequestMemoryUseCallback)
+  Z7_IFACE_COM7_IMP(IArchiveExtractCallbackStat)
 #endif
 
   // bool Write_CTime;
@@ -275,6 +278,10 @@ class CArchiveExtractCallback Z7_final:
   bool _removePartsForAltStreams;
 public:
   bool Is_elimPrefix_Mode;
+  CIoStat *IoStat;
+#ifndef Z7_SFX
+  CStageStatItem *StageStat; // optional: [NArchive::NExtract::NStage::kNumStages]
+#endif
 private:
 
   const CArc *_arc;
@@ -18,6 +18,16 @@
 #endif
 #endif // USE_POSIX_TIME
 
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#ifdef __NR_perf_event_open
+#define Z7_BENCH_PERF
+#endif
+#endif
+
 #ifdef _WIN32
 #define USE_ALLOCA
 #endif
@@ -769,9 +779,144 @@ static UInt64 GetNumCommands_from_Size_and_Complexity(UInt64 size, Int32 complex
       size / (UInt32)(-complexity);
 }
 
+/* CBenchPerf reads hardware performance counters of process.
+   The counters are inherited by threads that were created after Open() call.
+   So we call Open() before creation of benchmark threads,
+   and we use the difference of values between Start() and Stop() calls.
+   The idle workers of thread pool were created before Open() call,
+   so Open() destroys them, and the pool creates new workers for benchmark. */
+
+class CBenchPerf
+{
+ #ifdef Z7_BENCH_PERF
+  int _fds[NBenchPerf::kNumCounters];
+  UInt64 _start[NBenchPerf::kNumCounters];
+  bool ReadCounter(unsigned i, UInt64 &val) const;
+ #endif
+public:
+  CBenchPerf();
+  ~CBenchPerf();
+  bool Open();
+  void Start();
+  void Stop(CBenchInfo &info) const;
+};
+
+#ifdef Z7_BENCH_PERF
+
+CBenchPerf::CBenchPerf()
+{
+  for (unsigned i = 0; i < NBenchPerf::kNumCounters; i++)
+    _fds[i] = -1;
+}
+
+CBenchPerf::~CBenchPerf()
+{
+  for (unsigned i = 0; i < NBenchPerf::kNumCounters; i++)
+    if (_fds[i] >= 0)
+      close(_fds[i]);
+}
+
+static const UInt32 g_PerfTypes[NBenchPerf::kNumCounters] =
+{
+  PERF_TYPE_HARDWARE,
+  PERF_TYPE_HARDWARE,
+  PERF_TYPE_HARDWARE,
+  PERF_TYPE_HARDWARE,
+  PERF_TYPE_HW_CACHE
+};
+
+static const UInt64 g_PerfConfigs[NBenchPerf::kNumCounters] =
+{
+  PERF_COUNT_HW_CPU_CYCLES,
+  PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_CACHE_MISSES,
+  PERF_COUNT_HW_BRANCH_MISSES,
+  PERF_COUNT_HW_CACHE_DTLB
+    | ((UInt64)PERF_COUNT_HW_CACHE_OP_READ << 8)
+    | ((UInt64)PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+};
+
+bool CBenchPerf::Open()
+{
+  bool isOK = false;
+ #ifndef Z7_ST
+  ThreadPool_Shutdown();
+ #endif
+  for (unsigned i = 0; i < NBenchPerf::kNumCounters; i++)
+  {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = g_PerfTypes[i];
+    attr.config = g_PerfConfigs[i];
+    attr.inherit = 1;
+    // user mode counting is allowed for (perf_event_paranoid <= 2)
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // the kernel multiplexes counters, if there are not enough hardware counters
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    _fds[i] = (int)syscall(__NR_perf_event_open, &attr,
+        0, // current process
+        -1, // any cpu
+        -1, // no group
+        0);
+    if (_fds[i] >= 0)
+      isOK = true;
+  }
+  return isOK;
+}
+
+bool CBenchPerf::ReadCounter(unsigned i, UInt64 &val) const
+{
+  val = 0;
+  if (_fds[i] < 0)
+    return false;
+  UInt64 v[3]; // value, time_enabled, time_running
+  if (read(_fds[i], v, sizeof(v)) != (ssize_t)sizeof(v))
+    return false;
+  val = v[0];
+  if (v[2] == 0)
+    return v[0] == 0;
+  if (v[2] < v[1])
+    val = MyMultDiv64(v[0], v[1], v[2]);
+  return true;
+}
+
+void CBenchPerf::Start()
+{
+  for (unsigned i = 0; i < NBenchPerf::kNumCounters; i++)
+    ReadCounter(i, _start[i]);
+}
+
+void CBenchPerf::Stop(CBenchInfo &info) const
+{
+  info.PerfMask = 0;
+  for (unsigned i = 0; i < NBenchPerf::kNumCounters; i++)
+  {
+    UInt64 v;
+    if (ReadCounter(i, v) && v >= _start[i])
+    {
+      info.Perf[i] = v - _start[i];
+      info.PerfMask |= (1u << i);
+    }
+  }
+}
+
+#else
+
+CBenchPerf::CBenchPerf() {}
+CBenchPerf::~CBenchPerf() {}
+bool CBenchPerf::Open() { return false; }
+void CBenchPerf::Start() {}
+void CBenchPerf::Stop(CBenchInfo &info) const { info.PerfMask = 0; }
+
+#endif
+
+
 struct CBenchProps
 {
   bool LzmaRatingMode;
+  bool PerfMode; // it reads hardware performance counters for each pass
   
   Int32 EncComplex;
   Int32 DecComplexCompr;
@@ -781,6 +926,7 @@ struct CBenchProps
 
   CBenchProps():
       LzmaRatingMode(false),
+      PerfMode(false),
       KeySize(0)
     {}
 
@@ -1840,6 +1986,10 @@ static HRESULT MethodBench(
 
   #endif
 
+  // we open counters before creation of encoder and decoder threads
+  CBenchPerf perf;
+  const bool perfMode = (benchProps->PerfMode && perf.Open());
+
   CBenchEncoders encodersSpec(numEncoderThreads);
   CEncoderInfo *encoders = encodersSpec.encoders;
 
@@ -2013,6 +2163,8 @@ static HRESULT MethodBench(
     }
 
     CBenchProgressInfo *bpi = encoders[0].progressInfoSpec[0];
+    if (perfMode)
+      perf.Start();
     bpi->SetStartTime();
 
     const WRes wres = encoderFlusher.StartAndWait();
@@ -2022,6 +2174,8 @@ static HRESULT MethodBench(
   else
   #endif
   {
+    if (perfMode)
+      perf.Start();
     RINOK(encoders[0].Encode())
   }
 
@@ -2030,6 +2184,8 @@ static HRESULT MethodBench(
   CBenchInfo info;
 
   encoders[0].progressInfoSpec[0]->SetFinishTime(info);
+  if (perfMode)
+    perf.Stop(info);
   info.UnpackSize = 0;
   info.PackSize = 0;
   info.NumIterations = encoders[0].NumIterations;
@@ -2056,6 +2212,9 @@ static HRESULT MethodBench(
   #ifndef Z7_ST
   const bool mtDecoderMode = (numDecoderThreads > 1) || affinityMode->NeedAffinity();
   #endif
+
+  if (perfMode)
+    perf.Start();
   
   for (i = 0; i < numEncoderThreads; i++)
   {
@@ -2135,6 +2294,8 @@ static HRESULT MethodBench(
  
   RINOK(status.Res)
   encoders[0].progressInfoSpec[0]->SetFinishTime(info);
+  if (perfMode)
+    perf.Stop(info);
  
   /*
   #ifndef Z7_ST
@@ -2812,6 +2973,109 @@ static void PrintNumber(IBenchPrintCallback &f, UInt64 value, unsigned size)
   f.Print(s + startPos);
 }
 
+#ifndef Z7_ST
+
+/* Sync benchmark: two threads pass the token to each other
+   via pair of events (or semaphores). It measures the latency of handoff
+   that is used for blocks in match finder threads and multithreaded coders. */
+
+struct CSyncBenchInfo: public CBaseThreadInfo
+{
+  bool UseSemaphores;
+  UInt32 NumIterations;
+  ::CAutoResetEvent Events[2];
+  ::CSemaphore Semaphores[2];
+
+  CSyncBenchInfo()
+  {
+    for (unsigned i = 0; i < 2; i++)
+    {
+      Event_Construct(&Events[i]);
+      Semaphore_Construct(&Semaphores[i]);
+    }
+  }
+  ~CSyncBenchInfo()
+  {
+    Wait_If_Created();
+    for (unsigned i = 0; i < 2; i++)
+    {
+      Event_Close(&Events[i]);
+      Semaphore_Close(&Semaphores[i]);
+    }
+  }
+  WRes CreateObjects()
+  {
+    for (unsigned i = 0; i < 2; i++)
+    {
+      RINOK(AutoResetEvent_CreateNotSignaled(&Events[i]))
+      RINOK(Semaphore_Create(&Semaphores[i], 0, 1))
+    }
+    return 0;
+  }
+  void Signal(unsigned i)
+  {
+    if (UseSemaphores)
+      Semaphore_Release1(&Semaphores[i]);
+    else
+      Event_Set(&Events[i]);
+  }
+  void Wait(unsigned i)
+  {
+    if (UseSemaphores)
+      Semaphore_Wait(&Semaphores[i]);
+    else
+      Event_Wait(&Events[i]);
+  }
+};
+
+static THREAD_FUNC_DECL SyncThreadFunction(void *param)
+{
+  CSyncBenchInfo *p = (CSyncBenchInfo *)param;
+  for (UInt32 i = p->NumIterations; i != 0; i--)
+  {
+    p->Wait(0);
+    p->Signal(1);
+  }
+  return THREAD_FUNC_RET_ZERO;
+}
+
+static HRESULT SyncBench(IBenchPrintCallback &f)
+{
+  f.NewLine();
+  f.Print("Sync handoff (ns per round trip):");
+  const UInt64 freq = GetFreq();
+  for (unsigned k = 0; k < 2; k++)
+  {
+    f.Print(k == 0 ? "  Event:" : "  Semaphore:");
+    for (UInt32 numIterations = 1 << 8;; numIterations <<= 1)
+    {
+      RINOK(f.CheckBreak())
+      CSyncBenchInfo info;
+      info.UseSemaphores = (k != 0);
+      info.NumIterations = numIterations;
+      RINOK_WRes(info.CreateObjects())
+      RINOK_WRes(info.Thread.Create(SyncThreadFunction, &info))
+      const UInt64 start = ::GetTimeCount();
+      for (UInt32 i = numIterations; i != 0; i--)
+      {
+        info.Signal(0);
+        info.Wait(1);
+      }
+      const UInt64 delta = ::GetTimeCount() - start;
+      RINOK_WRes(info.Wait_If_Created())
+      if (delta >= freq / 4 || numIterations >= ((UInt32)1 << 24))
+      {
+        PrintNumber(f, MyMultDiv64(delta, 1000000000, freq) / numIterations, 6);
+        break;
+      }
+    }
+  }
+  f.NewLine();
+  return S_OK;
+}
+
+#endif
+
 static const unsigned kFieldSize_Name = 12;
 static const unsigned kFieldSize_SmallName = 4;
 static const unsigned kFieldSize_Speed = 9;
@@ -3000,11 +3264,15 @@ AString GetProcessThreadsInfo(const NSystem::CProcessAffinity &ti)
 
 #ifdef _WIN32
 extern bool g_LargePagesMode;
+#endif
 extern "C"
 {
   extern SIZE_T g_LargePageSize;
+  #ifndef _WIN32
+  extern UInt64 g_LargePages_HugeTlb_Size;
+  extern UInt64 g_LargePages_Thp_Size;
+  #endif
 }
-#endif
 
 void Add_LargePages_String(AString &s)
 {
@@ -3022,7 +3290,27 @@ void Add_LargePages_String(AString &s)
     s += ")";
   }
   #else
-    s += "";
+  if (g_LargePageSize != 0)
+  {
+    s.Add_OptSpaced("(LP-");
+    PrintSize_KMGT_Or_Hex(s, g_LargePageSize);
+    // the sizes of blocks allocated with MAP_HUGETLB and with transparent huge pages
+    const UInt64 ht = g_LargePages_HugeTlb_Size;
+    const UInt64 thp = g_LargePages_Thp_Size;
+    if (ht != 0)
+    {
+      s += "-HT:";
+      s.Add_UInt64(ht >> 20);
+      s += "M";
+    }
+    if (thp != 0)
+    {
+      s += "-THP:";
+      s.Add_UInt64(thp >> 20);
+      s += "M";
+    }
+    s += ")";
+  }
   #endif
 }
 
@@ -3056,6 +3344,8 @@ static void PrintRequirements(IBenchPrintCallback &f, const char *sizeString,
 
 
 
+struct CBenchLog;
+
 struct CBenchCallbackToPrint Z7_final: public IBenchCallback
 {
   bool NeedPrint;
@@ -3070,11 +3360,13 @@ struct CBenchCallbackToPrint Z7_final: public IBenchCallback
   UInt64 DictSize;
 
   IBenchPrintCallback *_file;
+  CBenchLog *Log;
   CBenchProps BenchProps;
   CTotalBenchRes EncodeRes;
   CTotalBenchRes DecodeRes;
 
   CBenchInfo BenchInfo_Results[2];
+  UInt64 Ratings[2];
   
   CBenchCallbackToPrint():
       NeedPrint(true),
@@ -3083,7 +3375,8 @@ struct CBenchCallbackToPrint Z7_final: public IBenchCallback
       NameFieldSize(0),
       EncodeWeight(1),
       DecodeWeight(1),
-      CpuFreq(0)
+      CpuFreq(0),
+      Log(NULL)
       {}
 
   void Init() { EncodeRes.Init(); DecodeRes.Init(); }
@@ -3106,11 +3399,14 @@ HRESULT CBenchCallbackToPrint::SetEncodeResult(const CBenchInfo &info, bool fina
 {
   RINOK(_file->CheckBreak())
   if (final)
+  {
     BenchInfo_Results[0] = info;
+    Ratings[0] = BenchProps.GetRating_Enc(DictSize, info.GlobalTime, info.GlobalFreq, info.UnpackSize * info.NumIterations);
+  }
   if (final)
   if (NeedPrint)
   {
-    const UInt64 rating = BenchProps.GetRating_Enc(DictSize, info.GlobalTime, info.GlobalFreq, info.UnpackSize * info.NumIterations);
+    const UInt64 rating = Ratings[0];
     PrintResults(_file, info,
         EncodeWeight, rating,
         ShowFreq, CpuFreq, &EncodeRes);
@@ -3126,11 +3422,14 @@ HRESULT CBenchCallbackToPrint::SetDecodeResult(const CBenchInfo &info, bool fina
 {
   RINOK(_file->CheckBreak())
   if (final)
+  {
     BenchInfo_Results[1] = info;
+    Ratings[1] = BenchProps.GetRating_Dec(info.GlobalTime, info.GlobalFreq, info.UnpackSize, info.PackSize, info.NumIterations);
+  }
   if (final)
   if (NeedPrint)
   {
-    const UInt64 rating = BenchProps.GetRating_Dec(info.GlobalTime, info.GlobalFreq, info.UnpackSize, info.PackSize, info.NumIterations);
+    const UInt64 rating = Ratings[1];
     if (Use2Columns)
       _file->Print(kSep);
     else
@@ -3183,6 +3482,614 @@ static bool DoesWildcardMatchName_NoCase(const AString &mask, const char *name)
 }
 
 
+/* corpus mode: (-mfile) switches can specify files and directories.
+   All files are loaded to one buffer, and the benchmark uses that data
+   instead of generated data. */
+
+static int CompareCorpusNames(void *const *a1, void *const *a2, void * /* param */)
+{
+  return CompareFileNames(*(*((const FString *const *)a1)), *(*((const FString *const *)a2)));
+}
+
+static HRESULT Bench_AddCorpusPath(const FString &path, FStringVector &files)
+{
+  NFile::NFind::CFileInfo fi;
+  if (!fi.Find(path))
+    return GetLastError_noZero_HRESULT();
+  if (!fi.IsDir())
+  {
+    files.Add(path);
+    return S_OK;
+  }
+  FString prefix = path;
+  prefix.Add_PathSepar();
+  NFile::NFind::CEnumerator enumerator;
+  enumerator.SetDirPrefix(prefix);
+  FStringVector names;
+  for (;;)
+  {
+    NFile::NFind::CDirEntry de;
+    bool found;
+    if (!enumerator.Next(de, found))
+      return GetLastError_noZero_HRESULT();
+    if (!found)
+      break;
+    names.Add(de.Name);
+  }
+  // we sort names to get same data order in each run
+  names.Sort(CompareCorpusNames, NULL);
+  FOR_VECTOR (i, names)
+  {
+    RINOK(Bench_AddCorpusPath(prefix + names[i], files))
+  }
+  return S_OK;
+}
+
+
+static HRESULT Bench_LoadCorpus(const FStringVector &paths, CMidAlignedBuffer &buf,
+    IBenchPrintCallback *printCallback)
+{
+  FStringVector files;
+  {
+    FOR_VECTOR (i, paths)
+    {
+      RINOK(Bench_AddCorpusPath(paths[i], files))
+    }
+  }
+
+  CRecordVector<UInt64> sizes;
+  UInt64 total = 0;
+  {
+    FOR_VECTOR (i, files)
+    {
+      NFile::NIO::CInFile file;
+      if (!file.Open(files[i]))
+        return GetLastError_noZero_HRESULT();
+      UInt64 len;
+      if (!file.GetLength(len))
+        return GetLastError_noZero_HRESULT();
+      sizes.Add(len);
+      total += len;
+    }
+  }
+
+  if (printCallback)
+  {
+    printCallback->Print("files =");
+    PrintNumber(*printCallback, files.Size(), 0);
+    printCallback->Print("  size =");
+    PrintNumber(*printCallback, total, 0);
+    printCallback->NewLine();
+  }
+
+  const size_t total_t = (size_t)total;
+  if (total_t != total)
+    return E_OUTOFMEMORY;
+
+  // (total == 0) is allowed. Also it's allowed if Alloc(0) returns NULL here
+  ALLOC_WITH_HRESULT(&buf, total_t)
+
+  size_t pos = 0;
+  FOR_VECTOR (i, files)
+  {
+    NFile::NIO::CInFile file;
+    if (!file.Open(files[i]))
+      return GetLastError_noZero_HRESULT();
+    const size_t len = (size_t)sizes[i];
+    size_t processed;
+    if (!file.ReadFull((Byte *)buf + pos, len, processed))
+      return GetLastError_noZero_HRESULT();
+    if (processed != len)
+      return E_FAIL;
+    pos += len;
+  }
+  return S_OK;
+}
+
+
+/* CBenchPeakMem measures the peak of process RSS over the level at Start().
+   Linux allows to reset the peak value (VmHWM) via /proc/self/clear_refs */
+
+struct CBenchPeakMem
+{
+  bool Defined;
+  UInt64 BaseSize;
+
+  CBenchPeakMem(): Defined(false), BaseSize(0) {}
+  void Start();
+  bool GetPeak(UInt64 &size) const;
+};
+
+#ifdef __linux__
+
+static bool Get_ProcStatus_Value_KiB(const char *name, UInt64 &val)
+{
+  const int fd = open("/proc/self/status", O_RDONLY);
+  if (fd < 0)
+    return false;
+  char buf[1 << 13];
+  const ssize_t res = read(fd, buf, sizeof(buf) - 1);
+  close(fd);
+  if (res <= 0)
+    return false;
+  buf[res] = 0;
+  const char *p = strstr(buf, name);
+  if (!p)
+    return false;
+  p += strlen(name);
+  while (*p == ' ' || *p == '\t')
+    p++;
+  const char *end;
+  val = ConvertStringToUInt64(p, &end);
+  return end != p;
+}
+
+void CBenchPeakMem::Start()
+{
+  Defined = false;
+  const int fd = open("/proc/self/clear_refs", O_WRONLY);
+  if (fd < 0)
+    return;
+  // "5" resets the peak RSS value of process
+  const bool isOK = (write(fd, "5", 1) == 1);
+  close(fd);
+  if (isOK)
+    Defined = Get_ProcStatus_Value_KiB("VmRSS:", BaseSize);
+}
+
+bool CBenchPeakMem::GetPeak(UInt64 &size) const
+{
+  size = 0;
+  UInt64 peak;
+  if (!Defined || !Get_ProcStatus_Value_KiB("VmHWM:", peak))
+    return false;
+  if (peak > BaseSize)
+    size = (peak - BaseSize) << 10;
+  return true;
+}
+
+#else
+
+void CBenchPeakMem::Start() {}
+bool CBenchPeakMem::GetPeak(UInt64 &size) const { size = 0; return false; }
+
+#endif
+
+
+static const unsigned kFieldSize_Ratio = 6;
+static const unsigned kFieldSize_Mem = 6;
+
+// (v) is value multiplied by 100. It writes 2 decimal digits after point.
+static void ConvertUInt64ToString_Dec2(UInt64 v, char *s)
+{
+  ConvertUInt64ToString(v / 100, s);
+  const unsigned pos = MyStringLen(s);
+  s[pos] = '.';
+  s[pos + 1] = (char)('0' + (unsigned)(v / 10 % 10));
+  s[pos + 2] = (char)('0' + (unsigned)(v % 10));
+  s[pos + 3] = 0;
+}
+
+static void PrintRatio(IBenchPrintCallback &f, UInt64 packSize, UInt64 unpackSize)
+{
+  // compression ratio in percents with 2 decimal digits
+  if (unpackSize != 0)
+  {
+    const UInt64 v = (packSize * 10000 + unpackSize / 2) / unpackSize;
+    char s[32];
+    ConvertUInt64ToString_Dec2(v, s);
+    PrintRight(f, s, kFieldSize_Ratio + 1);
+  }
+  else
+    PrintSpaces(f, kFieldSize_Ratio + 1);
+}
+
+static void PrintCorpusResults(IBenchPrintCallback &f, const CBenchInfo &encInfo, const CBenchPeakMem &peakMem)
+{
+  PrintRatio(f, encInfo.PackSize, encInfo.UnpackSize);
+  UInt64 mem;
+  if (peakMem.GetPeak(mem))
+    PrintNumber(f, (mem + (1 << 19)) >> 20, kFieldSize_Mem);
+}
+
+static void PrintPerfValue(IBenchPrintCallback &f, const char *name, UInt64 val, UInt64 divider)
+{
+  f.Print("  ");
+  f.Print(name);
+  f.Print(" ");
+  if (divider == 0)
+  {
+    f.Print("-");
+    return;
+  }
+  char s[32];
+  ConvertUInt64ToString_Dec2(MyMultDiv64(val, 100, divider), s);
+  f.Print(s);
+}
+
+/* It prints values of hardware counters for one pass:
+     IPC         : instructions per cycle
+     cyc/B       : cycles per byte of uncompressed data
+     miss/KB     : cache / branch / dTLB misses per KiB of uncompressed data
+   The low IPC with high cache and dTLB misses means memory-bound code. */
+
+static void PrintPerfResults(IBenchPrintCallback &f, const char *name, const CBenchInfo &info)
+{
+  f.Print(name);
+  if (info.PerfMask == 0)
+  {
+    f.Print("  -");
+    f.NewLine();
+    return;
+  }
+  const UInt64 size = info.Get_UnpackSize_Full();
+  const UInt64 *p = info.Perf;
+  const UInt64 cycles = (info.PerfMask & (1u << NBenchPerf::kCycles)) ? p[NBenchPerf::kCycles] : 0;
+  if (info.PerfMask & (1u << NBenchPerf::kInstructions))
+    PrintPerfValue(f, "IPC", p[NBenchPerf::kInstructions], cycles);
+  if (cycles != 0)
+    PrintPerfValue(f, "cyc/B", cycles, size);
+  const UInt64 sizeKB = size >> 10;
+  if (info.PerfMask & (1u << NBenchPerf::kCacheMisses))
+    PrintPerfValue(f, "cache-miss/KB", p[NBenchPerf::kCacheMisses], sizeKB);
+  if (info.PerfMask & (1u << NBenchPerf::kBranchMisses))
+    PrintPerfValue(f, "branch-miss/KB", p[NBenchPerf::kBranchMisses], sizeKB);
+  if (info.PerfMask & (1u << NBenchPerf::kTlbMisses))
+    PrintPerfValue(f, "dTLB-miss/KB", p[NBenchPerf::kTlbMisses], sizeKB);
+  f.NewLine();
+}
+
+static void PrintCodecPerfResults(IBenchPrintCallback &f, const CBenchInfo *results)
+{
+  PrintPerfResults(f, "  encode:", results[0]);
+  PrintPerfResults(f, "  decode:", results[1]);
+}
+
+static void PrintCorpusHeader(IBenchPrintCallback &f, bool unitsLine)
+{
+  PrintRight(f, unitsLine ? "%" : "Ratio", kFieldSize_Ratio + 1);
+  #ifdef __linux__
+  PrintRight(f, unitsLine ? "MB" : "Mem", kFieldSize_Mem + 1);
+  #endif
+}
+
+
+/* CBenchLog writes the results in JSON Lines format (-mjson=file).
+   And it compares the results with the results from previous file (-mcmp=file).
+   The speed values for same (method, threads, size, op) are grouped over iterations.
+   The regression is reported, if the average speed is lower than in previous file
+   by more than threshold (-mcmpth=percents), and if the difference is larger than
+   two standard errors of difference, when both files contain several iterations. */
+
+static void Json_AddName(AString &s, const char *name)
+{
+  s += ",\"";
+  s += name;
+  s += "\":";
+}
+
+static void Json_AddString(AString &s, const char *name, const char *val)
+{
+  Json_AddName(s, name);
+  s.Add_Char('\"');
+  for (;;)
+  {
+    const char c = *val++;
+    if (c == 0)
+      break;
+    if (c == '\"' || c == '\\')
+      s.Add_Char('\\');
+    s.Add_Char((Byte)c < 0x20 ? ' ' : c);
+  }
+  s.Add_Char('\"');
+}
+
+static void Json_AddNumber(AString &s, const char *name, UInt64 val)
+{
+  Json_AddName(s, name);
+  s.Add_UInt64(val);
+}
+
+// it supports only the lines that were written by CBenchLog
+
+static bool Json_GetValue(const AString &line, const char *name, AString &val)
+{
+  val.Empty();
+  AString key ("\"");
+  key += name;
+  key += "\":";
+  const int pos = line.Find(key);
+  if (pos < 0)
+    return false;
+  const char *p = line.Ptr((unsigned)pos + key.Len());
+  if (*p != '\"')
+  {
+    for (; *p != 0 && *p != ',' && *p != '}'; p++)
+      val.Add_Char(*p);
+    return true;
+  }
+  for (p++;; p++)
+  {
+    char c = *p;
+    if (c == 0)
+      return false;
+    if (c == '\"')
+      return true;
+    if (c == '\\')
+    {
+      c = *(++p);
+      if (c == 0)
+        return false;
+    }
+    val.Add_Char(c);
+  }
+}
+
+struct CBenchLogSamples
+{
+  AString Key;
+  CRecordVector<UInt64> Speeds;
+
+  void GetStat(UInt64 &mean, UInt64 &var) const
+  {
+    UInt64 sum = 0;
+    FOR_VECTOR (i, Speeds)
+      sum += Speeds[i];
+    const unsigned n = Speeds.Size();
+    mean = sum / n;
+    var = 0;
+    if (n < 2)
+      return;
+    UInt64 sum2 = 0;
+    FOR_VECTOR (i, Speeds)
+    {
+      const UInt64 v = Speeds[i];
+      const UInt64 d = (v > mean ? v - mean : mean - v);
+      sum2 += d * d;
+    }
+    var = sum2 / (n - 1);
+  }
+};
+
+static void BenchLog_Parse(const char *text, CObjectVector<CBenchLogSamples> &items)
+{
+  AString line;
+  for (;;)
+  {
+    const char *end = strchr(text, '\n');
+    if (!end)
+      end = text + strlen(text);
+    line.SetFrom(text, (unsigned)(end - text));
+    AString type, method, threads, size, op, speed;
+    if (Json_GetValue(line, "type", type) && type.IsEqualTo("result")
+        && Json_GetValue(line, "method", method)
+        && Json_GetValue(line, "threads", threads)
+        && Json_GetValue(line, "size", size)
+        && Json_GetValue(line, "op", op)
+        && Json_GetValue(line, "speed", speed))
+    {
+      AString key (method);
+      key += " ";
+      key += threads;
+      key += "T size=";
+      key += size;
+      key.Add_Space();
+      key += op;
+      unsigned i;
+      for (i = 0; i < items.Size(); i++)
+        if (items[i].Key == key)
+          break;
+      if (i == items.Size())
+        items.AddNew().Key = key;
+      items[i].Speeds.Add(ConvertStringToUInt64(speed, NULL));
+    }
+    if (*end == 0)
+      break;
+    text = end + 1;
+  }
+}
+
+struct CBenchLog
+{
+  NFile::NIO::COutFile File;
+  bool File_Defined;
+  bool Compare_Defined;
+  UInt32 Threshold; // in percents
+  FString ComparePath;
+  AString Text; // all lines of current run
+
+  CBenchLog(): File_Defined(false), Compare_Defined(false), Threshold(5) {}
+  bool IsEnabled() const { return File_Defined || Compare_Defined; }
+
+  HRESULT AddLine(AString &s);
+  HRESULT AddSystemInfo(UInt32 numCPUs, UInt64 ramSize, UInt64 cpuFreq);
+  HRESULT AddResult(const char *method, UInt32 numThreads, UInt64 size, UInt64 dict,
+      const char *op, UInt64 speed, UInt64 usage, const UInt64 *rating,
+      const CBenchPeakMem *peakMem, UInt64 cpuFreq, const CBenchInfo *perfInfo = NULL);
+  HRESULT AddCodecResults(const char *method, UInt32 numThreads, UInt64 size, UInt64 dict,
+      const CBenchCallbackToPrint &callback, const CBenchPeakMem &peakMem);
+  HRESULT Compare(IBenchPrintCallback &f);
+};
+
+HRESULT CBenchLog::AddLine(AString &s)
+{
+  s += "}\n";
+  Text += s;
+  if (File_Defined)
+    if (!File.WriteFull(s, s.Len()))
+      return GetLastError_noZero_HRESULT();
+  return S_OK;
+}
+
+HRESULT CBenchLog::AddSystemInfo(UInt32 numCPUs, UInt64 ramSize, UInt64 cpuFreq)
+{
+  AString s ("{\"type\":\"system\"");
+  {
+    AString s2;
+    GetCompiler(s2);
+    Json_AddString(s, "compiler", s2);
+  }
+  {
+    AString s2;
+    GetOsInfoText(s2);
+    Json_AddString(s, "os", s2);
+  }
+  {
+    AString s2, registers;
+    GetCpuName_MultiLine(s2, registers);
+    s2.Replace('\n', ' ');
+    Json_AddString(s, "cpu", s2);
+  }
+  {
+    AString s2;
+    AddCpuFeatures(s2);
+    Json_AddString(s, "cpu_flags", s2);
+  }
+  Json_AddNumber(s, "cpu_threads", numCPUs);
+  Json_AddNumber(s, "ram_mb", ramSize >> 20);
+  Json_AddNumber(s, "cpu_freq", cpuFreq / 1000000);
+  return AddLine(s);
+}
+
+HRESULT CBenchLog::AddResult(const char *method, UInt32 numThreads, UInt64 size, UInt64 dict,
+    const char *op, UInt64 speed, UInt64 usage, const UInt64 *rating,
+    const CBenchPeakMem *peakMem, UInt64 cpuFreq, const CBenchInfo *perfInfo)
+{
+  AString s ("{\"type\":\"result\"");
+  Json_AddString(s, "method", method);
+  Json_AddNumber(s, "threads", numThreads);
+  Json_AddNumber(s, "size", size);
+  if (dict != 0)
+    Json_AddNumber(s, "dict", dict);
+  Json_AddString(s, "op", op);
+  Json_AddNumber(s, "speed", speed / 1024);
+  Json_AddNumber(s, "usage", Benchmark_GetUsage_Percents(usage));
+  if (rating)
+  {
+    const UInt64 rpu = (usage == 0 ? 0 : MyMultDiv64(*rating, kBenchmarkUsageMult, usage));
+    Json_AddNumber(s, "rpu", (rpu + 500000) / 1000000);
+    Json_AddNumber(s, "rating", (*rating + 500000) / 1000000);
+  }
+  UInt64 mem;
+  if (peakMem && peakMem->GetPeak(mem))
+    Json_AddNumber(s, "mem_kb", mem >> 10);
+  if (cpuFreq != 0)
+    Json_AddNumber(s, "cpu_freq", cpuFreq / 1000000);
+  if (perfInfo)
+  {
+    static const char * const k_PerfNames[NBenchPerf::kNumCounters] =
+      { "cycles", "instructions", "cache_misses", "branch_misses", "dtlb_misses" };
+    for (unsigned i = 0; i < NBenchPerf::kNumCounters; i++)
+      if (perfInfo->PerfMask & (1u << i))
+        Json_AddNumber(s, k_PerfNames[i], perfInfo->Perf[i]);
+  }
+  return AddLine(s);
+}
+
+HRESULT CBenchLog::AddCodecResults(const char *method, UInt32 numThreads, UInt64 size, UInt64 dict,
+    const CBenchCallbackToPrint &callback, const CBenchPeakMem &peakMem)
+{
+  for (unsigned i = 0; i < 2; i++)
+  {
+    const CBenchInfo &info = callback.BenchInfo_Results[i];
+    RINOK(AddResult(method, numThreads, size, dict, i == 0 ? "encode" : "decode",
+        info.GetUnpackSizeSpeed(), info.GetUsage(), &callback.Ratings[i],
+        &peakMem, callback.CpuFreq, &info))
+  }
+  return S_OK;
+}
+
+HRESULT CBenchLog::Compare(IBenchPrintCallback &f)
+{
+  if (!Compare_Defined)
+    return S_OK;
+  
+  AString prevText;
+  {
+    NFile::NIO::CInFile file;
+    if (!file.Open(ComparePath))
+      return GetLastError_noZero_HRESULT();
+    UInt64 len;
+    if (!file.GetLength(len))
+      return GetLastError_noZero_HRESULT();
+    if (len >= ((UInt32)1 << 28))
+      return E_OUTOFMEMORY;
+    char *p = prevText.GetBuf((unsigned)len);
+    size_t processed;
+    if (!file.ReadFull(p, (size_t)len, processed))
+      return GetLastError_noZero_HRESULT();
+    prevText.ReleaseBuf_CalcLen((unsigned)processed);
+  }
+
+  CObjectVector<CBenchLogSamples> prevItems, items;
+  BenchLog_Parse(prevText, prevItems);
+  BenchLog_Parse(Text, items);
+
+  f.NewLine();
+  f.Print("Compare (KiB/s):");
+  f.NewLine();
+
+  unsigned numCompared = 0;
+  unsigned numRegressions = 0;
+  
+  FOR_VECTOR (i, items)
+  {
+    const CBenchLogSamples &cur = items[i];
+    unsigned k;
+    for (k = 0; k < prevItems.Size(); k++)
+      if (prevItems[k].Key == cur.Key)
+        break;
+    if (k == prevItems.Size())
+      continue;
+    const CBenchLogSamples &prev = prevItems[k];
+    numCompared++;
+    
+    UInt64 mean1, var1, mean2, var2;
+    prev.GetStat(mean1, var1);
+    cur.GetStat(mean2, var2);
+    
+    bool isRegression = false;
+    if (mean2 < mean1 && (mean1 - mean2) * 100 > (UInt64)Threshold * mean1)
+    {
+      isRegression = true;
+      if (prev.Speeds.Size() > 1 && cur.Speeds.Size() > 1)
+      {
+        // (d > 2 * sqrt(var1 / n1 + var2 / n2))
+        const UInt64 d = mean1 - mean2;
+        const UInt64 se2 = var1 / prev.Speeds.Size() + var2 / cur.Speeds.Size();
+        isRegression = (d * d > 4 * se2);
+      }
+    }
+    if (!isRegression)
+      continue;
+    numRegressions++;
+    
+    f.Print("Regression: ");
+    f.Print(cur.Key);
+    f.Print(" :");
+    PrintNumber(f, mean1, 0);
+    f.Print(" ->");
+    PrintNumber(f, mean2, 0);
+    {
+      char temp[32];
+      ConvertUInt64ToString((mean1 - mean2) * 100 / mean1, temp);
+      f.Print("  -");
+      f.Print(temp);
+      f.Print("%");
+    }
+    f.NewLine();
+  }
+  
+  f.Print("Compared:");
+  PrintNumber(f, numCompared, 0);
+  f.Print("  Regressions:");
+  PrintNumber(f, numRegressions, 0);
+  f.NewLine();
+  
+  return numRegressions != 0 ? k_Bench_HRESULT_Regression : S_OK;
+}
+
+
 static HRESULT TotalBench(
     DECL_EXTERNAL_CODECS_LOC_VARS
     const COneMethodInfo &methodMask,
@@ -3224,6 +4131,10 @@ static HRESULT TotalBench(
     callback->EncodeWeight = bench.Weight;
     callback->DecodeWeight = bench.Weight;
 
+    CBenchPeakMem peakMem;
+    if (fileData || callback->Log)
+      peakMem.Start();
+
     const HRESULT res = MethodBench(
         EXTERNAL_CODECS_LOC_VARS
         complexInCommands,
@@ -3245,9 +4156,21 @@ static HRESULT TotalBench(
     else
     {
       RINOK(res)
+      if (fileData)
+        PrintCorpusResults(*callback->_file, callback->BenchInfo_Results[0], peakMem);
+      if (callback->Log)
+      {
+        UInt32 numThreads2 = 1;
+        #ifndef Z7_ST
+        numThreads2 = numThreads;
+        #endif
+        RINOK(callback->Log->AddCodecResults(bench.Name, numThreads2, unpackSize2, 0, *callback, peakMem))
+      }
     }
     
     callback->NewLine();
+    if (res == S_OK && callback->BenchProps.PerfMode)
+      PrintCodecPerfResults(*callback->_file, callback->BenchInfo_Results);
   }
   return S_OK;
 }
@@ -3637,6 +4560,11 @@ static HRESULT TotalBench_Hash(
     else
     {
       RINOK(res)
+      if (callback->Log)
+      {
+        RINOK(callback->Log->AddResult(bench.Name, numThreads, bufSize, 0, "hash",
+            speed, usage, NULL, NULL, cpuFreq))
+      }
     }
     callback->NewLine();
   }
@@ -3672,6 +4600,7 @@ static bool AreSameMethodNames(const char *fullName, const char *shortName)
 
 
 
+
 static void Print_Usage_and_Threads(IBenchPrintCallback &f, UInt64 usage, UInt32 threads)
 {
   PrintRequirements(f, "usage:", true, usage, "Benchmark threads:   ", threads);
@@ -3762,7 +4691,10 @@ HRESULT Bench(
 
   CMidAlignedBuffer fileDataBuffer;
   bool use_fileData = false;
+  FStringVector corpusPaths;
   bool isFixedDict = false;
+  bool perfMode = false;
+  CBenchLog benchLog;
 
   {
   unsigned i;
@@ -3795,38 +4727,36 @@ HRESULT Bench(
     {
       if (property.Value.IsEmpty())
         return E_INVALIDARG;
+      corpusPaths.Add(us2fs(property.Value));
+      use_fileData = true;
+      continue;
+    }
 
-      NFile::NIO::CInFile file;
-      if (!file.Open(us2fs(property.Value)))
+    if (name.IsEqualTo("json"))
+    {
+      if (property.Value.IsEmpty() || benchLog.File_Defined)
+        return E_INVALIDARG;
+      if (!benchLog.File.Create_ALWAYS(us2fs(property.Value)))
         return GetLastError_noZero_HRESULT();
-      size_t len;
-      {
-        UInt64 len64;
-        if (!file.GetLength(len64))
-          return GetLastError_noZero_HRESULT();
-        if (printCallback)
-        {
-          printCallback->Print("file size =");
-          PrintNumber(*printCallback, len64, 0);
-          printCallback->NewLine();
-        }
-        len = (size_t)len64;
-        if (len != len64)
-          return E_INVALIDARG;
-      }
+      benchLog.File_Defined = true;
+      continue;
+    }
 
-      // (len == 0) is allowed. Also it's allowed if Alloc(0) returns NULL here
+    if (name.IsEqualTo("perf"))
+    {
+      NCOM::CPropVariant prop;
+      if (!property.Value.IsEmpty())
+        prop = property.Value;
+      RINOK(PROPVARIANT_to_bool(prop, perfMode))
+      continue;
+    }
 
-      ALLOC_WITH_HRESULT(&fileDataBuffer, len)
-      use_fileData = true;
-      
-      {
-        size_t processed;
-        if (!file.ReadFull((Byte *)fileDataBuffer, len, processed))
-          return GetLastError_noZero_HRESULT();
-        if (processed != len)
-          return E_FAIL;
-      }
+    if (name.IsEqualTo("cmp"))
+    {
+      if (property.Value.IsEmpty())
+        return E_INVALIDARG;
+      benchLog.ComparePath = us2fs(property.Value);
+      benchLog.Compare_Defined = true;
       continue;
     }
 
@@ -3842,6 +4772,12 @@ HRESULT Bench(
       continue;
     }
 
+    if (name.IsEqualTo("cmpth"))
+    {
+      RINOK(ParsePropToUInt32(UString(), propVariant, benchLog.Threshold))
+      continue;
+    }
+
     if (name.IsEqualTo("timems"))
     {
       RINOK(ParsePropToUInt32(UString(), propVariant, testTimeMs))
@@ -3930,6 +4866,11 @@ HRESULT Bench(
   }
   }
 
+  if (use_fileData)
+  {
+    RINOK(Bench_LoadCorpus(corpusPaths, fileDataBuffer, printCallback))
+  }
+
   if (printCallback)
   {
     AString s;
@@ -3952,6 +4893,8 @@ HRESULT Bench(
     printCallback->Print("1T CPU Freq (MHz):");
   }
 
+  UInt64 cpuFreq_1T = 0;
+
   if (printCallback || freqCallback)
   {
     UInt64 numMilCommands = 1 << 6;
@@ -3982,6 +4925,7 @@ HRESULT Bench(
       // mips is constant in some compilers
       const UInt64 hzVal = MyMultDiv64(numMilCommands * 1000000, freq, start);
       const UInt64 mipsVal = numMilCommands * freq / start;
+      cpuFreq_1T = hzVal;
       if (printCallback)
       {
         if (realDelta == 0)
@@ -4160,6 +5104,12 @@ HRESULT Bench(
   if (numThreadsSpecified < 1 || numThreadsSpecified > kNumThreadsMax)
     return E_INVALIDARG;
 
+  if (benchLog.IsEnabled())
+  {
+    RINOK(benchLog.AddSystemInfo(numCPUs, ramSize_Defined ? ramSize : 0,
+        specifiedFreq != 0 ? specifiedFreq : cpuFreq_1T))
+  }
+
   UInt64 dict = (UInt64)1 << startDicLog;
   const bool dictIsDefined = (isFixedDict || method.Get_DicSize(dict));
 
@@ -4203,6 +5153,15 @@ HRESULT Bench(
   if (methodName.IsEqualTo_Ascii_NoCase("CRC"))
     methodName = "crc32";
 
+  #ifndef Z7_ST
+  if (methodName.IsEqualTo_Ascii_NoCase("sync"))
+  {
+    if (!printCallback)
+      return E_INVALIDARG;
+    return SyncBench(*printCallback);
+  }
+  #endif
+
   CMethodId hashID;
   const bool isHashMethod = FindHashMethod(EXTERNAL_CODECS_LOC_VARS methodName, hashID);
   int codecIndex = -1;
@@ -4220,6 +5179,19 @@ HRESULT Bench(
   CBenchCallbackToPrint callback;
   callback.Init();
   callback._file = printCallback;
+  if (benchLog.IsEnabled())
+    callback.Log = &benchLog;
+  if (perfMode)
+  {
+    CBenchPerf perf;
+    if (perf.Open())
+      callback.BenchProps.PerfMode = true;
+    else if (printCallback)
+    {
+      printCallback->Print("WARNING: hardware performance counters are not available");
+      printCallback->NewLine();
+    }
+  }
 
   if (isHashMethod || codecIndex != -1)
   {
@@ -4454,6 +5426,11 @@ HRESULT Bench(
             Bench_BW_Print_Usage_Speed(f, usage, speed);
             speedTotals.Values[ti] += speed;
             usageTotals.Values[ti] += usage;
+            if (benchLog.IsEnabled())
+            {
+              RINOK(benchLog.AddResult(methodName, numThreads, dataSize, 0, "hash",
+                  speed, usage, NULL, NULL, 0))
+            }
           }
           else
           {
@@ -4516,6 +5493,12 @@ HRESULT Bench(
                 &callback.BenchProps);
             RINOK(res)
 
+            if (benchLog.IsEnabled())
+            {
+              const CBenchPeakMem peakMem;
+              RINOK(benchLog.AddCodecResults(method2.MethodName, numThreads, dataSize, 0, callback, peakMem))
+            }
+
             if (ti != 0)
               Print_Delimiter(f);
 
@@ -4553,7 +5536,7 @@ HRESULT Bench(
       f.NewLine();
     }
 
-    return S_OK;
+    return benchLog.Compare(f);
   }
 
   bool use2Columns = false;
@@ -4654,6 +5637,8 @@ HRESULT Bench(
   }
   callback.Use2Columns = use2Columns;
 
+  const bool corpusMode = (use_fileData && !onlyHashBench);
+
   bool showFreq = false;
   UInt64 cpuFreq = 0;
 
@@ -4694,6 +5679,8 @@ HRESULT Bench(
     if (j == 0)
       f.Print(kSep);
   }
+  if (corpusMode)
+    PrintCorpusHeader(f, false);
   
   f.NewLine();
   PrintSpaces(f, callback.NameFieldSize);
@@ -4714,6 +5701,8 @@ HRESULT Bench(
     if (j == 0)
       f.Print(kSep);
   }
+  if (corpusMode)
+    PrintCorpusHeader(f, true);
   
   f.NewLine();
   f.NewLine();
@@ -4920,6 +5909,10 @@ HRESULT Bench(
           uncompressedDataSize += kAdditionalSize;
       }
 
+      CBenchPeakMem peakMem;
+      if (corpusMode || benchLog.IsEnabled())
+        peakMem.Start();
+
       const HRESULT res = MethodBench(
           EXTERNAL_CODECS_LOC_VARS
           complexInCommands,
@@ -4930,8 +5923,17 @@ HRESULT Bench(
           method2,
           uncompressedDataSize, (const Byte *)fileDataBuffer,
           kOldLzmaDictBits, printCallback, &callback, &callback.BenchProps);
+      if (res == S_OK && corpusMode)
+        PrintCorpusResults(f, callback.BenchInfo_Results[0], peakMem);
       f.NewLine();
       RINOK(res)
+      if (callback.BenchProps.PerfMode)
+        PrintCodecPerfResults(f, callback.BenchInfo_Results);
+      if (benchLog.IsEnabled())
+      {
+        RINOK(benchLog.AddCodecResults(method2.MethodName, numThreads,
+            uncompressedDataSize, callback.DictSize, callback, peakMem))
+      }
       if (!multiDict)
         break;
     }
@@ -4966,6 +5968,257 @@ HRESULT Bench(
   PrintTotals(f, showFreq, cpuFreq, false, midRes);
   f.NewLine();
 
+  #if defined(Z7_LARGE_PAGES) && !defined(_WIN32)
+  {
+    // the large pages that were really used in benchmark
+    AString s;
+    Add_LargePages_String(s);
+    if (!s.IsEmpty())
+    {
+      f.Print("Large pages: ");
+      f.Print(s);
+      f.NewLine();
+    }
+  }
+  #endif
+
+  }
+  return benchLog.Compare(*printCallback);
+}
+
+
+
+/* Decoding benchmark for archives.
+   Some decoders (Zstd, LZX, LZMS, XPRESS, LZFSE, RAR, Implode, Z, ...) have no encoders
+   and they are not registered as codecs, so MethodBench() can't test them.
+   Here reference streams are items of archives that were opened by caller from memory:
+   the archives from files, or reference archives created by in-tree encoders.
+   Each pass tests all items of archive. */
+
+Z7_CLASS_IMP_COM_1(
+  CBenchArcExtractCallback
+  , IArchiveExtractCallback
+)
+  Z7_IFACE_COM7_IMP(IProgress)
+public:
+  IBenchPrintCallback *PrintCallback;
+  CCrcOutStream *OutStreamSpec;
+  CMyComPtr<ISequentialOutStream> OutStream;
+  UInt32 NumErrors;
+
+  CBenchArcExtractCallback(): PrintCallback(NULL), NumErrors(0)
+  {
+    OutStreamSpec = new CCrcOutStream;
+    OutStream = OutStreamSpec;
+    OutStreamSpec->CalcCrc = false;
+    OutStreamSpec->Init();
   }
+};
+
+Z7_COM7F_IMF(CBenchArcExtractCallback::SetTotal(UInt64 /* total */))
+{
+  return S_OK;
+}
+
+Z7_COM7F_IMF(CBenchArcExtractCallback::SetCompleted(const UInt64 * /* completeValue */))
+{
+  return PrintCallback->CheckBreak();
+}
+
+Z7_COM7F_IMF(CBenchArcExtractCallback::GetStream(UInt32 /* index */, ISequentialOutStream **outStream, Int32 askExtractMode))
+{
+  *outStream = NULL;
+  if (askExtractMode != NArchive::NExtract::NAskMode::kSkip)
+  {
+    *outStream = OutStream;
+    OutStream->AddRef();
+  }
+  return S_OK;
+}
+
+Z7_COM7F_IMF(CBenchArcExtractCallback::PrepareOperation(Int32 /* askExtractMode */))
+{
+  return S_OK;
+}
+
+Z7_COM7F_IMF(CBenchArcExtractCallback::SetOperationResult(Int32 opRes))
+{
+  if (opRes != NArchive::NExtract::NOperationResult::kOK)
+    NumErrors++;
+  return S_OK;
+}
+
+
+static const UInt32 kArcBenchPassMs = 1000;
+
+static HRESULT BenchArc_Pass(IInArchive *archive, CBenchArcExtractCallback *callbackSpec, IArchiveExtractCallback *callback)
+{
+  const UInt64 pos = callbackSpec->OutStreamSpec->Pos;
+  RINOK(archive->Extract(NULL, (UInt32)(Int32)-1, 1, callback))
+  if (callbackSpec->NumErrors != 0)
+    return S_FALSE;
+  if (callbackSpec->OutStreamSpec->Pos == pos)
+    return E_NOTIMPL;
+  return S_OK;
+}
+
+/* The complexity of decoders (instructions per byte of packed and unpacked data) for rating.
+   The values for methods that are not in g_Bench[] were selected so that the rating
+   of each decoder is close to the rating of Deflate decoder for same CPU.
+   So the rating can be compared for different formats. */
+
+struct CBenchArcMethod
+{
+  Int32 DecComplexCompr;
+  Int32 DecComplexUnc;
+  const char *Name; // method name or format name
+};
+
+static const CBenchArcMethod g_BenchArcMethods[] =
+{
+  { 145,   20, "LZMA" },
+  { 145,   20, "LZMA2" },
+  {  40,   14, "Deflate" },
+  {  40,   14, "Deflate64" },
+  { 122,  122, "BZip2" },
+  {   0, 1150, "PPMD" },
+  {  40,   21, "LZX" },
+  {  40,    9, "XPRESS" },
+  { 145,   15, "LZMS" },
+  {  40,   14, "LZFSE" },
+  {  40,   22, "Implode" },
+  // format names, if the method name reported by handler is not in this table
+  {  40,    2, "zstd" },
+  {  40,   13, "Rar" },
+  {  40,    7, "Rar5" },
+  {  40,   37, "Z" }
+};
+
+static const CBenchArcMethod *FindBenchArcMethod(const AString &names)
+{
+  for (unsigned pos = 0; pos < names.Len();)
+  {
+    int end = names.Find(' ', pos);
+    if (end < 0)
+      end = (int)names.Len();
+    AString name;
+    name.SetFrom(names.Ptr(pos), (unsigned)end - pos);
+    const int colon = name.Find(':');
+    if (colon >= 0)
+      name.DeleteFrom((unsigned)colon);
+    for (unsigned i = 0; i < Z7_ARRAY_SIZE(g_BenchArcMethods); i++)
+      if (name.IsEqualTo_Ascii_NoCase(g_BenchArcMethods[i].Name))
+        return &g_BenchArcMethods[i];
+    pos = (unsigned)end + 1;
+  }
+  return NULL;
+}
+
+HRESULT BenchArcs(IBenchPrintCallback *printCallback,
+    const CObjectVector<CBenchArc> &arcs, UInt32 numIterations)
+{
+  IBenchPrintCallback &f = *printCallback;
+
+  PrintLeft(f, "Format", kFieldSize_Name);
+  PrintRight(f, "Speed", kFieldSize_Speed + 1);
+  PrintRight(f, "Usage", kFieldSize_Usage + 1);
+  PrintRight(f, "R/U", kFieldSize_RU + 1);
+  PrintRight(f, "Rating", kFieldSize_Rating + 1);
+  PrintRight(f, "Ratio", kFieldSize_Ratio + 1);
+  f.NewLine();
+  PrintSpaces(f, kFieldSize_Name);
+  PrintRight(f, "KiB/s", kFieldSize_Speed + 1);
+  PrintRight(f, "%", kFieldSize_Usage + 1);
+  PrintRight(f, "MIPS", kFieldSize_RU + 1);
+  PrintRight(f, "MIPS", kFieldSize_Rating + 1);
+  PrintRight(f, "%", kFieldSize_Ratio + 1);
+  f.NewLine();
+  f.NewLine();
+
+  CTotalBenchRes totalRes;
+  totalRes.Init();
+  // rating is averaged only for methods with known complexity
+  UInt64 numRated = 0;
+
+  FOR_VECTOR (ai, arcs)
+  {
+    const CBenchArc &arc = arcs[ai];
+    const CBenchArcMethod *method = FindBenchArcMethod(arc.Method);
+    
+    CBenchArcExtractCallback *callbackSpec = new CBenchArcExtractCallback;
+    CMyComPtr<IArchiveExtractCallback> callback = callbackSpec;
+    callbackSpec->PrintCallback = printCallback;
+
+    // first pass checks the data and warms up the caches
+    {
+      const HRESULT res = BenchArc_Pass(arc.Archive, callbackSpec, callback);
+      if (res == E_NOTIMPL)
+        continue;
+      RINOK(res)
+    }
+    const UInt64 unpackSize = callbackSpec->OutStreamSpec->Pos;
+
+    for (UInt32 i = 0; i < numIterations; i++)
+    {
+      PrintLeft(f, arc.Name, kFieldSize_Name);
+      
+      CBenchInfoCalc calc;
+      calc.SetStartTime();
+      const UInt64 freq = calc.BenchInfo.GlobalFreq;
+      UInt64 numPasses = 0;
+      for (;;)
+      {
+        RINOK(BenchArc_Pass(arc.Archive, callbackSpec, callback))
+        numPasses++;
+        const UInt64 elapsed = ::GetTimeCount() - calc.BenchInfo.GlobalTime;
+        if (elapsed >= freq / 1000 * kArcBenchPassMs)
+          break;
+      }
+      
+      CBenchInfo info;
+      calc.SetFinishTime(info);
+      info.UnpackSize = unpackSize * numPasses;
+      info.PackSize = arc.PackSize * numPasses;
+      info.NumIterations = 1;
+      
+      CTotalBenchRes t;
+      t.Rating = 0;
+      t.NumIterations2 = 1;
+      if (method)
+      {
+        CBenchProps benchProps;
+        benchProps.DecComplexCompr = method->DecComplexCompr;
+        benchProps.DecComplexUnc = method->DecComplexUnc;
+        t.Rating = benchProps.GetRating_Dec(info.GlobalTime, info.GlobalFreq,
+            info.UnpackSize, info.PackSize, 1);
+        numRated++;
+      }
+      t.Generate_From_BenchInfo(info);
+      PrintNumber(f, t.Speed / 1024, kFieldSize_Speed);
+      if (method)
+        PrintResults(f, t.Usage, t.RPU, t.Rating, false, 0);
+      else
+      {
+        PrintUsage(f, t.Usage, kFieldSize_Usage);
+        PrintRight(f, "-", kFieldSize_RU + 1);
+        PrintRight(f, "-", kFieldSize_Rating + 1);
+      }
+      PrintRatio(f, arc.PackSize, unpackSize);
+      f.NewLine();
+      totalRes.Update_With_Res(t);
+    }
+  }
+
+  PrintChars(f, '-', kFieldSize_Name + kFieldSize_TotalSize);
+  f.NewLine();
+  PrintLeft(f, "Avr:", kFieldSize_Name);
+  {
+    const UInt64 num = totalRes.NumIterations2 ? totalRes.NumIterations2 : 1;
+    if (numRated == 0)
+      numRated = 1;
+    PrintNumber(f, totalRes.Speed / num / 1024, kFieldSize_Speed);
+    PrintResults(f, totalRes.Usage / num, totalRes.RPU / numRated, totalRes.Rating / numRated, false, 0);
+  }
+  f.NewLine();
   return S_OK;
 }
@@ -5,11 +5,27 @@
 
 #include "../../../Windows/System.h"
 
+#include "../../Archive/IArchive.h"
 #include "../../Common/CreateCoder.h"
 #include "../../UI/Common/Property.h"
 
 UInt64 Benchmark_GetUsage_Percents(UInt64 usage);
 
+// hardware performance counters (-mperf), supported only in Linux
+namespace NBenchPerf
+{
+  enum EEnum
+  {
+    kCycles,
+    kInstructions,
+    kCacheMisses,
+    kBranchMisses,
+    kTlbMisses, // dTLB read misses
+
+    kNumCounters
+  };
+}
+
 struct CBenchInfo
 {
   UInt64 GlobalTime;
@@ -19,6 +35,9 @@ struct CBenchInfo
   UInt64 UnpackSize;
   UInt64 PackSize;
   UInt64 NumIterations;
+
+  unsigned PerfMask; // bit (1 << i) is set, if (Perf[i]) is defined
+  UInt64 Perf[NBenchPerf::kNumCounters];
     
   /*
      during Code(): we track benchInfo only from one thread (theads with index[0])
@@ -29,7 +48,7 @@ struct CBenchInfo
        UnpackSize and PackSize are total sizes of all threads
   */
   
-  CBenchInfo(): NumIterations(0) {}
+  CBenchInfo(): NumIterations(0), PerfMask(0) {}
 
   UInt64 GetUsage() const;
   UInt64 GetRatingPerUsage(UInt64 rating) const;
@@ -97,6 +116,9 @@ DECLARE_INTERFACE(IBenchFreqCallback)
 };
 Z7_PURE_INTERFACES_END
 
+// Bench() returns it, if compare mode (-mcmp) has found performance regression
+#define k_Bench_HRESULT_Regression 0x20000020
+
 HRESULT Bench(
     DECL_EXTERNAL_CODECS_LOC_VARS
     IBenchPrintCallback *printCallback,
@@ -106,6 +128,17 @@ HRESULT Bench(
     bool multiDict,
     IBenchFreqCallback *freqCallback = NULL);
 
+struct CBenchArc
+{
+  AString Name;
+  AString Method; // method names and format name separated by spaces, for rating complexity
+  CMyComPtr<IInArchive> Archive; // it must be opened from memory stream
+  UInt64 PackSize;
+};
+
+HRESULT BenchArcs(IBenchPrintCallback *printCallback,
+    const CObjectVector<CBenchArc> &arcs, UInt32 numIterations);
+
 AString GetProcessThreadsInfo(const NWindows::NSystem::CProcessAffinity &ti);
 
 void GetSysInfo(AString &s1, AString &s2);
@@ -334,6 +334,14 @@ HRESULT Extract(
   #ifndef Z7_SFX
   ecs->SetHashMethods(hash);
   #endif
+  if (options.PhaseStat)
+  {
+    ecs->IoStat = &options.PhaseStat->Io;
+    #ifndef Z7_SFX
+    if (options.PhaseStat_Stages)
+      ecs->StageStat = options.PhaseStat->Stages;
+    #endif
+  }
 
   if (multi)
   {
@@ -411,6 +419,7 @@ HRESULT Extract(
     COpenOptions op;
     #ifndef Z7_SFX
     op.props = &options.Properties;
+    op.writeSeekIndex = options.WriteSeekIndex;
     #endif
     op.codecs = codecs;
     op.types = &types2;
@@ -418,8 +427,12 @@ HRESULT Extract(
     op.stdInMode = options.StdInMode;
     op.stream = NULL;
     op.filePath = arcPath;
+    if (options.PhaseStat)
+      op.ioStat = &options.PhaseStat->Io;
 
+    CPhaseTimer openTimer(options.PhaseStat);
     HRESULT result = arcLink.Open_Strict(op, openCallback);
+    openTimer.Stop(NPhaseStat::kOpen);
 
     if (result == E_ABORT)
       return result;
@@ -539,6 +552,7 @@ HRESULT Extract(
           false;
         #endif
 
+    CPhaseTimer extractTimer(options.PhaseStat);
     RINOK(DecompressArchive(
         codecs,
         arcLink,
@@ -548,6 +562,7 @@ HRESULT Extract(
         calcCrc,
         extractCallback, faeCallback, ecs,
         errorMessage, packProcessed))
+    extractTimer.Stop(NPhaseStat::kProcess);
 
     if (!options.StdInMode)
       packProcessed = fi.Size + arcLink.VolumesSize;
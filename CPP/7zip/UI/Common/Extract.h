@@ -10,6 +10,7 @@
 #include "ArchiveExtractCallback.h"
 #include "ArchiveOpenCallback.h"
 #include "ExtractMode.h"
+#include "PhaseStat.h"
 #include "Property.h"
 
 #include "../Common/LoadCodecs.h"
@@ -55,8 +56,12 @@ struct CExtractOptions: public CExtractOptionsBase
   // UString Password;
   #ifndef Z7_SFX
   CObjectVector<CProperty> Properties;
+  bool WriteSeekIndex;
   #endif
 
+  CPhaseStat *PhaseStat; // optional
+  bool PhaseStat_Stages; // request stage times from handler. 7z handler uses slower single-thread mixer then
+
   /*
   #ifdef Z7_EXTERNAL_CODECS
   CCodecs *Codecs;
@@ -67,7 +72,12 @@ struct CExtractOptions: public CExtractOptionsBase
       StdInMode(false),
       StdOutMode(false),
       YesToAll(false),
-      TestMode(false)
+      TestMode(false),
+      #ifndef Z7_SFX
+      WriteSeekIndex(false),
+      #endif
+      PhaseStat(NULL),
+      PhaseStat_Stages(false)
       {}
 };
 
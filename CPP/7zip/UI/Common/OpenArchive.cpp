@@ -30,6 +30,8 @@
 #include "OpenArchive.h"
 
 #ifndef Z7_SFX
+#include "../../Archive/Common/SeekIndex.h"
+
 #include "SetProperties.h"
 #endif
 
@@ -3098,6 +3100,7 @@ HRESULT CArc::OpenStreamOrFile(COpenOptions &op)
   {
     fileStreamSpec = new CInFileStream;
     fileStream = fileStreamSpec;
+    fileStreamSpec->IoStat = op.ioStat;
     Path = filePath;
     if (!fileStreamSpec->Open(us2fs(Path)))
       return GetLastError_noZero_HRESULT();
@@ -3229,6 +3232,52 @@ void CArchiveLink::Set_ErrorsText()
 }
 */
 
+#ifndef Z7_SFX
+
+/*
+  The handler of compressed stream (gzip, bzip2) can support the index of seek points.
+  It's used only if the caller requires the opening of unpacked stream
+  as archive (-ttar.gz). The opening of unpacked stream can require
+  the decoding of whole stream, so we build full index with open progress.
+  For top level archive we load the index file that is stored beside the archive.
+  The index file is written only if (op.writeSeekIndex) is requested.
+*/
+
+static HRESULT Arc_UseSeekIndex(const CArc &arc, const COpenOptions &op,
+    IInArchiveSeekIndex *seekIndex, bool isTopLevel)
+{
+  FString indexPath;
+  if (isTopLevel)
+  {
+    indexPath = us2fs(arc.Path);
+    indexPath += NArchive::NSeekIndex::k_FileExtension;
+    CMyComPtr2_Create<IInStream, CInFileStream> inStream;
+    if (inStream->Open(indexPath))
+    {
+      const HRESULT res = seekIndex->ReadSeekIndex(inStream);
+      if (res != S_FALSE)
+        return res;
+    }
+  }
+  RINOK(seekIndex->BuildSeekIndex(op.callback))
+  if (!isTopLevel || !op.writeSeekIndex)
+    return S_OK;
+  CMyComPtr2_Create<IOutStream, COutFileStream> outStream;
+  if (!outStream->Create_ALWAYS(indexPath))
+    return GetLastError_noZero_HRESULT();
+  HRESULT res = seekIndex->WriteSeekIndex(outStream);
+  if (res == S_OK)
+    res = outStream->Close();
+  if (res != S_OK)
+  {
+    outStream->Close();
+    NFile::NDir::DeleteFileAlways(indexPath);
+  }
+  return res;
+}
+
+#endif
+
 HRESULT CArchiveLink::Open(COpenOptions &op)
 {
   Release();
@@ -3321,7 +3370,19 @@ HRESULT CArchiveLink::Open(COpenOptions &op)
       if (prop.vt == VT_UI4)
         mainSubfile = prop.ulVal;
       else
+      {
+       #ifndef Z7_SFX
+        Z7_DECL_CMyComPtr_QI_FROM(
+            IInArchiveSeekIndex,
+            seekIndex, arc.Archive)
+        if (!seekIndex || op.types->Size() <= Arcs.Size())
+          break;
+        RINOK(Arc_UseSeekIndex(arc, op, seekIndex, Arcs.Size() == 1 && !op.stdInMode))
+        mainSubfile = 0;
+       #else
         break;
+       #endif
+      }
       UInt32 numItems;
       RINOK(arc.Archive->GetNumberOfItems(&numItems))
       if (mainSubfile >= numItems)
@@ -5,6 +5,8 @@
 
 #include "../../../Windows/PropVariant.h"
 
+#include "../../Common/IoStat.h"
+
 #include "ArchiveOpenCallback.h"
 #include "LoadCodecs.h"
 #include "Property.h"
@@ -130,6 +132,8 @@ struct COpenOptions
 
   bool stdInMode;
   UString filePath;
+  CIoStat *ioStat; // optional statistics of archive file reading
+  bool writeSeekIndex; // write index file of seek points for nested type (-ttar.gz)
 
   COpenOptions():
       codecs(NULL),
@@ -139,7 +143,9 @@ struct COpenOptions
       seqStream(NULL),
       callback(NULL),
       callbackSpec(NULL),
-      stdInMode(false)
+      stdInMode(false),
+      ioStat(NULL),
+      writeSeekIndex(false)
     {}
 
 };
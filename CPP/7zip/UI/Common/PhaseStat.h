@@ -0,0 +1,141 @@
+// PhaseStat.h
+
+#ifndef ZIP7_INC_PHASE_STAT_H
+#define ZIP7_INC_PHASE_STAT_H
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include "../../Common/IoStat.h"
+
+#include "../../Archive/IArchive.h"
+
+/* Optional per-phase statistics for extract and update operations.
+   If (CExtractOptions::PhaseStat) or (CUpdateOptions::PhaseStat) is set,
+   Extract() and UpdateArchive() fill it. All times are in microseconds. */
+
+namespace NPhaseStat
+{
+  enum EEnum
+  {
+    kScan,    // scanning of files on disk
+    kOpen,    // opening of archive
+    kProcess, // extracting / testing / compressing
+    kHeader,  // writing of archive headers after the last item. It's part of (kProcess)
+
+    kNumPhases
+  };
+}
+
+// (thread) is CPU time of calling thread. It's 0, if the system doesn't support it.
+inline void PhaseStat_GetCpuTime(UInt64 &process, UInt64 &thread)
+{
+  process = 0;
+  thread = 0;
+ #ifdef _WIN32
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  if (::GetThreadTimes(::GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+    thread = (
+        (((UInt64)kernelTime.dwHighDateTime << 32) | kernelTime.dwLowDateTime) +
+        (((UInt64)userTime.dwHighDateTime << 32) | userTime.dwLowDateTime)) / 10;
+  #ifdef UNDER_CE
+  process = thread;
+  #else
+  if (::GetProcessTimes(::GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+    process = (
+        (((UInt64)kernelTime.dwHighDateTime << 32) | kernelTime.dwLowDateTime) +
+        (((UInt64)userTime.dwHighDateTime << 32) | userTime.dwLowDateTime)) / 10;
+  #endif
+ #else
+  struct rusage ru;
+  if (getrusage(RUSAGE_SELF, &ru) == 0)
+    process =
+        (UInt64)ru.ru_utime.tv_sec * 1000000 + (UInt64)ru.ru_utime.tv_usec +
+        (UInt64)ru.ru_stime.tv_sec * 1000000 + (UInt64)ru.ru_stime.tv_usec;
+  #ifdef RUSAGE_THREAD
+  if (getrusage(RUSAGE_THREAD, &ru) == 0)
+    thread =
+        (UInt64)ru.ru_utime.tv_sec * 1000000 + (UInt64)ru.ru_utime.tv_usec +
+        (UInt64)ru.ru_stime.tv_sec * 1000000 + (UInt64)ru.ru_stime.tv_usec;
+  #endif
+ #endif
+}
+
+struct CPhaseStatItem
+{
+  UInt64 Time;      // wall clock time
+  UInt64 CpuTime;   // CPU time of all threads of process
+  UInt64 ThreadTime; // CPU time of main (calling) thread
+  UInt32 NumCalls;
+
+  void Clear()
+  {
+    Time = 0;
+    CpuTime = 0;
+    ThreadTime = 0;
+    NumCalls = 0;
+  }
+};
+
+struct CPhaseStat
+{
+  CPhaseStatItem Phases[NPhaseStat::kNumPhases];
+  CIoStat Io;
+  // stages of extraction reported by handler via IArchiveExtractCallbackStat
+  CStageStatItem Stages[NArchive::NExtract::NStage::kNumStages];
+
+  void Clear()
+  {
+    unsigned i;
+    for (i = 0; i < NPhaseStat::kNumPhases; i++)
+      Phases[i].Clear();
+    for (i = 0; i < NArchive::NExtract::NStage::kNumStages; i++)
+      Stages[i].Clear();
+    Io.Clear();
+  }
+
+  CPhaseStat() { Clear(); }
+};
+
+// it measures one phase, if (stat) is not NULL
+class CPhaseTimer
+{
+  CPhaseStat *_stat;
+  UInt64 _time;
+  UInt64 _cpuTime;
+  UInt64 _threadTime;
+public:
+  CPhaseTimer(): _stat(NULL), _time(0), _cpuTime(0), _threadTime(0) {}
+  CPhaseTimer(CPhaseStat *stat): _stat(NULL), _time(0), _cpuTime(0), _threadTime(0)
+  {
+    Start(stat);
+  }
+
+  // it restarts the timer, if it was started already
+  void Start(CPhaseStat *stat)
+  {
+    _stat = stat;
+    if (stat)
+    {
+      _time = IoStat_GetTime_us();
+      PhaseStat_GetCpuTime(_cpuTime, _threadTime);
+    }
+  }
+
+  void Stop(unsigned phase)
+  {
+    if (!_stat)
+      return;
+    UInt64 cpuTime, threadTime;
+    PhaseStat_GetCpuTime(cpuTime, threadTime);
+    CPhaseStatItem &item = _stat->Phases[phase];
+    item.Time += IoStat_GetTime_us() - _time;
+    item.CpuTime += cpuTime - _cpuTime;
+    item.ThreadTime += threadTime - _threadTime;
+    item.NumCalls++;
+    _stat = NULL;
+  }
+};
+
+#endif
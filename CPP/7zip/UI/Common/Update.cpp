@@ -646,6 +646,11 @@ static HRESULT Compress(
   updateCallbackSpec->UpdatePairs = &updatePairs2;
 
   updateCallbackSpec->ProcessedItemsStatuses = processedItemsStatuses;
+  if (options.PhaseStat)
+  {
+    updateCallbackSpec->IoStat = &options.PhaseStat->Io;
+    updateCallbackSpec->PhaseStat = options.PhaseStat;
+  }
 
   {
     const UString arcPath = archivePath.GetFinalPath();
@@ -676,7 +681,59 @@ static HRESULT Compress(
   CStdOutFileStream *stdOutFileStreamSpec = NULL;
   CMultiOutStream *volStreamSpec = NULL;
 
-  if (options.VolumesSizes.Size() == 0)
+  CMyComPtr<IOutArchiveAppend> outArchiveAppend;
+
+  if (options.AppendInPlace
+      && isUpdatingItself
+      && arc
+      && archivePath.Temp
+      && !options.StdOutMode
+      && !options.SfxMode
+      && options.VolumesSizes.Size() == 0
+      && arc->ArcStreamOffset == 0
+      && arc->GetGlobalOffset() == 0)
+  {
+    // we can append to archive in place, only if all old items are kept with old data
+    unsigned numOldItems = 0;
+    FOR_VECTOR (i, updatePairs2)
+    {
+      const CUpdatePair2 &up = updatePairs2[i];
+      if (up.ArcIndex >= 0 && !up.NewData)
+        numOldItems++;
+    }
+    if (numOldItems == arcItems.Size())
+    {
+      outArchive.QueryInterface(IID_IOutArchiveAppend, &outArchiveAppend);
+      if (outArchiveAppend)
+      {
+        if (outArchiveAppend->SetAppendMode(1) != S_OK)
+          outArchiveAppend.Release();
+        else
+        {
+          outStreamSpec = new COutFileStream;
+          outSeekStream = outStreamSpec;
+          if (options.PhaseStat)
+            outStreamSpec->IoStat = &options.PhaseStat->Io;
+          if (!outStreamSpec->Open_EXISTING(us2fs(archivePath.GetFinalPath())))
+          {
+            // the archive can be locked for writing. So we use temp file
+            outStreamSpec = NULL;
+            outSeekStream.Release();
+            RINOK(outArchiveAppend->SetAppendMode(0))
+            outArchiveAppend.Release();
+          }
+        }
+      }
+    }
+  }
+
+  if (outArchiveAppend)
+  {
+    // the archive will be updated in place without temp file
+    archivePath.Temp = false;
+    outStream = outSeekStream;
+  }
+  else if (options.VolumesSizes.Size() == 0)
   {
     if (options.StdOutMode)
     {
@@ -688,6 +745,8 @@ static HRESULT Compress(
       outStreamSpec = new COutFileStream;
       outSeekStream = outStreamSpec;
       outStream = outSeekStream;
+      if (options.PhaseStat)
+        outStreamSpec->IoStat = &options.PhaseStat->Io;
       bool isOK = false;
       FString realPath;
       
@@ -853,6 +912,7 @@ static HRESULT Compress(
   HRESULT result = outArchive->UpdateItems(tailStream, updatePairs2.Size(), updateCallback);
   // callback->Finalize();
   RINOK(result)
+  updateCallbackSpec->HeaderTimer.Stop(NPhaseStat::kHeader);
 
   if (!updateCallbackSpec->AreAllFilesClosed())
   {
@@ -1280,10 +1340,14 @@ HRESULT UpdateArchive(
       op.stdInMode = false;
       op.stream = NULL;
       op.filePath = arcPath;
+      if (options.PhaseStat)
+        op.ioStat = &options.PhaseStat->Io;
 
       RINOK(callback->StartOpenArchive(arcPath))
 
+      CPhaseTimer openTimer(options.PhaseStat);
       HRESULT result = arcLink.Open_Strict(op, openCallback);
+      openTimer.Stop(NPhaseStat::kOpen);
 
       if (result == E_ABORT)
         return result;
@@ -1394,10 +1458,12 @@ HRESULT UpdateArchive(
       dirItems.StoreOwnerName = options.StoreOwnerName.Val;
      #endif
 
+      CPhaseTimer scanTimer(options.PhaseStat);
       const HRESULT res = EnumerateItems(censor,
           options.PathMode,
           UString(), // options.AddPathPrefix,
           dirItems);
+      scanTimer.Stop(NPhaseStat::kScan);
 
       if (res != S_OK)
       {
@@ -1583,6 +1649,7 @@ HRESULT UpdateArchive(
 
     CFinishArchiveStat st;
 
+    CPhaseTimer compressTimer(options.PhaseStat);
     RINOK(Compress(options,
         isUpdating,
         codecs,
@@ -1598,6 +1665,7 @@ HRESULT UpdateArchive(
         tempFiles,
         multiStreams,
         errorInfo, callback, st))
+    compressTimer.Stop(NPhaseStat::kProcess);
 
     RINOK(callback->FinishArchive(st))
   }
@@ -1612,6 +1680,12 @@ HRESULT UpdateArchive(
   multiStreams.DisableDeletion();
   RINOK(multiStreams.Destruct())
 
+  if (createTempFile && !options.Commands[0].ArchivePath.Temp)
+  {
+    // new data was appended to archive in place
+    createTempFile = false;
+  }
+
   // here we disable deleting of temp archives.
   // note: archive moving can fail, or it can be interrupted,
   // if we move new temp update from another volume.
@@ -8,6 +8,7 @@
 #include "ArchiveOpenCallback.h"
 #include "LoadCodecs.h"
 #include "OpenArchive.h"
+#include "PhaseStat.h"
 #include "Property.h"
 #include "UpdateAction.h"
 #include "UpdateCallback.h"
@@ -94,6 +95,7 @@ struct CUpdateOptions
 
   bool DeleteAfterCompressing;
   bool SetArcMTime;
+  bool AppendInPlace; // write new data to the end of archive without temp file, if possible
 
   CBoolPair NtSecurity;
   CBoolPair AltStreams;
@@ -120,6 +122,8 @@ struct CUpdateOptions
   CObjectVector<CRenamePair> RenamePairs;
   CRecordVector<UInt64> VolumesSizes;
 
+  CPhaseStat *PhaseStat; // optional
+
   bool InitFormatIndex(const CCodecs *codecs, const CObjectVector<COpenType> &types, const UString &arcPath);
   bool SetArcPath(const CCodecs *codecs, const UString &arcPath);
 
@@ -139,9 +143,12 @@ struct CUpdateOptions
     
     DeleteAfterCompressing(false),
     SetArcMTime(false),
+    AppendInPlace(false),
 
     ArcNameMode(k_ArcNameMode_Smart),
-    PathMode(NWildcard::k_RelatPath)
+    PathMode(NWildcard::k_RelatPath),
+
+    PhaseStat(NULL)
     
     {}
 
@@ -91,6 +91,8 @@ CArchiveUpdateCallback::CArchiveUpdateCallback():
     CommentIndex(-1),
     
     ProcessedItemsStatuses(NULL),
+    IoStat(NULL),
+    PhaseStat(NULL),
     _hardIndex_From((UInt32)(Int32)-1)
 {
   #ifdef Z7_USE_SECURITY_CODE
@@ -670,8 +672,13 @@ Z7_COM7F_IMF(CArchiveUpdateCallback::GetStream2(UInt32 index, ISequentialInStrea
        for correct working if exception was raised in GetPhyPath */
     inStreamSpec->Callback = this;
     inStreamSpec->CallbackRef = index;
+    inStreamSpec->IoStat = IoStat;
 
-    if (!inStreamSpec->OpenShared(path, ShareForWrite))
+    const UInt64 openStartTime = IoStat ? IoStat_GetTime_us() : 0;
+    const bool openRes = inStreamSpec->OpenShared(path, ShareForWrite);
+    if (IoStat)
+      IoStat->AddCall(NIoStat::kOpen, 0, openStartTime);
+    if (!openRes)
     {
       bool isOpen = false;
       if (preserveATime)
@@ -775,6 +782,9 @@ Z7_COM7F_IMF(CArchiveUpdateCallback::ReportOperation(UInt32 indexType, UInt32 in
 
   // if (op == NUpdateNotifyOp::kOpFinished) return Callback->ReportFinished(indexType, index);
 
+  if (op == NUpdateNotifyOp::kHeader && indexType == NArchive::NEventIndexType::kNoIndex)
+    HeaderTimer.Start(PhaseStat);
+
   bool isDir = false;
 
   if (indexType == NArchive::NEventIndexType::kOutArcIndex)
@@ -14,6 +14,7 @@
 #include "../Common/UpdateProduce.h"
 
 #include "OpenArchive.h"
+#include "PhaseStat.h"
 
 struct CArcToDoStat
 {
@@ -171,6 +172,9 @@ public:
   CFiTime LatestMTime;
 
   Byte *ProcessedItemsStatuses;
+  CIoStat *IoStat; // optional statistics of reading of files
+  CPhaseStat *PhaseStat; // optional: (HeaderTimer) is started for it
+  CPhaseTimer HeaderTimer; // started by NUpdateNotifyOp::kHeader report from handler
 
 
   CArchiveUpdateCallback();
@@ -0,0 +1,1045 @@
+// ArcBenchCon.cpp
+
+#include "StdAfx.h"
+
+#include "../../../../C/CpuArch.h"
+
+#include "../../../Common/IntToString.h"
+#include "../../../Common/MyBuffer.h"
+#include "../../../Common/StringConvert.h"
+#include "../../../Common/StringToInt.h"
+
+#include "../../../Windows/FileDir.h"
+#include "../../../Windows/FileIO.h"
+#include "../../../Windows/FileName.h"
+
+#include "../../Common/StreamObjects.h"
+
+#include "../Common/ArchiveCommandLine.h"
+#include "../Common/Extract.h"
+#include "../Common/PhaseStat.h"
+#include "../Common/SetProperties.h"
+#include "../Common/Update.h"
+
+#include "ArcBenchCon.h"
+#include "ArcBenchRef.h"
+#include "BenchCon.h"
+#include "ConsoleClose.h"
+#include "ExtractCallbackConsole.h"
+#include "OpenCallbackConsole.h"
+#include "UpdateCallbackConsole.h"
+
+using namespace NWindows;
+using namespace NFile;
+using namespace NDir;
+
+static const char * const kTreeProp = "tree";
+static const char * const kArcProp = "arc";
+
+bool ArcBench_IsTreeMode(const CObjectVector<CProperty> &props)
+{
+  FOR_VECTOR (i, props)
+    if (StringsAreEqualNoCase_Ascii(props[i].Name, kTreeProp))
+      return true;
+  return false;
+}
+
+bool ArcBench_IsDecodeMode(const CObjectVector<CProperty> &props)
+{
+  FOR_VECTOR (i, props)
+    if (StringsAreEqualNoCase_Ascii(props[i].Name, kArcProp))
+      return true;
+  return false;
+}
+
+
+// wall and CPU time of one command
+
+struct CCmdTimer
+{
+  UInt64 WallTime;
+  UInt64 CpuTime;
+
+  void Start()
+  {
+    UInt64 threadTime;
+    WallTime = IoStat_GetTime_us();
+    PhaseStat_GetCpuTime(CpuTime, threadTime);
+  }
+  void Stop()
+  {
+    UInt64 cpuTime, threadTime;
+    PhaseStat_GetCpuTime(cpuTime, threadTime);
+    WallTime = IoStat_GetTime_us() - WallTime;
+    CpuTime = cpuTime - CpuTime;
+  }
+};
+
+
+class CArcBenchRandom
+{
+  UInt32 A1;
+  UInt32 A2;
+public:
+  CArcBenchRandom(): A1(362436069), A2(521288629) {}
+  UInt32 GetRnd()
+  {
+    return
+      ((A1 = 36969 * (A1 & 0xffff) + (A1 >> 16)) << 16) +
+      ((A2 = 18000 * (A2 & 0xffff) + (A2 >> 16)) );
+  }
+  UInt64 GetRnd64() { const UInt32 hi = GetRnd(); return ((UInt64)hi << 32) | GetRnd(); }
+};
+
+
+struct CTreeParams
+{
+  UInt32 NumFiles;
+  UInt32 NumFilesInDir;
+  UInt64 MinSize;
+  UInt64 MaxSize;
+  UInt32 Compressibility; // in percents
+
+  CTreeParams():
+      NumFiles(10000),
+      NumFilesInDir(100),
+      MinSize(0),
+      MaxSize(1 << 16),
+      Compressibility(50)
+      {}
+};
+
+static unsigned GetNumBits(UInt64 v)
+{
+  unsigned i;
+  for (i = 0; v != 0; i++)
+    v >>= 1;
+  return i;
+}
+
+/* we use log-uniform distribution for file sizes:
+   the number of files of each power-of-2 size class is same. */
+
+static UInt64 GetRandomFileSize(CArcBenchRandom &rnd, UInt64 minSize, UInt64 maxSize)
+{
+  const unsigned minBits = GetNumBits(minSize);
+  const unsigned maxBits = GetNumBits(maxSize);
+  const unsigned bits = minBits + (unsigned)(rnd.GetRnd() % (maxBits - minBits + 1));
+  UInt64 v = 0;
+  if (bits != 0)
+  {
+    const UInt64 base = (UInt64)1 << (bits - 1);
+    v = base + (rnd.GetRnd64() & (base - 1));
+  }
+  if (v < minSize) v = minSize;
+  if (v > maxSize) v = maxSize;
+  return v;
+}
+
+static const unsigned kChunkSize = 256;
+static const size_t kSrcHalfSize = (size_t)1 << 20;
+static const size_t kWriteBufSize = (size_t)1 << 16;
+
+/* CTreeGenerator writes files that consist of 256-byte chunks.
+   Each chunk is copied from text-like data (compressible)
+   or from random data (incompressible) with the probability
+   that is set by Compressibility. */
+
+class CTreeGenerator
+{
+  CArcBenchRandom _rnd;
+  CByteBuffer _src; // [0, half) : text, [half, 2 * half) : random data
+  CByteBuffer _buf;
+
+  void InitSource();
+  HRESULT WriteFile(const FString &path, UInt64 size, UInt32 compressibility);
+public:
+  UInt64 TotalSize;
+  UInt32 NumDirs;
+
+  HRESULT Generate(const CTreeParams &p, const FString &dirPrefix);
+};
+
+void CTreeGenerator::InitSource()
+{
+  _src.Alloc(kSrcHalfSize * 2);
+  _buf.Alloc(kWriteBufSize);
+
+  const unsigned kNumWords = 256;
+  char words[kNumWords][12];
+  unsigned i;
+  for (i = 0; i < kNumWords; i++)
+  {
+    const unsigned len = 2 + _rnd.GetRnd() % 8;
+    unsigned k;
+    for (k = 0; k < len; k++)
+      words[i][k] = (char)('a' + _rnd.GetRnd() % 26);
+    words[i][k] = 0;
+  }
+
+  Byte *p = _src;
+  size_t pos = 0;
+  for (unsigned numWords = 0; pos < kSrcHalfSize; numWords++)
+  {
+    const char *w = words[_rnd.GetRnd() % kNumWords];
+    for (; *w != 0 && pos < kSrcHalfSize; w++)
+      p[pos++] = (Byte)*w;
+    if (pos < kSrcHalfSize)
+      p[pos++] = (Byte)((numWords % 12 == 11) ? '\n' : ' ');
+  }
+
+  for (pos = kSrcHalfSize; pos < kSrcHalfSize * 2; pos += 4)
+    SetUi32(p + pos, _rnd.GetRnd())
+}
+
+HRESULT CTreeGenerator::WriteFile(const FString &path, UInt64 size, UInt32 compressibility)
+{
+  NIO::COutFile file;
+  if (!file.Create_ALWAYS(path))
+    return GetLastError_noZero_HRESULT();
+  size_t bufPos = 0;
+  while (size != 0)
+  {
+    size_t cur = kChunkSize;
+    if (cur > size)
+      cur = (size_t)size;
+    size_t offset = _rnd.GetRnd() % (kSrcHalfSize - kChunkSize);
+    if (_rnd.GetRnd() % 100 >= compressibility)
+      offset += kSrcHalfSize;
+    memcpy(_buf + bufPos, _src + offset, cur);
+    bufPos += cur;
+    size -= cur;
+    if (bufPos == kWriteBufSize || size == 0)
+    {
+      if (!file.WriteFull(_buf, bufPos))
+        return GetLastError_noZero_HRESULT();
+      bufPos = 0;
+    }
+  }
+  if (!file.Close())
+    return GetLastError_noZero_HRESULT();
+  return S_OK;
+}
+
+HRESULT CTreeGenerator::Generate(const CTreeParams &p, const FString &dirPrefix)
+{
+  InitSource();
+  TotalSize = 0;
+  NumDirs = 0;
+  FString dirPath;
+  for (UInt32 i = 0; i < p.NumFiles; i++)
+  {
+    if (i % p.NumFilesInDir == 0)
+    {
+      if (NConsoleClose::TestBreakSignal())
+        return E_ABORT;
+      char temp[32];
+      temp[0] = 'd';
+      ConvertUInt32ToString(NumDirs++, temp + 1);
+      dirPath = dirPrefix;
+      dirPath += fas2fs(temp);
+      if (!CreateDir(dirPath))
+        return GetLastError_noZero_HRESULT();
+      dirPath.Add_PathSepar();
+    }
+    char temp[32];
+    temp[0] = 'f';
+    ConvertUInt32ToString(i, temp + 1);
+    FString path (dirPath);
+    path += fas2fs(temp);
+    path += ".dat";
+    const UInt64 size = GetRandomFileSize(_rnd, p.MinSize, p.MaxSize);
+    RINOK(WriteFile(path, size, p.Compressibility))
+    TotalSize += size;
+  }
+  return S_OK;
+}
+
+
+static HRESULT ParseCommand(const char *command, const UString &type,
+    const UStringVector &args2, CArcCmdLineOptions &options)
+{
+  UStringVector args;
+  args.Add(UString(command));
+  if (!type.IsEmpty())
+  {
+    UString s ("-t");
+    s += type;
+    args.Add(s);
+  }
+  args += args2;
+  CArcCmdLineParser parser;
+  parser.Parse1(args, options);
+  parser.Parse2(options);
+  return S_OK;
+}
+
+static HRESULT Run_Update(CCodecs *codecs, const UString &type,
+    const UString &arcPath, const UString &srcPath, const UStringVector &methodProps,
+    CPhaseStat *phaseStat = NULL)
+{
+  UStringVector args (methodProps);
+  args.Add(arcPath);
+  args.Add(srcPath);
+  CArcCmdLineOptions options;
+  RINOK(ParseCommand("a", type, args, options))
+
+  CObjectVector<COpenType> types;
+  if (!ParseOpenTypes(*codecs, options.ArcType, types))
+    return E_NOTIMPL;
+
+  COpenCallbackConsole openCallback;
+  openCallback.Init(NULL, NULL, NULL, true);
+  CUpdateCallbackConsole callback;
+  callback.Init(NULL, NULL, NULL, true);
+  CUpdateErrorInfo errorInfo;
+  options.UpdateOptions.PhaseStat = phaseStat;
+
+  RINOK(UpdateArchive(codecs, types, options.ArchiveName,
+      options.Censor, options.UpdateOptions,
+      errorInfo, &openCallback, &callback, true))
+  if (errorInfo.ThereIsError()
+      || !callback.FailedFiles.Paths.IsEmpty()
+      || !callback.ScanErrors.Paths.IsEmpty())
+    return E_FAIL;
+  return S_OK;
+}
+
+static HRESULT Run_Extract(CCodecs *codecs, const UString &type,
+    const UString &arcPath, const UString &outDir, CDecompressStat &stat,
+    CPhaseStat *phaseStat)
+{
+  UStringVector args;
+  if (!outDir.IsEmpty())
+  {
+    UString s ("-o");
+    s += outDir;
+    args.Add(s);
+  }
+  args.Add(arcPath);
+  CArcCmdLineOptions options;
+  RINOK(ParseCommand(outDir.IsEmpty() ? "t" : "x", type, args, options))
+
+  CObjectVector<COpenType> types;
+  if (!ParseOpenTypes(*codecs, options.ArcType, types))
+    return E_NOTIMPL;
+  CIntVector excludedFormats;
+
+  CExtractCallbackConsole *ecs = new CExtractCallbackConsole;
+  CMyComPtr<IFolderArchiveExtractCallback> extractCallback = ecs;
+  ecs->Init(NULL, NULL, NULL, true);
+
+  CExtractOptions eo;
+  (CExtractOptionsBase &)eo = options.ExtractOptions;
+  eo.YesToAll = true;
+  eo.TestMode = options.Command.IsTestCommand();
+  eo.Properties = options.Properties;
+  eo.PhaseStat = phaseStat;
+  eo.PhaseStat_Stages = true; // for CRC column
+
+  UStringVector arcPaths;
+  arcPaths.Add(arcPath);
+  UString errorMessage;
+  stat.Clear();
+
+  RINOK(Extract(codecs, types, excludedFormats,
+      arcPaths, arcPaths,
+      options.Censor.Pairs.Front().Head,
+      eo, ecs, ecs, ecs,
+      NULL, errorMessage, stat))
+  if (!errorMessage.IsEmpty()
+      || ecs->NumCantOpenArcs != 0
+      || ecs->NumArcsWithError != 0
+      || ecs->NumFileErrors != 0)
+    return S_FALSE;
+  return S_OK;
+}
+
+// it opens archive and reads the properties of items that are shown by (l) command
+
+static HRESULT Run_List(CCodecs *codecs, const UString &type,
+    const UString &arcPath, UInt32 &numItems)
+{
+  numItems = 0;
+  CObjectVector<COpenType> types;
+  if (!ParseOpenTypes(*codecs, type, types))
+    return E_NOTIMPL;
+  CIntVector excludedFormats;
+  CObjectVector<CProperty> props;
+
+  COpenCallbackConsole openCallback;
+  openCallback.Init(NULL, NULL, NULL, true);
+
+  CArchiveLink arcLink;
+  COpenOptions op;
+  op.props = &props;
+  op.codecs = codecs;
+  op.types = &types;
+  op.excludedFormats = &excludedFormats;
+  op.stdInMode = false;
+  op.stream = NULL;
+  op.filePath = arcPath;
+
+  const HRESULT res = arcLink.Open_Strict(op, &openCallback);
+  if (res != S_OK)
+    return res == S_FALSE ? S_FALSE : res;
+
+  const CArc &arc = arcLink.Arcs.Back();
+  IInArchive *archive = arc.Archive;
+  RINOK(archive->GetNumberOfItems(&numItems))
+
+  CReadArcItem item;
+  for (UInt32 i = 0; i < numItems; i++)
+  {
+    RINOK(arc.GetItem(i, item))
+    UInt64 size;
+    bool size_Defined;
+    RINOK(arc.GetItem_Size(i, size, size_Defined))
+    CArcTime mtime;
+    RINOK(arc.GetItem_MTime(i, mtime))
+    NCOM::CPropVariant prop;
+    RINOK(archive->GetProperty(i, kpidAttrib, &prop))
+    prop.Clear();
+    RINOK(archive->GetProperty(i, kpidPackSize, &prop))
+  }
+  return S_OK;
+}
+
+
+static const unsigned kFieldSize_Format = 7;
+static const unsigned kFieldSize_Cmd = 4;
+static const unsigned kFieldSize_Time = 9;
+static const unsigned kFieldSize_Usage = 6;
+static const unsigned kFieldSize_Files = 9;
+static const unsigned kFieldSize_Speed = 8;
+static const unsigned kFieldSize_Ratio = 7;
+
+static void PrintSpaces(CStdOutStream &so, unsigned num)
+{
+  for (unsigned i = 0; i < num; i++)
+    so << ' ';
+}
+
+static void PrintRight(CStdOutStream &so, const char *s, unsigned size)
+{
+  const unsigned len = MyStringLen(s);
+  if (len < size)
+    PrintSpaces(so, size - len);
+  so << s;
+}
+
+static void PrintLeft(CStdOutStream &so, const char *s, unsigned size)
+{
+  const unsigned len = MyStringLen(s);
+  so << s;
+  if (len < size)
+    PrintSpaces(so, size - len);
+}
+
+static void PrintNumber(CStdOutStream &so, UInt64 v, unsigned size)
+{
+  char s[32];
+  ConvertUInt64ToString(v, s);
+  PrintRight(so, s, size);
+}
+
+// it prints (v / 10) with one decimal digit
+static void PrintNumber_Div10(CStdOutStream &so, UInt64 v, unsigned size)
+{
+  char s[32];
+  ConvertUInt64ToString(v / 10, s);
+  const unsigned pos = MyStringLen(s);
+  s[pos] = '.';
+  s[pos + 1] = (char)('0' + (unsigned)(v % 10));
+  s[pos + 2] = 0;
+  PrintRight(so, s, size);
+}
+
+static void PrintHeader(CStdOutStream &so)
+{
+  PrintLeft(so, "Format", kFieldSize_Format);
+  PrintLeft(so, "Cmd", kFieldSize_Cmd);
+  PrintRight(so, "Time", kFieldSize_Time);
+  PrintRight(so, "CPU", kFieldSize_Time);
+  PrintRight(so, "Usage", kFieldSize_Usage);
+  PrintRight(so, "Files", kFieldSize_Files);
+  PrintRight(so, "Speed", kFieldSize_Speed);
+  PrintRight(so, "Ratio", kFieldSize_Ratio);
+  so << endl;
+  PrintSpaces(so, kFieldSize_Format + kFieldSize_Cmd);
+  PrintRight(so, "ms", kFieldSize_Time);
+  PrintRight(so, "ms", kFieldSize_Time);
+  PrintRight(so, "%", kFieldSize_Usage);
+  PrintRight(so, "/s", kFieldSize_Files);
+  PrintRight(so, "MB/s", kFieldSize_Speed);
+  PrintRight(so, "%", kFieldSize_Ratio);
+  so << endl << endl;
+}
+
+static void PrintPhase(CStdOutStream &so, const UString &format, const char *cmd,
+    const CCmdTimer &t, UInt64 numFiles, UInt64 size, UInt64 arcSize)
+{
+  PrintLeft(so, UnicodeStringToMultiByte(format), kFieldSize_Format);
+  PrintLeft(so, cmd, kFieldSize_Cmd);
+  UInt64 wall = t.WallTime;
+  if (wall == 0)
+    wall = 1;
+  PrintNumber(so, (t.WallTime + 500) / 1000, kFieldSize_Time);
+  PrintNumber(so, (t.CpuTime + 500) / 1000, kFieldSize_Time);
+  PrintNumber(so, (t.CpuTime * 100 + wall / 2) / wall, kFieldSize_Usage);
+  PrintNumber(so, numFiles * 1000000 / wall, kFieldSize_Files);
+  if (size != 0)
+    PrintNumber_Div10(so, size * 10 * 1000000 / ((UInt64)1 << 20) / wall, kFieldSize_Speed);
+  else
+    PrintSpaces(so, kFieldSize_Speed);
+  if (arcSize != 0 && size != 0)
+    PrintNumber_Div10(so, (arcSize * 1000 + size / 2) / size, kFieldSize_Ratio);
+  so << endl;
+}
+
+
+/* Phase breakdown of commands. The values are taken from CPhaseStat.
+   (CRC) is reported only by handlers that support IArchiveExtractCallbackStat. */
+
+enum
+{
+  k_PhaseCol_Scan,
+  k_PhaseCol_Open,
+  k_PhaseCol_Crc,
+  k_PhaseCol_Header,
+  k_PhaseCol_Read,
+  k_PhaseCol_Write,
+  k_PhaseCol_Num
+};
+
+static const char * const k_PhaseColNames[k_PhaseCol_Num] =
+{
+    "Scan"
+  , "Open"
+  , "CRC"
+  , "Header"
+  , "Read"
+  , "Write"
+};
+
+static const UInt64 k_PhaseTime_Undefined = (UInt64)(Int64)-1;
+
+struct CPhaseRow
+{
+  UString Format;
+  const char *Cmd;
+  UInt64 Times[k_PhaseCol_Num]; // in microseconds
+
+  void Set(const CPhaseStat &ps)
+  {
+    Times[k_PhaseCol_Scan] = GetPhaseTime(ps.Phases[NPhaseStat::kScan]);
+    Times[k_PhaseCol_Open] = GetPhaseTime(ps.Phases[NPhaseStat::kOpen]);
+    Times[k_PhaseCol_Header] = GetPhaseTime(ps.Phases[NPhaseStat::kHeader]);
+    const CStageStatItem &crc = ps.Stages[NArchive::NExtract::NStage::kCrc];
+    Times[k_PhaseCol_Crc] = (crc.Size != 0) ? crc.Time : k_PhaseTime_Undefined;
+    Times[k_PhaseCol_Read] = GetIoTime(ps.Io.Items[NIoStat::kRead]);
+    Times[k_PhaseCol_Write] = GetIoTime(ps.Io.Items[NIoStat::kWrite]);
+  }
+private:
+  static UInt64 GetPhaseTime(const CPhaseStatItem &item)
+    { return item.NumCalls != 0 ? item.Time : k_PhaseTime_Undefined; }
+  static UInt64 GetIoTime(const CIoStatItem &item)
+    { return item.NumCalls != 0 ? item.Time : k_PhaseTime_Undefined; }
+};
+
+static void PrintPhaseRows(CStdOutStream &so, const CObjectVector<CPhaseRow> &rows)
+{
+  so << endl << "Phase times, ms:" << endl << endl;
+  PrintLeft(so, "Format", kFieldSize_Format);
+  PrintLeft(so, "Cmd", kFieldSize_Cmd);
+  unsigned k;
+  for (k = 0; k < k_PhaseCol_Num; k++)
+    PrintRight(so, k_PhaseColNames[k], kFieldSize_Time);
+  so << endl;
+  FOR_VECTOR (i, rows)
+  {
+    const CPhaseRow &row = rows[i];
+    so << endl;
+    PrintLeft(so, UnicodeStringToMultiByte(row.Format), kFieldSize_Format);
+    PrintLeft(so, row.Cmd, kFieldSize_Cmd);
+    for (k = 0; k < k_PhaseCol_Num; k++)
+    {
+      const UInt64 t = row.Times[k];
+      if (t == k_PhaseTime_Undefined)
+        PrintRight(so, "-", kFieldSize_Time);
+      else
+        PrintNumber(so, (t + 500) / 1000, kFieldSize_Time);
+    }
+  }
+  so << endl;
+}
+
+
+static bool ParseSizeValue(const UString &s, UInt64 &val)
+{
+  const wchar_t *end;
+  val = ConvertStringToUInt64(s, &end);
+  if (end == s.Ptr())
+    return false;
+  unsigned numBits;
+  switch (MyCharLower_Ascii(*end))
+  {
+    case 0: return true;
+    case 'k': numBits = 10; break;
+    case 'm': numBits = 20; break;
+    case 'g': numBits = 30; break;
+    default: return false;
+  }
+  if (end[1] != 0 || val >= ((UInt64)1 << (64 - numBits)))
+    return false;
+  val <<= numBits;
+  return true;
+}
+
+static bool ParseUInt32Value(const UString &s, UInt32 &val)
+{
+  const wchar_t *end;
+  val = ConvertStringToUInt32(s, &end);
+  return end != s.Ptr() && *end == 0;
+}
+
+
+struct CArcBenchTempDir
+{
+  FString Path;
+  ~CArcBenchTempDir()
+  {
+    if (!Path.IsEmpty())
+      RemoveDirWithSubItems(Path);
+  }
+};
+
+static HRESULT GetFileSize(const FString &path, UInt64 &size)
+{
+  NIO::CInFile file;
+  if (!file.Open(path) || !file.GetLength(size))
+    return GetLastError_noZero_HRESULT();
+  return S_OK;
+}
+
+
+HRESULT ArcBenchCon(CCodecs *codecs,
+    const CObjectVector<CProperty> &props, UInt32 numIterations, CStdOutStream &so)
+{
+  CTreeParams tp;
+  FString baseDir;
+  UStringVector formats;
+  UStringVector methodProps;
+
+  FOR_VECTOR (i, props)
+  {
+    const CProperty &prop = props[i];
+    UString name (prop.Name);
+    name.MakeLower_Ascii();
+    const UString &val = prop.Value;
+    bool isOK = true;
+
+    if (name.IsEqualTo(kTreeProp))
+      baseDir = us2fs(val);
+    else if (name.IsEqualTo("files"))
+      isOK = ParseUInt32Value(val, tp.NumFiles);
+    else if (name.IsEqualTo("fdir"))
+      isOK = ParseUInt32Value(val, tp.NumFilesInDir) && tp.NumFilesInDir != 0;
+    else if (name.IsEqualTo("fmin"))
+      isOK = ParseSizeValue(val, tp.MinSize);
+    else if (name.IsEqualTo("fmax"))
+      isOK = ParseSizeValue(val, tp.MaxSize);
+    else if (name.IsEqualTo("cr"))
+      isOK = ParseUInt32Value(val, tp.Compressibility) && tp.Compressibility <= 100;
+    else if (name.IsEqualTo("fmt"))
+    {
+      // -mfmt=7z,zip
+      UString s;
+      for (unsigned k = 0;; k++)
+      {
+        const wchar_t c = val[k];
+        if (c == 0 || c == ',')
+        {
+          if (!s.IsEmpty())
+            formats.Add(s);
+          s.Empty();
+          if (c == 0)
+            break;
+        }
+        else
+          s += c;
+      }
+    }
+    else if (name.IsEqualTo("x") || name.IsPrefixedBy_Ascii_NoCase("mt"))
+    {
+      // these properties are sent to archive handlers for (a) command
+      UString s ("-m");
+      s += prop.Name;
+      if (!val.IsEmpty())
+      {
+        s.Add_Char('=');
+        s += val;
+      }
+      methodProps.Add(s);
+    }
+    else
+      isOK = false;
+
+    if (!isOK)
+      return E_INVALIDARG;
+  }
+
+  if (tp.MinSize > tp.MaxSize)
+    return E_INVALIDARG;
+  if (formats.IsEmpty())
+  {
+    formats.Add(UString("7z"));
+    formats.Add(UString("zip"));
+    formats.Add(UString("tar"));
+    formats.Add(UString("xz"));
+  }
+  if (numIterations == 0)
+    numIterations = 1;
+
+  CArcBenchTempDir tempDir;
+  {
+    if (baseDir.IsEmpty())
+    {
+      if (!MyGetTempPath(baseDir))
+        return GetLastError_noZero_HRESULT();
+    }
+    else
+      NName::NormalizeDirPathPrefix(baseDir);
+    FString prefix (baseDir);
+    prefix += "7zBench";
+    AString postfix;
+    if (!CreateTempFile2(prefix, true, postfix, NULL))
+      return GetLastError_noZero_HRESULT();
+    tempDir.Path = prefix;
+    tempDir.Path += fas2fs(postfix);
+  }
+
+  FString dirPrefix (tempDir.Path);
+  dirPrefix.Add_PathSepar();
+  const FString srcDir = dirPrefix + FTEXT("src");
+  const FString outDir = dirPrefix + FTEXT("out");
+  const FString tarPath = dirPrefix + FTEXT("src.tar");
+
+  so << endl << "Temp folder: " << fs2us(tempDir.Path) << endl;
+
+  CTreeGenerator gen;
+  {
+    if (!CreateDir(srcDir))
+      return GetLastError_noZero_HRESULT();
+    CCmdTimer t;
+    t.Start();
+    RINOK(gen.Generate(tp, srcDir + FSTRING_PATH_SEPARATOR))
+    t.Stop();
+    so << "Files: " << tp.NumFiles
+       << "  Folders: " << gen.NumDirs
+       << "  Size: " << gen.TotalSize
+       << "  File sizes: " << tp.MinSize << " - " << tp.MaxSize
+       << "  Compressibility: " << tp.Compressibility << "%"
+       << endl;
+    so << "Generation time: " << (t.WallTime + 500) / 1000 << " ms" << endl << endl;
+  }
+
+  bool tarIsCreated = false;
+  CObjectVector<CPhaseRow> phaseRows;
+
+  PrintHeader(so);
+
+  for (UInt32 iter = 0; iter < numIterations; iter++)
+  {
+    if (iter != 0)
+      so << endl;
+
+    FOR_VECTOR (fi, formats)
+    {
+      const UString &format = formats[fi];
+
+      // xz is single-file format, so it packs tar archive of the tree
+      const bool isXz = StringsAreEqualNoCase_Ascii(format, "xz");
+      UString src = fs2us(srcDir);
+      UInt64 numFiles = tp.NumFiles;
+      UInt64 size = gen.TotalSize;
+      if (isXz)
+      {
+        if (!tarIsCreated)
+        {
+          RINOK(Run_Update(codecs, UString("tar"), fs2us(tarPath), src, UStringVector()))
+          tarIsCreated = true;
+        }
+        src = fs2us(tarPath);
+        numFiles = 1;
+        RINOK(GetFileSize(tarPath, size))
+      }
+
+      FString arcPath = dirPrefix;
+      arcPath += "arc.";
+      arcPath += us2fs(format);
+      DeleteFileAlways(arcPath);
+
+      CCmdTimer t;
+      UInt64 arcSize;
+
+      {
+        CPhaseStat ps;
+        t.Start();
+        RINOK(Run_Update(codecs, format, fs2us(arcPath), src, methodProps, &ps))
+        t.Stop();
+        CPhaseRow &row = phaseRows.AddNew();
+        row.Format = format;
+        row.Cmd = "a";
+        row.Set(ps);
+      }
+      RINOK(GetFileSize(arcPath, arcSize))
+      PrintPhase(so, format, "a", t, numFiles, size, arcSize);
+
+      UInt32 numItems;
+      t.Start();
+      RINOK(Run_List(codecs, format, fs2us(arcPath), numItems))
+      t.Stop();
+      PrintPhase(so, format, "l", t, numItems, 0, 0);
+
+      for (unsigned ext = 0; ext < 2; ext++)
+      {
+        const char *cmd = (ext == 0 ? "t" : "x");
+        CDecompressStat stat;
+        CPhaseStat ps;
+        t.Start();
+        RINOK(Run_Extract(codecs, format, fs2us(arcPath),
+            ext == 0 ? UString() : fs2us(outDir), stat, &ps))
+        t.Stop();
+        PrintPhase(so, format, cmd, t, numFiles, size, 0);
+        CPhaseRow &row = phaseRows.AddNew();
+        row.Format = format;
+        row.Cmd = cmd;
+        row.Set(ps);
+      }
+
+      if (!RemoveDirWithSubItems(outDir))
+        return GetLastError_noZero_HRESULT();
+      DeleteFileAlways(arcPath);
+
+      if (NConsoleClose::TestBreakSignal())
+        return E_ABORT;
+    }
+  }
+
+  PrintPhaseRows(so, phaseRows);
+  return S_OK;
+}
+
+
+
+/* Reference archives for decoders that are not covered by codec benchmark,
+   because they have no registered codecs. These archives are created by in-tree encoders.
+   Other reference archives are stored in ArcBenchRef.cpp. */
+
+struct CRefArcParam
+{
+  const char *Format;
+  const char *Method;
+  const char *Name;
+};
+
+static const CRefArcParam k_RefArcs[] =
+{
+  { "wim", "lzx",    "WIM:LZX" },
+  { "wim", "xpress", "WIM:XPRESS" }
+};
+
+
+// it opens archive from memory stream for decoding benchmark
+
+static HRESULT Bench_OpenArc(const CCodecs *codecs, int mainIndex,
+    CBufferInStream *streamSpec, IInStream *stream,
+    const CObjectVector<CProperty> &handlerProps, CBenchArc &arc)
+{
+  arc.PackSize = streamSpec->Buf.Size();
+
+  for (int i = -1; i < (int)codecs->Formats.Size(); i++)
+  {
+    const int formatIndex = (i < 0 ? mainIndex : i);
+    if (formatIndex < 0 || (i >= 0 && i == mainIndex))
+      continue;
+    CMyComPtr<IInArchive> archive;
+    if (codecs->CreateInArchive((unsigned)formatIndex, archive) != S_OK || !archive)
+      continue;
+    streamSpec->Init();
+    const UInt64 maxCheckStartPosition = 0;
+    if (archive->Open(stream, &maxCheckStartPosition, NULL) != S_OK)
+    {
+      archive->Close();
+      continue;
+    }
+    Z7_DECL_CMyComPtr_QI_FROM(ISetProperties, setProperties, archive)
+    if (setProperties && !handlerProps.IsEmpty())
+    {
+      // the properties (-mmt) must be set before Open(), as in (x) command.
+      // (x) command ignores them for handlers without ISetProperties.
+      archive->Close();
+      RINOK(SetProperties(archive, handlerProps))
+      streamSpec->Init();
+      RINOK(archive->Open(stream, &maxCheckStartPosition, NULL))
+    }
+    arc.Archive = archive;
+    arc.Name = UnicodeStringToMultiByte(codecs->Formats[(unsigned)formatIndex].Name);
+    {
+      // method names of first item and then format name are used to select rating complexity
+      NCOM::CPropVariant prop;
+      UInt32 numItems = 0;
+      RINOK(archive->GetNumberOfItems(&numItems))
+      if (numItems != 0)
+      {
+        RINOK(archive->GetProperty(0, kpidMethod, &prop))
+      }
+      if (prop.vt == VT_EMPTY)
+      {
+        RINOK(archive->GetArchiveProperty(kpidMethod, &prop))
+      }
+      if (prop.vt == VT_BSTR)
+      {
+        arc.Method = UnicodeStringToMultiByte(prop.bstrVal);
+        arc.Method.Add_Space();
+      }
+      arc.Method += arc.Name;
+    }
+    return S_OK;
+  }
+  return S_FALSE;
+}
+
+static HRESULT Bench_OpenArc(const CCodecs *codecs, const FString &path,
+    const CObjectVector<CProperty> &handlerProps, CBenchArc &arc)
+{
+  CBufferInStream *streamSpec = new CBufferInStream;
+  CMyComPtr<IInStream> stream = streamSpec;
+  {
+    NIO::CInFile file;
+    if (!file.Open(path))
+      return GetLastError_noZero_HRESULT();
+    UInt64 size;
+    if (!file.GetLength(size))
+      return GetLastError_noZero_HRESULT();
+    if (size != (size_t)size)
+      return E_OUTOFMEMORY;
+    streamSpec->Buf.Alloc((size_t)size);
+    size_t processed;
+    if (!file.ReadFull(streamSpec->Buf, (size_t)size, processed))
+      return GetLastError_noZero_HRESULT();
+    if (processed != size)
+      return E_FAIL;
+  }
+  return Bench_OpenArc(codecs, codecs->FindFormatForArchiveName(fs2us(path)),
+      streamSpec, stream, handlerProps, arc);
+}
+
+
+HRESULT ArcDecBenchCon(CCodecs *codecs,
+    const CObjectVector<CProperty> &props, UInt32 numIterations, CStdOutStream &so)
+{
+  UStringVector paths;
+  bool useRefArcs = false;
+  CObjectVector<CProperty> handlerProps;
+
+  FOR_VECTOR (i, props)
+  {
+    const CProperty &prop = props[i];
+    if (StringsAreEqualNoCase_Ascii(prop.Name, kArcProp))
+    {
+      if (prop.Value.IsEmpty())
+        useRefArcs = true;
+      else
+        paths.Add(prop.Value);
+    }
+    else if (prop.Name.IsPrefixedBy_Ascii_NoCase("mt")
+        || StringsAreEqualNoCase_Ascii(prop.Name, "memuse"))
+      handlerProps.Add(prop);
+    else
+      return E_INVALIDARG;
+  }
+
+  CObjectVector<CBenchArc> arcs;
+  CArcBenchTempDir tempDir;
+
+  if (useRefArcs)
+  {
+    FString prefix;
+    if (!MyGetTempPath(prefix))
+      return GetLastError_noZero_HRESULT();
+    prefix += "7zBench";
+    AString postfix;
+    if (!CreateTempFile2(prefix, true, postfix, NULL))
+      return GetLastError_noZero_HRESULT();
+    tempDir.Path = prefix;
+    tempDir.Path += fas2fs(postfix);
+    FString dirPrefix (tempDir.Path);
+    dirPrefix.Add_PathSepar();
+    const FString srcDir = dirPrefix + FTEXT("src");
+    if (!CreateDir(srcDir))
+      return GetLastError_noZero_HRESULT();
+
+    CTreeParams tp;
+    tp.NumFiles = 64;
+    tp.MinSize = (UInt32)1 << 16;
+    tp.MaxSize = (UInt32)1 << 20;
+    tp.Compressibility = 90;
+    CTreeGenerator gen;
+    RINOK(gen.Generate(tp, srcDir + FSTRING_PATH_SEPARATOR))
+
+    for (unsigned k = 0; k < Z7_ARRAY_SIZE(k_RefArcs); k++)
+    {
+      const CRefArcParam &rp = k_RefArcs[k];
+      if (codecs->FindFormatForArchiveType(UString(rp.Format)) < 0)
+        continue; // the handler is not included to this build
+      FString arcPath (dirPrefix);
+      arcPath += "ref";
+      arcPath.Add_UInt32(k);
+      arcPath.Add_Dot();
+      arcPath += fas2fs(rp.Format);
+      UStringVector methodProps;
+      UString m ("-m0=");
+      m += rp.Method;
+      methodProps.Add(m);
+      RINOK(Run_Update(codecs, UString(rp.Format), fs2us(arcPath), fs2us(srcDir), methodProps))
+      CBenchArc &arc = arcs.AddNew();
+      RINOK(Bench_OpenArc(codecs, arcPath, handlerProps, arc))
+      arc.Name = rp.Name;
+    }
+
+    for (unsigned k = 0; k < g_NumArcBenchRefs; k++)
+    {
+      const CArcBenchRef &ref = g_ArcBenchRefs[k];
+      const int formatIndex = codecs->FindFormatForArchiveType(UString(ref.Format));
+      if (formatIndex < 0)
+        continue; // the handler is not included to this build
+      CBufferInStream *streamSpec = new CBufferInStream;
+      CMyComPtr<IInStream> stream = streamSpec;
+      streamSpec->Buf.CopyFrom(ref.Data, ref.Size);
+      CBenchArc arc;
+      const HRESULT res = Bench_OpenArc(codecs, formatIndex, streamSpec, stream, handlerProps, arc);
+      if (res == S_FALSE)
+        continue;
+      RINOK(res)
+      arc.Name = ref.Name;
+      arc.Method = ref.Method;
+      arcs.Add(arc);
+    }
+  }
+
+  FOR_VECTOR (i, paths)
+  {
+    CBenchArc &arc = arcs.AddNew();
+    const HRESULT res = Bench_OpenArc(codecs, us2fs(paths[i]), handlerProps, arc);
+    if (res == S_FALSE)
+    {
+      so << endl << "Can not open the file as archive: " << paths[i] << endl;
+      return E_FAIL;
+    }
+    RINOK(res)
+  }
+
+  return BenchArcsCon(arcs, numIterations, (FILE *)so);
+}
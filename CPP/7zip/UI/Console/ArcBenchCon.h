@@ -0,0 +1,31 @@
+// ArcBenchCon.h
+
+#ifndef ZIP7_INC_ARC_BENCH_CON_H
+#define ZIP7_INC_ARC_BENCH_CON_H
+
+#include "../../../Common/StdOutStream.h"
+
+#include "../Common/LoadCodecs.h"
+#include "../Common/Property.h"
+
+/* End-to-end benchmark of archive commands (a, l, t, x) for synthetic file tree.
+   It's enabled by (-mtree[=baseDir]) property of (b) command.
+   The table of phase times (scan, open, CRC, header, file I/O) is printed after main table. */
+
+bool ArcBench_IsTreeMode(const CObjectVector<CProperty> &props);
+
+HRESULT ArcBenchCon(CCodecs *codecs,
+    const CObjectVector<CProperty> &props, UInt32 numIterations, CStdOutStream &so);
+
+/* Decoding benchmark of archive handlers. It's enabled by (-marc) property:
+     -marc=path : archive from file, it can be repeated.
+     -marc      : reference archives: WIM LZX and XPRESS created by in-tree encoders,
+                  and stored archives (Zstd, LZMS, LZFSE, RAR3, RAR5, Implode, Z).
+   (-mmt) and (-mmemuse) properties are sent to archive handlers as in (x) command. */
+
+bool ArcBench_IsDecodeMode(const CObjectVector<CProperty> &props);
+
+HRESULT ArcDecBenchCon(CCodecs *codecs,
+    const CObjectVector<CProperty> &props, UInt32 numIterations, CStdOutStream &so);
+
+#endif
@@ -0,0 +1,1532 @@
+// ArcBenchRef.cpp
+
+#include "StdAfx.h"
+
+#include "ArcBenchRef.h"
+
+/* Reference archives for decoding benchmark (-marc).
+   There are no in-tree encoders for these methods, so the archives are stored here.
+   Each archive contains one file of 32 KiB: deterministic English-like text
+   (sentences of random common words from fixed seeds).
+   Zstd stream was created by zstd (-19).
+   Other streams were created by simple offline encoders (greedy LZ and static Huffman tables),
+   written for these decoders, and all streams were checked by (t) command. */
+
+static const Byte kZstd[2214] =
+{
+  0x28,0xb5,0x2f,0xfd,0x64,0x00,0x7f,0xc5,0x44,0x00,0x22,0xce,0x21,0x11,0xb0,0xeb,
+  0x20,0x61,0x18,0x54,0x58,0x7d,0x55,0x0b,0x25,0x09,0x2a,0x4e,0x1f,0x88,0x01,0x40,
+  0x38,0x00,0x01,0x04,0x5a,0x65,0xae,0x2b,0xad,0x26,0x2e,0x0d,0xfb,0xf7,0x86,0x0b,
+  0x9e,0x6b,0x5a,0x20,0x5e,0x0e,0x2f,0x74,0x5a,0x5f,0x81,0x70,0x0e,0x5f,0xad,0x8f,
+  0x0e,0xb8,0xf7,0x3a,0xbc,0x91,0xc7,0xe1,0x7a,0xb4,0xd9,0x85,0xce,0xd9,0xf0,0x78,
+  0xa9,0xdf,0x70,0x1e,0xa7,0x59,0xb3,0x7d,0x7e,0xc3,0x7b,0x2f,0xb5,0xd9,0xb0,0x0f,
+  0x40,0xe4,0xf1,0xd1,0x49,0x9d,0x2a,0x9d,0x53,0xa1,0x17,0x7a,0xe9,0xb9,0x4b,0xc2,
+  0x70,0xae,0xce,0x09,0x7d,0x36,0xfc,0x4d,0x56,0xeb,0x97,0xe7,0x3e,0xfa,0x8d,0xa0,
+  0xd6,0x78,0xbf,0xc6,0x49,0xad,0x34,0xcf,0x81,0x38,0x44,0x8f,0xf3,0xf1,0xdc,0x4b,
+  0x8f,0xf7,0xce,0x13,0x83,0x52,0xa8,0x42,0x9f,0x91,0x24,0x85,0x7a,0x2c,0x63,0x22,
+  0x08,0x24,0x18,0x14,0x14,0xcb,0x73,0x45,0xd3,0xe3,0x03,0x12,0x60,0x90,0x20,0x02,
+  0x04,0x21,0x50,0x10,0x04,0x21,0x40,0x10,0x04,0x48,0x48,0x0c,0x41,0x10,0x88,0x00,
+  0x21,0x60,0x28,0x02,0x04,0x41,0x09,0x44,0x06,0xb5,0xac,0x03,0xea,0xaa,0x92,0x66,
+  0xeb,0x8e,0xf9,0x7b,0x75,0x3f,0x4b,0x38,0x2c,0x16,0xa2,0x2f,0x3a,0x99,0x58,0xc0,
+  0xc3,0x31,0x04,0x07,0xc8,0x82,0x59,0x9f,0xf3,0x8c,0x31,0x5a,0x21,0x32,0xf8,0xaa,
+  0x5e,0xb2,0x6c,0x88,0x1d,0x51,0xf3,0x1e,0x7d,0x9c,0x83,0xc5,0xba,0xfe,0xb8,0x1a,
+  0x14,0x85,0xfb,0x8d,0x44,0x8d,0xb0,0x44,0xef,0x41,0x7a,0xb5,0x88,0xc3,0x9d,0x72,
+  0xd3,0x22,0xf1,0x50,0x8d,0x34,0x66,0x81,0x5f,0x18,0x41,0x3c,0x36,0xe9,0xe0,0xa5,
+  0x8d,0x06,0x1b,0xb5,0x99,0x84,0x3c,0xcd,0xc4,0xbf,0x67,0x96,0x53,0xc1,0x56,0x7b,
+  0x79,0xf2,0xdb,0xad,0xd6,0xdb,0x25,0x47,0xcd,0x40,0x5e,0xa2,0x82,0xa6,0xeb,0xa7,
+  0xca,0x72,0x7a,0x0b,0xbb,0xba,0x96,0xb2,0xfb,0x7f,0x6d,0x4f,0x6d,0xfa,0x83,0x9f,
+  0xeb,0x52,0xc2,0xec,0x28,0x6f,0x47,0x72,0x22,0x92,0x02,0x59,0x62,0x6c,0x7f,0x8d,
+  0x3f,0x8b,0x82,0xc4,0xa9,0x57,0xab,0xb9,0x46,0x31,0xd1,0x44,0x69,0xf4,0x7d,0x46,
+  0xd9,0xe5,0x14,0x4e,0xf3,0x77,0xbb,0x51,0x60,0x0a,0x72,0xef,0x21,0x04,0xc9,0x07,
+  0xd6,0xa7,0x72,0xae,0x4b,0xae,0x90,0x92,0xfc,0x58,0xdb,0x07,0x61,0x74,0x8d,0x54,
+  0xc5,0xe9,0x6a,0x1f,0x66,0x05,0x6a,0x51,0xbb,0xa1,0xe2,0xa7,0xcc,0x1b,0x00,0x4f,
+  0x4e,0xcc,0x78,0x93,0x77,0x39,0x7b,0x39,0x17,0xa0,0xac,0xc1,0xfb,0xfd,0x7c,0x59,
+  0x84,0x3f,0xa3,0x5e,0xbb,0x16,0x75,0xb2,0x96,0x1c,0xaf,0x2b,0x0a,0x25,0xdf,0x65,
+  0x9b,0x09,0xf7,0xd7,0x67,0x30,0x9e,0x42,0x12,0xe8,0x0a,0x1f,0x7c,0x73,0x21,0xc8,
+  0xc4,0x9b,0xe9,0x4a,0xeb,0x40,0x4f,0x7a,0x73,0xb3,0x1c,0xd6,0xd3,0x5b,0xb6,0xf1,
+  0xd3,0xda,0xfa,0xd1,0x82,0x97,0xb3,0x8f,0x86,0xe8,0x87,0x64,0x63,0xe4,0xff,0x0f,
+  0x41,0xd3,0xc4,0xf1,0xc1,0x0c,0x7e,0xad,0x28,0xd5,0xf0,0x25,0xab,0x75,0x1f,0x4e,
+  0xee,0x1a,0x41,0x29,0x78,0x46,0x53,0xa7,0x28,0x13,0xdc,0x0c,0x9e,0x53,0x5f,0xab,
+  0x4d,0xbd,0x7d,0xcf,0xae,0xb4,0xef,0x8c,0xfb,0xf2,0xc2,0x91,0x6d,0x4b,0x63,0x70,
+  0xf4,0xc9,0x8b,0x09,0xc7,0xa4,0x7e,0x5b,0x98,0x71,0xbc,0xbf,0x20,0xe6,0x30,0x19,
+  0x95,0x9c,0x5d,0x1a,0x67,0x74,0x70,0x1a,0x6d,0xcb,0xcf,0x16,0xbb,0xfb,0xde,0x42,
+  0xca,0x69,0x79,0x15,0x40,0x2a,0xfb,0xce,0x0e,0x83,0x76,0x78,0x39,0x92,0x12,0x4a,
+  0x8b,0x65,0x1a,0xb5,0xcd,0x50,0x2e,0xf9,0x53,0x07,0xf5,0x66,0x46,0xba,0x15,0xd5,
+  0xb3,0xad,0xcb,0x0a,0x50,0xe8,0xa0,0xce,0x58,0xf5,0x3a,0x45,0x55,0x27,0x44,0x76,
+  0xb4,0x18,0x27,0x37,0x6b,0x50,0xbc,0x01,0xc8,0x39,0x8b,0x6a,0x1a,0x89,0x2d,0x79,
+  0xb7,0x59,0x88,0x31,0x82,0x72,0x2c,0x86,0x3c,0x69,0xd1,0x02,0xb2,0x1d,0xc7,0x29,
+  0xed,0xe6,0xcd,0x1e,0xd1,0x74,0x6a,0x30,0x95,0x27,0x69,0x3e,0x34,0xb8,0x96,0x84,
+  0x7e,0x63,0x6a,0x77,0xb9,0xca,0x17,0xda,0x49,0x1b,0x17,0xee,0x22,0x71,0x92,0xe0,
+  0x27,0x2a,0x29,0x8d,0x10,0x35,0x4e,0xe0,0xd3,0xe7,0x7a,0x49,0x20,0x25,0xcd,0xf4,
+  0x4b,0x58,0xef,0xb4,0x76,0xdd,0xcf,0xb6,0x0e,0x3e,0x10,0x99,0x2a,0xca,0xa5,0x0e,
+  0x7a,0x10,0x5f,0xec,0x8e,0x3f,0x48,0xf3,0xfc,0x90,0x85,0x61,0xa7,0x04,0x6d,0xff,
+  0x84,0x06,0xa3,0x3a,0xad,0x1c,0xd8,0xd8,0xfe,0xe3,0xce,0x5e,0x09,0xc2,0x39,0xa4,
+  0xb9,0x54,0xd1,0x61,0x87,0xe0,0x40,0x5e,0x63,0x74,0xce,0xff,0xa1,0x82,0x48,0xc5,
+  0xe0,0x26,0x32,0x94,0x7c,0x68,0xec,0xd8,0x62,0x1b,0xa0,0x80,0x37,0xb4,0x53,0xc9,
+  0xa0,0xa0,0x11,0x4d,0xa5,0x11,0x8d,0x67,0x1c,0x29,0x40,0x8d,0x26,0xba,0x83,0xe2,
+  0x2c,0xbc,0xc0,0xdd,0x71,0x9e,0x8d,0x34,0x31,0xa2,0xfe,0xc3,0xc7,0x31,0x02,0x04,
+  0xa6,0xaf,0xd3,0xe9,0xfb,0xe3,0x95,0xdc,0x93,0x44,0xb9,0xc6,0x2c,0x82,0x68,0x06,
+  0xc9,0x6f,0x16,0x8e,0xb0,0x4a,0x4c,0x65,0x6b,0x12,0xb6,0xe6,0xed,0x7a,0xaa,0x38,
+  0x04,0xe9,0xb8,0x41,0x87,0xc4,0xc5,0xe2,0xbf,0x2d,0x15,0xf4,0x09,0xfc,0x1d,0xbe,
+  0x83,0xc2,0x44,0x1a,0xe3,0xd8,0xba,0x70,0xb2,0x77,0x10,0x4b,0xa1,0xa9,0x92,0xed,
+  0x18,0x13,0x94,0x69,0x5e,0xdb,0x26,0xd2,0x10,0x1c,0xbb,0x8d,0xce,0x3c,0xcb,0x22,
+  0x02,0x0c,0xe7,0xa4,0x53,0x1b,0x7f,0xa9,0x0d,0x0f,0x2c,0xb5,0x0f,0x56,0x9c,0x86,
+  0x56,0x2a,0x8b,0x2f,0x84,0xff,0x92,0x70,0xcf,0x53,0x82,0x8b,0x54,0x07,0x76,0x39,
+  0x26,0x39,0xf0,0x53,0x92,0x8c,0xf2,0x5c,0xc3,0x7a,0x2d,0xc7,0x83,0x24,0xc7,0xa2,
+  0x09,0x73,0x1c,0xd6,0x65,0xea,0x98,0xd1,0x34,0x0e,0x0f,0x78,0x64,0x40,0x2c,0x69,
+  0x49,0x62,0x94,0x86,0xc1,0xf1,0x92,0x76,0xe5,0x88,0x05,0xb6,0x3a,0x89,0xd2,0xac,
+  0x7b,0xea,0xb9,0x63,0xfd,0x2e,0x9e,0x31,0xf7,0x1c,0xc7,0x5e,0x5a,0x60,0xb6,0xe9,
+  0x95,0x8e,0x4d,0x7d,0x94,0xf6,0xc6,0xd0,0xc0,0x4d,0x2c,0x32,0x8d,0x89,0xd5,0x49,
+  0xf8,0x86,0xb9,0xe2,0x67,0x3b,0x96,0x88,0x84,0x49,0xad,0x75,0x7d,0xc0,0x29,0xca,
+  0x66,0xfc,0xc3,0xeb,0x1e,0xa6,0x71,0x3a,0xc6,0x93,0xf0,0x1b,0xb0,0xc0,0x0f,0x1a,
+  0x82,0x8a,0xe4,0x89,0xd1,0x5f,0x0c,0xe8,0x97,0x7e,0x43,0x51,0x83,0x9b,0x1f,0x66,
+  0x39,0xd4,0x5b,0x58,0xfe,0xd2,0x8f,0x07,0x71,0x9d,0xdc,0x6e,0xad,0x37,0x93,0x6a,
+  0x49,0x0b,0x18,0x26,0x64,0x63,0xcf,0xe6,0xbd,0x23,0x15,0x06,0x1d,0xf1,0x28,0x65,
+  0x09,0x8e,0xfb,0xbb,0x72,0xd1,0x80,0xc6,0x58,0xe8,0xc3,0x91,0x88,0xd0,0x52,0xc4,
+  0x51,0xc9,0x20,0xdc,0x7e,0x9b,0x81,0x15,0xee,0xaa,0x8b,0x97,0xa6,0x61,0xd4,0xe3,
+  0x89,0x21,0xe8,0x0c,0xc3,0xf1,0x9c,0x7a,0x49,0xed,0xef,0xd0,0x41,0x67,0x5f,0x76,
+  0x07,0xc8,0xf6,0xb6,0xe0,0x06,0xa8,0x3f,0xb6,0x32,0xa2,0x1e,0x2f,0xcb,0x6e,0xa0,
+  0x2c,0x48,0x1d,0x6f,0x9a,0xa2,0xce,0x0c,0x8c,0xdb,0x3e,0xba,0x20,0xb4,0x7c,0x7d,
+  0x85,0x6e,0x10,0x4a,0x53,0xe6,0xb4,0xf9,0x29,0x5a,0xd8,0xd0,0xb7,0x80,0xb2,0x5c,
+  0x48,0xfb,0xbc,0xb8,0x4f,0xd0,0xcd,0x42,0x41,0x76,0x9f,0x4d,0xe6,0x03,0x61,0xac,
+  0x00,0xab,0x75,0x6f,0xd0,0xd0,0x9a,0x6a,0xee,0x01,0x96,0x28,0xd5,0x96,0xf6,0x74,
+  0x9b,0xef,0xc2,0xa4,0xf1,0xa4,0x75,0x96,0x01,0xa2,0x45,0x3b,0xae,0x3a,0xc6,0x6e,
+  0xd3,0x39,0xa2,0x1f,0xdc,0x03,0x45,0xbb,0x5d,0x5a,0xc9,0x84,0xcb,0xda,0x82,0xbc,
+  0x24,0x91,0x4f,0xa3,0x8c,0xd0,0x07,0xe9,0x18,0x1c,0x3e,0x77,0x92,0xa1,0x2b,0xae,
+  0x7a,0xba,0x7a,0x93,0xab,0x2d,0x90,0x71,0x52,0xc7,0xc4,0xd7,0xea,0x4f,0xfd,0xd9,
+  0xaf,0x35,0xbe,0x2d,0x05,0xfe,0x21,0x7e,0x58,0xf2,0xe1,0x36,0x48,0x3b,0xff,0x4c,
+  0x03,0x96,0x2b,0x31,0x30,0x0b,0x0d,0x2a,0xdd,0x9a,0x54,0xb7,0x27,0x79,0x90,0x84,
+  0x70,0x7b,0x15,0xab,0x96,0xe4,0x9c,0x20,0x9a,0x8c,0xc3,0xff,0xb1,0x11,0xd0,0x1a,
+  0x6d,0x77,0x61,0x99,0x19,0xbb,0x3e,0x37,0x48,0x75,0x8d,0xc1,0x3c,0x92,0x52,0xee,
+  0x48,0xa1,0x25,0x7c,0x3d,0x6b,0xe0,0x0e,0xb0,0x43,0x58,0x2c,0x60,0x85,0x33,0x97,
+  0x7c,0xfa,0xb2,0xb8,0x16,0x0b,0x48,0x88,0x98,0x16,0x3a,0x30,0xa2,0x78,0x79,0x27,
+  0x63,0x90,0xcf,0x11,0xcf,0x43,0x65,0xb4,0x60,0xc3,0x73,0x3c,0xd0,0x23,0x71,0xa1,
+  0x00,0x66,0xd3,0x41,0x70,0xb5,0xdf,0x03,0x7c,0xf1,0xd0,0x46,0xe2,0x41,0x4a,0x6a,
+  0x95,0xa2,0x28,0x0e,0xbf,0x61,0xe0,0x34,0x37,0x7c,0x62,0x75,0xaa,0xda,0x16,0xcc,
+  0xdc,0x7b,0x0c,0x01,0xd5,0x59,0x01,0xe0,0x45,0x92,0xe3,0x0b,0x34,0xd3,0xe8,0x38,
+  0x16,0x74,0x1c,0xdb,0xeb,0xf6,0xc3,0x0d,0xdc,0x32,0x9a,0x84,0xaf,0x25,0x0a,0x48,
+  0xb8,0x0e,0xab,0xf5,0xb6,0x50,0xb7,0xf8,0x24,0x19,0x0a,0xac,0x3e,0xda,0x46,0x0e,
+  0xee,0xf8,0x63,0x46,0x80,0x8a,0x14,0xb7,0xc3,0x54,0x38,0x32,0x21,0x9a,0x55,0x22,
+  0x3d,0x17,0x1d,0xd5,0x55,0x87,0xe6,0xd5,0xd6,0xea,0x42,0x7a,0x2c,0x68,0x48,0xed,
+  0x4c,0x96,0x8e,0x3a,0xcd,0x49,0xa4,0xf3,0x50,0x68,0xba,0x73,0x12,0x06,0x2f,0x72,
+  0x7a,0x5c,0xaf,0x43,0xee,0xce,0xe8,0xa1,0x85,0x25,0x1d,0x55,0xd5,0x39,0xa1,0x7e,
+  0xb3,0xce,0x6f,0x0a,0x5d,0x41,0x31,0x83,0x08,0x4a,0x41,0x16,0xc6,0x05,0x37,0xf9,
+  0x8a,0x63,0xae,0x14,0x7e,0xaf,0x28,0x1a,0x76,0xd4,0xe4,0x80,0x06,0xe8,0x7c,0x07,
+  0xbb,0x5d,0xd2,0x6d,0x8f,0x97,0x42,0x35,0xa8,0xfe,0x90,0x34,0xa0,0x63,0x21,0x9e,
+  0xa4,0x31,0x47,0xdd,0xeb,0x05,0xf8,0x14,0xe1,0x0c,0x5e,0xf5,0x17,0x40,0x97,0xcb,
+  0xdf,0x41,0x9f,0x6a,0xbe,0x46,0x62,0xdd,0xd0,0xa2,0xc9,0xea,0xf3,0x94,0xac,0x5c,
+  0x25,0xf4,0xe2,0x1a,0x64,0x4a,0xe2,0x43,0x48,0x38,0x04,0x30,0x64,0x18,0x34,0xb3,
+  0xc7,0xfa,0xec,0x08,0x91,0x8a,0xe7,0x4e,0xf4,0x58,0x14,0x22,0x24,0xb2,0x05,0x1e,
+  0x5d,0x86,0x56,0xba,0xb3,0x0b,0xd0,0x0e,0xb8,0x1e,0x4b,0x4f,0xbf,0xdd,0xa0,0x6b,
+  0x49,0xa2,0x22,0xa0,0xba,0x5d,0x7d,0x23,0x2e,0xbb,0x57,0xea,0x67,0x34,0xa8,0xa0,
+  0x01,0xf5,0x65,0x3a,0x1c,0x77,0x0d,0x50,0xe8,0x86,0x59,0x40,0x11,0x4d,0xd7,0xc9,
+  0x8d,0xc3,0x4b,0xc6,0xfd,0x40,0x1d,0x3d,0x76,0x75,0x20,0x06,0x8e,0xd2,0x51,0x9e,
+  0xd3,0x81,0x35,0x5d,0x3b,0x71,0x05,0x1f,0x12,0xa6,0x7c,0xb2,0xeb,0xb6,0x89,0xc3,
+  0x3b,0x52,0x85,0x6d,0xc1,0x6b,0x21,0x47,0x9b,0xff,0xc5,0xc8,0xc4,0xac,0xdc,0xa9,
+  0x4c,0xba,0xe5,0xe9,0xd6,0xbb,0xa5,0xfb,0x36,0x3b,0xa1,0x7d,0x9a,0xc9,0xeb,0x9c,
+  0xcb,0xa7,0x30,0xa3,0x62,0x04,0xe9,0x97,0x1c,0xfe,0x09,0xfc,0x8c,0x13,0x6d,0x34,
+  0xf4,0x19,0xa7,0xfc,0x1c,0x5e,0x7a,0x32,0xb2,0xfc,0xd5,0xbf,0xb9,0x31,0xb2,0x35,
+  0x21,0x05,0x79,0x04,0xec,0x06,0xe8,0x0b,0xba,0xe9,0xfb,0xcf,0x23,0x9a,0xe5,0x6a,
+  0x5e,0xbc,0x83,0x86,0x41,0x90,0xd6,0x47,0xb9,0x82,0x3e,0xa3,0xeb,0xcc,0x43,0xc8,
+  0x83,0x69,0xbe,0x73,0xb5,0xd9,0xb0,0x16,0xac,0xa1,0x1a,0x93,0x9d,0xc2,0x37,0x79,
+  0xa9,0xf0,0xc1,0x00,0x20,0xfc,0xab,0xff,0x28,0xb9,0xb5,0x07,0xfd,0xbe,0x3c,0x91,
+  0xaf,0xdc,0xb2,0x10,0xc4,0xba,0xe2,0xd7,0xb8,0x28,0x26,0x70,0x4c,0xbe,0x42,0x4e,
+  0x95,0xb6,0x9c,0x5f,0x95,0x04,0x52,0xde,0x02,0x9c,0xf2,0x58,0xee,0xf8,0xdf,0x05,
+  0x6a,0xd4,0x0c,0x9e,0x88,0xdf,0x21,0x2f,0x02,0x5a,0xbd,0x9c,0x20,0xb4,0xa9,0x92,
+  0x39,0xaa,0xab,0x16,0x0c,0xf9,0xf2,0x04,0x0e,0xa0,0xd3,0xa6,0x2b,0xa0,0xf3,0x79,
+  0x79,0x1b,0xc0,0xef,0x94,0x1a,0xbc,0x51,0xfc,0xc5,0xab,0x37,0xd6,0x31,0x30,0x39,
+  0x59,0xb0,0xbb,0x2b,0xbf,0x7b,0x26,0x29,0xcc,0x19,0x6d,0x26,0xb8,0x6e,0x63,0xaa,
+  0x16,0xaf,0xa0,0xb0,0xae,0x21,0xd3,0x66,0x49,0x0a,0x69,0x7a,0x74,0x3b,0x90,0x08,
+  0x6b,0xcd,0x1e,0x82,0x73,0xa7,0xa1,0x9f,0xa3,0xc4,0x54,0x34,0x75,0x23,0xea,0x44,
+  0x23,0x3c,0xce,0x04,0x7a,0x91,0x51,0x11,0x94,0x23,0xa6,0x7f,0x5e,0xe5,0x11,0xc9,
+  0xcb,0xf6,0x65,0xe0,0x63,0xfc,0x15,0x3f,0xd4,0x69,0x21,0x47,0xfe,0x44,0x3f,0xd9,
+  0x47,0xe2,0x4b,0x98,0x4f,0x2e,0x4c,0x4e,0x36,0x49,0xd0,0x15,0xbc,0xc4,0x34,0x79,
+  0x80,0x63,0xb2,0x4c,0x7a,0xc4,0x16,0xc0,0x30,0x02,0x90,0xca,0x25,0x15,0x79,0x07,
+  0x76,0xe5,0x63,0x96,0x79,0xc3,0x66,0xda,0xda,0xe0,0xf7,0xff,0x51,0x8d,0xb8,0x65,
+  0xe5,0x11,0x9a,0x70,0x99,0xbf,0x08,0x31,0x0a,0x86,0x18,0xbe,0x65,0x7f,0xe7,0xc1,
+  0x9a,0xfc,0x35,0x01,0x10,0x62,0x0e,0x82,0xdb,0xe8,0x04,0xa7,0xeb,0x84,0xbd,0xae,
+  0x01,0x97,0x9a,0x91,0x05,0x51,0xae,0x47,0x11,0x01,0x35,0x81,0x91,0x05,0x03,0xbf,
+  0x52,0x77,0x79,0x8a,0xe0,0x54,0x51,0x23,0xbc,0xd3,0xeb,0x00,0xd7,0x81,0x2f,0x7f,
+  0xec,0xdf,0x90,0x7c,0xec,0xe8,0x77,0x3c,0x87,0x47,0x10,0xf8,0xc8,0x0b,0x74,0x85,
+  0x05,0x2f,0x9d,0xcc,0xe9,0x9a,0x41,0x97,0x33,0x72,0x04,0x84,0x85,0xfb,0xff,0xa0,
+  0x78,0x56,0x8f,0x90,0xe5,0x1b,0x1e,0x08,0x03,0xab,0xa1,0x2d,0x7d,0x57,0xf3,0xca,
+  0x01,0x64,0xec,0x40,0x59,0xf4,0xfa,0x75,0xae,0x5c,0x03,0x26,0xe7,0x62,0x9f,0x03,
+  0xa7,0x04,0x2d,0xcc,0x57,0x58,0x7d,0x07,0x02,0xec,0xd3,0x96,0xe9,0xc2,0x51,0x71,
+  0xda,0x0a,0x53,0x89,0xe7,0x6d
+};
+
+static const Byte kLzms[3786] =
+{
+  0x4d,0x53,0x57,0x49,0x4d,0x00,0x00,0x00,0xd0,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,
+  0x82,0x00,0x08,0x00,0x00,0x80,0x00,0x00,0x50,0x37,0xc7,0xb2,0x4d,0x91,0x84,0x32,
+  0x88,0x62,0x5c,0x7f,0xd4,0x1f,0x85,0x64,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,
+  0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xa8,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0x02,0x00,0x00,0x00,0x00,0x00,0x02,
+  0x0c,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x04,0x00,0xdc,0x4d,0x7f,0xb5,0xc6,0x71,0xbe,0x09,0xd5,0x0b,0xa3,0x5b,0x25,0xe4,
+  0x29,0x3e,0xa4,0x38,0xfd,0x2f,0x90,0xdb,0x6c,0x4c,0xe5,0x07,0x63,0x98,0x6c,0x40,
+  0x33,0x43,0xa0,0xc5,0x65,0x95,0x42,0x5c,0x12,0x12,0xc3,0xd5,0x6f,0xf6,0x70,0xe0,
+  0x88,0xb9,0x50,0x96,0xed,0xd2,0x22,0x2e,0x58,0xd8,0xbd,0x94,0x73,0xbe,0xd5,0x5f,
+  0x22,0xc0,0x53,0x4d,0x21,0xa0,0xcf,0x10,0xe2,0x4f,0xdb,0xa8,0x44,0xbc,0x0e,0x5a,
+  0x75,0x3d,0xf6,0x4e,0xf5,0x33,0x3f,0xaa,0x03,0x69,0x62,0xff,0xfa,0x28,0x0d,0x07,
+  0x6c,0x61,0x4f,0x95,0x7e,0xc4,0x71,0xb8,0xee,0x97,0xc7,0xba,0x0f,0xb4,0x46,0x6b,
+  0x00,0x00,0x90,0xd2,0x53,0xf2,0xc4,0x7c,0xf6,0xa9,0x16,0xe5,0xa8,0x4a,0x5e,0xac,
+  0x1c,0xc8,0x19,0x75,0x33,0x33,0x48,0x3b,0x25,0x52,0x45,0x38,0xe5,0x50,0x96,0x82,
+  0xeb,0xf1,0x2e,0x5d,0xfc,0x3d,0x36,0x5f,0x8f,0xf9,0xa1,0x4a,0x91,0x26,0x8e,0xdb,
+  0x01,0xa1,0x75,0x44,0xab,0x7a,0x8a,0xb2,0xbe,0x81,0xae,0x48,0xb5,0x38,0xcb,0x34,
+  0x59,0x4e,0xa0,0x1d,0x2a,0xaa,0x80,0xa6,0x55,0x99,0x92,0x73,0x86,0xe1,0x5b,0x70,
+  0x37,0xea,0x38,0x1f,0x69,0x1a,0x65,0x84,0x01,0x67,0x00,0x46,0x67,0x55,0xa6,0x4d,
+  0xbe,0x48,0x28,0x54,0x8a,0xd7,0x00,0x35,0x50,0x70,0x12,0x07,0x3c,0x2c,0x96,0x4e,
+  0xad,0x84,0x0b,0xce,0xb7,0xda,0x5b,0x09,0x38,0x8f,0x9d,0x5b,0x56,0xc3,0xdd,0xb0,
+  0x45,0x4a,0x57,0x98,0xd5,0xe5,0x39,0x0d,0x4a,0xfd,0xf9,0x5b,0xa7,0xd2,0x92,0x8d,
+  0x19,0xd3,0x3a,0x70,0x57,0xc3,0x6f,0x3c,0x4d,0x24,0xc6,0xce,0xd9,0x33,0x5d,0x9f,
+  0x6f,0x16,0xcd,0xe7,0x54,0xd8,0x9a,0xfd,0x61,0x7b,0x74,0xd0,0x84,0x8d,0x9a,0xbe,
+  0xcb,0x9c,0x44,0x79,0x55,0x6f,0x4e,0x2c,0xf2,0x60,0x17,0xf5,0xfe,0xb6,0x31,0xe0,
+  0xf2,0x3f,0x2e,0x46,0xfb,0x46,0xf6,0x98,0xe8,0x3c,0xa3,0xf2,0x70,0x14,0xa4,0x99,
+  0x42,0xb1,0x66,0x97,0xc9,0x15,0x83,0x22,0x10,0xe9,0x4c,0x74,0x4c,0x6f,0x97,0x9f,
+  0xed,0x72,0x39,0x3e,0x68,0x34,0x9e,0x9f,0x77,0x00,0x75,0x4d,0xc9,0x5e,0x80,0x74,
+  0xa5,0xd7,0x84,0x5d,0xb0,0x95,0x65,0xb1,0xbd,0xfc,0x12,0x13,0x6d,0xab,0xc4,0xaa,
+  0xa5,0x43,0x37,0xe4,0xce,0x03,0xea,0x16,0x8f,0x59,0x92,0x40,0xe3,0x4a,0xc1,0x8b,
+  0x13,0xbc,0xaa,0x70,0xeb,0xbd,0x7a,0x53,0x45,0x54,0xf8,0x5d,0xa9,0x2f,0xae,0x20,
+  0x6d,0x70,0xc0,0x57,0x1b,0x26,0x9f,0x0a,0xdc,0xac,0xcb,0x68,0x56,0xd0,0x67,0x37,
+  0x62,0x91,0x2e,0xb9,0xda,0x4f,0xa6,0x91,0xe5,0xb4,0x13,0x70,0xc9,0xde,0x58,0x17,
+  0xd2,0xc9,0x21,0xf1,0x9d,0x0a,0x3b,0xc3,0x69,0x0f,0x15,0xed,0xaf,0x6d,0x9a,0x6c,
+  0x67,0xc1,0x23,0xb9,0x7a,0xb0,0x34,0x93,0xd1,0xc8,0xf7,0x61,0xdd,0x5d,0x7a,0x07,
+  0x18,0xa3,0x51,0x05,0xf1,0x3c,0xe3,0xbc,0x29,0x54,0x8d,0x2f,0x92,0xc7,0x7a,0xae,
+  0x25,0x72,0x9b,0x4a,0x32,0xda,0x60,0xbd,0x74,0xf0,0x1c,0x35,0x0c,0x93,0x3c,0x63,
+  0x61,0xc9,0x60,0xdb,0x50,0xfb,0x40,0xa8,0x7a,0x0b,0xf6,0xaf,0x77,0xd9,0x48,0xb1,
+  0xce,0x58,0x75,0x52,0x9a,0x55,0xb2,0xa5,0xbb,0x42,0x75,0xf2,0x6e,0xe7,0x70,0xc8,
+  0xe0,0xfc,0x56,0x86,0xfe,0xa1,0x30,0xc1,0x70,0xab,0xd9,0xe6,0x38,0x9e,0x06,0x26,
+  0xfa,0xae,0xa7,0x96,0x08,0x60,0xaa,0x95,0x69,0xda,0xa8,0x9b,0x90,0x83,0x95,0x18,
+  0x26,0x7b,0x90,0xcc,0x34,0x83,0x8f,0xde,0x48,0x37,0x5f,0x3b,0xd8,0x5e,0xa4,0x44,
+  0x47,0x78,0x30,0xe6,0x9b,0xa6,0x7c,0x49,0x07,0xc4,0x6a,0x49,0x95,0x69,0xeb,0x8b,
+  0xdc,0xd6,0x67,0xb4,0x6e,0x07,0xd1,0x96,0xa7,0x87,0x0a,0x6f,0x3a,0x54,0x43,0x09,
+  0xa2,0x4e,0xef,0x4b,0x8b,0x7e,0xa5,0x8d,0x8a,0x9b,0xce,0x29,0x49,0x4f,0xf8,0x06,
+  0x51,0x78,0xd3,0x61,0x99,0xf1,0x85,0x61,0xf1,0xf7,0x78,0x1f,0xd7,0xd6,0xad,0x04,
+  0x72,0x41,0x09,0xbd,0x2a,0x20,0xf9,0x7c,0x69,0xf4,0xed,0xe9,0xd9,0x76,0xb3,0x2f,
+  0xa3,0xad,0xb1,0x8f,0x15,0x66,0x4f,0x86,0x0f,0xe5,0xce,0x96,0x1c,0xb3,0x9b,0x99,
+  0x8c,0xdc,0x20,0xca,0xb7,0x24,0xd7,0x77,0x6e,0xf1,0xd0,0x49,0x9e,0x06,0x58,0x7f,
+  0x4e,0x85,0x21,0x76,0x0e,0xe5,0x7a,0x86,0x1c,0x59,0x15,0x6d,0x0b,0xad,0x75,0x8b,
+  0x39,0x81,0x63,0x62,0xdd,0xbb,0xc6,0xa2,0x9b,0x6e,0x61,0xcf,0xc4,0x32,0xce,0x37,
+  0x3c,0x95,0x20,0x16,0x2f,0xde,0xf2,0x0f,0xb1,0x01,0x0d,0xe3,0xd7,0x59,0xcf,0x76,
+  0x61,0xa7,0x00,0xf5,0x20,0xa4,0xb2,0xe9,0x98,0x8d,0x99,0xdc,0x66,0x09,0xef,0x01,
+  0x7a,0x53,0x11,0xa3,0xc5,0x25,0x79,0x73,0x10,0xbf,0x79,0x28,0xbd,0x92,0x38,0xe3,
+  0x5c,0xc1,0x47,0x3e,0x8a,0xa8,0xb9,0x99,0xa6,0x3e,0xb0,0xcc,0x19,0xdd,0x34,0xeb,
+  0xf7,0x58,0x31,0x9a,0xc7,0x80,0xb8,0x26,0x10,0xe6,0x60,0x72,0x92,0xac,0x61,0x48,
+  0xa8,0xc8,0xb4,0x48,0x49,0xc1,0x8f,0xa4,0x69,0xb1,0x8d,0xa2,0xd4,0x85,0xd3,0x2a,
+  0xb0,0x09,0x4a,0x12,0x41,0x9f,0x22,0x89,0xb6,0x5c,0x34,0x13,0x2d,0x0e,0x64,0xef,
+  0x52,0xb6,0x47,0x44,0xfb,0x05,0x14,0x79,0x13,0xc0,0xd0,0x02,0x21,0x0f,0x1e,0x6a,
+  0x98,0xb8,0x4e,0x06,0xa7,0xc5,0x73,0x65,0xfa,0x5e,0x30,0x5e,0xfe,0x6c,0x03,0xad,
+  0x98,0x5d,0xa6,0xe6,0x60,0x59,0x3b,0x03,0x83,0xaf,0x95,0x15,0x9a,0x44,0x9b,0x11,
+  0xa1,0xd7,0x9e,0x4a,0xed,0x59,0xb4,0x71,0x30,0x32,0x01,0xaa,0x1c,0xd0,0x5a,0x80,
+  0x7e,0x06,0x1d,0xb7,0x0a,0xf5,0xc9,0xa0,0x3d,0x3e,0xdb,0x00,0x5c,0xf7,0xe3,0x44,
+  0x82,0x0e,0xe3,0x0b,0x57,0x61,0xda,0x0c,0x9a,0x9e,0xad,0xd1,0x67,0xa2,0x59,0xcc,
+  0xb2,0xee,0x5e,0xec,0xe6,0x32,0x8b,0x61,0xc4,0x57,0x83,0x6f,0xd8,0x35,0x1d,0x1e,
+  0x09,0x35,0x13,0xed,0x3a,0xc4,0xec,0x5b,0x74,0xd7,0xbb,0x04,0x86,0x94,0xb6,0x8e,
+  0x8e,0xde,0x8d,0x2a,0x9e,0x83,0x59,0x03,0x42,0x6f,0x55,0x85,0x71,0xe0,0x89,0x97,
+  0x73,0x20,0xd6,0xae,0x6e,0xda,0x2c,0xb5,0x79,0x47,0xba,0x22,0x27,0xec,0xe6,0x2c,
+  0xcd,0x79,0x5c,0x74,0x13,0xde,0x52,0x51,0x37,0xe7,0xac,0x42,0xa1,0x09,0x45,0xc9,
+  0x69,0x6d,0xd3,0xb4,0xe1,0x32,0x7d,0x9d,0xd8,0xfc,0x1c,0x47,0xf4,0xa1,0xc9,0x17,
+  0x86,0xdd,0x06,0xa6,0x0a,0xb8,0xba,0x60,0x04,0x8e,0x00,0x24,0xff,0xa9,0x50,0xf9,
+  0x66,0x5c,0xcd,0xa2,0xbc,0x71,0xf1,0x90,0x92,0xbb,0x7b,0x34,0x55,0x4c,0x80,0x41,
+  0x02,0xea,0x46,0x2a,0xd5,0xf5,0x14,0xab,0xdd,0xc5,0x68,0x75,0x82,0x61,0xb1,0x82,
+  0x56,0x9d,0xac,0xe6,0xfe,0x69,0x3f,0xa9,0xbc,0x89,0x94,0x9f,0x91,0x8f,0x5f,0x0e,
+  0x5f,0x12,0x84,0xe4,0x70,0x75,0x83,0xf0,0xbc,0x83,0x30,0x29,0xb3,0x91,0x71,0x20,
+  0xc5,0xc6,0xcd,0x0e,0x13,0xbe,0x76,0x99,0x68,0xf5,0x1a,0x5a,0x86,0x51,0x0f,0xd5,
+  0x93,0xff,0x81,0xfa,0x4d,0x8d,0xa0,0x95,0x4b,0xd1,0x0e,0xa0,0x14,0x9a,0x8c,0x4b,
+  0xe5,0xaf,0x03,0x39,0x6a,0x89,0xbf,0x22,0x45,0xb1,0x69,0x72,0x00,0xa2,0x8d,0x12,
+  0xe6,0x86,0x9a,0x7a,0x57,0x71,0xbc,0x5c,0xd4,0xa7,0x1e,0x0e,0xf0,0x8b,0x98,0x92,
+  0xce,0x5c,0x96,0x89,0x16,0x8d,0x68,0xb0,0x84,0x04,0xb7,0x75,0x69,0x52,0xc2,0xc3,
+  0x8d,0x48,0x4d,0x77,0xc2,0xe6,0xf7,0x04,0x17,0x93,0x5e,0x22,0x03,0xc5,0xd2,0x45,
+  0x0a,0x98,0x7c,0xf6,0x42,0x9c,0x9b,0xf4,0xad,0x16,0x3b,0x33,0x8d,0xd6,0x94,0x6e,
+  0x41,0x97,0xd4,0x68,0x99,0xba,0x21,0x8c,0x76,0x32,0xe3,0xcd,0x65,0xa0,0x44,0x93,
+  0x72,0x34,0xa8,0x46,0x45,0x1d,0xc0,0x37,0xe8,0xc4,0x55,0xfc,0x98,0x93,0x8e,0xab,
+  0x82,0x9f,0xa0,0xab,0x0f,0xcb,0x26,0x77,0xb2,0xf5,0xc4,0xb7,0xfa,0x10,0x97,0x44,
+  0x2d,0x8d,0x46,0x83,0x6c,0x1f,0xbf,0x52,0x8f,0xf6,0x25,0x45,0x29,0x5d,0x95,0x88,
+  0xd5,0xc6,0x42,0x55,0x85,0x66,0x7e,0xf7,0xb7,0x55,0xde,0x0c,0xc6,0xc5,0xc6,0xe4,
+  0x9e,0x2b,0xac,0x05,0xcd,0x9e,0xf3,0x01,0x95,0xcf,0x8d,0xa3,0x94,0xe9,0xf7,0x2f,
+  0x4b,0x08,0xf5,0x57,0x91,0x6d,0xce,0xb5,0x1a,0x20,0x4e,0x71,0x96,0xcf,0xf4,0xa5,
+  0xdd,0x95,0xda,0xc4,0x5b,0xd7,0x81,0xdf,0xb9,0x9f,0x69,0xdd,0xae,0x42,0xee,0x7b,
+  0x88,0x88,0x65,0x9a,0xca,0x97,0xdc,0x3a,0x9e,0x39,0x81,0x69,0xd8,0xac,0xb7,0x16,
+  0xc1,0xa6,0x1f,0x6e,0xcf,0x30,0xb2,0xf2,0x57,0x61,0xcb,0x31,0x8d,0xca,0xfc,0xd3,
+  0x2d,0xa5,0x69,0xe6,0x46,0x96,0x96,0x92,0x58,0xde,0xa2,0xab,0x79,0xcd,0xb1,0x38,
+  0x83,0x0e,0x0d,0xd5,0x30,0xec,0xec,0x54,0xde,0x7b,0xaa,0x9f,0x13,0x77,0xa0,0xe5,
+  0x76,0x2f,0x4d,0xdc,0x13,0xd1,0x8d,0x50,0x3a,0x90,0xa9,0x7b,0xc4,0xb0,0x6d,0x5a,
+  0xd0,0x37,0xec,0x3b,0x98,0xd1,0x04,0x81,0xed,0x6a,0x2c,0x7e,0x29,0x54,0x1d,0x03,
+  0xbb,0x1c,0xba,0xaf,0x4e,0xf3,0x75,0x48,0xff,0x16,0x92,0xb7,0x67,0x99,0xdc,0x13,
+  0xed,0xcc,0xf2,0x5c,0xee,0x95,0xad,0x20,0x71,0x5d,0x85,0xce,0x1e,0xa0,0x69,0x88,
+  0x6b,0xf9,0x78,0xd1,0xc6,0xa6,0xbb,0xbb,0x99,0xfe,0x86,0xe1,0x21,0xc0,0x34,0x68,
+  0x0b,0x2c,0x4d,0x9b,0xb8,0xd9,0xe2,0x7c,0x0e,0x6a,0x12,0xe0,0xf3,0x7d,0x59,0x41,
+  0x8b,0x35,0xdc,0xf0,0x7b,0x71,0xf9,0xb6,0xec,0xfd,0x2e,0x5e,0x59,0x0e,0x25,0x7c,
+  0xdb,0xde,0xf2,0xa1,0xad,0x30,0x68,0x3b,0x01,0x28,0x01,0xee,0xa4,0xff,0xd3,0x02,
+  0xc3,0x02,0xb0,0x2d,0x7b,0x6d,0xbb,0xe3,0x52,0xaf,0x30,0xa3,0x47,0x49,0x03,0xd5,
+  0xc1,0x34,0xa5,0x24,0x4b,0x48,0x35,0x61,0xb9,0xce,0xcf,0x3d,0x77,0x09,0xc3,0x98,
+  0x23,0xb0,0x9a,0x51,0xa9,0x34,0x3c,0x03,0x1e,0xc3,0x34,0x2e,0x60,0x77,0x1c,0xe1,
+  0x9b,0x3a,0x7d,0x7c,0x4e,0x3a,0xda,0xe5,0xd7,0x1a,0x78,0x9e,0x9b,0xe2,0x5a,0x5c,
+  0xd7,0xb6,0x5d,0xa9,0x65,0xa9,0xa6,0x96,0xa4,0xa7,0xbf,0xba,0x4e,0x4a,0xe9,0x83,
+  0xba,0xf4,0xa4,0x47,0x55,0x17,0xfb,0xd1,0xb1,0x94,0x8a,0x64,0x01,0x37,0xd7,0xa4,
+  0xe5,0xa9,0xd4,0x5c,0x42,0x56,0x93,0x96,0x9d,0x84,0xc6,0xbf,0x85,0xe0,0x42,0x2b,
+  0xbb,0xd4,0x04,0xd7,0x3f,0xa2,0x7d,0x5f,0x2a,0x56,0xb6,0x24,0x93,0x58,0xde,0xd6,
+  0x93,0xfa,0xc8,0xf2,0x80,0x49,0x9e,0x94,0xeb,0x68,0x5c,0xf4,0xf4,0xd1,0xbc,0x47,
+  0xfb,0x21,0xba,0xea,0xa4,0x82,0x26,0xec,0x85,0x4b,0xc9,0xe4,0x54,0x99,0xbe,0xc3,
+  0x77,0xe7,0x1f,0xbd,0xad,0xb0,0x3f,0x75,0xd9,0xcd,0xe5,0x3b,0x5f,0x7d,0x6f,0x56,
+  0xd6,0x24,0x50,0xff,0x70,0xd5,0xd6,0xe7,0x79,0x65,0x88,0xd6,0x5c,0x82,0xb6,0x83,
+  0xef,0x9e,0xdd,0x77,0xcb,0x95,0x19,0x3a,0x02,0xeb,0xdc,0x5c,0xf7,0xec,0xa0,0x84,
+  0xa5,0x55,0x47,0xdc,0x91,0x54,0x7a,0x17,0xcd,0x3f,0xbf,0xae,0x22,0xba,0x5d,0x93,
+  0xb5,0x76,0x0e,0x0d,0x45,0xd1,0xa2,0x77,0xf9,0xc2,0xd4,0xdb,0xb3,0x12,0x06,0x74,
+  0x0e,0xca,0xd7,0x2b,0x1b,0xf9,0xc3,0x75,0xc9,0x94,0x8e,0x36,0x4a,0xa3,0x8b,0x9e,
+  0xce,0xac,0x4b,0x25,0x68,0x3a,0x19,0x5e,0x0c,0xcd,0x37,0x82,0xee,0x4b,0xec,0x9f,
+  0x40,0x1f,0x5f,0xbc,0x8b,0xa6,0xdb,0x6a,0xd7,0x50,0x18,0x0b,0x59,0xb0,0x5b,0xb6,
+  0xb0,0xe7,0x3a,0xc3,0x7c,0x5b,0xba,0x08,0xa6,0x64,0xa4,0xb8,0x4e,0x57,0x98,0x89,
+  0x10,0xaa,0xf5,0xc4,0xe6,0x4d,0xd4,0x66,0x16,0x09,0xfd,0xea,0x16,0x62,0xdf,0x24,
+  0xc6,0xc0,0xa4,0x21,0xb4,0x95,0xcf,0x88,0xd8,0xd4,0x5a,0x89,0xa5,0xde,0x57,0x5d,
+  0x36,0x34,0xf9,0xc8,0x61,0x92,0x3e,0x57,0xe8,0x46,0x9c,0x63,0x5b,0xd8,0xe1,0x28,
+  0x33,0x21,0x45,0x91,0xd6,0x97,0x30,0xb5,0x60,0xbd,0x85,0xd8,0xb4,0x20,0xd7,0xa9,
+  0x6a,0xa4,0x9f,0x32,0x43,0x96,0x82,0x99,0xe6,0x87,0xab,0x7a,0xff,0xa1,0x6b,0xa0,
+  0x8a,0x46,0x74,0xaa,0x84,0x5d,0x6e,0x4b,0xae,0x88,0x75,0x8f,0x91,0x59,0x56,0xca,
+  0x99,0x75,0xc5,0xb1,0x73,0xeb,0xd3,0xe9,0x0e,0x5f,0xdc,0x23,0x87,0xc6,0xe5,0x10,
+  0xf3,0xf8,0xde,0x29,0xbb,0x14,0x4b,0xa0,0xa3,0xa9,0xb1,0xb1,0x2e,0x84,0xa2,0x9a,
+  0x13,0x7f,0xf7,0x51,0xa4,0xe9,0x4c,0x18,0x04,0x28,0x53,0x44,0x3b,0x63,0xe6,0x54,
+  0x58,0x9f,0x8f,0x30,0x02,0x5a,0x6d,0x25,0x34,0x1e,0x50,0xaa,0x2d,0x9a,0x4c,0x43,
+  0x63,0xc9,0x62,0x3a,0xe0,0x98,0x35,0x58,0x93,0x30,0xb1,0xfa,0xe3,0x29,0x09,0x9d,
+  0x2c,0xa5,0x93,0x31,0x5f,0x25,0xf5,0x47,0x8a,0x66,0x0e,0x55,0x31,0x98,0xef,0x6d,
+  0xd0,0x02,0xb1,0xf2,0x06,0xeb,0x51,0x25,0x7b,0x80,0xda,0x52,0x52,0x8d,0xa5,0xea,
+  0x1c,0xa4,0x96,0x55,0xa7,0x95,0x64,0xdd,0x53,0xd2,0xbd,0x12,0x1d,0x46,0x41,0xc7,
+  0x48,0xb4,0x13,0xbe,0xab,0xcf,0x3a,0x8f,0xd0,0xab,0x82,0xf2,0x8e,0xc6,0x5e,0x4c,
+  0x17,0xa4,0x19,0xaa,0xc6,0x7f,0x6a,0x97,0xe9,0x1c,0x9c,0xa6,0x53,0x0c,0xf6,0x77,
+  0xf5,0xc5,0x90,0xe6,0xc6,0x38,0x5e,0x6f,0x45,0x2f,0xb3,0xba,0x82,0xb2,0xa6,0x5d,
+  0xd2,0xa6,0x94,0xb4,0x6d,0xa5,0xe0,0xf2,0x6d,0x3f,0x73,0x6c,0x83,0xe6,0x15,0xb4,
+  0xe2,0x12,0x65,0xb0,0x6c,0xfe,0xd3,0xf6,0x93,0xda,0x5e,0xc2,0xdd,0xd3,0xb2,0x8a,
+  0xac,0x07,0xa6,0x13,0x3f,0xd1,0xea,0x13,0x89,0x3b,0xd9,0x7f,0x92,0x53,0x49,0x6b,
+  0x98,0x79,0x3e,0x3e,0x63,0xd6,0x8b,0x2a,0x11,0xa6,0x41,0x5d,0x00,0x70,0xd7,0xa3,
+  0x39,0x4d,0xf2,0x2e,0x8a,0xc6,0x1b,0xd7,0xf1,0x5f,0x68,0xa8,0x15,0x08,0x95,0x55,
+  0xaa,0x1e,0x43,0x69,0x7a,0x19,0x9e,0x2c,0x59,0xff,0xa0,0xa1,0x1f,0x0c,0xfb,0xd9,
+  0x89,0x39,0x1d,0x27,0xe4,0x99,0x28,0xcb,0x10,0xca,0x0c,0xc9,0xa6,0x06,0x3d,0x11,
+  0xf5,0xe3,0x28,0x07,0x0a,0x66,0x10,0xe0,0x09,0xb0,0x54,0xa5,0x0d,0x87,0xb6,0x37,
+  0x39,0x33,0x8b,0xf8,0x6c,0x19,0xb8,0x92,0x50,0x5b,0xbf,0x12,0x19,0xb0,0x94,0x88,
+  0xf3,0x4a,0x74,0x2c,0xfa,0x22,0x49,0xf3,0x3f,0xa8,0xbf,0x81,0xe6,0x1e,0xe8,0xe9,
+  0x17,0x4d,0x0c,0xa6,0x81,0xbc,0x67,0x37,0x5a,0x67,0x31,0xbb,0xc6,0x0a,0xca,0x3b,
+  0xaa,0x61,0x32,0x2d,0x68,0xc8,0x9f,0xf5,0xc7,0xf5,0x7b,0xcc,0xf6,0x58,0x0b,0x32,
+  0xe6,0x33,0xb5,0xc0,0x14,0xcd,0x75,0x8e,0x09,0xbf,0x19,0xc0,0x44,0xe7,0x7f,0xf3,
+  0x37,0xcc,0x61,0x53,0xc5,0x3a,0x87,0x0c,0xf9,0x34,0xcb,0xf7,0xcc,0xff,0xbb,0x53,
+  0x62,0xd6,0x96,0xea,0xa0,0x68,0xe9,0xa3,0x19,0x2a,0xc4,0xc8,0x23,0xbb,0x45,0x32,
+  0x7a,0x60,0x78,0x05,0x63,0x41,0x59,0x36,0xfd,0x6e,0xd7,0x62,0x6c,0x3d,0xe0,0x20,
+  0xe5,0x2a,0x40,0xf6,0x81,0xf5,0x36,0xae,0xe4,0xb7,0x88,0xc7,0x84,0x9f,0x21,0x4a,
+  0x46,0x7b,0x96,0x0c,0x19,0x32,0xf3,0xbf,0xa2,0x01,0xcb,0x3d,0xef,0x7a,0x7e,0x4c,
+  0x2a,0x2e,0xec,0x93,0x85,0xa1,0x5d,0xc5,0xbf,0xb0,0xa1,0xfb,0x82,0x5b,0x9a,0x15,
+  0xfc,0xd9,0x62,0x5c,0xce,0x6f,0x45,0x7f,0x5a,0x3a,0xa0,0x85,0x5f,0x39,0x1f,0xb0,
+  0xa8,0xc0,0x46,0x83,0x03,0xfe,0xe5,0x7d,0xac,0x0b,0x79,0xd8,0x5d,0x64,0xb2,0x97,
+  0x89,0x59,0xc3,0xcf,0xe1,0x80,0x2e,0x93,0xbd,0xdb,0x9b,0x75,0xfc,0xe2,0xea,0x57,
+  0x70,0xc1,0xb0,0x7f,0x0d,0x61,0xbb,0x7f,0x90,0xec,0x24,0xae,0xa3,0x68,0xae,0xff,
+  0x32,0x4b,0x1d,0x2e,0x28,0x5c,0xf7,0x7f,0x15,0xff,0x22,0x7e,0x16,0x32,0x37,0xcd,
+  0x08,0x59,0xf0,0x61,0x57,0xf5,0x2f,0xf3,0x37,0xad,0x07,0x2c,0x79,0x62,0xd6,0xef,
+  0x31,0x0d,0x60,0x53,0xc8,0x32,0x80,0x41,0x7f,0xf1,0xc0,0x02,0xde,0xf2,0x80,0xb9,
+  0xfd,0xd8,0xf3,0x74,0x69,0x97,0xee,0x97,0xf5,0x5b,0xbd,0xbf,0xe4,0xdf,0x0a,0x7f,
+  0x6b,0xfa,0xed,0xc2,0xd0,0x2c,0xe0,0xad,0xe6,0x2f,0xf3,0xb2,0x15,0xf5,0xd6,0xed,
+  0x75,0x6f,0x79,0x97,0xf9,0xbf,0x5d,0xd2,0x83,0x98,0xbd,0x61,0xb8,0xb3,0xbc,0xd1,
+  0x6d,0xd6,0xc7,0x6a,0x8f,0x49,0x9f,0xe5,0x1c,0x7f,0x05,0x97,0x32,0x34,0x8b,0xf8,
+  0xd6,0xf2,0x2d,0xf4,0xb2,0x3b,0x90,0x32,0xb9,0xb0,0x8b,0xfa,0x17,0xf0,0x87,0x59,
+  0xdd,0xb7,0xa6,0xc7,0xc8,0xdc,0xc2,0x30,0xe8,0x59,0xd0,0xe8,0xd2,0xee,0x40,0x32,
+  0xdd,0xbb,0x85,0x81,0xd0,0xd5,0x89,0x81,0xd0,0xbd,0xb9,0x59,0xb5,0x83,0xe4,0x59,
+  0xcc,0x5b,0xd3,0x83,0xe4,0x89,0x6d,0xb9,0xb3,0x58,0xb1,0x5b,0xca,0x63,0xea,0x6f,
+  0x66,0x20,0x6e,0x69,0x20,0x72,0x69,0x65,0x68,0x74,0x0a,0x2e,0x68,0x63,0x69,0x68,
+  0x77,0x20,0x74,0x61,0x68,0x74,0x20,0x73,0x69,0x68,0x20,0x6f,0x74,0x20,0x65,0x68,
+  0x36,0x83,0x89,0x66,0x5b,0xe5,0x3e,0xf1,0xfb,0xbb,0x2a,0x31,0x00,0x00,0x00,0x00,
+  0x25,0x6f,0xe1,0x59,0xc1,0xc5,0xfa,0xe9,0x00,0xc2,0x00,0xc8,0x00,0x20,0xc6,0x19,
+  0xa0,0x88,0x8f,0x05,0xc1,0x1f,0x58,0x86,0x21,0xb0,0x37,0x5a,0xa4,0x00,0xf6,0xd0,
+  0x4a,0xc8,0xc2,0x79,0x56,0x38,0xdf,0x3c,0x77,0x2d,0x0d,0x24,0x05,0x04,0xd1,0x00,
+  0xa9,0x01,0x02,0xba,0xbf,0xf0,0x12,0xc6,0x56,0x38,0x97,0x01,0xf0,0xac,0xff,0xa0,
+  0x76,0x40,0x08,0x6d,0xa0,0x65,0x00,0x08,0x80,0x0a,0x00,0x00,0x00,0x00,0x00,0x04,
+  0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x01,0x00,0x01,0x00,0x00,0x00,0xe7,0x0b,0x21,0x2b,0x43,0xd8,0x02,0x91,0x68,0xde,
+  0xc0,0x86,0x19,0x60,0x7f,0x04,0x16,0x3e,0x22,0x80,0x58,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x06,0x50,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x9d,0xd2,0x56,0xee,0x89,0x2c,0xfd,0x81,
+  0x57,0xdf,0xdd,0xee,0x51,0x0c,0x60,0x81,0xd9,0x9c,0x3c,0x8a,0xff,0xfe,0x3c,0x00,
+  0x57,0x00,0x49,0x00,0x4d,0x00,0x3e,0x00,0x3c,0x00,0x54,0x00,0x4f,0x00,0x54,0x00,
+  0x41,0x00,0x4c,0x00,0x42,0x00,0x59,0x00,0x54,0x00,0x45,0x00,0x53,0x00,0x3e,0x00,
+  0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x32,0x00,0x3c,0x00,0x2f,0x00,0x54,0x00,
+  0x4f,0x00,0x54,0x00,0x41,0x00,0x4c,0x00,0x42,0x00,0x59,0x00,0x54,0x00,0x45,0x00,
+  0x53,0x00,0x3e,0x00,0x3c,0x00,0x49,0x00,0x4d,0x00,0x41,0x00,0x47,0x00,0x45,0x00,
+  0x20,0x00,0x49,0x00,0x4e,0x00,0x44,0x00,0x45,0x00,0x58,0x00,0x3d,0x00,0x22,0x00,
+  0x31,0x00,0x22,0x00,0x3e,0x00,0x3c,0x00,0x4e,0x00,0x41,0x00,0x4d,0x00,0x45,0x00,
+  0x3e,0x00,0x31,0x00,0x3c,0x00,0x2f,0x00,0x4e,0x00,0x41,0x00,0x4d,0x00,0x45,0x00,
+  0x3e,0x00,0x3c,0x00,0x44,0x00,0x49,0x00,0x52,0x00,0x43,0x00,0x4f,0x00,0x55,0x00,
+  0x4e,0x00,0x54,0x00,0x3e,0x00,0x30,0x00,0x3c,0x00,0x2f,0x00,0x44,0x00,0x49,0x00,
+  0x52,0x00,0x43,0x00,0x4f,0x00,0x55,0x00,0x4e,0x00,0x54,0x00,0x3e,0x00,0x3c,0x00,
+  0x46,0x00,0x49,0x00,0x4c,0x00,0x45,0x00,0x43,0x00,0x4f,0x00,0x55,0x00,0x4e,0x00,
+  0x54,0x00,0x3e,0x00,0x31,0x00,0x3c,0x00,0x2f,0x00,0x46,0x00,0x49,0x00,0x4c,0x00,
+  0x45,0x00,0x43,0x00,0x4f,0x00,0x55,0x00,0x4e,0x00,0x54,0x00,0x3e,0x00,0x3c,0x00,
+  0x54,0x00,0x4f,0x00,0x54,0x00,0x41,0x00,0x4c,0x00,0x42,0x00,0x59,0x00,0x54,0x00,
+  0x45,0x00,0x53,0x00,0x3e,0x00,0x33,0x00,0x32,0x00,0x37,0x00,0x36,0x00,0x38,0x00,
+  0x3c,0x00,0x2f,0x00,0x54,0x00,0x4f,0x00,0x54,0x00,0x41,0x00,0x4c,0x00,0x42,0x00,
+  0x59,0x00,0x54,0x00,0x45,0x00,0x53,0x00,0x3e,0x00,0x3c,0x00,0x43,0x00,0x52,0x00,
+  0x45,0x00,0x41,0x00,0x54,0x00,0x49,0x00,0x4f,0x00,0x4e,0x00,0x54,0x00,0x49,0x00,
+  0x4d,0x00,0x45,0x00,0x3e,0x00,0x3c,0x00,0x48,0x00,0x49,0x00,0x47,0x00,0x48,0x00,
+  0x50,0x00,0x41,0x00,0x52,0x00,0x54,0x00,0x3e,0x00,0x30,0x00,0x78,0x00,0x30,0x00,
+  0x31,0x00,0x44,0x00,0x44,0x00,0x35,0x00,0x46,0x00,0x37,0x00,0x38,0x00,0x3c,0x00,
+  0x2f,0x00,0x48,0x00,0x49,0x00,0x47,0x00,0x48,0x00,0x50,0x00,0x41,0x00,0x52,0x00,
+  0x54,0x00,0x3e,0x00,0x3c,0x00,0x4c,0x00,0x4f,0x00,0x57,0x00,0x50,0x00,0x41,0x00,
+  0x52,0x00,0x54,0x00,0x3e,0x00,0x30,0x00,0x78,0x00,0x30,0x00,0x39,0x00,0x36,0x00,
+  0x33,0x00,0x43,0x00,0x45,0x00,0x35,0x00,0x42,0x00,0x3c,0x00,0x2f,0x00,0x4c,0x00,
+  0x4f,0x00,0x57,0x00,0x50,0x00,0x41,0x00,0x52,0x00,0x54,0x00,0x3e,0x00,0x3c,0x00,
+  0x2f,0x00,0x43,0x00,0x52,0x00,0x45,0x00,0x41,0x00,0x54,0x00,0x49,0x00,0x4f,0x00,
+  0x4e,0x00,0x54,0x00,0x49,0x00,0x4d,0x00,0x45,0x00,0x3e,0x00,0x3c,0x00,0x4c,0x00,
+  0x41,0x00,0x53,0x00,0x54,0x00,0x4d,0x00,0x4f,0x00,0x44,0x00,0x49,0x00,0x46,0x00,
+  0x49,0x00,0x43,0x00,0x41,0x00,0x54,0x00,0x49,0x00,0x4f,0x00,0x4e,0x00,0x54,0x00,
+  0x49,0x00,0x4d,0x00,0x45,0x00,0x3e,0x00,0x3c,0x00,0x48,0x00,0x49,0x00,0x47,0x00,
+  0x48,0x00,0x50,0x00,0x41,0x00,0x52,0x00,0x54,0x00,0x3e,0x00,0x30,0x00,0x78,0x00,
+  0x30,0x00,0x31,0x00,0x44,0x00,0x44,0x00,0x35,0x00,0x46,0x00,0x37,0x00,0x38,0x00,
+  0x3c,0x00,0x2f,0x00,0x48,0x00,0x49,0x00,0x47,0x00,0x48,0x00,0x50,0x00,0x41,0x00,
+  0x52,0x00,0x54,0x00,0x3e,0x00,0x3c,0x00,0x4c,0x00,0x4f,0x00,0x57,0x00,0x50,0x00,
+  0x41,0x00,0x52,0x00,0x54,0x00,0x3e,0x00,0x30,0x00,0x78,0x00,0x30,0x00,0x39,0x00,
+  0x36,0x00,0x33,0x00,0x43,0x00,0x45,0x00,0x35,0x00,0x42,0x00,0x3c,0x00,0x2f,0x00,
+  0x4c,0x00,0x4f,0x00,0x57,0x00,0x50,0x00,0x41,0x00,0x52,0x00,0x54,0x00,0x3e,0x00,
+  0x3c,0x00,0x2f,0x00,0x4c,0x00,0x41,0x00,0x53,0x00,0x54,0x00,0x4d,0x00,0x4f,0x00,
+  0x44,0x00,0x49,0x00,0x46,0x00,0x49,0x00,0x43,0x00,0x41,0x00,0x54,0x00,0x49,0x00,
+  0x4f,0x00,0x4e,0x00,0x54,0x00,0x49,0x00,0x4d,0x00,0x45,0x00,0x3e,0x00,0x3c,0x00,
+  0x2f,0x00,0x49,0x00,0x4d,0x00,0x41,0x00,0x47,0x00,0x45,0x00,0x3e,0x00,0x3c,0x00,
+  0x2f,0x00,0x57,0x00,0x49,0x00,0x4d,0x00,0x3e,0x00
+};
+
+static const Byte kLzfse[2812] =
+{
+  0x50,0x4b,0x03,0x04,0x14,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x21,0x58,0xa0,0x82,
+  0x4a,0xac,0x8a,0x0a,0x00,0x00,0x00,0x80,0x00,0x00,0x08,0x00,0x00,0x00,0x64,0x61,
+  0x74,0x61,0x2e,0x74,0x78,0x74,0x62,0x76,0x78,0x32,0x00,0x80,0x00,0x00,0x08,0x01,
+  0x10,0x08,0x00,0xa0,0x03,0x20,0xe5,0x6d,0x75,0x46,0xf1,0x5c,0x09,0x20,0xa9,0x00,
+  0x00,0x00,0x3f,0x0c,0x30,0x00,0x8f,0xc1,0x56,0x55,0x01,0x00,0x14,0x81,0x44,0x55,
+  0x54,0xaf,0x9e,0x80,0x0b,0x04,0x15,0x8d,0x49,0x93,0x8e,0x31,0xc6,0x18,0x73,0xce,
+  0xb9,0x4e,0x2e,0x0e,0xe6,0xd1,0xcd,0x3e,0xb8,0x3b,0x3a,0xda,0x67,0x07,0x27,0xf3,
+  0x62,0x24,0x2b,0x02,0x00,0x00,0x30,0x00,0x00,0x38,0x04,0x00,0x00,0x00,0x00,0xe0,
+  0xa9,0x00,0x00,0x00,0x7e,0x00,0x0e,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xe0,0xb9,0x78,0x00,0xc6,0xe1,0x6b,0x70,0xcf,0xbf,0xf1,0x64,0x00,
+  0xe3,0x1f,0x78,0x2e,0xe0,0xfe,0xf8,0xa1,0x38,0x18,0x87,0xfc,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xf0,0xfb,0x62,0x48,0xf9,0x68,0x89,0x87,0xf4,0xef,0x48,0xd7,0x32,0x88,0x54,
+  0xb4,0x52,0xfc,0x69,0x07,0xda,0x20,0xf2,0x8d,0x90,0x42,0x42,0xc8,0x52,0x00,0x91,
+  0xee,0x1b,0x96,0xc5,0x0e,0xdc,0xd0,0xc3,0x92,0x3e,0x93,0xf8,0xc6,0x23,0xb7,0x2c,
+  0xfc,0x51,0x8c,0x23,0x2e,0xce,0x05,0x11,0xdd,0x81,0x90,0xfa,0x78,0x76,0x2e,0xff,
+  0x5f,0xf7,0xee,0x59,0x55,0x04,0x2a,0x30,0x62,0xde,0xa4,0xda,0x65,0xb2,0x1a,0x2e,
+  0x50,0x17,0xc5,0x00,0x52,0x82,0xed,0x46,0x2d,0x14,0xa8,0xe8,0x25,0x1d,0xc3,0x0b,
+  0x29,0x58,0x7a,0x7e,0xf5,0x92,0x3b,0xc6,0x6a,0xe3,0xdf,0x2a,0x68,0xc6,0x8a,0x2d,
+  0x93,0x2b,0xd5,0xf7,0x3c,0xcd,0x80,0xad,0x00,0x84,0xf0,0xbd,0xa0,0x01,0xca,0x04,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x81,0x61,0x33,0x37,0x13,0x1c,
+  0xb2,0x7b,0xcd,0xf9,0xa4,0x26,0x93,0x3a,0xd5,0x0c,0x13,0xaf,0x90,0x30,0x23,0xdb,
+  0x4c,0xcb,0x46,0x71,0x29,0x33,0xab,0x50,0x65,0xf0,0x95,0x28,0x42,0x30,0x3b,0x0a,
+  0x96,0xec,0x4e,0x17,0xae,0x06,0x11,0x58,0x8d,0x0a,0x61,0x76,0xf5,0x99,0xa7,0xd3,
+  0xa3,0x81,0xa5,0x86,0x8b,0xf0,0x21,0x04,0x63,0xa7,0xa8,0xe4,0xf8,0x99,0x66,0x06,
+  0x42,0x48,0x52,0xd5,0x2e,0x33,0xa6,0x8b,0xc9,0x10,0x25,0x09,0x49,0x34,0xef,0xea,
+  0x4c,0x2d,0x71,0xc1,0x55,0xd3,0x1c,0xc9,0x59,0x98,0x8c,0x52,0x7b,0x40,0x09,0xb0,
+  0x55,0x4f,0x3c,0xdd,0x51,0x30,0x73,0x01,0x9d,0xe7,0x96,0x96,0x90,0x30,0x43,0xe7,
+  0xf9,0x01,0x61,0xe0,0xa1,0x55,0xac,0x60,0xdb,0xf8,0x37,0xdf,0xc3,0xbc,0xde,0x51,
+  0x5f,0xed,0xaf,0x10,0x28,0x18,0x7d,0xaa,0x2e,0xea,0x8c,0xb9,0x8c,0xed,0xce,0x3a,
+  0xaa,0xad,0xb6,0x0f,0x70,0x61,0x05,0x70,0x4b,0x55,0x3b,0x0b,0xac,0x5f,0xd2,0x48,
+  0x8d,0x4d,0xcd,0xad,0x01,0xcb,0x2e,0x56,0x92,0xe8,0xdd,0x85,0xe2,0xfe,0xed,0x8a,
+  0x42,0x8b,0x25,0xd8,0x69,0xb0,0x26,0x6c,0x51,0x05,0x71,0x4a,0xb8,0x10,0x44,0x02,
+  0x30,0xf3,0x83,0x90,0x10,0x2c,0x92,0xcf,0x39,0x6e,0xd6,0xf9,0x8a,0x00,0x77,0x57,
+  0x57,0x16,0x0b,0xbe,0x50,0x64,0x43,0xf2,0xfa,0x16,0x50,0xba,0x4d,0x18,0x4b,0x49,
+  0x54,0xf9,0x37,0xa7,0x4a,0x02,0x2c,0x3d,0xf8,0xa8,0x3e,0xd7,0x79,0xe5,0xd1,0x8a,
+  0x3a,0x30,0xd5,0xae,0x5f,0x30,0xa0,0x7e,0x8b,0xc6,0x67,0xd3,0xa5,0x8f,0x94,0x6d,
+  0x2e,0xc0,0x4a,0xe5,0x90,0x04,0x29,0x70,0xd7,0xc7,0xae,0x76,0x03,0xbc,0x8f,0xbf,
+  0x31,0x7c,0x84,0xd8,0x8f,0xce,0x0e,0xe8,0xec,0x02,0xa4,0xa8,0x7d,0x36,0x42,0x34,
+  0xa3,0x0b,0xbd,0xc5,0x6c,0xeb,0x71,0x5b,0x85,0xaf,0x1f,0xea,0xeb,0xab,0x31,0xce,
+  0x00,0xc9,0x04,0x82,0x82,0xfa,0x9c,0xed,0x02,0x16,0xd8,0xd1,0x6c,0x01,0xfd,0x1c,
+  0xc4,0x83,0x68,0xc8,0x97,0x07,0x83,0x68,0xee,0xb8,0x39,0x47,0x1b,0xf0,0xa0,0xfa,
+  0x98,0xb9,0x90,0x72,0xcc,0xa9,0xad,0x9a,0x9b,0x02,0x3a,0x8e,0x8c,0xad,0x57,0x15,
+  0x74,0x80,0xe5,0xf8,0x53,0xc2,0xac,0x51,0x4e,0x9d,0x37,0xc4,0x2d,0x57,0xc7,0xeb,
+  0xb0,0x0a,0x09,0xbc,0xdd,0x54,0x82,0x1e,0x48,0x41,0x16,0xff,0x67,0xa7,0xde,0x7e,
+  0x75,0x95,0x40,0xd3,0xbe,0x5b,0x81,0xe7,0x3a,0x41,0x91,0x0c,0xe8,0x9b,0xb2,0xdf,
+  0x25,0x04,0xcd,0xe3,0x78,0xf3,0x02,0x19,0xb4,0x4a,0x67,0x5b,0x32,0x09,0x2c,0xc7,
+  0xe9,0x00,0x0c,0x0f,0xed,0x65,0x53,0x91,0x27,0x8c,0xdd,0xbe,0x5f,0x03,0x47,0xa1,
+  0xc8,0x0c,0x0f,0xa9,0x14,0x79,0xaa,0x00,0xa8,0x19,0xdd,0x66,0x77,0xe3,0x5c,0xb2,
+  0x85,0x9b,0x02,0x1b,0x58,0xd0,0x21,0x17,0xbe,0x73,0xce,0x01,0x01,0x51,0x5a,0xac,
+  0xdf,0x8e,0x8d,0x5a,0x6f,0x83,0x34,0x27,0xe5,0xa5,0x8c,0x1d,0x6d,0xda,0x43,0xc8,
+  0x80,0x5b,0x26,0x26,0x0b,0x1a,0xa1,0xa2,0x93,0xa4,0x39,0x0b,0xb3,0x9f,0x0d,0x7c,
+  0x81,0xbb,0x28,0x7e,0x21,0xe4,0xe6,0xf4,0xc1,0xa8,0x08,0x09,0x39,0x25,0x23,0x83,
+  0x48,0xd1,0xe8,0x37,0xac,0x4a,0xa1,0x97,0x20,0x60,0x81,0x80,0x0a,0x12,0x90,0x64,
+  0x25,0xc7,0x31,0xb2,0x95,0x47,0x35,0x94,0xa6,0x3f,0xab,0xd1,0x8e,0xcc,0x6c,0xae,
+  0x44,0x3d,0x00,0x14,0x08,0x6f,0x10,0x64,0xa3,0x73,0x96,0xbd,0x0b,0x15,0xae,0xfd,
+  0xf2,0xf5,0x36,0x61,0xb2,0xc4,0x87,0xd2,0x2c,0x44,0xe3,0x6c,0x25,0x18,0xc2,0xb8,
+  0x89,0xf2,0xac,0x33,0x7b,0x50,0xc3,0xd9,0x4d,0xc9,0x92,0xe3,0xce,0x9b,0x18,0x94,
+  0xa4,0xd6,0x55,0x51,0xeb,0x4b,0xdb,0x7a,0x00,0x16,0xfe,0x09,0xe0,0x30,0x9e,0x39,
+  0x43,0x09,0x90,0x22,0xe0,0x7c,0xc9,0xa2,0x6e,0x2d,0x85,0x54,0x00,0x2b,0xf1,0x56,
+  0xba,0xde,0x21,0x70,0xbd,0x56,0x95,0x6a,0x6e,0x30,0xf6,0x8a,0xb0,0xd1,0x52,0x16,
+  0x3d,0x69,0xce,0x68,0x78,0x3f,0x68,0x03,0x4e,0x8a,0x07,0x14,0xdc,0xb3,0x63,0x36,
+  0x20,0xd2,0x10,0xe6,0xa1,0x66,0x2d,0x28,0x93,0x87,0x60,0x00,0x82,0x15,0x8b,0xdc,
+  0x56,0x26,0x81,0x86,0x5c,0xab,0x69,0x54,0x85,0x5d,0x1a,0x02,0x67,0xdb,0xdd,0xb0,
+  0xd7,0xe3,0x14,0x50,0x54,0x50,0x5c,0x3d,0x11,0x18,0x27,0x93,0x14,0x16,0x2b,0x60,
+  0xf2,0xa7,0x29,0x09,0x32,0x55,0x3b,0xad,0xbd,0xd9,0x44,0xcc,0x92,0x8f,0xc5,0x88,
+  0x75,0x03,0x01,0x47,0x8b,0xa3,0xb5,0xe3,0x10,0x15,0xb9,0x48,0xad,0x24,0xa5,0x83,
+  0x4a,0x91,0x96,0xd7,0x82,0xc7,0xbf,0x2f,0x0e,0x9f,0x92,0x68,0x3c,0x0e,0x04,0x06,
+  0xab,0xdc,0x09,0x24,0x20,0x41,0x76,0x1e,0xb9,0xc2,0x30,0x1a,0x0b,0x7c,0x95,0x34,
+  0xea,0xb0,0x57,0x35,0x28,0xb4,0x41,0xc8,0x08,0xdd,0xf2,0xa6,0xa1,0x54,0x20,0x7a,
+  0x90,0x02,0x14,0x2f,0x34,0xb0,0x14,0xce,0xdb,0xb5,0xb9,0x71,0xa5,0x0a,0x4d,0x20,
+  0x8e,0x00,0x88,0x24,0xc0,0xd1,0x9a,0xe0,0x85,0xbb,0x64,0x05,0x6f,0x0f,0x0a,0x79,
+  0x7d,0xa1,0x0a,0x92,0x11,0xbd,0xfd,0x9d,0x16,0x52,0x88,0x4a,0xfc,0x40,0x05,0x7a,
+  0x87,0x81,0xb2,0x28,0xef,0x38,0xb9,0x4f,0x8b,0x24,0x40,0xbc,0x10,0xab,0x5b,0x6b,
+  0xf0,0x3d,0xe1,0x62,0xd8,0xc4,0x01,0x08,0xaa,0xf6,0xed,0x4f,0x2d,0x15,0x48,0x85,
+  0x2f,0x74,0xf2,0x28,0xd9,0xaa,0x4e,0x0c,0xb2,0x48,0x41,0x18,0x3d,0x37,0x66,0xa1,
+  0x51,0xf6,0x12,0x07,0x4b,0x4c,0x09,0xb3,0x2e,0x0d,0x7c,0x0c,0xf8,0xd1,0x7c,0xc9,
+  0xa3,0xd4,0x6b,0xd7,0x20,0x14,0x08,0x3b,0xe7,0x22,0x18,0xf9,0x31,0xaf,0x31,0x67,
+  0x09,0x67,0xad,0xd2,0x1b,0xeb,0xd5,0xd3,0x48,0x2a,0x2f,0x6c,0xf5,0x93,0x1b,0xfa,
+  0x5d,0x36,0xa4,0x4e,0x3c,0x11,0x7a,0x58,0xcd,0x61,0x36,0x68,0x28,0x60,0x75,0x94,
+  0x90,0x08,0x52,0xca,0x1d,0xc3,0xd3,0x31,0x0c,0x75,0x7a,0x64,0x1d,0x42,0x8d,0xf7,
+  0x0e,0x98,0x59,0xda,0x9a,0x87,0xe6,0xc0,0xd8,0x8f,0x49,0x70,0x98,0xa5,0x4e,0xca,
+  0x0c,0x60,0x02,0x18,0xa2,0x59,0xe4,0xed,0x8e,0x48,0x26,0x01,0x50,0x1d,0x0d,0x48,
+  0x1d,0x6c,0x0d,0x8e,0x06,0x46,0xcd,0xad,0x09,0x19,0x49,0xb7,0xbf,0xc0,0xd8,0x47,
+  0x6d,0xe0,0x6e,0xd3,0x3d,0x79,0xf9,0x97,0xfe,0x20,0x87,0x23,0xcc,0x09,0x03,0xef,
+  0xf5,0xd6,0x61,0x99,0x04,0x7d,0x19,0x75,0x13,0x44,0x1d,0xf0,0x05,0x08,0xdc,0xc2,
+  0xa5,0xcc,0xac,0x09,0x0e,0xfa,0xa1,0xeb,0x30,0x44,0x50,0x9f,0x76,0x5c,0x9c,0x41,
+  0xb9,0xc0,0xf2,0x20,0x77,0x70,0x0d,0xc5,0x2c,0x85,0xef,0xea,0x94,0x70,0xfd,0x69,
+  0x59,0x8d,0x98,0xfc,0xdf,0xdb,0x1e,0x43,0x73,0xa5,0x85,0xcd,0x80,0xb6,0x83,0x07,
+  0x7c,0xeb,0x59,0x09,0xae,0xc0,0x71,0x61,0xce,0x0f,0x53,0xa0,0x29,0xc2,0x6b,0xa8,
+  0x09,0x24,0x51,0x2a,0x98,0xa9,0x66,0x17,0xc6,0xd5,0x05,0x6f,0x4d,0x9e,0x7a,0x55,
+  0xb3,0x28,0x2e,0x8d,0x4f,0xd4,0xd7,0x98,0x0f,0x8b,0x77,0x5e,0xc0,0x85,0x84,0x90,
+  0x06,0x29,0x80,0x2e,0x0c,0x66,0x72,0x6d,0x3c,0x64,0xdc,0x33,0xaa,0xa0,0x5d,0xdc,
+  0x4b,0xfa,0xfe,0x38,0xab,0x1b,0x36,0x07,0x29,0x3a,0x53,0x2a,0xd0,0x41,0xcd,0xcf,
+  0xd3,0x32,0x41,0x0b,0x18,0x28,0x5f,0x2b,0x0a,0x75,0x15,0x01,0x59,0xfe,0x19,0xb7,
+  0x99,0xc2,0x3c,0x61,0x90,0xa4,0x08,0x0a,0x80,0xb4,0x29,0xb7,0xfa,0x32,0x0a,0xc4,
+  0xda,0xad,0x39,0x08,0xd2,0x8b,0x9d,0x25,0x34,0x04,0xa1,0xd7,0x0f,0x4a,0xe8,0xe9,
+  0x32,0x43,0xd2,0xb5,0x87,0x9c,0x94,0x51,0x50,0x8c,0x9b,0x40,0x70,0xf5,0x04,0x58,
+  0x1c,0x1f,0xc5,0xa0,0xd7,0x6f,0xb0,0x7f,0x24,0x43,0x8b,0x82,0x52,0xf6,0xba,0x5f,
+  0x16,0x39,0x0c,0x63,0xd1,0xbc,0x93,0x2c,0x05,0x00,0x83,0x96,0x83,0x97,0xfb,0x59,
+  0x07,0x64,0x81,0x38,0xdd,0xd4,0x2c,0x5a,0xee,0x47,0xe9,0xfd,0x08,0xa1,0x5a,0x03,
+  0xc2,0x30,0x14,0x5a,0x5c,0x30,0x00,0x9d,0xa6,0x91,0xc8,0x3b,0x7d,0xf3,0xe3,0x07,
+  0x55,0x0f,0x18,0x7a,0xea,0x7b,0x50,0x98,0xb5,0x70,0x48,0x72,0x8f,0xba,0x1a,0xfa,
+  0x45,0xce,0xb9,0x11,0x4d,0x4b,0xbf,0x9a,0xef,0x40,0x13,0x84,0xba,0xb8,0xcf,0x4d,
+  0x1b,0x40,0x02,0x1c,0x28,0x40,0x11,0x77,0x15,0x05,0xbb,0x89,0xc6,0xf1,0x4e,0x04,
+  0x16,0xf3,0x07,0x66,0x07,0xa5,0x3a,0xc8,0x7f,0x75,0xe6,0x04,0xf6,0xa5,0x3c,0x4b,
+  0x0a,0x82,0xb7,0x4a,0x5f,0x3e,0xc8,0xd0,0x6b,0xa1,0x8c,0x1a,0x38,0xbf,0xc0,0xac,
+  0x84,0x70,0xf5,0xf7,0x61,0x02,0xa7,0x19,0x76,0x81,0x2e,0x29,0x89,0x80,0x32,0x10,
+  0x39,0x0d,0x8d,0x00,0x75,0xad,0x7b,0xc8,0x93,0xf9,0x7e,0x87,0x86,0xe0,0xeb,0xa7,
+  0xec,0x0a,0x92,0xbc,0xdf,0x0a,0xb6,0xbd,0xe0,0x7e,0x19,0x51,0xb4,0xdd,0x92,0xbe,
+  0xcb,0xc8,0x3b,0x1d,0xdf,0xc2,0xd4,0xbe,0x32,0x54,0xed,0x4e,0xeb,0xd6,0x32,0x2d,
+  0x86,0x11,0x35,0x34,0x06,0x27,0x19,0x7a,0x7b,0x7d,0xa8,0xc0,0x66,0xb9,0x29,0xa8,
+  0x12,0x0a,0x3a,0xa6,0x70,0x39,0x88,0xe3,0xc3,0xfe,0xc9,0x33,0xc9,0x11,0xf4,0x2a,
+  0x19,0xd8,0xda,0xf2,0xe2,0xa6,0x59,0x38,0x22,0x3f,0x68,0xfa,0x08,0xc6,0x4e,0xcd,
+  0x23,0x60,0x7a,0xcc,0x38,0xf9,0x15,0xbe,0x78,0xc1,0x11,0x5a,0x9b,0x12,0xaf,0x5e,
+  0x8f,0xc5,0xc0,0x37,0x43,0xdd,0x23,0x30,0x13,0x70,0xb9,0xf7,0xb9,0x10,0xcf,0x09,
+  0x74,0xb9,0x0f,0x4e,0x84,0x33,0x0a,0x47,0x60,0x60,0x4f,0xe6,0xdb,0x19,0x36,0x1b,
+  0xd6,0x8a,0x95,0x1c,0xb6,0x61,0x61,0x87,0xbb,0x58,0x7a,0xa1,0x06,0x48,0xaa,0x22,
+  0x9a,0x51,0x5b,0xff,0xa6,0x57,0xc8,0x3e,0x08,0x91,0x96,0x32,0xa7,0x37,0x85,0x86,
+  0xc1,0x19,0x12,0xcc,0x74,0x90,0xc6,0xdd,0xde,0x38,0x4e,0x65,0x44,0x84,0x09,0xac,
+  0x8d,0x39,0x94,0xfa,0xf9,0x2b,0x18,0xf5,0x5c,0x86,0x33,0x86,0x4c,0x84,0x7b,0xf0,
+  0x12,0x29,0xf3,0x51,0xb9,0x99,0xde,0x8a,0xd9,0x19,0x44,0x21,0xb4,0x78,0x35,0x29,
+  0x44,0x9d,0xf8,0x01,0x38,0x0b,0x7d,0x04,0x7b,0x91,0xd9,0x00,0x93,0x83,0x5e,0x8e,
+  0x68,0x4c,0xd1,0x60,0x4d,0xf1,0x80,0xd1,0x5f,0xc3,0x83,0xe2,0x4c,0x58,0x46,0x1a,
+  0x35,0x4f,0x19,0xcc,0x0d,0x1b,0xf4,0x39,0x41,0x7c,0x3a,0xdd,0x09,0xe4,0x7b,0x71,
+  0x76,0xb2,0x01,0x01,0x32,0x9c,0xd4,0x36,0x64,0x0b,0x40,0x36,0x93,0xe1,0xc4,0xd7,
+  0x62,0x41,0xf9,0xbe,0x2e,0xf7,0x42,0xeb,0x64,0x8f,0x87,0x97,0x05,0xbb,0x27,0x26,
+  0xc8,0x9a,0xac,0xba,0xaf,0xc7,0x46,0xe2,0xfc,0x67,0xaf,0x88,0x0b,0x1f,0xf6,0x4b,
+  0x45,0xe1,0xdd,0x40,0x13,0x63,0x0a,0x86,0xd3,0x5c,0xae,0x2e,0x01,0x20,0x81,0x7f,
+  0xf3,0xa9,0xc1,0x73,0xdd,0xeb,0xfd,0xca,0xde,0x55,0xb9,0xc0,0xe3,0x16,0xb9,0x56,
+  0x06,0x96,0xb8,0x35,0x48,0x7d,0x4d,0x34,0x35,0xe1,0x06,0x38,0xec,0x49,0x80,0x33,
+  0xb2,0x11,0x50,0x8e,0x34,0x7e,0x8c,0xab,0x3d,0x9b,0x04,0x68,0xe1,0x76,0x18,0x61,
+  0x31,0x9f,0x4e,0xd7,0xf5,0x49,0x2d,0x7a,0x83,0xde,0xd0,0xcc,0xc5,0x30,0x18,0xdc,
+  0xff,0xc0,0xa4,0x6e,0x6d,0x48,0xa0,0x0d,0xe1,0xf8,0x01,0x84,0x37,0xe1,0xb8,0x45,
+  0x30,0xca,0x63,0x1c,0xa0,0x25,0x3d,0x06,0x20,0x44,0x1c,0x7a,0x77,0x7a,0x3b,0xd5,
+  0x7c,0x2c,0x6b,0x10,0x82,0xd8,0x26,0x77,0x78,0x25,0xd9,0x68,0xc5,0xda,0xbb,0x44,
+  0xe7,0xec,0xc9,0x0b,0x19,0x8a,0x65,0x94,0x2f,0x01,0xea,0x4f,0xdb,0xbf,0x56,0x0d,
+  0x39,0x85,0x16,0x08,0xab,0x8a,0xdd,0xd7,0x5b,0x1e,0x83,0x9c,0x56,0xf9,0xb3,0xca,
+  0x2b,0xcd,0x7d,0x48,0x2c,0xb6,0xd1,0xdd,0x55,0x49,0xd4,0xe4,0x5c,0x24,0xdc,0x83,
+  0x2f,0xc7,0xbc,0xc0,0xc0,0xf1,0x0a,0x9d,0x8c,0xf5,0xd3,0xae,0x37,0xf6,0x12,0x7f,
+  0x98,0x03,0xbd,0xff,0x8d,0x3a,0xab,0x8c,0x93,0xb2,0xa1,0x30,0x28,0x7a,0x3d,0x5f,
+  0x47,0xf5,0x1b,0x81,0xe1,0x0c,0x20,0x40,0x6a,0x8d,0x15,0x42,0xf4,0x5e,0x26,0x0f,
+  0x23,0x12,0x0e,0xec,0x3a,0x5d,0x2c,0x98,0x22,0xe5,0x6c,0x44,0xb7,0x85,0x99,0x91,
+  0xf5,0xc0,0x9e,0x4f,0x81,0x0e,0x15,0xc5,0x2c,0x07,0x49,0x82,0x02,0x4f,0xaf,0xf2,
+  0xe5,0x57,0x01,0x22,0x72,0x03,0xeb,0x41,0xa2,0xd9,0xfb,0x96,0x7e,0xb3,0xd4,0x6b,
+  0xdd,0x4f,0x63,0xb7,0x58,0x8f,0xa1,0x43,0xe7,0xda,0x01,0x73,0xc0,0xc5,0xb5,0x4d,
+  0x4a,0x7a,0x9b,0x6c,0x7a,0xa9,0xdf,0x33,0x9c,0x02,0x02,0xc0,0x35,0xb9,0x79,0xd5,
+  0x0c,0xeb,0xee,0x46,0x53,0x40,0xa2,0xe5,0x48,0x82,0xc2,0xd4,0x56,0x28,0xe4,0x1a,
+  0x18,0x13,0x01,0x82,0xc5,0x10,0xab,0xf6,0x67,0x60,0x18,0x49,0xe2,0xc9,0x9d,0x03,
+  0x43,0x91,0xee,0x1e,0xba,0x81,0xf2,0xe1,0x46,0xb2,0xbc,0xb6,0x38,0x6c,0xa1,0x32,
+  0xea,0xa7,0x62,0xe0,0xb4,0x41,0xee,0x4b,0x59,0x9b,0x07,0x27,0xfe,0x1f,0xfb,0x27,
+  0x54,0xad,0x08,0x51,0xd9,0xe6,0xe2,0xc2,0xbe,0xd3,0x86,0xa0,0x4d,0x3a,0x44,0x38,
+  0xad,0x15,0xe8,0x11,0x64,0x20,0x19,0x86,0xf8,0x53,0xac,0x0a,0x0f,0xf3,0x33,0xa8,
+  0x87,0x55,0xab,0xcc,0xa0,0x8d,0xd8,0x07,0x43,0x98,0x89,0xb5,0x21,0x6a,0x43,0xaa,
+  0x84,0x5e,0x18,0xdf,0xc0,0xa9,0xbc,0x25,0x58,0x69,0x64,0x1d,0xcc,0xae,0x98,0x99,
+  0xa2,0x6e,0x5c,0x21,0xa4,0x2a,0x2c,0x52,0x0a,0x8a,0x60,0xf0,0xb1,0x1d,0xd7,0x5a,
+  0xd6,0x2b,0x2c,0x67,0x08,0x72,0x10,0xe9,0xb5,0x4b,0x09,0xf8,0x9e,0x11,0x33,0x06,
+  0x69,0x31,0x79,0xaf,0x35,0x36,0x58,0x21,0xc6,0xd5,0x70,0x84,0xd9,0x21,0xa8,0x5f,
+  0x18,0x15,0x64,0xe7,0xe1,0x2c,0x04,0xa1,0x01,0x60,0x41,0xa1,0x02,0xb9,0x20,0x19,
+  0xad,0xa1,0xde,0x62,0x91,0x2c,0xbc,0xbb,0xd0,0x46,0x11,0x17,0x84,0xc6,0xb0,0xfd,
+  0x10,0xc3,0xd8,0x9c,0x0b,0xc2,0x1a,0x90,0x1b,0x40,0xf0,0x61,0x29,0x6b,0x78,0x47,
+  0x59,0x36,0x60,0x5f,0x6a,0x12,0x78,0xab,0x75,0x9b,0x25,0x48,0x1e,0xc3,0x59,0xa8,
+  0xb1,0x83,0x80,0x3b,0x5e,0x1a,0x90,0x40,0x0a,0x5d,0x0c,0x81,0x5d,0x4a,0xf5,0xf8,
+  0x42,0xb6,0x09,0x88,0x83,0xc1,0xe7,0x00,0xf9,0xe2,0x09,0x58,0xcb,0xe4,0x07,0x72,
+  0xf0,0x33,0x74,0x15,0xd8,0xb7,0x03,0xc6,0x0c,0x7a,0x52,0x5c,0x84,0x98,0x10,0xc8,
+  0x23,0x36,0xf9,0x1a,0x42,0x1e,0xba,0x96,0xc5,0x8d,0x62,0xc1,0x22,0xc9,0xca,0x31,
+  0x2e,0x3b,0xc6,0x37,0x82,0x7d,0x61,0xae,0x04,0x7a,0x8b,0xc0,0x43,0x84,0x4b,0x00,
+  0x84,0x1f,0xf4,0xf7,0x63,0x80,0x73,0x04,0xfc,0x8d,0x81,0x2f,0x67,0xa5,0x41,0x76,
+  0x71,0x9a,0xc6,0xc8,0xf7,0x15,0xe6,0x15,0x6c,0x5b,0x90,0xdd,0x08,0x77,0x8b,0x81,
+  0x8f,0x33,0x70,0xb7,0x52,0x38,0x83,0x03,0x27,0x08,0xe5,0x06,0x62,0x76,0x78,0x24,
+  0x50,0x4b,0x01,0x02,0x14,0x00,0x14,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x21,0x58,
+  0xa0,0x82,0x4a,0xac,0x8a,0x0a,0x00,0x00,0x00,0x80,0x00,0x00,0x08,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x61,
+  0x74,0x61,0x2e,0x74,0x78,0x74,0x50,0x4b,0x05,0x06,0x00,0x00,0x00,0x00,0x01,0x00,
+  0x01,0x00,0x36,0x00,0x00,0x00,0xb0,0x0a,0x00,0x00,0x00,0x00
+};
+
+static const Byte kImplode[2776] =
+{
+  0x50,0x4b,0x03,0x04,0x14,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x21,0x58,0xa0,0x82,
+  0x4a,0xac,0x66,0x0a,0x00,0x00,0x00,0x80,0x00,0x00,0x08,0x00,0x00,0x00,0x64,0x61,
+  0x74,0x61,0x2e,0x74,0x78,0x74,0x2a,0x98,0x05,0xf8,0x48,0x03,0xa8,0x05,0x08,0x05,
+  0xf8,0xf8,0xf8,0x18,0x03,0x05,0x07,0x06,0x04,0x05,0x08,0x03,0x04,0x28,0x07,0x04,
+  0x03,0x18,0x16,0x04,0x06,0x07,0x06,0x08,0x05,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,
+  0x98,0xb7,0x22,0x34,0x06,0x17,0x06,0x08,0x07,0x08,0x06,0x05,0x07,0x16,0x14,0x03,
+  0x14,0x03,0x35,0x07,0x16,0x15,0x06,0x05,0x06,0x15,0x06,0x04,0x06,0x24,0x06,0x35,
+  0x76,0x17,0x18,0x07,0x26,0x03,0x1b,0x02,0x23,0x64,0x25,0x04,0x06,0x55,0x06,0x05,
+  0x06,0x15,0x96,0x07,0x16,0x07,0x06,0x27,0x26,0x07,0x06,0x07,0x08,0x36,0x27,0x06,
+  0x07,0x08,0x17,0x77,0xff,0xcb,0xf9,0x77,0x1b,0xfc,0xcb,0x7d,0xcb,0xef,0xbf,0x5b,
+  0xdf,0x3b,0x9d,0x2f,0x77,0xdf,0x86,0xfe,0xb6,0xfe,0xf1,0x61,0x78,0x27,0xfa,0x94,
+  0xf8,0x9c,0x89,0x1c,0x72,0x32,0xfa,0x56,0x9f,0x48,0x9f,0xa3,0xaf,0xf1,0xb9,0x9e,
+  0xe5,0x4f,0x06,0x96,0xff,0x56,0xbe,0xb7,0xdf,0xbf,0x2d,0x77,0x06,0xf5,0xfe,0xd6,
+  0x61,0x8d,0x77,0xab,0x4f,0xe1,0xcf,0x87,0xfc,0x01,0xfb,0xf1,0x86,0xf6,0xdf,0xbf,
+  0x23,0x7c,0x7a,0x7e,0x42,0x7e,0xde,0x7d,0x3a,0x77,0xd8,0x32,0x63,0x7d,0x97,0x7b,
+  0xa7,0x3d,0xe4,0x72,0x66,0x20,0xef,0x67,0xfc,0xa9,0x3e,0x0e,0xc5,0x8e,0xd1,0x19,
+  0xf0,0xf8,0xc4,0xfa,0xed,0x04,0x1f,0x4a,0x9f,0x30,0x9f,0xf7,0xf5,0x76,0xff,0x54,
+  0xd8,0xc9,0xb2,0x43,0xf0,0x93,0xfe,0x83,0xe4,0x63,0x5b,0x9c,0xde,0xfd,0x5f,0x09,
+  0x77,0xc2,0x7c,0x02,0xef,0x80,0x7a,0xd7,0xdb,0xe6,0xbe,0x9d,0x6f,0xbb,0xe1,0xe7,
+  0x64,0x34,0x13,0x5e,0xf6,0x21,0xf8,0x90,0xfd,0x78,0x32,0x6f,0xd4,0xcb,0x5e,0x87,
+  0x67,0xd0,0x1f,0x92,0x1f,0x36,0x3b,0xd0,0x77,0x70,0xcd,0xdc,0x65,0x36,0x5a,0xf4,
+  0xb0,0x9e,0xf6,0x6d,0x16,0xd2,0x79,0x07,0xee,0xfb,0x74,0x2e,0x7f,0xd5,0xfa,0xf3,
+  0xac,0x6c,0x6f,0x0b,0xee,0x42,0x38,0x7f,0x4e,0x76,0x8a,0x37,0xbb,0xee,0x23,0x81,
+  0xe9,0xc4,0x1f,0x88,0x87,0x70,0xee,0xae,0xd2,0x5d,0x6f,0x64,0xe6,0x7b,0x96,0x2a,
+  0xaa,0x7e,0x92,0x7f,0x78,0x76,0x53,0xfe,0xdc,0x56,0x83,0x61,0xe1,0xcc,0x90,0xfc,
+  0xb8,0x6f,0x18,0xf7,0x83,0xa5,0xbb,0xf9,0xc7,0x48,0xe4,0x5d,0x65,0x06,0xc5,0x36,
+  0x8c,0x69,0x33,0xb8,0x37,0xcc,0xd2,0x18,0xdf,0x71,0x3e,0xb5,0x3f,0xec,0xfb,0x0c,
+  0xb7,0x49,0xed,0x40,0x2d,0x10,0xc2,0x0b,0xe9,0xd9,0x63,0x75,0x7f,0xdb,0x41,0xb7,
+  0xe3,0xe4,0x8e,0x55,0xc9,0x64,0xad,0x00,0x5d,0x45,0xe9,0x08,0x57,0x4d,0x85,0xe6,
+  0x65,0x73,0x75,0x29,0x3a,0xd1,0x36,0x96,0xcf,0x0d,0xe8,0xcd,0x6a,0xa6,0x7b,0xe9,
+  0x83,0x46,0x13,0x75,0xd6,0x21,0xa5,0xc8,0xf8,0x6e,0xf0,0xc1,0x15,0x3b,0x57,0x37,
+  0xa4,0x37,0xd1,0xed,0x74,0xef,0x86,0x1f,0x82,0xb5,0x61,0x9f,0xcd,0xbf,0x8d,0x2f,
+  0x3d,0xca,0xdf,0x21,0x8f,0xb1,0x60,0x66,0x83,0x84,0xbd,0xe1,0xb3,0x3b,0x65,0xb2,
+  0xdd,0xef,0x75,0xfd,0x1b,0xd4,0x64,0x38,0x11,0xa3,0xd0,0x54,0x2d,0xa7,0x93,0x55,
+  0x96,0x42,0x85,0x4e,0x27,0xf6,0x24,0x3d,0x10,0x1e,0xd3,0x70,0x3e,0xc7,0x43,0xa7,
+  0x8f,0xd2,0x98,0xf0,0xc5,0x72,0x5b,0x2a,0xe5,0x74,0xc5,0x22,0x1b,0x86,0x64,0x5d,
+  0x9f,0x32,0x92,0x41,0xe6,0x25,0x2c,0xba,0xfb,0x28,0x64,0x46,0xb1,0x4c,0x0d,0xf7,
+  0x1d,0xc3,0x66,0x1b,0xce,0xd4,0x76,0x40,0x1a,0x29,0x3b,0x58,0x3c,0xa8,0x4b,0x8c,
+  0x63,0x62,0x58,0xc3,0xfa,0x03,0xa0,0xb2,0x3d,0x0b,0xa8,0x86,0x8b,0x5e,0xd5,0x40,
+  0x5a,0x1d,0xd6,0xd6,0xb8,0xc7,0x06,0x3b,0xc5,0xda,0x07,0x85,0x78,0xf0,0xe6,0x0a,
+  0x08,0xd9,0x0c,0x90,0x33,0x38,0x74,0xc7,0x60,0xb3,0xac,0xd2,0x71,0x57,0x49,0x40,
+  0xd7,0x44,0x52,0xa2,0xd1,0x45,0x8a,0x95,0x58,0xd7,0x96,0x93,0x5e,0x27,0x3f,0x7e,
+  0xdc,0x02,0xff,0x83,0x4f,0xe7,0xb4,0x0a,0x81,0x52,0x23,0x68,0x70,0x8f,0xb1,0xe8,
+  0x12,0xbc,0x55,0x90,0x91,0x16,0x40,0xb4,0x23,0x6e,0xa5,0x19,0xc8,0x38,0xcd,0x24,
+  0x3a,0x19,0x85,0x94,0x2f,0xe0,0x2c,0x4f,0x61,0x31,0xe0,0x5a,0x55,0xfb,0xa3,0xfc,
+  0xed,0xcb,0xbb,0x98,0x27,0xef,0x41,0xc8,0xd7,0xa9,0x57,0xaf,0xa0,0x39,0x9f,0x9c,
+  0x89,0xcb,0x3e,0xd0,0x9b,0x45,0x42,0x49,0xba,0x36,0x4f,0xed,0x12,0x9d,0x13,0x08,
+  0x97,0x4c,0xa8,0x5a,0x00,0xf5,0x18,0xc7,0xfb,0xd0,0xb7,0x80,0xb3,0x13,0x48,0x75,
+  0xc6,0x66,0x32,0x75,0x95,0x3c,0xd1,0xdd,0xf2,0xbb,0x9b,0x14,0xd9,0xdb,0xda,0xe2,
+  0xc9,0x6e,0x55,0x0a,0x22,0x54,0x5b,0x17,0x82,0xe9,0xe0,0x19,0xaf,0x36,0x4f,0xeb,
+  0x0e,0xcb,0xd6,0xdc,0xea,0x3e,0xb8,0x74,0x25,0x17,0x1c,0x48,0x3f,0xe2,0x6a,0x30,
+  0x91,0x60,0x5a,0x74,0xe8,0xaf,0x01,0xba,0xce,0xa4,0x26,0x51,0xd4,0x35,0x8f,0x53,
+  0xb2,0x26,0x11,0x61,0xf9,0x0a,0x5c,0x8d,0x4b,0x48,0x81,0xd9,0x5c,0x37,0x0f,0x87,
+  0x4f,0x86,0x81,0x93,0x76,0x80,0x4e,0x69,0xa6,0xcd,0xe2,0x12,0x56,0x80,0x85,0xbe,
+  0x11,0x9a,0xce,0x31,0x77,0x92,0x5d,0xef,0xb3,0xbc,0x99,0x14,0x11,0x62,0x06,0xe3,
+  0xc8,0xd8,0x58,0xde,0x43,0x65,0x68,0xb5,0xe5,0x6f,0x73,0xfc,0x5b,0xcd,0xe7,0x30,
+  0xcd,0x0c,0xbe,0x32,0x59,0xd0,0x1c,0xe8,0xc5,0x77,0xde,0x5c,0xc9,0x4a,0x45,0xd1,
+  0xfc,0x93,0x32,0x12,0xf1,0xb3,0x9c,0x70,0xf8,0x9a,0x0d,0x14,0x0f,0x8d,0x45,0xc0,
+  0x13,0x55,0x21,0xc3,0x26,0xeb,0x83,0x3a,0x83,0x82,0x27,0xe8,0x18,0x16,0xbd,0x91,
+  0x30,0xa7,0x3e,0x72,0xc9,0x00,0xd3,0xe8,0x58,0x49,0xb7,0xcd,0x24,0x99,0x18,0x9e,
+  0x28,0x03,0x87,0x96,0x2d,0x74,0x11,0x4f,0xcb,0x5c,0x06,0x5f,0x4b,0xb5,0xbc,0x37,
+  0x2c,0x96,0x0f,0xff,0xed,0x6b,0x94,0x18,0x20,0xb8,0xe2,0x25,0x1d,0xe7,0xce,0x76,
+  0x8b,0x3a,0xcb,0x64,0xa9,0xd5,0x83,0xcf,0xc4,0x3e,0xd6,0x94,0x4b,0xd7,0x5d,0x0f,
+  0xd9,0x67,0xeb,0xd3,0x13,0xc0,0xad,0x02,0x26,0xeb,0x2f,0x3f,0x99,0x13,0x30,0x74,
+  0xd9,0x61,0x19,0x63,0xa3,0x5d,0x67,0x35,0x0d,0xc5,0x61,0x9a,0x50,0xf9,0x2d,0xbc,
+  0xae,0x4b,0xe6,0x1c,0xf7,0xe5,0xd8,0x12,0x09,0x21,0x20,0x10,0x96,0x42,0xd2,0x8e,
+  0xd7,0x13,0x11,0xe8,0x3d,0x6f,0x44,0x4d,0x90,0xcb,0xf9,0x29,0x20,0x2e,0x32,0x4d,
+  0x3c,0x63,0x0d,0x49,0x38,0x5b,0xe5,0x5d,0x56,0xb7,0x39,0x8d,0x93,0x5f,0xa0,0x4a,
+  0x26,0xa0,0x6a,0x4c,0x31,0xcb,0x07,0x27,0x38,0x0f,0x78,0x67,0x75,0xa7,0x4e,0xc5,
+  0xbb,0x16,0xb2,0x53,0x92,0x08,0x4a,0x16,0xf5,0xa0,0x90,0x32,0x99,0x35,0x5b,0xa6,
+  0x2a,0xcd,0x22,0x59,0x07,0x01,0x1e,0x24,0x23,0x41,0x8a,0x47,0x35,0x40,0x40,0xc9,
+  0x51,0x12,0x87,0x53,0x28,0xf8,0x99,0x45,0x25,0x50,0x30,0x80,0xb1,0xe5,0xa4,0xaa,
+  0x39,0xdc,0xeb,0xd6,0x6a,0x96,0xf4,0x02,0x5c,0xcd,0x32,0x8e,0x77,0x3f,0x01,0xde,
+  0xf1,0x74,0x39,0x8b,0x70,0x4d,0x06,0x22,0x5e,0xa4,0x83,0x92,0x3f,0x09,0x11,0xa3,
+  0x1d,0x02,0xd9,0x34,0x35,0x8b,0x71,0x70,0x51,0x6b,0x01,0x00,0xce,0x7e,0x38,0x74,
+  0xa6,0x6f,0xc0,0x53,0x68,0xa7,0xb6,0xa4,0x27,0x80,0x0c,0x3a,0xb0,0x78,0xa8,0xcc,
+  0xb3,0x56,0x32,0x6c,0x11,0x79,0xf7,0xa1,0xfb,0xa5,0x5e,0x89,0x3a,0x93,0x50,0xd0,
+  0xac,0x5c,0xb4,0xd2,0x76,0x3a,0xb1,0xc0,0x6c,0x81,0xa2,0xbd,0xd6,0xa2,0x51,0xed,
+  0xbb,0xfe,0x78,0xf4,0x41,0x47,0x2d,0x01,0x4e,0xd6,0x89,0x2f,0x1d,0x45,0x70,0x24,
+  0x0a,0x18,0x0e,0x31,0x9f,0x4d,0x0a,0x90,0x18,0xc1,0xa4,0x16,0xb0,0x46,0x69,0x18,
+  0x99,0x4e,0xf4,0x9b,0x22,0x06,0xc8,0x68,0x44,0x92,0xb0,0x16,0xd4,0xd1,0x01,0x41,
+  0x9b,0x54,0xd4,0x2a,0x8c,0x29,0xf2,0x36,0x1e,0x79,0x8e,0x80,0xbd,0x04,0xf4,0x3a,
+  0x43,0x9f,0x23,0xd9,0xfa,0x37,0x40,0xec,0x82,0x4d,0x8d,0xf6,0x01,0x29,0x35,0x38,
+  0xd2,0x4e,0x76,0x48,0x18,0x29,0x10,0x0e,0x72,0x1c,0x17,0xca,0xb9,0x25,0x59,0x18,
+  0x1d,0xd5,0x96,0xee,0x03,0x92,0x9c,0x38,0x99,0xda,0x5e,0x05,0x81,0x56,0x09,0x98,
+  0x4b,0x41,0x3f,0x9e,0x52,0x74,0x86,0x46,0xf2,0xa3,0x81,0xb9,0x1a,0x06,0x5f,0xfa,
+  0x0b,0x06,0x0b,0x93,0x05,0x5c,0x03,0x69,0x09,0x14,0x52,0xce,0x9b,0x1f,0xa7,0xc2,
+  0x6f,0xb9,0x80,0x50,0x1c,0x5e,0x5c,0x82,0x07,0x24,0x1f,0x7a,0x0d,0x56,0xf4,0x65,
+  0x60,0x14,0x39,0xb0,0xe3,0x36,0x40,0xf0,0x40,0x53,0x57,0x00,0x1e,0x2f,0x62,0x65,
+  0xdb,0xac,0x1a,0xa4,0x48,0x24,0xae,0x96,0xf4,0x20,0x89,0xa6,0xaf,0xe2,0x84,0x24,
+  0x20,0x67,0x3d,0xdc,0x92,0xc0,0x05,0x38,0xdf,0x9a,0xe2,0x64,0xcb,0x00,0x58,0x60,
+  0xad,0x92,0xc1,0x66,0x33,0xbc,0xea,0x9a,0x5e,0x6f,0x3c,0x22,0xdb,0x7c,0xc2,0x12,
+  0x59,0x1a,0x88,0xe2,0xba,0xd9,0xbf,0x64,0x93,0xd3,0x25,0xd7,0xe3,0xdb,0x2a,0xa3,
+  0xec,0xb8,0x25,0x6f,0xa7,0x69,0x5c,0xd5,0x59,0x5e,0xe3,0x1e,0x0a,0x79,0xb0,0xe9,
+  0x22,0x19,0xa8,0x90,0x64,0x6f,0xcb,0xc0,0x01,0xb8,0xc1,0xf0,0x42,0x82,0x68,0x69,
+  0xaf,0x80,0x8a,0x62,0x12,0x34,0x55,0xae,0x7a,0x4f,0xda,0x16,0x70,0x68,0xa6,0x2e,
+  0x8b,0x48,0x78,0xcb,0x95,0x81,0xd1,0x6d,0x9e,0xc4,0x22,0x39,0x66,0x6f,0xc4,0x3c,
+  0x36,0x31,0xf0,0x39,0xd3,0x61,0x1d,0x35,0xd4,0xb9,0x72,0xc9,0xd4,0x49,0xe4,0x12,
+  0x23,0x3e,0xac,0x02,0x9d,0x6c,0x06,0xb7,0x02,0xc6,0xfe,0xc9,0xc5,0xa5,0xc0,0xd2,
+  0x50,0x50,0x5e,0xde,0xfc,0x49,0x89,0xcd,0x64,0x38,0xb2,0x22,0x6f,0xce,0xda,0x41,
+  0xb4,0x9d,0x0d,0x30,0x0b,0x1e,0xf6,0xa2,0x43,0x3a,0x02,0x59,0xb2,0xd5,0x9f,0x7b,
+  0xff,0x92,0x61,0x02,0x83,0x71,0x9e,0x26,0x38,0x66,0xde,0x04,0x9b,0x4a,0xc7,0xd5,
+  0x0a,0x1c,0x4b,0xf1,0xdd,0x28,0xc1,0xe7,0xa8,0x57,0x42,0xc7,0x3e,0xcb,0x66,0x33,
+  0xd5,0x0b,0xf7,0x13,0x0b,0x9a,0x52,0xb3,0x34,0xce,0x24,0xe3,0x5b,0xf8,0x54,0x19,
+  0x77,0x0b,0x78,0x94,0x95,0x45,0x04,0x22,0x01,0x49,0x26,0x11,0x21,0x47,0xb7,0xb9,
+  0x6e,0xf9,0x42,0x14,0x3d,0x01,0xdc,0x11,0x16,0xd3,0x66,0xdf,0x4d,0xc1,0x72,0xb1,
+  0xea,0xe3,0x05,0x08,0xf7,0x15,0x60,0x96,0x02,0x9a,0x53,0x8d,0x14,0xc4,0xbe,0xb9,
+  0x82,0xc0,0x61,0xda,0x14,0xc0,0x17,0x2b,0xed,0x08,0x28,0x9e,0x83,0xb7,0x07,0x4a,
+  0x97,0x20,0x56,0x57,0x5b,0x06,0x7a,0x15,0x91,0x15,0xe7,0xc4,0xc7,0x9b,0x0b,0xac,
+  0x8b,0x85,0xdb,0x05,0x0a,0xbb,0x1a,0xf8,0xe0,0x9c,0x39,0x3c,0xc5,0xa9,0x02,0xa4,
+  0x28,0x5a,0x05,0xdd,0xc6,0xba,0x42,0xe3,0xf4,0x5c,0x10,0x55,0xe1,0x8c,0xf4,0x45,
+  0x20,0xe0,0x1d,0x3e,0x5d,0xf3,0xae,0x51,0xc7,0xc3,0xfc,0x72,0xf0,0x25,0x11,0xbe,
+  0x37,0xb9,0x2a,0xf9,0xca,0x89,0x5c,0x00,0x17,0xed,0x3c,0xb2,0xae,0x2b,0xee,0x01,
+  0x89,0xc6,0x5c,0xf8,0x49,0x9e,0x09,0x21,0xda,0x40,0x46,0x03,0x5a,0xa0,0xcf,0x9c,
+  0xf2,0x64,0x95,0x5b,0x76,0x85,0xa8,0xc0,0x05,0xec,0x89,0xde,0x02,0x06,0xc1,0x12,
+  0xcf,0x54,0x5f,0x2e,0x86,0x81,0x67,0xe9,0x59,0x4c,0x7d,0xe6,0x52,0xb8,0xda,0xdc,
+  0x63,0x56,0xc0,0x11,0xc1,0x0c,0x33,0x03,0xa9,0x44,0x83,0x0a,0xe3,0x15,0x62,0x8e,
+  0x42,0xa4,0x9d,0x21,0x5b,0xe6,0x5f,0x53,0x77,0x1d,0xd4,0x16,0xb2,0xf4,0x80,0x35,
+  0xf1,0x1b,0xc5,0xb9,0xbe,0x40,0x4a,0xfe,0x9b,0x4c,0x95,0xa4,0x27,0x6a,0xbb,0x38,
+  0x3a,0xe8,0xe7,0x53,0xe2,0x41,0xed,0x20,0xce,0x07,0xbd,0x14,0x2e,0xb9,0x32,0xc9,
+  0xb6,0xb5,0x17,0xd0,0x27,0x23,0x55,0x3a,0xf2,0xc2,0x91,0x92,0x0a,0x74,0x85,0xb0,
+  0x4d,0x33,0x0b,0x6f,0x5b,0xb2,0x13,0xe7,0x74,0x5a,0x3e,0xd0,0x38,0x82,0xa3,0x97,
+  0xfd,0x41,0x57,0x02,0x7a,0x14,0x04,0xc3,0x81,0xa6,0xd7,0x93,0x5f,0x44,0x33,0x05,
+  0x8b,0x0d,0xa7,0x19,0x5a,0xa5,0x5c,0x76,0xa2,0x97,0x14,0x3d,0x8b,0xf3,0xa8,0x21,
+  0x79,0x95,0x03,0xdb,0x0c,0x16,0x1d,0x50,0x7b,0x21,0x08,0x86,0x4c,0x13,0xc8,0xe7,
+  0x31,0xf8,0x6c,0x8b,0x2e,0xca,0x5e,0xd4,0x0b,0xd5,0xa6,0xc8,0xe2,0x60,0xe0,0xba,
+  0x6b,0x7b,0x94,0x23,0x4f,0x16,0xf8,0x29,0xc2,0x98,0x15,0x10,0xe1,0x15,0x31,0xb6,
+  0x2a,0x1e,0x74,0x34,0x33,0x33,0xe9,0x94,0x67,0x01,0x83,0x01,0x22,0x0a,0x4e,0x2c,
+  0x01,0x08,0x74,0x01,0x18,0x00,0x54,0xc9,0x0d,0x36,0x54,0x49,0x84,0x1d,0xc1,0x55,
+  0xdb,0xc6,0xe4,0x8e,0x36,0x3c,0xda,0x0b,0x15,0x9a,0x54,0x21,0xf9,0x74,0xa3,0xaa,
+  0xb9,0x43,0x15,0x02,0xe7,0x21,0x47,0xd1,0x2b,0x67,0x35,0x1c,0x17,0x82,0x22,0x63,
+  0x27,0x97,0x29,0x8a,0xc6,0x1a,0x88,0xa1,0x26,0x1d,0xcd,0x7b,0x94,0x2c,0xce,0xd6,
+  0xc0,0x2d,0xe1,0xa9,0x12,0x0b,0x39,0x6f,0x17,0xd0,0x6a,0xc1,0x83,0x74,0xb6,0xc9,
+  0xb0,0xaf,0x91,0x24,0x9f,0x40,0xae,0xe0,0x91,0xe8,0xec,0xbc,0x5b,0x22,0x5e,0x2d,
+  0x28,0x12,0xa2,0x44,0xa4,0x2c,0x49,0xb0,0x93,0x5d,0x3d,0x97,0xdf,0xc3,0x41,0x58,
+  0x56,0x39,0x60,0x12,0xd2,0xe1,0x41,0x12,0x2d,0xd4,0x80,0x49,0xd5,0x88,0xf2,0x19,
+  0x30,0x33,0xa6,0x91,0xa8,0x1c,0x4e,0x3c,0xec,0x80,0x22,0x36,0x1a,0x5a,0x20,0x3c,
+  0x16,0x45,0x08,0x08,0x6f,0x47,0xa1,0x49,0x19,0x0e,0xa9,0x1f,0x49,0xd8,0x09,0x6e,
+  0x2e,0x87,0xa8,0x6f,0x00,0x74,0x88,0x22,0x29,0x19,0xc0,0xfc,0x02,0x03,0x98,0xf9,
+  0xd0,0xbc,0x55,0x8a,0x34,0xfb,0x0c,0x82,0xc3,0x46,0x07,0x31,0x92,0xe4,0xc9,0x77,
+  0x48,0xe9,0x34,0xf3,0x62,0x68,0xe1,0x12,0x61,0x7c,0x5a,0x40,0x0b,0x57,0x11,0x94,
+  0x0a,0x09,0x66,0xdf,0x24,0x5b,0x68,0xe8,0x25,0xa0,0xa0,0x57,0x45,0x92,0x20,0xd0,
+  0x15,0x43,0x75,0x6e,0x0e,0x4b,0x2e,0x00,0xa4,0x35,0x45,0x23,0x48,0x60,0x19,0xc9,
+  0x7f,0x78,0xdc,0x23,0xd0,0x0b,0x9d,0xfc,0x6c,0x5e,0x00,0x8b,0x0f,0x13,0xb3,0x5b,
+  0x60,0xb2,0xb6,0x03,0x08,0x47,0x9a,0x33,0xb0,0x6c,0x50,0x73,0xb1,0xee,0x9b,0xf5,
+  0xc2,0x42,0x48,0x8e,0xbf,0x16,0x54,0x14,0x42,0x30,0xd4,0x6b,0xb2,0xab,0x16,0x58,
+  0x54,0x37,0x61,0x51,0xb4,0x28,0x89,0x86,0x57,0x84,0xa3,0xcd,0x64,0xe1,0xc0,0x4e,
+  0x10,0xd6,0x45,0x5f,0x75,0x11,0xdc,0xc0,0x64,0xb9,0x3e,0x31,0x3b,0x68,0xea,0x50,
+  0xcb,0xf5,0xf0,0xd5,0xe6,0x80,0x58,0x85,0x05,0x0b,0x18,0x49,0xca,0x09,0x17,0x1d,
+  0xeb,0x9d,0x03,0xcb,0x94,0x5c,0xd8,0x2c,0xe7,0x27,0xf0,0x5c,0xe6,0x22,0x68,0x5d,
+  0xe4,0xc2,0x1e,0x4c,0x23,0xac,0x84,0x28,0x08,0x49,0x97,0x2f,0x50,0xbb,0x90,0x48,
+  0xb5,0x67,0xb3,0x89,0x3a,0x76,0x04,0xba,0x6e,0xa5,0x6b,0x62,0x14,0xd3,0x3b,0x38,
+  0x39,0x01,0xcf,0xd4,0x8a,0x66,0x15,0x55,0xe7,0x64,0xb9,0x4b,0xc0,0x42,0x3f,0x59,
+  0x01,0xab,0x64,0x9e,0x26,0x07,0xad,0xa4,0x23,0x80,0xb1,0x9c,0x53,0x5c,0x04,0xef,
+  0x0c,0x25,0xc5,0x22,0xc0,0x25,0x2a,0x16,0xa8,0x44,0x2a,0x04,0xfd,0x8c,0x91,0x2c,
+  0x8f,0x16,0xbd,0x0e,0xd5,0x5b,0xb0,0xa2,0x70,0x32,0xd4,0x47,0x52,0x2a,0xaa,0xc4,
+  0xbe,0x68,0x2f,0x80,0xe0,0xa3,0x15,0xd1,0xb0,0x94,0x5f,0x1e,0x6a,0x17,0x48,0x0a,
+  0xaf,0x41,0xc0,0x69,0x31,0x14,0x61,0x58,0x60,0x90,0xa5,0xc1,0x8b,0x0b,0x21,0xe0,
+  0x99,0x36,0x9a,0x68,0xef,0xa3,0xab,0xa7,0x40,0x0b,0x47,0x18,0x5f,0x0c,0x2b,0x0a,
+  0xd2,0x38,0x70,0x01,0xcf,0x53,0x9c,0x7f,0x00,0x83,0xbd,0xc2,0x66,0xbf,0x52,0x55,
+  0x1f,0xb7,0x14,0xc5,0x18,0x28,0xd0,0xb8,0x00,0x0e,0xde,0xe2,0xc6,0x20,0xb4,0x5b,
+  0xf4,0xad,0x99,0x9b,0x06,0x8a,0x58,0xa8,0x40,0x5a,0x78,0x6e,0x54,0x86,0x98,0x4e,
+  0xb2,0x99,0x53,0x74,0x24,0xbe,0x3f,0x0c,0x44,0x76,0x67,0x7a,0x26,0x47,0x04,0xc3,
+  0x6c,0x00,0xb5,0xe8,0xad,0xef,0x78,0x9b,0x4a,0xa2,0xad,0xc0,0x01,0x43,0xec,0x83,
+  0x9e,0x73,0x8a,0xb1,0x9a,0xf3,0x9a,0xaf,0x4e,0x62,0x2b,0x05,0x78,0x1c,0x0b,0xd6,
+  0xf4,0x34,0x69,0x3c,0xa1,0x08,0xc3,0x9d,0x23,0x0b,0xe3,0x84,0x5a,0x00,0x88,0x6a,
+  0x72,0xc2,0x13,0xf8,0xb3,0x38,0xf7,0x5c,0x7e,0x02,0xa4,0x45,0xe0,0xcf,0xaf,0xab,
+  0x2f,0x00,0x27,0xca,0x10,0x74,0x32,0xc8,0x58,0x60,0xa4,0x4d,0xe0,0xa8,0x55,0x0e,
+  0xda,0x4b,0x53,0xb0,0xfa,0x9e,0xce,0x02,0xf7,0x54,0x37,0x00,0x50,0x4b,0x01,0x02,
+  0x14,0x00,0x14,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x21,0x58,0xa0,0x82,0x4a,0xac,
+  0x66,0x0a,0x00,0x00,0x00,0x80,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x61,0x74,0x61,0x2e,0x74,
+  0x78,0x74,0x50,0x4b,0x05,0x06,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x36,0x00,
+  0x00,0x00,0x8c,0x0a,0x00,0x00,0x00,0x00
+};
+
+static const Byte kRar3[2581] =
+{
+  0x52,0x61,0x72,0x21,0x1a,0x07,0x00,0xcf,0x90,0x73,0x00,0x00,0x0d,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xb3,0x23,0x74,0x00,0x80,0x28,0x00,0xd2,0x09,0x00,0x00,0x00,
+  0x80,0x00,0x00,0x03,0xa0,0x82,0x4a,0xac,0x00,0x00,0x00,0x4a,0x1d,0x33,0x08,0x00,
+  0x00,0x00,0xa4,0x81,0x64,0x61,0x74,0x61,0x2e,0x74,0x78,0x74,0x11,0x41,0x48,0xd1,
+  0x0d,0x4c,0x00,0x00,0x00,0x15,0x3f,0xde,0x8a,0xbd,0x00,0xe9,0xea,0x7b,0x73,0xd8,
+  0xe9,0x2f,0x89,0x97,0x55,0xef,0x5f,0xa3,0xa7,0xbe,0xe7,0xcc,0xfe,0x4a,0xed,0xb6,
+  0xde,0x65,0xf7,0xa9,0x1d,0x11,0x73,0xdf,0x72,0x49,0x3d,0x99,0x78,0x92,0x42,0x0e,
+  0x9d,0x00,0xb5,0x34,0x98,0x00,0x00,0x00,0x05,0x72,0xab,0x9a,0x36,0x5d,0x32,0xd7,
+  0x4c,0xa5,0x3f,0xd6,0x5a,0xcb,0x3d,0x72,0xf5,0x94,0xff,0xa9,0x79,0x78,0x6b,0x2e,
+  0x93,0xfc,0xe5,0x3e,0xb9,0x7a,0x69,0xb7,0xfa,0xa7,0x85,0x4f,0xf9,0xf1,0xf8,0xf8,
+  0x7c,0xfd,0xb2,0xa7,0x97,0x4f,0x13,0xdb,0x2a,0x7f,0x1e,0xba,0x6b,0x97,0x9f,0xef,
+  0x5c,0xb3,0xeb,0xbf,0xee,0xcb,0xd6,0x7a,0xcb,0xc7,0x6f,0x23,0x3e,0xbf,0x8f,0xfb,
+  0x4f,0x2e,0x99,0x0e,0x75,0xc9,0x2b,0x8c,0x67,0xf9,0xe9,0x97,0xaf,0x4a,0x7f,0x8a,
+  0x61,0xf4,0xc2,0x25,0xd3,0xcb,0xc0,0x3a,0x1f,0xc7,0x6c,0x5b,0x6f,0xd3,0xf1,0x8d,
+  0x6b,0xa7,0x8e,0xdf,0x06,0x9e,0x99,0x57,0xca,0xd2,0xba,0x2b,0xdb,0x4f,0xdd,0x3f,
+  0x99,0x7c,0xce,0x95,0xfe,0xa9,0xe2,0xd3,0xe8,0x96,0x7f,0xe5,0x33,0x7a,0x68,0x5a,
+  0xe9,0x6a,0x60,0x35,0xce,0xab,0xf1,0x4f,0x5d,0xbc,0x70,0x67,0xf4,0xd8,0x54,0xfa,
+  0x2b,0xb8,0x36,0xf2,0x37,0xd7,0xbb,0x6f,0x7d,0xb5,0xf5,0x30,0x3f,0x3f,0x6f,0x1f,
+  0x7d,0xc3,0xa5,0x7f,0xaa,0xe3,0x39,0xef,0xf4,0xfb,0xee,0xae,0xbf,0x8f,0x1a,0xe5,
+  0x15,0xc2,0x6b,0xa6,0xeb,0xbd,0x28,0x8b,0xba,0x35,0xd3,0x35,0xe0,0xbd,0xd3,0x5e,
+  0x5f,0x1a,0x6e,0xbb,0x9f,0x6c,0x73,0xcb,0xc2,0xf6,0x73,0x4c,0xaf,0x4e,0xbb,0xfe,
+  0x6d,0x7e,0x76,0xe5,0x32,0x7f,0x3e,0x9b,0xff,0xd6,0xdc,0x77,0xed,0xb2,0x01,0xae,
+  0x45,0xf3,0x82,0x6d,0xcc,0xfb,0x70,0xab,0x24,0x7a,0x86,0x4c,0x9a,0x8b,0x53,0x15,
+  0xae,0x65,0xbf,0x27,0xd3,0x25,0x9f,0x5f,0xa4,0x07,0x54,0x39,0x5c,0x26,0x59,0xfe,
+  0x2b,0x8e,0x6d,0xc2,0xd5,0xcc,0xfd,0xb6,0xf8,0x6a,0x85,0x77,0xd1,0x5b,0xa0,0xcf,
+  0x1d,0xff,0x46,0xeb,0x99,0xb6,0x0d,0x4f,0xb2,0xb9,0x69,0x79,0xef,0x7d,0x87,0x5d,
+  0x53,0xf2,0xba,0x9f,0x1b,0x86,0xbc,0x9f,0xd7,0x7c,0xdf,0xa6,0xdb,0x43,0x66,0x1c,
+  0x62,0xa5,0x8c,0x38,0xca,0xf7,0x80,0xd7,0x85,0x0e,0xa7,0x0a,0xf0,0x28,0x19,0x66,
+  0xca,0xcb,0xef,0xa8,0xa9,0xf3,0x4f,0x7f,0x02,0x88,0xaf,0x65,0xf7,0xfd,0x35,0x44,
+  0x68,0xe9,0xd6,0xad,0x49,0xb6,0x0d,0x5f,0xef,0x60,0x2e,0xdf,0x8b,0xb7,0xf1,0x36,
+  0xda,0x3b,0x7e,0xaa,0xe0,0x7b,0xaa,0x0f,0xbe,0x59,0xbe,0xfe,0x13,0x5f,0x0b,0xe4,
+  0xab,0x03,0xfa,0x7b,0xb2,0x0f,0xf1,0x82,0x43,0x61,0xbe,0xee,0x6c,0xa4,0x33,0x71,
+  0x0a,0xe9,0x14,0x0d,0xaa,0x43,0xb6,0xb1,0x88,0xb9,0x56,0xf3,0x0e,0xdc,0x59,0x62,
+  0xb7,0x41,0x3f,0x0f,0xca,0x69,0xdd,0x07,0xd3,0xec,0xf4,0xfc,0xe9,0xfd,0x9d,0x12,
+  0x99,0x7e,0x2e,0x6b,0x7d,0x92,0x53,0x25,0xc5,0x20,0x61,0x89,0x5a,0xd8,0x82,0x50,
+  0x90,0x87,0x17,0x04,0xb0,0x4e,0xe1,0x21,0x96,0xed,0x97,0xb6,0x39,0xee,0x31,0x94,
+  0x48,0x78,0x6f,0x6d,0x1b,0x46,0xaa,0xe0,0x72,0x3d,0x40,0xe9,0x1a,0xae,0x0c,0xae,
+  0x57,0xee,0xa0,0x16,0x97,0x3d,0xab,0xc3,0x6c,0x29,0x7d,0x9d,0x49,0x74,0x76,0x3b,
+  0x93,0x75,0xff,0xc0,0xdc,0x5a,0xca,0x00,0xb0,0x2e,0xf8,0xe0,0x34,0x3c,0x3e,0x04,
+  0x49,0x1d,0xf4,0x30,0xc5,0x6a,0xb6,0x6a,0xdd,0x74,0x90,0x24,0x69,0x14,0xc9,0x34,
+  0xcf,0x45,0x77,0x6d,0x61,0x1e,0xe4,0x4c,0x3b,0x08,0x0f,0x9f,0x7c,0xff,0xcb,0xc1,
+  0x23,0x2d,0x24,0x54,0xa2,0xc0,0x1b,0x65,0x71,0xa2,0x4e,0x13,0x8e,0x79,0x96,0xbc,
+  0xa3,0x6d,0x57,0x1c,0x1a,0x0d,0x36,0xcd,0x09,0x09,0xd4,0x7e,0x92,0xba,0x73,0x83,
+  0x82,0xaf,0x71,0xc0,0xbf,0x28,0xbe,0x41,0x2f,0xd9,0x5d,0x2e,0xfc,0x5e,0x51,0xde,
+  0x48,0x2b,0xaa,0x25,0x05,0x1b,0x0f,0xc7,0x2f,0x10,0x5d,0xf4,0x43,0x04,0xaa,0x3b,
+  0xa4,0x7b,0x52,0x8f,0x3a,0x63,0xb0,0x8c,0x5c,0x22,0xa8,0x02,0x09,0x1a,0x12,0x40,
+  0xf9,0x39,0x39,0x15,0x10,0x23,0xb8,0xc0,0xf5,0x3e,0x2d,0xe4,0x26,0x37,0xbe,0xef,
+  0x7e,0xec,0x64,0xb0,0x76,0x83,0x6c,0xa6,0x14,0xa6,0xe2,0x89,0x23,0x18,0x40,0xa3,
+  0xf8,0x12,0x35,0x2b,0xd6,0xae,0x8d,0x64,0x72,0x9b,0x83,0x85,0xd1,0x85,0xc8,0x5c,
+  0x21,0x77,0x62,0x24,0x03,0x16,0x57,0x4e,0x17,0x28,0xed,0x27,0xa5,0xf9,0x6d,0x48,
+  0x15,0xd4,0x6b,0x38,0xfa,0x5e,0x68,0x30,0xbb,0x0a,0xc1,0x2c,0x59,0x38,0x56,0x7e,
+  0xb2,0x87,0x9e,0x2c,0xa7,0xc8,0x29,0x6e,0x1b,0x98,0xeb,0xeb,0x94,0xe0,0x61,0x2e,
+  0xe4,0x24,0x0b,0x22,0xf4,0xd2,0x73,0x32,0x1b,0x65,0x5d,0x3e,0xd4,0xf6,0x63,0x00,
+  0x46,0x50,0xd8,0x2b,0x3f,0xb3,0x81,0x63,0xcd,0xc5,0xab,0x0f,0xf8,0x37,0xf1,0x53,
+  0x98,0xdd,0x98,0xcb,0x78,0x5d,0x0b,0x20,0xc8,0x07,0x12,0x5f,0x19,0x9c,0xd8,0x2d,
+  0x28,0xb0,0xd2,0x47,0xa4,0x3c,0x88,0xb0,0x9c,0xf7,0x15,0xf0,0xa0,0x40,0x94,0x56,
+  0x97,0xa0,0xbc,0xee,0x21,0x09,0x78,0xcb,0x87,0x90,0xa1,0xc2,0x8c,0x41,0xd2,0x11,
+  0xe8,0x09,0x33,0x3b,0x07,0xf2,0xe2,0x53,0x0b,0x2d,0x58,0xd1,0x96,0xdb,0x80,0xce,
+  0x6e,0x23,0xd1,0x33,0x1a,0x2f,0x07,0xa4,0x5c,0x6b,0x57,0x9c,0xbe,0x86,0x16,0x65,
+  0xc3,0x13,0xe7,0xda,0xab,0xde,0x1a,0x09,0x41,0x6e,0x16,0x7a,0x4a,0x31,0x3b,0xea,
+  0x78,0xbd,0x40,0xa2,0xdd,0xaf,0x8f,0x73,0x96,0x71,0x81,0x4d,0x0d,0xba,0x5e,0x48,
+  0x20,0xad,0xe7,0x13,0x3c,0x04,0x51,0x66,0x49,0x69,0x4f,0xd6,0x48,0x03,0xf4,0x96,
+  0x5a,0xcf,0xe3,0x1f,0x1d,0xbc,0x29,0xa9,0xdd,0x1c,0x26,0x28,0xb2,0x21,0x6b,0x4a,
+  0x5d,0x16,0xc7,0x67,0x11,0xcb,0x79,0x92,0x5c,0x9c,0xc8,0x46,0xa3,0x93,0x26,0xf4,
+  0xf3,0xd5,0x17,0xa2,0x49,0x23,0x5b,0x64,0x3f,0x31,0xfd,0xb3,0x4b,0xb9,0x67,0x17,
+  0x12,0xd0,0xc4,0x65,0xbb,0x3a,0x5e,0xdf,0xd6,0x17,0xe7,0x0d,0x6a,0x2e,0xc9,0x02,
+  0x18,0x13,0x22,0x1f,0x22,0x48,0x28,0xe0,0x08,0xf9,0x6b,0xc9,0x75,0x62,0xba,0xec,
+  0xda,0x9c,0x6b,0x05,0x68,0x54,0x58,0x9b,0x20,0xcc,0xad,0x6c,0xba,0x72,0xc0,0xb0,
+  0x9e,0x72,0x09,0x37,0x0e,0x53,0x8d,0x4e,0x0d,0x9d,0x2f,0x26,0x0f,0x0e,0x1b,0xe2,
+  0x92,0x2c,0xb6,0x04,0x71,0x44,0x37,0x62,0x25,0x55,0xb3,0x8e,0x0c,0xbd,0x6a,0x0a,
+  0x48,0xd4,0xe1,0x57,0x8c,0xa5,0x9b,0xaa,0xf7,0x81,0xb1,0xd1,0xe0,0x11,0x5e,0x5c,
+  0x33,0x7e,0x11,0x28,0x92,0xba,0x82,0x25,0xb8,0x76,0x8e,0xc1,0xdf,0x4e,0x56,0x96,
+  0xe7,0xbd,0x10,0x0c,0xdb,0x58,0x12,0x0d,0x0b,0x14,0xa1,0x4d,0x35,0xae,0x6d,0xe9,
+  0x80,0xaf,0x2a,0x75,0x56,0x28,0x62,0xaa,0xc9,0xae,0xc0,0xb6,0xf0,0xb9,0xa0,0x1e,
+  0x48,0xf8,0x89,0xdc,0x99,0x27,0x70,0x2b,0x6d,0xa9,0x43,0x05,0xd0,0x74,0xc0,0xa4,
+  0x54,0x3b,0xd5,0xa5,0x1d,0x49,0x3b,0x9d,0xff,0xa4,0x1d,0x2f,0x4b,0x2c,0x38,0xcf,
+  0x22,0xd1,0xf5,0xa1,0x7a,0xd5,0x05,0x0a,0xc8,0x8d,0xda,0x6d,0x4a,0x19,0x01,0x51,
+  0x37,0x9c,0x60,0x32,0x06,0xa1,0x05,0xd4,0xf0,0xe8,0x62,0xa6,0x88,0xf9,0x50,0x92,
+  0x44,0x1a,0x8f,0x34,0x80,0x12,0x4a,0x83,0x43,0x85,0x71,0xf9,0x2a,0x64,0x83,0x88,
+  0x08,0x17,0x5f,0xb2,0x65,0x77,0x11,0xc0,0x56,0xe2,0xa9,0xc1,0xb5,0x51,0xb7,0xa1,
+  0xf6,0xe1,0x14,0x93,0x94,0xb1,0x69,0x9d,0xb8,0xae,0xa4,0x8a,0x48,0x8f,0xb4,0xdf,
+  0xd1,0xd5,0xea,0xc6,0x64,0xaa,0x3e,0x38,0x69,0xe2,0x47,0xaa,0xf7,0x00,0xf2,0x71,
+  0x81,0x72,0x76,0x7c,0x84,0x22,0x1f,0x0b,0xb9,0xb3,0x11,0x5c,0x4d,0x7d,0x2c,0x59,
+  0x56,0x10,0xb5,0xf6,0x6d,0x1f,0xa4,0x66,0xc8,0x98,0x21,0xbf,0x9a,0x5e,0x8e,0x89,
+  0x33,0x08,0x30,0x3c,0xcc,0xa6,0xa0,0x6e,0xae,0x91,0x72,0x0a,0xd6,0x83,0x19,0xc7,
+  0xe0,0x9b,0x7a,0x28,0x10,0x2a,0x34,0x9c,0xef,0x8e,0xe6,0x2c,0xb0,0xa6,0x6f,0x69,
+  0xa9,0x4d,0xf5,0xe2,0xe9,0x68,0xc7,0x92,0x67,0x88,0xcd,0x03,0xff,0x9c,0xf3,0xdc,
+  0x40,0xb8,0x3e,0xbe,0x34,0xa7,0x15,0x2b,0x01,0xb3,0x55,0x61,0xe8,0x3b,0xd6,0x5e,
+  0xa2,0x95,0x2c,0xdd,0x1e,0x9e,0x24,0x4c,0xd8,0x9f,0x86,0xfd,0x76,0x91,0xed,0x71,
+  0xaf,0xff,0x1f,0x8d,0x0b,0x6b,0x9b,0xa3,0xf8,0x89,0xb1,0x90,0x3f,0x75,0xd2,0x9d,
+  0xa2,0xa5,0xd7,0x70,0xb5,0x6c,0x36,0x18,0x81,0xd3,0x45,0xa0,0xee,0xc6,0x70,0xaa,
+  0xcc,0xab,0x30,0xdd,0x38,0x48,0x60,0x47,0x2c,0xe6,0x15,0x84,0xb9,0x6b,0x60,0x7b,
+  0x7d,0x1a,0xd0,0xc1,0x21,0x43,0x9b,0x45,0xbb,0x24,0xac,0xaa,0xaf,0x04,0xaa,0x84,
+  0x58,0x66,0xe1,0x24,0x19,0x1f,0x1a,0xd1,0x10,0xef,0x3e,0x9e,0x25,0xb3,0xe6,0x90,
+  0x7e,0x8c,0x07,0x63,0x48,0x35,0x82,0xb9,0x84,0xaf,0xce,0xe6,0xe8,0x81,0x78,0x30,
+  0x85,0x8f,0x93,0x83,0xc9,0xe1,0x4b,0x19,0x09,0x44,0xc9,0x2d,0xff,0x83,0xad,0x9a,
+  0xc5,0x8f,0x22,0xdb,0x04,0xb7,0x0e,0xd8,0x04,0xb6,0x80,0x59,0xa7,0x8c,0x15,0xa1,
+  0xd9,0x9a,0x08,0x44,0xdb,0x16,0xee,0x93,0x7a,0x16,0x45,0x20,0x37,0xdd,0xd9,0xf1,
+  0x0c,0x99,0xc5,0x46,0xc2,0x55,0xc6,0x11,0x5c,0x35,0xdb,0xeb,0x3e,0x25,0x9e,0xea,
+  0x14,0xff,0x41,0xe9,0x64,0x0b,0x67,0x9a,0x56,0x7c,0xe0,0xf5,0xfa,0x3e,0xbf,0x89,
+  0x9f,0x64,0xca,0x4b,0xe0,0x76,0xe3,0x20,0x70,0x7d,0x07,0x2b,0xd9,0x98,0x8d,0x8f,
+  0x65,0x65,0x24,0x59,0xfa,0xc3,0x85,0xa0,0x04,0x48,0xd5,0x82,0x3a,0xe1,0x0b,0x4d,
+  0xb9,0x31,0xb8,0x22,0xae,0xcf,0x12,0x8e,0xf6,0x2c,0x2b,0xee,0xe1,0x4b,0x6a,0x5c,
+  0xe3,0xf4,0xe4,0x8d,0xf9,0x10,0xfc,0x30,0x19,0xd0,0x25,0x29,0x5a,0x12,0x60,0xa1,
+  0x8e,0x1d,0xa3,0x6b,0x32,0x92,0x68,0x8e,0x1a,0xd5,0x35,0x74,0x44,0xcc,0x8b,0xbe,
+  0x9f,0xef,0xee,0xb3,0x4a,0x1e,0x79,0x60,0x06,0x29,0xb8,0x81,0xac,0xcc,0xf3,0x88,
+  0xe8,0xd6,0x04,0xe4,0x57,0x23,0xe9,0xc9,0xdc,0xc5,0x41,0x17,0x46,0x1e,0x42,0x31,
+  0x6e,0x5d,0xaf,0x5c,0x2a,0x32,0x56,0xfc,0x51,0x1d,0x6e,0xc7,0xe9,0x4b,0x5f,0xc8,
+  0x12,0x9b,0xc0,0x24,0xb8,0xf4,0xd3,0x9c,0xde,0xd2,0xc2,0xc1,0xbb,0xda,0x51,0x2d,
+  0x50,0x96,0xfc,0x9d,0x3a,0x66,0xb3,0x86,0xf4,0xe5,0xbd,0xfb,0x49,0x35,0xb6,0x4c,
+  0x6e,0x25,0x7d,0xd0,0x02,0xc2,0x52,0x4f,0x34,0x20,0xd7,0x19,0xc5,0xd4,0x0b,0xe6,
+  0x38,0x37,0x6b,0x8f,0x79,0x38,0xdf,0x56,0x1d,0x7c,0xfe,0xe6,0x66,0xb1,0x51,0x11,
+  0xe9,0x0c,0xf1,0xa4,0x52,0xb0,0x9d,0xc2,0xc2,0x1e,0x23,0x7b,0x02,0xac,0x39,0x8c,
+  0xfb,0xf9,0x1d,0xba,0x1d,0x50,0x26,0xb2,0x95,0x8e,0x81,0xfb,0xb4,0x8f,0xc2,0x56,
+  0x79,0x23,0x64,0x8a,0x43,0x29,0xdd,0x82,0xf7,0xa3,0x7a,0x4e,0x25,0x67,0xdc,0x63,
+  0x92,0x96,0x81,0xdf,0x27,0x48,0x7c,0x0c,0x2f,0x37,0x5d,0x71,0xbd,0xa4,0xe9,0xc5,
+  0x49,0x31,0x37,0x25,0xe6,0xa4,0x61,0xe0,0x1f,0x90,0x97,0x71,0x98,0xd7,0x6c,0xb0,
+  0xd3,0xca,0x2a,0xd9,0x1a,0x5f,0xc8,0xb1,0xb8,0x60,0x9a,0x11,0x20,0x24,0xdb,0xf5,
+  0xf1,0xc5,0x28,0x8c,0xfb,0xfd,0x13,0x32,0x94,0xe2,0x6d,0x6c,0x53,0x30,0xb9,0x29,
+  0x47,0x8b,0x10,0x35,0x0a,0xb5,0xe3,0xd6,0x08,0x81,0x82,0x36,0x0c,0x73,0xbb,0xd3,
+  0x6b,0xda,0x35,0x5c,0xc9,0x70,0x7c,0x1e,0x0b,0x4c,0x59,0x40,0x17,0xac,0x96,0x6f,
+  0xef,0x51,0xc7,0xbb,0x6e,0x95,0x63,0xe4,0xf7,0xb0,0xf8,0x82,0xa1,0xc2,0x13,0x88,
+  0xde,0x88,0xc6,0xc8,0x78,0x8d,0xd6,0x97,0xc9,0x4d,0x9b,0xa9,0x81,0x6a,0x4b,0xa0,
+  0x52,0x2a,0x7c,0x7a,0x94,0x00,0xad,0x0c,0xdf,0x64,0xc2,0xf6,0x04,0x03,0x36,0x56,
+  0x7c,0x8c,0x84,0xa1,0xc2,0xf6,0x09,0x6d,0x1c,0x7a,0xd4,0x0e,0xab,0x74,0x48,0xb2,
+  0x87,0xf5,0xdb,0x2c,0xc5,0x1e,0xa2,0x2b,0xbf,0x4e,0xb8,0x83,0x32,0x14,0x2f,0x0a,
+  0x44,0x54,0xba,0x68,0x31,0xac,0x7b,0xbb,0x2c,0x43,0x56,0xf0,0x0c,0xbd,0x58,0xa3,
+  0xb9,0x05,0x4d,0x11,0x9c,0x79,0x6a,0xc1,0xf2,0x4f,0x3b,0x89,0x01,0x74,0x63,0xda,
+  0x47,0x5f,0xf7,0xa1,0x63,0x4a,0xd2,0x6d,0x6b,0x63,0xe2,0x25,0xd1,0xff,0x95,0x4e,
+  0xcb,0xf3,0xe6,0x6a,0x73,0x8d,0xd8,0xac,0x93,0x33,0x34,0x6d,0x4c,0x79,0xb9,0x62,
+  0xee,0xc9,0x4c,0x2b,0x11,0x0e,0x30,0x32,0x11,0x31,0xc3,0xca,0xa0,0x83,0xc6,0x2a,
+  0xfa,0x36,0x4e,0xa9,0x3f,0xaf,0x5c,0x86,0xdc,0x9b,0xb9,0xe2,0x59,0xa4,0x72,0x50,
+  0x92,0x2d,0x03,0x76,0x90,0x36,0xac,0xac,0x83,0xa0,0x8d,0x22,0x29,0x80,0x7a,0x8e,
+  0xbc,0xc2,0xb4,0x8f,0xb0,0x6c,0x6a,0xd1,0x84,0x19,0xbd,0x26,0xc6,0x72,0xcc,0x51,
+  0x7e,0x79,0x5a,0x93,0x97,0x64,0xd2,0x4f,0x2d,0x10,0x21,0x1a,0xbe,0xd2,0x86,0x5c,
+  0x68,0xb4,0xa2,0xd3,0x06,0x61,0x38,0x3a,0x46,0x80,0xba,0x5f,0x4e,0x5a,0x2e,0xb8,
+  0x5d,0x17,0x73,0x97,0x9b,0xe0,0xc2,0xe4,0x9b,0xb6,0xb0,0x27,0x11,0xa0,0x79,0x9c,
+  0x85,0x3d,0xe0,0x32,0x01,0x04,0x6b,0xa5,0x04,0xdb,0x31,0xfa,0xb1,0x7a,0xdc,0xea,
+  0x81,0x11,0xe5,0x62,0x84,0x00,0xd9,0x4a,0xc1,0xb8,0x1c,0xc0,0xd4,0x3d,0xef,0x1e,
+  0x17,0xa8,0x24,0x99,0x3d,0xec,0xa9,0x5c,0xda,0x2f,0x85,0x4e,0xef,0x01,0x84,0xd3,
+  0x83,0x84,0x8b,0x16,0x13,0x8d,0x4f,0x0f,0xa3,0x63,0x58,0xb6,0x6a,0x49,0x0b,0x84,
+  0x2e,0xfb,0x2a,0x86,0xe5,0xe3,0x9c,0x7e,0xa8,0xda,0x2c,0x8b,0x01,0x57,0x88,0x9a,
+  0x01,0xda,0xbd,0xac,0x58,0x8d,0xdf,0x2c,0x9d,0xf7,0x0a,0x1d,0x9b,0xe1,0x38,0x44,
+  0x56,0xeb,0x45,0x21,0x5d,0x5c,0x9f,0x9a,0x59,0xf5,0xcf,0xb8,0x61,0xdf,0xb8,0x3d,
+  0x02,0xbf,0x24,0x0b,0xb1,0x15,0x49,0xb0,0xdb,0x63,0x77,0x23,0x97,0xc9,0x56,0x79,
+  0x36,0x28,0x87,0x7a,0xf0,0x9c,0xca,0x2a,0xd4,0xef,0x07,0xff,0x76,0x83,0xfe,0x8a,
+  0xbd,0xd5,0xbc,0xc0,0xdd,0x4a,0xee,0x1c,0xd7,0xc4,0xa5,0x5a,0x7f,0x04,0x38,0x13,
+  0xe3,0x33,0x7b,0xe9,0xfa,0x57,0x6d,0x63,0x35,0x61,0x52,0xb1,0xbc,0x2a,0x4e,0x99,
+  0xf4,0x4b,0x92,0x80,0x1a,0x21,0x24,0x75,0xac,0x51,0x76,0x1b,0x87,0x48,0x6e,0x84,
+  0x1b,0x86,0x89,0xc7,0xe5,0x16,0xb8,0x0d,0x89,0x75,0x62,0x36,0x5c,0x54,0xdf,0x95,
+  0x56,0x49,0xc4,0xc8,0xd6,0x11,0xd6,0xe0,0x4a,0xe1,0xb7,0xa4,0x23,0xe0,0xf8,0x7d,
+  0x6d,0xa0,0xdc,0x5e,0xef,0x8a,0xb9,0x61,0x68,0x10,0x21,0x27,0x3e,0xc5,0x69,0x18,
+  0x2b,0xc2,0xe0,0x8a,0xcf,0x77,0x87,0xfb,0x0c,0x62,0x6e,0x7b,0xbd,0x2c,0xda,0x9f,
+  0xb9,0xe4,0x76,0x38,0xe0,0xa0,0x61,0x07,0x7d,0x43,0xba,0x03,0xff,0x21,0x05,0xa9,
+  0x1d,0xda,0xe3,0xfb,0xc0,0xa4,0x92,0x6e,0xd0,0x96,0x25,0x43,0x6d,0x1e,0x8a,0xda,
+  0xc5,0x8a,0x7c,0x85,0x9a,0x84,0x05,0x0b,0x04,0x20,0xea,0x9c,0x37,0xa2,0x41,0x02,
+  0x51,0x2d,0x23,0xa9,0xd8,0x22,0xf3,0xd9,0x92,0xf3,0x39,0xa1,0x37,0xc2,0xb6,0xd3,
+  0xc4,0xb3,0xdc,0x60,0xec,0xf0,0x84,0xf2,0x35,0x78,0x5d,0x45,0x8f,0x8f,0x4a,0x9c,
+  0xea,0x10,0x4a,0xb9,0xc3,0xcc,0x0b,0x03,0x89,0x7e,0x78,0x79,0x60,0x28,0xfb,0x55,
+  0xcd,0xc9,0xbb,0x62,0x96,0x73,0x27,0xa0,0x99,0x08,0x44,0x4b,0x30,0x02,0x87,0x21,
+  0x34,0xe5,0xcc,0x9e,0x9e,0x22,0xfa,0x85,0x59,0x6b,0x1e,0x57,0xfa,0x00,0xc4,0x3d,
+  0x7b,0x00,0x40,0x07,0x00
+};
+
+static const Byte kRar5[2571] =
+{
+  0x52,0x61,0x72,0x21,0x1a,0x07,0x01,0x00,0xc5,0x1a,0x33,0x32,0x03,0x01,0x00,0x00,
+  0xb5,0xf6,0xfe,0xe8,0x1d,0x02,0x02,0xd1,0x13,0x06,0x80,0x80,0x02,0x20,0x00,0x00,
+  0x00,0x60,0xa0,0x82,0x4a,0xac,0x80,0x03,0x00,0x08,0x64,0x61,0x74,0x61,0x2e,0x74,
+  0x78,0x74,0xc9,0x57,0xcd,0x09,0x46,0x05,0x23,0x34,0x44,0x30,0x00,0x00,0x00,0x64,
+  0xff,0xe7,0x0a,0x7c,0x02,0xeb,0x39,0x3b,0xc9,0xb7,0x94,0x97,0xe2,0x5b,0xaa,0xdd,
+  0x7b,0x36,0xb3,0xbf,0xca,0xd4,0x9b,0xcc,0xcc,0xbb,0x7e,0xf2,0x47,0x84,0x3d,0xde,
+  0x17,0x24,0x93,0x6e,0xdd,0xa4,0x90,0x83,0xc7,0x80,0x1a,0x9c,0x5c,0x00,0x00,0x00,
+  0x03,0xea,0xaf,0xb8,0xec,0xba,0xe5,0xae,0x99,0x4a,0x7f,0x8c,0xb5,0x96,0x7a,0xe5,
+  0xfa,0x94,0xff,0xc9,0x79,0xf9,0x6b,0x2e,0xb3,0xfb,0xe5,0x3e,0xd9,0x7a,0xe9,0xb7,
+  0xfa,0xa7,0x85,0x4f,0xf9,0xe9,0xf1,0xf0,0xfa,0x7b,0x65,0x4f,0x2e,0x9e,0x27,0xb6,
+  0x54,0xfe,0x3d,0xb4,0xd7,0x2f,0x4f,0xce,0xb9,0x67,0xdb,0x7f,0xdd,0x97,0xea,0x7a,
+  0xcb,0xa6,0xde,0x46,0x7d,0xbe,0xdf,0xfe,0x9e,0x5d,0x32,0x1c,0xeb,0x92,0x57,0x18,
+  0xcf,0xef,0xd7,0x2f,0xd7,0x5a,0x7f,0x8a,0x61,0xf4,0xc2,0x25,0xd7,0xcf,0xc8,0x5a,
+  0x1f,0xa6,0xd8,0xb6,0xdf,0xa7,0xe3,0x1a,0xd7,0x4e,0x9b,0x7c,0x1a,0x7a,0xe5,0x5f,
+  0x2b,0x4a,0xe8,0xaf,0x6d,0x3f,0x34,0xfe,0x66,0xf3,0x3a,0xd7,0xfa,0xa7,0x8b,0x4f,
+  0xa2,0x59,0xff,0xd4,0xcd,0xe9,0xa1,0x6b,0xa5,0xa9,0x80,0xd7,0x3a,0xaf,0xc5,0x3d,
+  0x76,0xf1,0xc3,0x9f,0xd3,0x61,0x53,0xe8,0xae,0xe0,0xdb,0xc8,0xdf,0x5e,0xed,0xbd,
+  0xf6,0xd7,0xd4,0xc0,0xfd,0x3d,0xba,0x7b,0xee,0x1d,0x2b,0xfd,0x57,0x19,0xcf,0x7f,
+  0xa7,0xdf,0x75,0x76,0xfb,0x74,0xae,0x51,0x5c,0x26,0xba,0x6e,0xbb,0xd3,0xf6,0x8b,
+  0xba,0xb6,0xd3,0x34,0xe0,0xbd,0x93,0x5e,0x5f,0x1a,0x6e,0xbb,0x9f,0x6c,0x73,0xcf,
+  0xca,0xfe,0x73,0x4c,0xaf,0x4e,0xdb,0xfe,0x6d,0x7e,0x76,0xe5,0x32,0x7f,0x4e,0xbb,
+  0xff,0xd5,0x78,0xef,0xda,0xa8,0x06,0xb9,0x17,0xce,0x09,0x5e,0x67,0xaf,0x0a,0xb2,
+  0x47,0xa8,0xe4,0xc9,0xa8,0xb5,0x31,0x5a,0xe6,0x5b,0x72,0x7d,0x32,0x59,0xf6,0xf9,
+  0x40,0x74,0x43,0x95,0xc2,0x65,0x9f,0xda,0xb8,0xe5,0x78,0x5a,0xb9,0x9f,0xb6,0xdf,
+  0x0d,0x10,0xae,0xfa,0x2b,0x64,0x19,0xd3,0x7f,0xd1,0xb2,0xe6,0x6d,0x83,0x53,0xec,
+  0xae,0x5a,0x5e,0x7b,0xdf,0x61,0xd7,0x54,0xfc,0x2e,0xa7,0xc6,0xe1,0xa7,0x27,0xf6,
+  0xdf,0x37,0xeb,0xb6,0xd0,0xab,0x0e,0x31,0x52,0xc6,0x1c,0x65,0x7f,0xc0,0x6b,0xc2,
+  0x87,0x53,0x85,0x78,0x14,0x0c,0xb3,0x65,0x65,0xf7,0xd4,0x54,0xf9,0xa7,0xbf,0x81,
+  0xfb,0x45,0x75,0x5f,0x7f,0xc3,0x54,0x46,0x96,0x9d,0x6a,0xd4,0x9b,0x60,0xd5,0xfe,
+  0xea,0x05,0xdb,0x71,0x76,0xfe,0x26,0xdb,0x47,0x6f,0xd5,0x5c,0x0f,0x65,0x41,0xf7,
+  0xcb,0x37,0xdf,0xc2,0x6b,0xe1,0xfc,0x94,0x60,0x7f,0x5d,0xd9,0x07,0xfa,0xc1,0x21,
+  0x51,0xbe,0xf0,0x6c,0xa4,0x73,0x71,0x0a,0xe9,0x14,0x0d,0xaa,0x43,0xb6,0xb1,0x88,
+  0xb9,0x56,0xf3,0x0e,0xdc,0x59,0x62,0xb7,0x41,0x7f,0x0f,0xc2,0x69,0xd9,0x07,0xd3,
+  0xec,0xf5,0xfb,0xe9,0xfe,0x9d,0x12,0x99,0x7e,0x2e,0xeb,0x7a,0xa4,0xa6,0x4b,0x8a,
+  0x40,0xc3,0x12,0xb5,0xb1,0x04,0xa1,0x21,0x0e,0x2e,0x09,0x60,0x9d,0xc2,0x43,0x2d,
+  0x9b,0x2f,0x6c,0x73,0x71,0x8c,0xfd,0xa4,0x3c,0x37,0xb6,0x8d,0xa3,0x55,0x70,0x39,
+  0x1e,0xa0,0x74,0x8d,0x47,0x06,0x57,0x2b,0xdd,0x40,0x2d,0x2e,0x7b,0x57,0x86,0xd8,
+  0x52,0xfb,0x5a,0x92,0xe8,0xec,0x78,0x26,0xe6,0x1f,0x81,0xb8,0xb5,0x94,0x01,0x60,
+  0x5d,0xf1,0xc0,0x68,0x78,0xfc,0x08,0x92,0x3b,0xe4,0x61,0x8a,0xd5,0x6c,0xd5,0xba,
+  0xe9,0x20,0x48,0xd2,0x29,0x92,0x69,0xa6,0x8a,0xf1,0xda,0xc2,0x3d,0xc8,0x98,0x76,
+  0x10,0x1f,0x3b,0xb3,0xff,0x3f,0x24,0x8c,0xb4,0x91,0x52,0x8b,0x00,0x6d,0x95,0xc6,
+  0x89,0x38,0x4e,0x39,0xe6,0x5a,0xf2,0x8d,0xb5,0x5c,0x70,0x68,0x34,0xdb,0x34,0x24,
+  0x27,0x51,0xfa,0x4b,0x69,0xce,0x0e,0x0a,0xbd,0xc7,0x03,0xfc,0xa3,0xf9,0x04,0xbf,
+  0x65,0x74,0xbb,0xf1,0x79,0x4b,0x79,0x20,0xae,0xa8,0x94,0x14,0x6c,0x3f,0x1c,0xbc,
+  0x41,0x77,0xd1,0x0c,0x12,0xa8,0xee,0x91,0xed,0x4a,0x3c,0xe9,0x96,0xc2,0x31,0x70,
+  0x8a,0xa0,0x08,0x24,0x68,0x49,0x03,0xe4,0xe4,0xe4,0x54,0x40,0x8e,0xe3,0x03,0xd4,
+  0xf8,0xb7,0x90,0x98,0xde,0xfb,0xbd,0xfc,0x71,0x92,0xc1,0xda,0x1d,0xb2,0x98,0x52,
+  0x9b,0x8a,0x24,0x8c,0x61,0x02,0x8f,0xe0,0x48,0xd4,0xaf,0x5a,0xba,0x35,0x91,0xca,
+  0x6e,0x0e,0x17,0x46,0x17,0x21,0x70,0x85,0xed,0x88,0x90,0x0c,0x59,0x5d,0x38,0x6c,
+  0xa3,0xbc,0x9e,0x97,0xe5,0xb5,0x20,0x57,0x51,0xac,0xe3,0xe9,0x79,0xa1,0xc2,0xec,
+  0x2b,0x04,0xb1,0x64,0xe1,0x5a,0xfa,0xca,0x1e,0x78,0xb2,0x9f,0x20,0xa5,0xb8,0x6c,
+  0x63,0xaf,0x9e,0x53,0x81,0x84,0xbb,0x90,0x90,0x2c,0x8b,0xd3,0x49,0xcc,0xc8,0xed,
+  0x95,0xb4,0xfb,0x53,0xd9,0x8c,0x01,0x19,0x43,0x60,0xac,0xfe,0xce,0x05,0x8f,0x37,
+  0x16,0xac,0x3f,0xe1,0xdf,0xc5,0x4e,0x63,0x76,0x63,0x3d,0xe1,0x74,0x2c,0x83,0x20,
+  0x1c,0x49,0x7c,0x66,0x73,0x60,0xb4,0xa3,0xc3,0x49,0x1e,0x91,0x32,0x22,0xc2,0x73,
+  0xe0,0x57,0xc2,0x81,0x02,0x51,0x5a,0x5e,0x82,0xf3,0xc0,0x84,0x25,0xe3,0x2e,0x3e,
+  0x42,0x87,0x0a,0x31,0x07,0x48,0x47,0xa0,0x24,0xcc,0xec,0x1f,0xcb,0x89,0x4c,0x2c,
+  0xb5,0x63,0x46,0x5b,0x6e,0x03,0x39,0xb8,0x8f,0x44,0xcc,0x68,0xbc,0x1e,0x91,0x71,
+  0xad,0x5e,0x72,0xfa,0x38,0x59,0x97,0x0c,0x4f,0x9f,0x6a,0xaf,0x78,0x68,0x25,0x05,
+  0xb8,0x59,0xe9,0x28,0xc4,0xef,0xa9,0xe2,0xf5,0x02,0x8b,0x77,0xbe,0x3d,0xd6,0x59,
+  0xc6,0x05,0x34,0x76,0xe9,0x79,0x20,0x82,0xb7,0x9c,0x4c,0xf0,0x11,0x45,0x99,0x25,
+  0xa5,0x3f,0x59,0x20,0x0f,0xca,0x59,0x6b,0x3f,0x8c,0x7c,0x76,0xf0,0xa6,0xa7,0x74,
+  0x70,0x98,0xa2,0xc8,0x85,0xad,0x29,0x74,0x7b,0x1d,0x9c,0x47,0x2d,0xe6,0x49,0x72,
+  0x73,0x21,0x1a,0x8e,0x4c,0x9b,0xd3,0xcf,0x54,0x5e,0x89,0x24,0x8d,0x7d,0x90,0xfc,
+  0xc7,0xf6,0xcd,0x2e,0xe5,0x9c,0x5c,0x4b,0x43,0x11,0x96,0xed,0x69,0x7b,0x9f,0x58,
+  0x5f,0x9c,0x35,0xa8,0xbb,0x24,0x08,0x60,0x4c,0x88,0x7c,0x89,0x20,0xa5,0x80,0x25,
+  0xe5,0xaf,0x25,0xd5,0x8a,0xeb,0xb3,0x6a,0x71,0xac,0x15,0xa1,0x51,0x62,0x6c,0x83,
+  0x32,0xb5,0xb2,0xe9,0xcb,0x02,0xc2,0x79,0xc8,0x24,0xdc,0x39,0x4e,0x35,0x38,0x36,
+  0x74,0xbc,0x98,0x3c,0x38,0x6f,0x8a,0x48,0xb2,0xd8,0x11,0xc5,0x10,0xdd,0x88,0x95,
+  0x56,0xd6,0x38,0x32,0xf5,0xa8,0x29,0x23,0x53,0x85,0x5e,0x32,0x9e,0x6e,0xab,0xde,
+  0x06,0xc7,0x47,0x80,0x45,0x79,0x70,0xcd,0xf8,0x44,0xa2,0x4a,0xea,0x08,0x96,0xe1,
+  0xda,0x3b,0x07,0x7d,0x39,0x5a,0x5b,0x9b,0xd1,0x00,0xcd,0xb5,0x81,0x20,0xd0,0xb1,
+  0x4a,0x14,0xd7,0x5a,0xe6,0xde,0x98,0x0a,0xf2,0xa7,0x55,0x62,0x86,0x2a,0xac,0x9a,
+  0xec,0x0f,0x6f,0x0b,0x9a,0x03,0xe4,0x8f,0x88,0x9d,0xc9,0x92,0x77,0x02,0xb6,0xda,
+  0x94,0x30,0x5d,0x0b,0x4c,0x0a,0x45,0x43,0xcd,0x5a,0x51,0xd4,0x93,0xb9,0xdf,0xfa,
+  0x41,0xd2,0xf4,0xb2,0xc3,0x8d,0x32,0x2d,0x1f,0x5a,0x17,0xad,0x50,0x50,0xac,0x88,
+  0xdd,0xa6,0xd4,0xa1,0x90,0x15,0x13,0x79,0xc6,0x03,0x20,0x6a,0x10,0x5d,0x4f,0x0e,
+  0x86,0x2a,0x68,0x8f,0x95,0x09,0x24,0x41,0xa8,0xf3,0x48,0x01,0x24,0xa8,0x34,0x38,
+  0x57,0x1f,0x92,0xa6,0x48,0x38,0x80,0x81,0x75,0xfb,0x26,0x57,0x71,0x1c,0x05,0x6e,
+  0x2a,0x9c,0x1b,0x55,0x1b,0x7a,0x1f,0x6e,0x11,0x49,0x39,0x4b,0x16,0x99,0xdb,0x8a,
+  0xea,0x48,0xa4,0x88,0xfb,0x4d,0xfd,0x1d,0x5e,0xac,0x66,0x4a,0xa3,0xe3,0x86,0x9e,
+  0x24,0x7a,0xaf,0x70,0x0f,0x27,0x18,0x17,0x27,0x67,0xc8,0x42,0x21,0xf0,0xbb,0x9b,
+  0x31,0x15,0xc4,0xd7,0xd2,0xc5,0x95,0x61,0x0b,0x5f,0x66,0xd1,0xfa,0x46,0x6c,0x89,
+  0x82,0x1b,0xf9,0xa5,0xe8,0xe8,0x97,0x30,0x83,0x03,0xcc,0xca,0x6a,0x06,0xea,0xe9,
+  0x17,0x20,0xad,0x68,0x31,0x9c,0xfe,0x09,0xb7,0xa2,0x81,0x02,0xa3,0x49,0xce,0xf8,
+  0xf0,0x62,0xcb,0x0a,0x66,0xf6,0x9a,0x94,0xdf,0x5e,0x2e,0x96,0x8c,0x79,0x26,0x78,
+  0x8c,0xd0,0x3f,0xc3,0x9e,0x7b,0x88,0x17,0x16,0x35,0xf1,0xa5,0x38,0xa9,0x58,0x0d,
+  0x9a,0xab,0x13,0x41,0xde,0xb2,0xf5,0x14,0xa9,0x66,0xe8,0xf4,0xf1,0x22,0x66,0xc4,
+  0xfc,0x37,0xeb,0xb4,0x93,0x6b,0x8d,0x7f,0xc1,0xf1,0xa1,0x6d,0x73,0x74,0x7f,0x11,
+  0x36,0x32,0x07,0xee,0xba,0x53,0xb4,0x54,0xba,0xf6,0x16,0xad,0x86,0xc3,0x10,0x3a,
+  0x68,0xb4,0x1e,0x38,0xce,0x15,0x59,0x95,0x66,0x1b,0xa7,0x09,0x0c,0x08,0xe5,0x9c,
+  0xc2,0xb0,0x97,0x2d,0x6c,0x0f,0x6f,0xa3,0x5a,0x18,0x24,0x28,0x73,0x68,0xb7,0x64,
+  0x95,0x95,0x55,0xe0,0x95,0x50,0x8b,0x0c,0xdc,0x24,0x83,0x23,0xe3,0x5a,0x22,0x1d,
+  0xe7,0xd3,0xc4,0xb6,0x7c,0xd2,0x0f,0xd1,0x80,0xee,0x69,0x06,0xb0,0x57,0x30,0x95,
+  0xf9,0xe0,0xdd,0x10,0x2f,0x06,0x10,0xb1,0xf2,0x70,0x79,0x3c,0x29,0x63,0x21,0x28,
+  0x99,0x25,0xbf,0xf0,0x75,0xb3,0x58,0xb1,0xe4,0x5b,0x60,0x96,0xe1,0xdb,0x00,0x96,
+  0xd0,0x0b,0x35,0x31,0x82,0xb4,0x3b,0x33,0x41,0x08,0x9b,0x63,0xdd,0xd2,0x6f,0x42,
+  0xc8,0xa4,0x06,0xfa,0xbb,0x3e,0x21,0x93,0x38,0xa8,0xd8,0x4a,0xb8,0xc2,0x2b,0x86,
+  0xdb,0x7d,0x67,0xc4,0xb4,0xdd,0x42,0x9f,0xe8,0x4d,0x2c,0x81,0x6c,0xf3,0x4a,0xcf,
+  0x9c,0x1e,0xbf,0x47,0xd3,0xf8,0x99,0xf6,0x4c,0xa4,0xbe,0x0b,0x6e,0x32,0x07,0x07,
+  0xd0,0x72,0xbd,0x99,0x88,0xd8,0xf6,0x56,0x52,0x45,0xaf,0xac,0x58,0x5a,0x00,0x44,
+  0x8d,0x58,0x23,0xae,0x10,0xf4,0xdb,0x93,0x1b,0x82,0x2a,0xec,0xf1,0x28,0xef,0x62,
+  0xc2,0xbe,0xee,0x14,0xb6,0xa5,0xce,0x3f,0x4e,0x48,0xdf,0x91,0x0f,0xc3,0x01,0x9d,
+  0x02,0x52,0x95,0xa1,0x26,0x0a,0x18,0xe1,0xda,0x36,0xb3,0x29,0x2e,0x88,0xe3,0xad,
+  0x53,0x57,0x44,0x4c,0xc8,0xbb,0xe9,0xfe,0xbe,0xeb,0x34,0xa1,0xe7,0x96,0x00,0x62,
+  0x9b,0x88,0x1a,0xcc,0xcf,0x38,0x8e,0x8d,0x60,0x4e,0x45,0x72,0x3e,0x9c,0x9d,0xcc,
+  0x54,0x11,0x74,0x61,0xe4,0x23,0x16,0xe5,0xda,0xf5,0xc2,0xa3,0x25,0x6f,0xc5,0x11,
+  0xd6,0xec,0x7e,0x94,0xb5,0xfc,0x81,0x29,0xbc,0x02,0x4b,0x8f,0x4d,0x39,0xcd,0xed,
+  0x2c,0x2c,0x1b,0xbd,0xe5,0x12,0xd5,0x09,0x6f,0xc9,0xd3,0xa6,0x6b,0x38,0x6f,0x4e,
+  0x5b,0xdf,0xb4,0x93,0x5b,0x64,0xc6,0xe2,0x57,0xe1,0x00,0x2c,0x25,0x24,0xf3,0x42,
+  0x0d,0x71,0x9c,0x5d,0x40,0xbe,0x63,0x83,0x77,0xb8,0xf7,0x93,0x8d,0xf5,0x61,0xd7,
+  0xcf,0xea,0x66,0x6b,0x15,0x11,0x1e,0x90,0xcf,0x1a,0x45,0x2b,0x09,0xdc,0x2c,0x21,
+  0xe2,0x37,0xb0,0x2a,0xc3,0x98,0xec,0x6f,0xe4,0xb6,0xe8,0xb5,0x40,0x9a,0xca,0x56,
+  0x3a,0x07,0xee,0xf2,0x3f,0x09,0x59,0xe4,0x8d,0x92,0x29,0x0c,0xa7,0x76,0x0b,0xde,
+  0xad,0xe9,0x38,0x95,0x9f,0x71,0x8e,0x4a,0x5a,0x07,0x7c,0x9d,0x21,0xf0,0x30,0xbc,
+  0xdd,0x75,0xc6,0xf6,0x93,0xa7,0x15,0x24,0xc5,0xdc,0x97,0x9a,0x91,0x8f,0x80,0x7e,
+  0x42,0x5d,0xc6,0x63,0x5d,0xb2,0xc3,0x4f,0x28,0xab,0x64,0x69,0x7f,0x62,0xc6,0xe1,
+  0x82,0x68,0x44,0x80,0x93,0x6f,0xd7,0xc7,0x14,0xa2,0x33,0xf1,0xf4,0x4c,0xca,0x53,
+  0x89,0xb5,0xb1,0x4c,0xc2,0xe4,0xa5,0x1e,0x2c,0x40,0xd4,0x2a,0xd7,0x93,0x58,0x22,
+  0x06,0x08,0xd8,0x31,0xce,0xef,0x4d,0xaf,0x68,0xd5,0x73,0x25,0xc1,0xf0,0x78,0x2d,
+  0x31,0x65,0x00,0x5e,0xb2,0x59,0xbf,0xad,0x47,0x1f,0x1d,0xba,0x55,0x8f,0x93,0xde,
+  0xc3,0xe2,0x0a,0x87,0x08,0x4e,0x23,0x7a,0x23,0x1b,0x21,0xe2,0x37,0x5a,0x5f,0x25,
+  0x36,0x6e,0xa6,0x05,0xa9,0x2e,0x81,0x48,0xa9,0xf1,0xea,0x50,0x02,0xb4,0x32,0x1b,
+  0x26,0x17,0xb0,0x20,0x19,0xb2,0xb3,0xe4,0x64,0x25,0x0e,0x17,0xb0,0x4b,0x68,0xe3,
+  0xd6,0xa0,0x76,0x5b,0xa2,0x45,0x94,0x3f,0xae,0xd9,0x66,0x28,0xf5,0x11,0x5d,0xfa,
+  0x75,0xc4,0x19,0x90,0xa1,0x78,0x52,0x22,0xa5,0xd3,0x41,0x8d,0x63,0xdd,0xd9,0x62,
+  0x1a,0xb7,0x80,0x65,0xea,0xc5,0x1d,0xc8,0x2a,0x68,0x8c,0xe3,0xcb,0x56,0x0f,0x92,
+  0x79,0xdc,0x48,0x0b,0xa3,0x1e,0xd2,0x3a,0xff,0xbd,0x0b,0x1a,0x56,0x93,0x6b,0x5b,
+  0x1f,0x11,0x2e,0x8f,0xfc,0xaa,0x76,0x6f,0x9f,0x33,0x53,0x9c,0x6e,0xc5,0x64,0x99,
+  0x99,0xa3,0x6a,0x63,0xcd,0xcb,0x17,0x76,0x4a,0x61,0x58,0x88,0x71,0x81,0x90,0x89,
+  0x8e,0x1e,0x55,0x04,0x1e,0x31,0x57,0xd1,0xb2,0x75,0x49,0xfd,0x7a,0xe4,0x36,0xe4,
+  0xdd,0xcf,0x12,0xcd,0x23,0x92,0x84,0x91,0x68,0x1b,0xb4,0x81,0xb5,0x65,0x64,0x1d,
+  0x04,0x69,0x11,0x4c,0x03,0xd4,0x75,0xe6,0x15,0xa4,0x7d,0x83,0x63,0x56,0x8c,0x20,
+  0xcd,0xe9,0x36,0x33,0x96,0x62,0x8b,0xf3,0xca,0xd4,0x9c,0xbb,0x26,0x92,0x79,0x68,
+  0x81,0x08,0xd5,0xf6,0x94,0x32,0xe3,0x45,0xa5,0x1e,0x98,0x33,0x09,0xc1,0xd2,0x34,
+  0x05,0xd2,0xfa,0x72,0xd1,0x75,0xc2,0xe8,0xbb,0x9c,0xbc,0xdf,0x06,0x17,0x24,0xdd,
+  0xb5,0x81,0x38,0x8d,0x03,0xcc,0xe4,0x29,0xef,0x01,0x90,0x08,0x23,0x5d,0x28,0x26,
+  0xd9,0x8f,0xd5,0x8b,0xd6,0xe7,0x54,0x08,0x8f,0x2b,0x14,0x20,0x06,0xca,0x56,0x0d,
+  0xc0,0xe6,0x06,0xa2,0x6f,0x78,0xf0,0xbd,0x41,0x24,0xc9,0xef,0x65,0x4a,0xe6,0xd1,
+  0x7c,0x2a,0x77,0x78,0x0c,0x26,0x9c,0x1c,0x24,0x58,0xb0,0x9c,0x6a,0x78,0x7d,0x1b,
+  0x1a,0xc5,0xb3,0x52,0x48,0x5c,0x21,0x77,0xd9,0x54,0x37,0x2f,0x1c,0xe3,0xf5,0x46,
+  0xd1,0x64,0x58,0x0a,0xbc,0x44,0xd0,0x0e,0xd5,0xed,0x62,0xc4,0x6e,0xf9,0x64,0xef,
+  0xb8,0x50,0xef,0xdf,0x09,0xc2,0x22,0xb7,0x5a,0x29,0x0a,0xea,0xe5,0x3c,0xd2,0xcf,
+  0xae,0x7d,0xc3,0x0e,0xfd,0xc1,0xe8,0x15,0xf9,0x20,0x5d,0x88,0xaa,0x4d,0x86,0xdb,
+  0x1b,0xb9,0x1c,0xbe,0x4a,0xb3,0xc9,0xb1,0x44,0x3b,0xd7,0x84,0xe6,0x51,0x56,0xa7,
+  0x78,0x3f,0xfb,0xb4,0x1f,0xf4,0x55,0xee,0xad,0xe6,0x06,0xea,0x57,0x70,0xe6,0xbe,
+  0x25,0x2a,0xd3,0xf8,0x21,0xc0,0x9f,0x19,0x9b,0xdf,0x4f,0xd2,0xbb,0x6b,0x19,0xab,
+  0x0a,0x95,0x8d,0xe1,0x52,0x74,0xcf,0xa2,0x5c,0x94,0x00,0xd1,0x09,0x23,0xad,0x62,
+  0x8b,0xb0,0xdc,0x3a,0x43,0x74,0x20,0xdc,0x74,0x4e,0x3f,0x28,0xb6,0xc0,0x6c,0x4b,
+  0xab,0x11,0xb2,0xe2,0xa6,0xfc,0xaa,0xb2,0x4e,0x26,0x46,0xb0,0x8e,0xb7,0x02,0x57,
+  0x0d,0xcd,0x21,0x1f,0x07,0xc3,0xeb,0x6d,0x06,0xe2,0xf7,0x7c,0x55,0xcb,0x0b,0x40,
+  0x81,0x09,0x39,0xf6,0x2b,0x48,0xc1,0x5e,0x17,0x04,0x56,0x7b,0xc4,0x3f,0xd8,0xe3,
+  0x13,0x73,0xdd,0xe9,0x66,0xd4,0xfd,0xcf,0x23,0xb1,0xc7,0x05,0x03,0x08,0x3b,0xea,
+  0x1d,0xd0,0x1f,0xf9,0x08,0x2d,0x48,0xee,0xd7,0x1f,0xde,0x05,0x24,0x93,0x76,0x84,
+  0xb1,0x2a,0x1b,0x68,0xf4,0x56,0xd6,0x2c,0x53,0xe4,0x2c,0xd4,0x20,0x28,0x58,0x21,
+  0x07,0x54,0xe1,0xbd,0x12,0x08,0x12,0x89,0x69,0x1d,0x4e,0xc1,0x17,0x9e,0xcc,0x97,
+  0x99,0xcd,0x09,0xbe,0x15,0xb6,0x9e,0x25,0x9e,0xe3,0x07,0x67,0x84,0x27,0x91,0xab,
+  0xc2,0xea,0x2c,0x7c,0x7a,0x54,0xe7,0x50,0x82,0x55,0xce,0x26,0x60,0x58,0x1c,0x4d,
+  0xf3,0xc3,0xcb,0x01,0x47,0xda,0xae,0x6e,0x4d,0xdb,0x14,0xb3,0x99,0x3d,0x04,0xc8,
+  0x42,0x22,0x59,0x80,0x14,0x39,0x09,0xa7,0x2e,0x64,0xf4,0xf1,0x17,0xd4,0x2a,0xcb,
+  0x59,0xf2,0x80,0x19,0xb2,0x3a,0x35,0x03,0x05,0x00,0x00
+};
+
+static const Byte kZ[6856] =
+{
+  0x1f,0x9d,0x90,0x68,0xca,0x80,0xa0,0xf3,0x06,0x04,0x9a,0x34,0x73,0x06,0xa2,0x09,
+  0x43,0x07,0xc4,0x9d,0x83,0x63,0xd0,0xb8,0x50,0x40,0x27,0x60,0x1a,0x39,0x20,0xd2,
+  0xb8,0x01,0x61,0xe6,0x0d,0x46,0x8d,0x03,0x0b,0x76,0x94,0xc3,0x22,0xe3,0xc6,0x91,
+  0x20,0xc4,0xe4,0x01,0xc1,0x50,0x61,0x99,0x95,0x1e,0x41,0xb8,0x79,0xd3,0x50,0x4c,
+  0x9d,0x86,0x61,0x36,0x3e,0x4c,0x13,0xd1,0x61,0x9a,0x8a,0x25,0x51,0xe6,0x24,0xe3,
+  0xb3,0xa2,0x42,0x84,0x2c,0x13,0x56,0x2c,0x73,0x91,0xa5,0x1c,0x81,0x77,0xca,0x3c,
+  0x35,0xc9,0xb2,0x61,0xc0,0x89,0x01,0x43,0x1a,0x44,0x5a,0xb1,0xe5,0xce,0x88,0x25,
+  0x6d,0x5a,0x45,0x9a,0xd3,0x21,0x44,0x34,0x21,0x4b,0x1e,0x4c,0xf8,0xc6,0x4c,0x46,
+  0xa5,0x05,0x55,0x82,0xc8,0xf3,0xa6,0x0e,0x88,0xb6,0x61,0x6f,0x6e,0x4d,0x58,0xf6,
+  0x2b,0x5a,0x82,0x6a,0x05,0x66,0x95,0x8b,0x74,0xa1,0x1d,0xa8,0x61,0xf8,0xba,0x21,
+  0xda,0xb6,0xaa,0xc1,0x30,0x87,0x33,0xd2,0x09,0xac,0x75,0xad,0x42,0xaf,0x67,0x4b,
+  0xc6,0xcc,0x3a,0xd3,0x2a,0x64,0x81,0x4b,0x9b,0x2e,0x5d,0x19,0x75,0x6a,0x63,0x95,
+  0x25,0xef,0xfc,0xfc,0x5b,0x90,0x20,0xcb,0xc5,0x4e,0x05,0x36,0x0e,0x8d,0x71,0x68,
+  0xc9,0x96,0x9b,0xc9,0x4e,0xfd,0x99,0xb2,0x0c,0xe5,0xc1,0x2b,0x0b,0x7f,0x76,0x98,
+  0xf8,0x35,0x63,0xb7,0x2d,0x0d,0x0b,0xfc,0x39,0xb1,0x6b,0xc3,0xa5,0x6f,0x2f,0xd7,
+  0xd4,0x4b,0x7b,0xa2,0x6a,0xa3,0xae,0x5d,0x0f,0x8d,0x7d,0xd7,0x2d,0x6d,0xe3,0x25,
+  0x79,0xbf,0xd9,0xe8,0xfc,0xa8,0xd2,0x85,0x38,0x13,0x8a,0x01,0x8d,0x5e,0x26,0xcd,
+  0x94,0xc1,0x27,0xbb,0x34,0xce,0x7d,0x3c,0x47,0x8f,0x58,0x05,0x0b,0x24,0x9c,0x50,
+  0x39,0x71,0xc5,0xc7,0x39,0xe6,0xdf,0x4f,0xe1,0x35,0x64,0x5f,0x79,0x15,0x71,0xd5,
+  0x5e,0x71,0xeb,0x49,0xe7,0x5e,0x4d,0xf1,0x05,0x15,0xd3,0x76,0xd7,0xfd,0x65,0x59,
+  0x71,0xdf,0x85,0x31,0x55,0x69,0xcb,0x6d,0x94,0x5c,0x19,0x13,0xd9,0x77,0x47,0x71,
+  0x7e,0x49,0x46,0x55,0x79,0x62,0x49,0x36,0xd1,0x76,0x0b,0x11,0x25,0xd7,0x68,0x49,
+  0xc1,0xf7,0x18,0x51,0xd9,0x59,0x96,0xa1,0x1b,0x25,0x95,0x07,0x92,0x6b,0x3b,0x5a,
+  0xc6,0x21,0x65,0xae,0xd9,0xd8,0x9e,0x5f,0x39,0x2e,0x08,0x5b,0x89,0x15,0x3a,0x58,
+  0x9e,0x7d,0x2d,0xf6,0x76,0x1f,0x46,0x23,0x69,0x86,0x11,0x67,0xef,0xf9,0xf7,0x1d,
+  0x8c,0x1c,0x76,0x07,0x9f,0x75,0xab,0x69,0xa5,0x1d,0x6c,0x1a,0xca,0xe6,0x9d,0x45,
+  0xb5,0x2d,0x96,0x5a,0x97,0xd9,0x15,0xb4,0x5d,0x98,0x5a,0xde,0x48,0xc6,0x6f,0xfb,
+  0x05,0xd7,0xdf,0x70,0x23,0x02,0xa8,0x65,0x72,0xc3,0x11,0xa8,0x64,0x56,0x0a,0xb6,
+  0x94,0x22,0x6d,0x12,0x96,0x49,0x54,0x92,0x09,0xf2,0x75,0x1e,0x53,0xb5,0x6d,0x28,
+  0x55,0x87,0x02,0x82,0xa8,0x40,0x8a,0x17,0xea,0x74,0x56,0x48,0xcd,0xb5,0x07,0x5d,
+  0x9f,0xd3,0x3d,0x47,0xe6,0x6f,0x48,0xf1,0x06,0x9d,0x7d,0x6c,0x22,0x24,0xa5,0x41,
+  0x02,0x75,0xf6,0x58,0x64,0x57,0x06,0x44,0xda,0xa2,0x5a,0xaa,0x34,0x91,0x50,0x47,
+  0xa2,0x79,0xe1,0xa1,0x4d,0xb1,0x99,0x25,0x48,0x1f,0x8e,0x4a,0xa5,0x67,0xa8,0x92,
+  0xe9,0xd2,0xaa,0xa6,0xb9,0x85,0x9a,0x79,0x7b,0xcd,0x55,0xd7,0x5d,0x24,0x21,0xfb,
+  0xab,0x59,0x3c,0xa1,0xe5,0x9f,0xa9,0x0c,0xae,0x94,0xa1,0x55,0x8e,0xe2,0x36,0xa5,
+  0x6e,0xcb,0xd5,0xe4,0x9b,0x63,0xb9,0xf1,0xb5,0x9b,0xb6,0x05,0xde,0x69,0x1a,0x8e,
+  0x29,0xe9,0x15,0x29,0xb3,0x3d,0x01,0x46,0xea,0xba,0xfc,0x9d,0x8a,0x98,0x9d,0x8d,
+  0xe1,0x19,0x99,0x9e,0x59,0x05,0x89,0x29,0xba,0x68,0xe8,0x5a,0x6a,0x95,0xc3,0xa5,
+  0xfa,0x92,0x43,0xac,0x9e,0x96,0x47,0xa5,0x02,0xad,0x39,0xee,0x93,0x70,0xca,0x28,
+  0x5c,0x64,0x75,0xd2,0x17,0x2f,0xaf,0xd9,0xaa,0x85,0x54,0x63,0x5c,0xc5,0xb5,0x12,
+  0x5d,0x76,0xb5,0x35,0x11,0xa4,0x64,0x49,0xda,0x2c,0xa5,0x0a,0xc4,0x84,0xe5,0xa4,
+  0xcf,0xbe,0x17,0xad,0x4b,0xb5,0x52,0x5b,0x64,0x4b,0x97,0x9e,0xe7,0x27,0x75,0x9b,
+  0x52,0x85,0x92,0x5c,0x2c,0xab,0xaa,0xac,0xa9,0x29,0xf6,0x35,0x69,0x85,0x67,0x62,
+  0xd7,0x9a,0x9a,0x60,0x06,0x8b,0xb2,0xa0,0x2b,0x6b,0xba,0x9c,0xcb,0x99,0x0e,0x0d,
+  0x64,0x41,0x42,0x62,0xd6,0x6c,0xd1,0xf3,0xdd,0xfb,0x67,0xcc,0xa6,0x0e,0x08,0x97,
+  0x63,0x66,0xc8,0xf1,0x46,0x1b,0x12,0xb3,0xe5,0x56,0xc5,0x32,0x62,0xdc,0x5d,0x7e,
+  0xc5,0x7a,0x9a,0x15,0xa8,0xbb,0xcd,0xd1,0x33,0x6b,0x5a,0x19,0x2c,0xe6,0xd0,0xc6,
+  0x85,0x38,0xe5,0xbe,0x10,0xc3,0x8d,0x65,0xc0,0xc2,0xe6,0x01,0xf5,0x8e,0x05,0xf5,
+  0x88,0xd4,0x8f,0xe5,0x8e,0xa5,0x18,0xbe,0x69,0x15,0xc5,0xf6,0x97,0x44,0xb1,0x39,
+  0x9b,0xaf,0xb6,0xad,0x6b,0x2f,0xd2,0xf8,0x16,0x59,0x70,0xd0,0xb2,0x9d,0x84,0x9f,
+  0x02,0x84,0xfe,0x4c,0x9f,0xe2,0x63,0x22,0x0a,0x1e,0xdc,0x20,0xa1,0xc4,0xf7,0x93,
+  0xaf,0x8a,0xdc,0x9e,0x90,0x05,0xcb,0x57,0x2f,0xd3,0xf7,0x12,0xa9,0xec,0xae,0xee,
+  0xda,0x6d,0x73,0x96,0x02,0xdf,0x66,0xe0,0xb5,0xde,0x66,0xdb,0xdb,0x6d,0xb0,0x35,
+  0xf9,0xa2,0xcd,0x27,0x37,0x59,0xa3,0x82,0x9e,0xe7,0x04,0x75,0xcb,0x0e,0x4e,0x8d,
+  0xe8,0xc6,0xe6,0x76,0x4c,0xb8,0xba,0x49,0xb6,0xe4,0xa7,0x40,0x59,0x6f,0x7d,0x3c,
+  0x9f,0x90,0x2b,0x7f,0x51,0xb8,0x07,0x5a,0xda,0x74,0x7a,0x4e,0x96,0x87,0x73,0x7c,
+  0x64,0x5b,0x66,0x76,0xe5,0xdc,0x89,0xba,0xe7,0xd1,0xc9,0xc3,0xbc,0x3c,0x45,0xde,
+  0xb3,0x8f,0xa2,0xfb,0xdb,0x3f,0xe9,0x20,0xea,0x55,0x55,0x5a,0xb3,0xfc,0xed,0x69,
+  0x9f,0x2c,0xac,0x83,0x92,0x15,0x59,0x68,0x95,0x28,0xa8,0xb0,0x0a,0x57,0x2a,0x0b,
+  0x5c,0xb1,0x74,0xf6,0x31,0x82,0xc8,0x6d,0x5d,0x55,0xeb,0x97,0xaf,0xee,0x26,0x34,
+  0x57,0x61,0x0e,0x4d,0x9a,0x73,0x5b,0x9b,0x18,0x67,0x26,0x62,0x59,0x46,0x6c,0x1e,
+  0x29,0x52,0x61,0x90,0x02,0xc2,0x64,0x65,0x05,0x38,0xd1,0xf1,0x4f,0xc3,0xb6,0xf3,
+  0xb0,0xd8,0xe9,0x49,0x3c,0xc8,0x19,0x57,0xd7,0xb4,0x04,0x36,0xb9,0x80,0xd0,0x0c,
+  0x0f,0x84,0x9d,0x95,0x26,0x38,0x3b,0xbc,0xc1,0x47,0x33,0x3a,0x21,0xd1,0xa4,0x78,
+  0xd3,0xa3,0x97,0x35,0x84,0x39,0xf0,0x6b,0xc9,0xe8,0xfc,0x96,0x10,0x0e,0xad,0xa8,
+  0x77,0x61,0x70,0x91,0xb4,0x80,0xa7,0x9e,0x95,0x08,0xaf,0x35,0xa8,0xab,0x15,0xb9,
+  0x36,0x43,0xb7,0xd8,0xf9,0x0b,0x58,0x6f,0x1b,0x16,0x0c,0xeb,0x43,0xae,0xd5,0x15,
+  0xab,0x3c,0x7e,0x59,0xd1,0xed,0x16,0xf8,0xad,0xdd,0x19,0xce,0x4b,0x40,0x4b,0x9c,
+  0xd0,0xdc,0x94,0xc3,0x2e,0xee,0xd0,0x73,0x14,0x0c,0xa3,0xde,0x4c,0x14,0xaf,0x71,
+  0x4d,0x44,0x3c,0xe4,0xf1,0xde,0xbd,0x18,0xc4,0x9e,0x96,0x8c,0x4f,0x32,0x50,0xa3,
+  0xd0,0xce,0x64,0x55,0x33,0xdc,0x6c,0xc4,0x77,0xd4,0x8b,0xc9,0x48,0xc8,0xf6,0x38,
+  0x07,0xb9,0x0e,0x41,0xd8,0x6b,0x9f,0xd1,0xea,0x97,0xb9,0xb6,0x51,0x6e,0x83,0xc5,
+  0xeb,0x20,0x20,0xf7,0x34,0x48,0xf5,0x14,0xb2,0x21,0x87,0xa4,0x97,0x7e,0x14,0x36,
+  0x27,0x86,0x15,0x87,0x85,0xc8,0xa9,0x1b,0x12,0x31,0xc9,0x3f,0x23,0x2a,0xed,0x75,
+  0x76,0x94,0x20,0x1e,0x7b,0x58,0xc1,0x3d,0x8a,0x48,0x88,0x1f,0x23,0x62,0x20,0x6d,
+  0xa9,0xa7,0xf2,0x28,0xf2,0x63,0x84,0xf2,0x9e,0x23,0x67,0xe4,0x24,0x94,0x44,0xc9,
+  0x7e,0x14,0x12,0xa0,0xa1,0xe0,0x66,0xab,0x03,0x7a,0x28,0x81,0xd0,0xd1,0xa0,0x7d,
+  0x9e,0x69,0xba,0x7f,0x95,0xa8,0x64,0xe0,0xfb,0x5d,0xf1,0xb0,0x69,0xa4,0x41,0x2d,
+  0x12,0x3b,0xca,0x34,0xd0,0x23,0xa3,0xd8,0x4c,0x49,0x86,0xd0,0x7e,0xe5,0xc1,0x1f,
+  0x43,0xd6,0x06,0xc7,0xcd,0xcd,0x91,0x83,0x6f,0x82,0xe7,0xe9,0x88,0x57,0x95,0x40,
+  0xdd,0x8f,0x9f,0xf3,0xe4,0x16,0xee,0xd2,0x07,0x2e,0xd0,0x59,0xee,0x23,0xe4,0x11,
+  0xc9,0xe5,0x4e,0xd8,0x29,0xa3,0xdd,0xc5,0x43,0x69,0xbb,0x5e,0x2d,0x93,0x56,0x9d,
+  0x24,0xe2,0xe4,0x48,0xe7,0xb4,0x50,0x23,0xd5,0xc9,0xcc,0x06,0x39,0xf3,0x9d,0xa3,
+  0xc4,0x64,0x29,0xc3,0xd7,0x9e,0x54,0xca,0x27,0x74,0x31,0xa1,0x99,0xd1,0x60,0x82,
+  0x11,0x9c,0xe9,0x85,0x81,0x3d,0xe1,0x99,0xe3,0x58,0x07,0x39,0xd7,0x85,0x54,0x90,
+  0x90,0x23,0xa4,0x83,0x4c,0x9a,0xb0,0x76,0xa9,0xf0,0x95,0xb0,0x69,0xe1,0x80,0xe4,
+  0x13,0x3d,0x9c,0x68,0x8b,0x23,0x5a,0x6b,0x03,0xf3,0x04,0xf7,0x9a,0xe7,0xbd,0x81,
+  0x4b,0x3e,0xf3,0xa4,0x1c,0xdf,0xe6,0x26,0x11,0xf6,0x87,0x84,0xc7,0xba,0x1c,0xc7,
+  0x06,0x57,0x22,0x75,0xdd,0xb4,0x66,0x23,0x6d,0x90,0xf8,0xde,0x43,0x18,0x3a,0x94,
+  0x2f,0x4e,0x29,0xa4,0x13,0x50,0x03,0x24,0xaf,0x88,0x3d,0xc8,0x85,0x57,0x6b,0x49,
+  0xf5,0xb8,0xb6,0x2e,0xf3,0x39,0x14,0x6d,0x47,0xe3,0xde,0x30,0x35,0x15,0xd6,0x53,
+  0xbe,0xb5,0xac,0xfa,0x7a,0xeb,0x1d,0x45,0xc3,0x4b,0x3d,0xd2,0x33,0x4d,0xf6,0xa4,
+  0x2a,0x3e,0x97,0x76,0xc6,0x21,0x65,0x46,0x66,0x29,0x5d,0xc9,0xfe,0x58,0xfa,0xd7,
+  0x97,0x7a,0x2c,0xa6,0xab,0x99,0x21,0xc5,0xae,0x66,0xc3,0xac,0xe2,0x10,0x7e,0x23,
+  0x4c,0x48,0x09,0x25,0x97,0xd8,0x87,0x22,0x4c,0xa0,0x6c,0xd4,0xdd,0x7a,0x80,0xf8,
+  0x1f,0xc2,0x09,0x53,0x93,0x2a,0x02,0xed,0x55,0x45,0x9b,0xd5,0x64,0x6d,0xb5,0xa9,
+  0x5d,0x7d,0x03,0x63,0xbf,0x17,0x39,0x68,0xc6,0x0a,0x9d,0x03,0xa4,0xa6,0xa2,0x76,
+  0x73,0x4d,0x52,0x71,0x2a,0x21,0xe7,0x33,0x6d,0xa8,0xd4,0x56,0x57,0xb4,0x2e,0xec,
+  0x5d,0x0e,0x8b,0xa5,0x0b,0xe5,0xa3,0xa3,0x84,0x9e,0xc8,0x47,0x8b,0xd2,0xec,0xd7,
+  0x38,0x7b,0x31,0xcf,0xee,0xb6,0x75,0x67,0x09,0x51,0x10,0x9b,0x38,0xc4,0x23,0xee,
+  0x55,0x81,0x2f,0xe4,0xa8,0x48,0x73,0x6a,0xca,0x9d,0x92,0x35,0x42,0xb8,0x14,0xac,
+  0x2e,0x09,0xeb,0x4d,0x1f,0x0e,0xcb,0x5a,0xa9,0x35,0xd1,0x7a,0x1e,0x38,0xb2,0x8f,
+  0x81,0x33,0x46,0xe2,0x4c,0x99,0x71,0x15,0x78,0xae,0xdc,0xb2,0xb6,0x61,0x25,0x7a,
+  0xed,0xfc,0x8e,0xa8,0xba,0x55,0xfa,0x54,0xad,0xf0,0x92,0xee,0x50,0x0f,0x9b,0xc1,
+  0x4f,0x2e,0x2e,0x94,0xf9,0xfc,0x25,0x79,0x83,0x69,0x5e,0xd8,0xaa,0x92,0x5d,0x72,
+  0x8a,0xdd,0x0a,0x83,0x2a,0xe1,0x3c,0x9d,0xd4,0x40,0x31,0xac,0x1c,0x85,0xa5,0x5a,
+  0x9f,0xce,0x69,0x31,0x9f,0x2c,0x62,0xa7,0x38,0x25,0x5b,0x45,0x66,0x0e,0x8f,0x80,
+  0xaf,0xf9,0x6e,0x4d,0x1f,0xdb,0x49,0xc4,0xb5,0x98,0x9a,0x1d,0xc4,0xef,0x85,0xda,
+  0xb8,0xda,0x99,0x36,0xd6,0x69,0x60,0x29,0xd6,0x66,0xb5,0xd2,0xd9,0x8c,0x99,0xa1,
+  0xa7,0x21,0xfe,0x69,0x84,0x05,0x64,0x62,0x89,0x46,0x67,0xc1,0xb7,0xa4,0xe5,0x95,
+  0xfb,0x47,0xbf,0x64,0x45,0x70,0x5e,0x71,0x6d,0xc8,0x5c,0x57,0xec,0x63,0xce,0x01,
+  0x39,0x9f,0x3d,0x8e,0xe3,0x8f,0xe9,0xa8,0x80,0x18,0x4b,0x71,0x59,0xc1,0x63,0xe7,
+  0x8d,0x81,0xbc,0x37,0xeb,0x32,0x11,0x60,0x4f,0xf9,0x23,0x8a,0xc9,0xa8,0x57,0x52,
+  0xb2,0x97,0xa4,0x86,0x7c,0x6f,0x6c,0x19,0x8a,0xdc,0xbb,0x42,0x34,0xaf,0x6f,0x44,
+  0xac,0x36,0x5d,0x4c,0xb4,0xf5,0x6d,0xd9,0x96,0x80,0x32,0x32,0x6f,0x6d,0xaa,0x5e,
+  0x9c,0x3a,0x48,0xa7,0x63,0x85,0x10,0x22,0x95,0xbc,0x5d,0x26,0x77,0xd7,0xc9,0x7d,
+  0x5e,0xef,0xa5,0xdb,0x9b,0x69,0x85,0x99,0xd5,0xa2,0x51,0xcb,0x5e,0x97,0x75,0x6c,
+  0xc9,0xf0,0x86,0x6c,0x6e,0xf2,0xed,0xd5,0x2e,0xeb,0xdb,0xcb,0xbc,0x30,0x15,0xa6,
+  0xac,0x09,0xec,0x97,0xd9,0x33,0x6b,0x30,0xb6,0x6a,0x60,0x0a,0x40,0x29,0x46,0x54,
+  0xba,0xac,0x98,0xb8,0xf4,0xa2,0x84,0x93,0x29,0x4a,0xe2,0x09,0xd0,0x06,0x97,0xcd,
+  0xd0,0xe9,0x63,0x2e,0x00,0x13,0x3d,0x2b,0xe1,0x1a,0x90,0xb8,0x8d,0x62,0x35,0x1a,
+  0x5d,0x6d,0x99,0x25,0xbb,0xa6,0xc9,0xdd,0xb1,0xdd,0xeb,0xb0,0xa5,0xdf,0x6d,0x71,
+  0x31,0xd6,0xbc,0xa6,0xaf,0xaf,0x05,0x26,0xde,0xd6,0x26,0xb8,0xc3,0x58,0xd6,0x53,
+  0x51,0x1d,0xe3,0xd1,0xa4,0xda,0x7a,0x81,0x97,0xcd,0xb5,0x41,0xed,0x37,0xba,0x67,
+  0xa6,0xb9,0xb4,0x17,0x7e,0xf1,0xbd,0x0b,0x3c,0x29,0x75,0x2d,0x7b,0x9f,0x87,0xca,
+  0x1f,0xfc,0x3c,0x27,0xec,0x13,0x29,0xd4,0x84,0xa0,0xa1,0x69,0xab,0x9f,0xe6,0x41,
+  0xac,0x66,0x4c,0x0e,0x13,0xd9,0xf5,0x95,0xd5,0x24,0x66,0x7b,0xd3,0xc7,0x77,0x53,
+  0xfc,0x57,0x9c,0x69,0x84,0x45,0xe2,0x69,0xf1,0xc0,0xc0,0xec,0x89,0x82,0xb9,0xcc,
+  0x60,0xab,0x16,0x6b,0xb4,0x9c,0xde,0x78,0xd8,0xbc,0x5b,0x71,0xda,0x5e,0x3c,0x3c,
+  0x07,0x95,0xd1,0x64,0x6f,0x46,0x56,0xcb,0x26,0x3b,0xb3,0x75,0x6d,0xe8,0x7c,0xf0,
+  0xfa,0x16,0x6d,0x3b,0x96,0xe2,0x07,0x4f,0x4e,0xb3,0xf5,0xe7,0x50,0xa9,0x75,0x99,
+  0x60,0x00,0x3f,0xa8,0x95,0x9d,0xbe,0xc9,0x64,0x9d,0x5b,0xe3,0x5f,0xc4,0xb3,0x1e,
+  0xf5,0x6c,0x5a,0x51,0x1b,0x93,0xd4,0x25,0x15,0x34,0x12,0x85,0x4c,0x6e,0xde,0x14,
+  0xf9,0xdf,0x8b,0x3e,0xb3,0xd1,0x91,0x2c,0x11,0x05,0x10,0xda,0x44,0x9f,0x3a,0x74,
+  0xd1,0x1d,0x4d,0xf5,0x5b,0xa2,0xdd,0xc2,0x8c,0xfe,0xdc,0x57,0xf9,0xfa,0x67,0xb1,
+  0x86,0x5d,0xd3,0xf2,0xc6,0x20,0x8b,0xcd,0xcc,0xe6,0xbd,0x13,0xeb,0xeb,0x80,0x46,
+  0xa5,0xd8,0xe5,0xa3,0x71,0xb0,0xc9,0xd5,0xe3,0x64,0xcf,0x5d,0xb9,0xb5,0x2b,0x73,
+  0x70,0xe3,0xa5,0xe6,0xc6,0xba,0x39,0xdd,0x55,0x5d,0x75,0x32,0xab,0x99,0xf0,0x8b,
+  0x85,0xec,0xb0,0x25,0xbb,0x52,0x9e,0x27,0x0d,0xd7,0x86,0xe3,0x1d,0x51,0x40,0x0e,
+  0xe7,0x1a,0x5f,0xf1,0xf0,0x1c,0x4c,0x24,0x46,0x91,0xc9,0x48,0x4d,0x2d,0x13,0x92,
+  0xf6,0x7b,0xe6,0x77,0x1a,0xde,0xef,0x85,0x46,0xfc,0xc8,0x0d,0x49,0x63,0xb0,0xf7,
+  0xac,0x38,0x72,0x19,0x73,0xf6,0x98,0x45,0xe7,0x46,0x4d,0x8b,0xfb,0x8f,0x26,0x2b,
+  0x9b,0x16,0x96,0xfa,0xc7,0x65,0x1c,0x72,0x1a,0xcb,0xe8,0xf5,0x85,0xa2,0x33,0xba,
+  0x65,0xfe,0x78,0xeb,0x11,0xd8,0x79,0x06,0x76,0xd0,0x12,0x03,0xf9,0xb7,0xec,0x7e,
+  0x9f,0xab,0x05,0xd7,0x6d,0xa2,0x2b,0x3c,0x55,0x50,0x0a,0xfc,0xfc,0xb8,0x4d,0x3f,
+  0x25,0x25,0xbe,0x6d,0x8a,0x6b,0xb9,0xee,0x91,0xee,0x76,0xa7,0xbf,0xfd,0xe9,0x70,
+  0xf3,0x31,0xc5,0x0f,0xa5,0x6b,0xfc,0x22,0x6b,0xea,0xa6,0x75,0xbf,0x26,0x39,0x4d,
+  0xc1,0x7b,0xd6,0x35,0x49,0xc3,0x27,0x2e,0x2a,0xc6,0x47,0xe7,0x95,0x7d,0x88,0xe7,
+  0x77,0x81,0x06,0x78,0xd4,0xe5,0x2b,0x0a,0xa8,0x15,0xcf,0x14,0x79,0x04,0xe5,0x46,
+  0xf7,0xc7,0x79,0x43,0x53,0x3a,0x82,0x42,0x6d,0xc1,0x95,0x21,0xc3,0xc5,0x28,0xb9,
+  0xb2,0x6f,0xa2,0xb3,0x80,0x97,0x93,0x7d,0x1f,0x54,0x5b,0x03,0x07,0x7e,0xe9,0x27,
+  0x80,0x75,0x93,0x75,0xb4,0x93,0x37,0xa1,0x66,0x69,0x13,0xe8,0x57,0x3c,0x75,0x69,
+  0xc8,0x87,0x16,0xc9,0xb4,0x7c,0x4c,0x22,0x63,0x91,0x04,0x25,0xef,0x74,0x75,0x03,
+  0x98,0x6e,0x18,0x91,0x47,0xbf,0x76,0x56,0xac,0x24,0x62,0x6b,0x75,0x27,0xb2,0xe4,
+  0x6c,0x76,0x35,0x74,0x72,0xa7,0x3e,0x1f,0x08,0x5b,0x15,0x75,0x5b,0xa8,0xa7,0x2e,
+  0xc7,0x67,0x4e,0xb4,0xa7,0x7c,0xb6,0xc7,0x51,0xcd,0xe7,0x4e,0x10,0x57,0x19,0xe0,
+  0xd5,0x2c,0x75,0xb4,0x7d,0x36,0x68,0x5f,0xc0,0x96,0x85,0x58,0x16,0x69,0x5c,0x98,
+  0x6f,0x85,0x73,0x77,0xed,0x17,0x70,0x82,0xc2,0x74,0xf4,0x81,0x24,0xb5,0xe7,0x20,
+  0x43,0xe8,0x22,0x45,0x78,0x5a,0x49,0xc7,0x54,0xd9,0x74,0x81,0xfb,0xf3,0x68,0x14,
+  0x15,0x33,0x70,0xc8,0x72,0x59,0x96,0x15,0xda,0x24,0x7d,0xbb,0x97,0x73,0xbd,0x87,
+  0x71,0x21,0x33,0x5e,0xae,0x05,0x6f,0x8c,0x88,0x44,0x66,0x34,0x69,0x8f,0xe5,0x66,
+  0x32,0x02,0x23,0x23,0xe7,0x25,0x59,0x54,0x26,0x31,0x88,0x7e,0x0d,0xa4,0x7e,0x9e,
+  0x38,0x63,0x00,0x66,0x45,0x72,0x56,0x72,0x38,0x66,0x3c,0xd3,0xf7,0x66,0xa0,0xe8,
+  0x7a,0xad,0x08,0x7b,0xa1,0xe4,0x4f,0xd1,0x04,0x5c,0xd3,0x64,0x82,0xd7,0x86,0x82,
+  0x09,0x74,0x42,0xce,0xd5,0x4a,0xd0,0x05,0x4b,0x54,0x36,0x2f,0xf2,0x81,0x84,0x35,
+  0xc8,0x43,0xb4,0x66,0x58,0x92,0x96,0x86,0x11,0xa1,0x87,0xc8,0x13,0x87,0x31,0xb3,
+  0x89,0xce,0x98,0x2f,0x98,0x07,0x73,0x6f,0x97,0x5c,0x44,0x87,0x10,0xd0,0x98,0x49,
+  0xd2,0xf8,0x3e,0xd9,0x08,0x6d,0xcb,0x45,0x83,0x5e,0xa4,0x8c,0xeb,0x86,0x83,0x3e,
+  0x08,0x86,0xc9,0xa7,0x51,0x63,0xc8,0x7c,0x44,0x98,0x7b,0x47,0x68,0x89,0xef,0x76,
+  0x5d,0xc4,0x24,0x1f,0xd3,0x96,0x4c,0x25,0xc8,0x38,0x27,0x48,0x15,0x29,0x38,0x87,
+  0x4e,0xc5,0x3d,0x00,0x38,0x1e,0x94,0x57,0x43,0xfd,0x77,0x79,0x76,0xb8,0x66,0xa1,
+  0xd7,0x78,0x61,0x86,0x54,0x5b,0xc3,0x75,0xdd,0x03,0x56,0x7d,0xc7,0x83,0x8b,0xe7,
+  0x79,0x00,0x97,0x77,0x8d,0xb3,0x88,0x90,0x46,0x26,0x6a,0x34,0x6e,0x92,0x67,0x76,
+  0xdb,0xd2,0x70,0xc4,0x06,0x23,0xc6,0xd6,0x73,0xc8,0xc6,0x87,0x40,0xb1,0x79,0x5a,
+  0xa8,0x91,0xb2,0xf5,0x72,0x30,0x98,0x8e,0x3f,0x27,0x86,0x7e,0xb8,0x4e,0x80,0x08,
+  0x8f,0x67,0x58,0x85,0x71,0x17,0x6d,0xb8,0xf8,0x5b,0x16,0x92,0x8f,0xc5,0xb3,0x8f,
+  0x08,0x34,0x60,0x5f,0xf8,0x92,0xec,0x18,0x93,0x1d,0x15,0x88,0x0c,0x78,0x8f,0xd2,
+  0x14,0x23,0xbc,0x68,0x80,0x3f,0x19,0x10,0x6b,0x17,0x7c,0x8f,0x45,0x8d,0x3b,0xa6,
+  0x86,0x6e,0xe7,0x60,0x51,0x06,0x61,0xd1,0x55,0x8c,0x6e,0x35,0x46,0xc5,0x87,0x73,
+  0xf6,0x13,0x92,0x36,0x33,0x92,0xa7,0x47,0x87,0x15,0x32,0x7f,0xc0,0xd7,0x5b,0xe1,
+  0x68,0x85,0x38,0x89,0x92,0xdf,0x58,0x3f,0xa9,0x58,0x7d,0xab,0x68,0x63,0xae,0x08,
+  0x64,0x22,0xf8,0x4f,0x09,0x17,0x50,0xdd,0x44,0x1a,0x24,0x33,0x1c,0xd0,0x52,0x63,
+  0xd3,0x02,0x94,0xe5,0x24,0x94,0x7b,0x72,0x7b,0xef,0xe8,0x7c,0x50,0x85,0x16,0xd2,
+  0x73,0x54,0x63,0xc6,0x96,0x8c,0x98,0x7f,0xbf,0xc7,0x89,0x14,0xe7,0x8f,0xe1,0x97,
+  0x97,0x84,0xf3,0x5f,0x27,0xf3,0x97,0x4e,0x89,0x5a,0x43,0xa6,0x5a,0xdb,0x12,0x89,
+  0xfc,0xc6,0x82,0xc9,0x62,0x78,0x12,0xb8,0x20,0x60,0x57,0x81,0xa6,0xa6,0x87,0xc7,
+  0xb4,0x8e,0x83,0x49,0x86,0x85,0x69,0x86,0x50,0x96,0x56,0xae,0x34,0x65,0x6d,0xb5,
+  0x69,0x48,0xa9,0x8b,0x4a,0xa9,0x8f,0xbd,0xc8,0x8f,0x09,0xc4,0x81,0xa1,0x52,0x50,
+  0x83,0xd8,0x58,0xa9,0x23,0x6e,0xdd,0xd2,0x81,0xfb,0x75,0x41,0x46,0x91,0x98,0xcd,
+  0xe4,0x71,0x07,0x09,0x7a,0x18,0x56,0x8a,0xf1,0x77,0x8a,0x14,0x99,0x76,0x55,0x05,
+  0x7f,0x5d,0xf8,0x54,0xa8,0x36,0x7e,0xc4,0x02,0x38,0xf3,0x36,0x3d,0x0c,0x49,0x57,
+  0xbf,0x29,0x4f,0xa7,0xb6,0x9c,0xf7,0xd4,0x9c,0xd4,0x49,0x87,0xea,0xa2,0x90,0x6d,
+  0xd3,0x71,0x0d,0x59,0x95,0x68,0x38,0x95,0x49,0x26,0x9e,0x8a,0x45,0x9e,0xc8,0x58,
+  0x8e,0xbd,0x66,0x80,0xb5,0xb3,0x7e,0x83,0x37,0x9e,0xef,0x87,0x91,0x89,0x88,0x28,
+  0xe4,0x38,0x58,0x4b,0x58,0x58,0x07,0x18,0x5f,0x58,0x67,0x8e,0xf6,0x89,0x8e,0xbc,
+  0x49,0x64,0xdb,0x82,0x9e,0xda,0xa1,0x9e,0x74,0x95,0x96,0x37,0x39,0x8e,0x2a,0x18,
+  0x13,0x93,0x38,0x2a,0xfd,0xd5,0x13,0x96,0xe9,0x97,0x8c,0x93,0x40,0x5c,0x29,0x43,
+  0xf8,0x59,0x66,0xfa,0xd9,0x68,0xdb,0xa9,0x98,0x1e,0x27,0x95,0x13,0xf7,0x9e,0x82,
+  0x07,0xa2,0xf1,0xf9,0x7e,0xfa,0x57,0x79,0x05,0xf9,0x59,0xc0,0xf8,0x84,0x52,0x96,
+  0x95,0xb3,0x49,0x2f,0x13,0xb3,0x7f,0x16,0x93,0x79,0xfe,0x17,0xa3,0x0f,0x16,0x9b,
+  0x34,0x3a,0x85,0x16,0x3a,0x3b,0x7b,0x19,0x19,0x7d,0xf9,0x89,0x1b,0x3a,0x60,0xa2,
+  0xc9,0x5b,0x98,0xf6,0x77,0xa7,0x89,0x6a,0xa9,0x09,0x84,0x7d,0xb8,0x24,0x32,0xd9,
+  0x4e,0x46,0xf8,0x3f,0x13,0xa2,0x93,0xc4,0x82,0x21,0xb8,0xc9,0x94,0xc5,0x75,0x15,
+  0x0a,0xc0,0xa0,0x1c,0xd7,0x9d,0x00,0xc9,0x67,0xe2,0x67,0x67,0xe4,0xd7,0x44,0x8b,
+  0xd2,0x8d,0x13,0xa5,0x40,0x8e,0xd9,0x9e,0x27,0x6a,0x8d,0x2d,0x4a,0x90,0x3a,0x7a,
+  0x79,0x92,0x39,0x83,0x2e,0x69,0x92,0x43,0x29,0xa5,0x45,0x49,0x93,0x2e,0xf7,0x82,
+  0x9a,0x37,0x9f,0x00,0xba,0x2c,0x37,0xb8,0x25,0x0a,0xf0,0x9d,0xcd,0x16,0x9d,0x78,
+  0xa7,0x76,0xb1,0x68,0xa4,0x22,0x47,0x8b,0x24,0x67,0x8b,0x27,0xa7,0x2c,0x17,0xea,
+  0x2c,0x7c,0x69,0x32,0x1a,0x3a,0x4e,0xa4,0x72,0x98,0xf5,0x24,0x9d,0xa1,0x57,0xa7,
+  0xd0,0x79,0xa7,0x19,0xb5,0x9a,0xee,0x38,0x93,0xce,0x57,0x67,0x5a,0x71,0x67,0x4e,
+  0x64,0x9c,0x87,0xf3,0x79,0x21,0xfa,0x39,0xf0,0xe9,0x7e,0x8d,0xa6,0x61,0x97,0x48,
+  0x8f,0x49,0x33,0x4b,0x96,0xe1,0xa7,0xc8,0xa2,0x7a,0x1d,0x05,0x97,0xa1,0x38,0x67,
+  0x37,0x92,0x83,0x10,0x39,0x6a,0x89,0xf7,0x57,0xf0,0xc5,0xa3,0x57,0xe9,0xa3,0xc4,
+  0x58,0xa3,0xa7,0x06,0xa8,0xf3,0x15,0xa0,0xcb,0x38,0xa0,0x2e,0x68,0x71,0xb9,0xaa,
+  0x99,0x65,0x57,0x50,0x10,0x7a,0x36,0x57,0x38,0x07,0x6b,0x58,0xa0,0xf5,0x39,0xa8,
+  0xc3,0xc2,0xac,0x04,0xe8,0xac,0xe7,0xf8,0x43,0x1f,0xca,0xaa,0x2b,0xda,0x68,0xb5,
+  0xb9,0x93,0xbb,0xb8,0xa5,0xb7,0xd2,0xa5,0xdb,0x62,0xac,0xb0,0x39,0x8c,0x24,0xa6,
+  0x95,0x9b,0x96,0xa4,0x7d,0xe5,0x5e,0x16,0xe8,0x95,0x33,0x43,0x7a,0xc5,0xd6,0x52,
+  0x24,0xf9,0x9c,0xeb,0xe8,0x9c,0xd5,0x09,0x75,0x8f,0x48,0x3a,0xd7,0x69,0xa6,0xd9,
+  0x69,0x7e,0x86,0x7a,0x97,0x54,0x18,0x8c,0x50,0x28,0x9b,0x40,0x1a,0x74,0x85,0xa6,
+  0x96,0x12,0x2a,0xab,0xf3,0x58,0x44,0xb5,0xda,0xb0,0x32,0x8a,0x95,0xc9,0x1a,0xb1,
+  0xfc,0xc9,0xa6,0x31,0x93,0xa0,0x9c,0xd9,0xa7,0xd2,0xfa,0x4e,0xd5,0x75,0xaa,0x67,
+  0xaa,0x75,0x4f,0xd9,0x5b,0x1f,0xeb,0x3f,0x02,0x6b,0x9e,0xea,0x17,0x94,0x78,0x2a,
+  0xaa,0x7f,0x48,0xa5,0xa7,0x25,0xb2,0x93,0xe7,0x5b,0x01,0x64,0x9b,0x5a,0xda,0x93,
+  0xb9,0xd9,0x94,0xe6,0x26,0x8f,0xe5,0x45,0xab,0xe8,0x65,0x8f,0x57,0xba,0xb3,0xea,
+  0x7a,0x9b,0x3e,0xcb,0xa5,0xd9,0x06,0xaa,0x61,0x98,0xa7,0xed,0x51,0xb3,0x1e,0x65,
+  0x86,0xa8,0xf9,0x83,0xd4,0x26,0x84,0x53,0x3a,0xb5,0x55,0x5a,0x29,0xa1,0x35,0xa7,
+  0xcf,0x17,0x3f,0x88,0x08,0xb2,0xfe,0xd9,0x5c,0x1b,0x8b,0xac,0xf3,0xaa,0xac,0x53,
+  0x07,0x82,0x91,0x66,0xaf,0x11,0x89,0xaf,0xa6,0x46,0x5a,0x05,0xab,0x7b,0xed,0x81,
+  0x9d,0xd9,0xa7,0x9d,0x29,0x6a,0xae,0xb0,0xfa,0x39,0x26,0x5a,0x7f,0xcf,0xe8,0x76,
+  0x37,0xea,0xa2,0x73,0xfa,0x59,0xe0,0xaa,0x84,0x82,0xea,0x86,0x66,0x09,0x99,0x7d,
+  0xbb,0xb0,0xf3,0x11,0x50,0x9e,0xb9,0x82,0x1a,0xf8,0x4e,0x9e,0x9a,0x2e,0xea,0x37,
+  0xb8,0xb2,0xf3,0xac,0xf7,0xc9,0xb6,0xc2,0x4a,0x81,0x8a,0x97,0xaf,0xa2,0xa7,0x73,
+  0xa5,0x27,0x96,0x0a,0x84,0x7a,0x32,0x15,0xb9,0xfa,0xd6,0xb8,0x14,0x0a,0x9a,0x25,
+  0x01,0xa6,0x58,0x93,0x54,0x7f,0x94,0x73,0x60,0xf9,0x2f,0xa0,0x9b,0x33,0x64,0x09,
+  0x74,0xf0,0xfa,0x5c,0xad,0xd5,0xb1,0xd3,0x85,0x80,0x08,0xf5,0x99,0x8f,0x9b,0x2c,
+  0xaf,0x8a,0x87,0x71,0xd3,0x66,0x6b,0xb4,0x99,0x39,0x8b,0xb9,0x3b,0xe8,0xb6,0x80,
+  0x55,0x9e,0xff,0xf8,0x46,0xc8,0x59,0x6f,0xde,0xb7,0xb7,0x47,0x97,0x64,0x16,0x3b,
+  0xb4,0x18,0x5b,0xb4,0xba,0xdb,0xb9,0x15,0xba,0xb8,0xd1,0x77,0x5a,0xd0,0x77,0x87,
+  0xd2,0x67,0xbc,0xa4,0x39,0xac,0x3d,0x38,0xbd,0x1c,0x46,0xb4,0x29,0x62,0xa3,0x5e,
+  0x03,0xb8,0x37,0xf4,0xb2,0xcb,0x0b,0xbe,0xd2,0x53,0x9a,0x9b,0xdb,0xa4,0xe4,0xab,
+  0x72,0x98,0x58,0x8f,0xad,0xfb,0x95,0xfc,0x2a,0x92,0xfe,0x3a,0x96,0x42,0x89,0x72,
+  0x1b,0x46,0xbf,0xe6,0xab,0x17,0x48,0x34,0xbf,0x68,0xb1,0x72,0xf5,0x48,0xb2,0x36,
+  0x37,0xad,0xbf,0x6b,0x91,0x1d,0x54,0xbb,0xc2,0x78,0xbb,0x67,0xeb,0xb1,0xb7,0x5a,
+  0xb2,0xa1,0x49,0x7c,0x1e,0x2a,0xb3,0xa1,0x8a,0x49,0x84,0x49,0xaa,0x54,0x5b,0xa8,
+  0x47,0x4b,0x82,0xeb,0xba,0xb4,0xed,0xda,0xb4,0xe9,0x9a,0xa5,0xaf,0xe8,0x93,0xee,
+  0xea,0x84,0x3d,0x2a,0xaf,0x6c,0x25,0xc1,0x87,0x88,0x7f,0xd3,0x28,0x18,0x42,0x17,
+  0xa1,0x69,0xd3,0x6e,0x08,0x46,0xbd,0xe7,0x75,0xbe,0x27,0xd6,0x75,0x3a,0x18,0xbe,
+  0x9a,0x4b,0xac,0xb1,0xb5,0xc0,0x8a,0x4a,0xb9,0x6d,0x58,0x6b,0x12,0x0b,0x77,0xd8,
+  0xba,0x96,0x94,0xf9,0x4d,0x95,0x1a,0x4e,0x21,0x27,0x60,0x99,0x79,0xad,0xe8,0x23,
+  0xa1,0xd0,0xcb,0x76,0x88,0x7a,0x87,0x0c,0x4c,0x06,0x75,0x99,0x8b,0x49,0xdb,0xb3,
+  0xb5,0x82,0xc2,0x4d,0x4b,0xc4,0x06,0xea,0xad,0x7b,0x04,0x92,0xf9,0x1b,0x96,0xfb,
+  0x1b,0xba,0xb3,0x7b,0x92,0xaa,0xdb,0x7d,0x74,0xf5,0x96,0xad,0x77,0x7d,0xb5,0x38,
+  0x9a,0xa1,0x84,0x15,0x7f,0x2b,0xa7,0x37,0x74,0xbf,0xfb,0xea,0x18,0xfa,0x5b,0x59,
+  0x25,0x99,0x51,0xfe,0xc4,0x6c,0x0c,0xfb,0x9f,0xcd,0x5a,0xb8,0x46,0x4c,0xc0,0x26,
+  0x52,0xbd,0x3a,0x8c,0xc0,0x5e,0xbb,0xad,0x49,0x58,0xb9,0xe3,0x3a,0x2c,0x42,0x3c,
+  0x9d,0xd1,0x9a,0xc0,0xef,0xd4,0xc6,0x0e,0xaa,0xc7,0x91,0xc5,0xc7,0x68,0xec,0xc7,
+  0x00,0x0b,0xa5,0x27,0x49,0xba,0x85,0x53,0xc2,0xd9,0xe7,0xc5,0x05,0xc4,0xb4,0x29,
+  0xe8,0xc0,0x0f,0xfb,0xa3,0xb9,0x5b,0xae,0x15,0xa9,0xa8,0x55,0x0c,0x95,0x54,0x39,
+  0xc9,0xa1,0x27,0xc5,0xca,0x15,0x51,0xda,0xeb,0xbd,0xa7,0xa5,0xca,0x33,0x8a,0xbb,
+  0x43,0x75,0xb8,0xd5,0x98,0x93,0x48,0x6b,0xc2,0xd6,0x86,0xca,0xd4,0xb2,0x54,0xf8,
+  0xb6,0xbc,0xa4,0x5c,0x6d,0x4b,0x39,0xc2,0x29,0xe8,0xbe,0xe1,0x24,0x91,0x16,0xb8,
+  0xc5,0x58,0x5a,0xca,0x27,0xfc,0xb3,0xee,0x9a,0xba,0x8f,0xec,0x78,0x0e,0x4a,0xc8,
+  0xe1,0x6a,0xc8,0x5b,0x27,0xbc,0x1c,0x49,0x9c,0xdb,0x22,0xca,0xea,0x12,0xcb,0xbd,
+  0x65,0xce,0xea,0x17,0xa7,0xdc,0x15,0xb8,0x63,0x5a,0x7c,0x8e,0x9c,0x8c,0xdd,0xea,
+  0x86,0x57,0x8c,0x90,0xe4,0xd9,0xbd,0x64,0x74,0x5a,0x23,0x9a,0x9c,0xde,0x87,0xc8,
+  0x06,0x9c,0xb1,0x2b,0xeb,0x3a,0xea,0x2c,0x7b,0xea,0x08,0xca,0x50,0xbb,0xc1,0x36,
+  0xcb,0x80,0x62,0x3c,0xcf,0x46,0xac,0xb8,0x85,0x08,0xcc,0xee,0x69,0x8d,0xd0,0x0c,
+  0x60,0xd2,0xfc,0xb6,0xd4,0xda,0x91,0x05,0xd5,0xb2,0xab,0xf6,0x7f,0x64,0xe4,0x90,
+  0x01,0xe9,0x06,0xe5,0x33,0xc3,0x49,0xbc,0x5c,0x9a,0xaa,0x68,0x89,0x3a,0x9d,0x0e,
+  0xed,0x88,0xa7,0xc6,0xcb,0x1c,0x1b,0xc1,0xad,0x3c,0xd0,0x04,0xfa,0xc8,0x45,0x1c,
+  0xce,0x29,0x1d,0x9c,0xae,0xcc,0xa9,0xe4,0x09,0xd3,0xfb,0xec,0xbc,0x74,0xa5,0xd1,
+  0x9d,0xc7,0x98,0x19,0x39,0xb6,0x3b,0x4d,0x3d,0x1e,0x37,0xd1,0x4b,0x6a,0x9a,0x65,
+  0xa5,0xc9,0xa3,0xc7,0xc9,0xb0,0x9b,0xc6,0xb2,0x2b,0x94,0xc8,0x4c,0x70,0x9f,0xea,
+  0xd3,0x21,0xe8,0xc1,0x23,0x88,0x8f,0x21,0xfc,0xc5,0xd8,0x4c,0xc2,0xa6,0xa3,0x74,
+  0x83,0x0c,0xd4,0xfd,0x59,0x3f,0x0b,0x5d,0x80,0x64,0x0c,0xac,0x7c,0x97,0xb9,0x15,
+  0x9d,0xbc,0x30,0x8d,0xce,0xae,0xe3,0xcf,0xf5,0x0b,0xd0,0x92,0x2a,0xa4,0xfe,0xd5,
+  0xc4,0x71,0x89,0x99,0x8e,0x62,0xba,0xbb,0xeb,0x1a,0xcf,0x64,0xd4,0xf0,0x0b,0xc4,
+  0x48,0x04,0xd3,0x27,0xcb,0x23,0x29,0x9b,0xaa,0xec,0xec,0x69,0x81,0xcb,0xb5,0xb3,
+  0xe5,0xb5,0x69,0x9b,0x92,0xef,0x43,0xcb,0xf2,0x09,0x6b,0xdc,0x4a,0xd6,0xf4,0x1c,
+  0xd3,0xf2,0x2c,0xd9,0x46,0x4c,0xd5,0x15,0x55,0xc9,0x8a,0xad,0xb3,0x20,0xac,0xb4,
+  0x5a,0x6d,0xcc,0x03,0x06,0xc7,0xb3,0x28,0xc7,0x8f,0x4a,0xc7,0x5a,0x44,0xcd,0xc3,
+  0x6c,0xcd,0xc5,0xec,0xcc,0x1c,0x6a,0xc1,0x0f,0xc8,0xd2,0x66,0xdb,0xc2,0xd3,0x15,
+  0xcf,0xf4,0x69,0xd9,0xcc,0x88,0xb3,0x1e,0xa9,0xc2,0xc7,0xca,0xc2,0x52,0xd8,0xca,
+  0x35,0xdd,0x4f,0x60,0x2d,0xb6,0xf5,0x63,0xc6,0x4c,0x4d,0x59,0xc7,0xf6,0xc9,0xa9,
+  0x77,0xd3,0x27,0x1d,0x7a,0xb8,0x5d,0x50,0x8e,0xfd,0x7e,0xbf,0xcd,0xb8,0x81,0x39,
+  0xb3,0x1a,0xcc,0x9a,0x1c,0x5c,0xa5,0xde,0x4c,0xb8,0x4c,0x78,0x9f,0xcb,0xcc,0x93,
+  0x9f,0xcd,0xda,0x99,0xfa,0x28,0xcd,0x63,0x8a,0x92,0xab,0xaf,0x9b,0xbc,0x73,0xb1,
+  0xeb,0x73,0x78,0xea,0xbf,0xb3,0xaa,0xc8,0x02,0xec,0x6c,0x95,0xc4,0xb7,0x6d,0xe7,
+  0xd6,0x01,0xcc,0x60,0xba,0x1d,0xaf,0x10,0x2c,0xdb,0xbf,0xdc,0x80,0x0f,0x79,0xd6,
+  0xc7,0x5b,0x6a,0x6a,0x3d,0xde,0xc8,0xad,0x2e,0xa2,0x4d,0x45,0xa4,0x2d,0x8a,0x26,
+  0x47,0x8a,0x64,0xbb,0xc2,0xf9,0xdd,0xdb,0x13,0x96,0xcb,0xf9,0x2c,0xb7,0x0c,0x27,
+  0x89,0xa0,0x59,0xd2,0xec,0x67,0xcf,0xef,0xf7,0xdc,0x79,0xc8,0x9e,0xf1,0x1d,0xbd,
+  0xd6,0x88,0xd9,0x31,0x0c,0x62,0xf8,0x3d,0x62,0xfa,0x5d,0x65,0xca,0x8d,0xc5,0x8a,
+  0xda,0xa1,0x95,0x43,0x30,0x09,0x48,0xe1,0xbd,0x0b,0xb7,0xdb,0xbb,0xd7,0x95,0x16,
+  0xac,0xff,0xcd,0xa4,0xc9,0xcb,0xd6,0xae,0x16,0xdd,0xc7,0x28,0xae,0x95,0x49,0xd7,
+  0x97,0x79,0xa4,0x99,0x89,0xc1,0x4f,0x4b,0xb3,0x59,0x6b,0x94,0xef,0x84,0xe3,0x14,
+  0x87,0xe4,0x49,0x06,0xdb,0xbc,0x2d,0x54,0x26,0xe6,0xd1,0x1d,0x5d,0x89,0xee,0x86,
+  0xc3,0x1e,0xa6,0xb1,0x0c,0x4e,0xe2,0x0e,0x6e,0xe2,0x98,0x2c,0xa6,0xa6,0x75,0xc3,
+  0xe5,0xeb,0xde,0xf6,0xad,0xaa,0x9b,0xba,0xdc,0xf7,0xec,0x88,0x31,0x7e,0xe4,0x32,
+  0x3c,0xb1,0x34,0x7c,0x34,0x50,0xde,0x95,0x9c,0x8d,0xd5,0x9e,0x7d,0xca,0xe0,0x1d,
+  0xc5,0x56,0x39,0xe2,0x51,0xe8,0xe4,0xc6,0x68,0xde,0x4b,0x8d,0xde,0x4e,0xad,0xde,
+  0x80,0xcc,0xbc,0x46,0xc5,0xcf,0x4a,0xb5,0x70,0x51,0x67,0xb0,0x20,0xde,0xd8,0x77,
+  0xfb,0xca,0xd3,0x49,0xdc,0x7c,0xee,0xc9,0xa2,0x0b,0x74,0x30,0x4d,0xdf,0x60,0xbe,
+  0x69,0xf8,0x5c,0x7c,0xfa,0xdc,0x25,0xcd,0x4b,0xd4,0xeb,0x59,0xd8,0xfc,0xe7,0xce,
+  0x27,0x8e,0xe1,0x8d,0x76,0xe8,0x17,0xa1,0xd4,0x9e,0xdb,0xaf,0x8e,0xbe,0xc6,0x1f,
+  0x6e,0xe6,0xba,0xfc,0x4c,0x3a,0x7e,0x5c,0x48,0x3c,0xc5,0xb8,0xac,0xe2,0x01,0x78,
+  0xc4,0xda,0x98,0xad,0x10,0xfd,0xa6,0x03,0xd9,0xce,0xeb,0x5b,0xa6,0x28,0x9b,0xb0,
+  0x4f,0xb1,0xd8,0x6d,0xf9,0xb5,0x13,0xce,0xbb,0x7a,0x0d,0xb9,0x02,0x5e,0x9d,0xda,
+  0x2c,0x4b,0x0b,0xb9,0x98,0x78,0xed,0x70,0xa7,0xc5,0xd7,0xe2,0x3b,0x91,0xca,0x1b,
+  0x7e,0x8c,0xfe,0xb9,0x7d,0xfe,0xc7,0x4f,0xfb,0x9a,0xb6,0x8b,0xe5,0x78,0xee,0x56,
+  0x95,0x7e,0x30,0x0c,0xa8,0xd9,0x30,0xb7,0xc4,0x43,0xda,0x45,0x3f,0x8e,0xa9,0x41,
+  0x3e,0xb7,0x08,0x5b,0xb7,0xe6,0xf7,0xed,0xe8,0xf3,0x4c,0x30,0x5d,0xed,0xa6,0x7e,
+  0xdc,0x8f,0x5e,0x11,0x16,0x9e,0x9f,0xe7,0x1a,0xbc,0x1a,0x1e,0xbc,0x5b,0xce,0xec,
+  0xd3,0x9d,0xc1,0xe9,0x34,0xaa,0x09,0x8d,0xe6,0xcf,0x46,0xb1,0xb8,0xbc,0xd6,0x75,
+  0xbe,0xed,0x77,0x5e,0x62,0x79,0x1e,0xd7,0xde,0x54,0xee,0x6f,0x75,0xee,0x50,0xfc,
+  0xae,0x09,0xff,0xc0,0xdc,0xce,0xf0,0x5b,0x39,0xe3,0xfe,0xed,0xc3,0x69,0x0d,0x5f,
+  0xf2,0xde,0xc7,0xf4,0x8e,0xea,0xf7,0xae,0xa2,0x79,0x3b,0x14,0x0e,0x19,0x81,0x4a,
+  0xda,0xd7,0x3d,0xc8,0xe9,0x39,0x9a,0xc7,0xe2,0x7d,0x6b,0x30,0x7b,0xeb,0xf2,0xcd,
+  0xc8,0xd8,0xf8,0x98,0xc1,0xcc,0xeb,0x82,0xed,0xeb,0x14,0xef,0xa6,0x33,0x3f,0xed,
+  0x76,0xca,0xe4,0x0d,0xde,0xed,0xb4,0xf9,0xc1,0x70,0x6e,0xca,0xdc,0x31,0xe7,0xef,
+  0x7a,0xc7,0xba,0x4e,0x73,0xfd,0x5e,0xa2,0x36,0x1f,0xd1,0x7a,0x5e,0xea,0x20,0xff,
+  0xaf,0xf5,0x2e,0xd1,0x1a,0x0f,0x7b,0xef,0x1b,0xed,0x9c,0x2b,0xee,0xb5,0x15,0xd5,
+  0x32,0x78,0x8a,0x32,0xef,0xe1,0xa6,0x9a,0xf3,0xec,0x9e,0x67,0x07,0xdb,0xeb,0x65,
+  0xbf,0xa0,0xdb,0xbc,0xec,0x1e,0xd7,0xec,0x93,0x88,0xd8,0x2c,0xa9,0x79,0xfb,0x6e,
+  0xf2,0xfc,0xfd,0xd1,0x34,0xdf,0xf5,0x7e,0x9b,0xbe,0x78,0xec,0x59,0x21,0xad,0xe6,
+  0x23,0x8d,0xcb,0x73,0xbf,0x18,0xa4,0xfe,0xba,0xc6,0x4d,0xf5,0xa8,0xce,0xbe,0xe1,
+  0xd7,0xea,0x94,0x5d,0xdb,0x3c,0x4e,0xc6,0x19,0xb7,0xf6,0xe9,0xc9,0xe5,0x6e,0x8f,
+  0xba,0x5d,0x9e,0x72,0x05,0xfc,0xd6,0xd6,0x1b,0xdc,0x2e,0xab,0xf9,0x1b,0x0d,0xd8,
+  0x60,0x0b,0xc3,0x63,0xfb,0xf1,0x9d,0x1c,0xf2,0xfd,0xeb,0xf0,0x7a,0x39,0xd7,0x44,
+  0x6a,0xa9,0x8c,0x3a,0xf1,0xae,0x5e,0xeb,0x6b,0x29,0xeb,0x02,0xc9,0xf9,0x3f,0xad,
+  0xce,0xb4,0x1d,0xa8,0xdb,0x9d,0x37,0x23,0x8f,0xb7,0xc0,0xdb,0x38,0x43,0xdd,0x9d,
+  0x55,0x5b,0xd0,0x57,0xdb,0x8e,0x52,0x6b,0xe4,0x56,0x07,0xd9,0x32,0x3d,0xc6,0x93,
+  0xad,0xe4,0x6d,0xc7,0xf5,0x9a,0xe7,0xee,0xa6,0xc5,0x4d,0x42,0xfb,0xe5,0x39,0xfc,
+  0xde,0xf4,0x94,0xe9,0x5c,0x0e,0xf4,0x17,0x4f,0xaf,0x7a,0x32,0xd6,0x8d,0x6f,0xb8,
+  0x0b,0xd7,0xe2,0xc4,0xfe,0x70,0x04,0x2d,0x98,0xd5,0x2d,0xf0,0x5a,0x7b,0xe9,0x51,
+  0x45,0xf2,0xbb,0xdf,0xc0,0x4a,0x6f,0xd8,0xbb,0xee,0xfc,0xdb,0x64,0xb2,0xff,0x3e,
+  0xe4,0xe5,0x3f,0xfc,0x7c,0x4a,0xeb,0xe2,0x58,0xc3,0x6d,0x06,0x45,0xb2,0x68,0xe0,
+  0x72,0x81,0x7d,0xa3,0x28,0xc7,0xf8,0x3c,0xb0,0x27,0xe5,0xbc,0x1c,0x00,0x9b,0x74,
+  0xe8,0x8b,0x86,0x2c,0x3d,0x50,0xb3,0x7d,0xb8,0x19,0x97,0x6b,0x6e,0xbd,0x41,0x0f,
+  0xd1,0x2d,0xec,0xf2,0xeb,0x64,0x5f,0x23,0x1a,0x76,0x8e,0xab,0xd8,0xf9,0x2e,0x4c,
+  0x17,0xe8,0x78,0x1a,0xe2,0xb3,0x53,0x81,0xad,0x6f,0x0c,0x36,0xf3,0x63,0xcb,0xb6,
+  0x11,0x73,0xc1,0x7e,0x0b,0x4f,0xfb,0xc1,0x37,0xfa,0xe3,0xe1,0x08,0xd6,0x99,0x2b,
+  0x7e,0x82,0x0a,0xe2,0x15,0xa9,0x00,0x53,0x1b,0x5a,0x1b,0x0f,0xa3,0x71,0x1c,0x0f,
+  0x79,0xc1,0x17,0xee,0x07,0xce,0x06,0x14,0x0a,0x84,0x58,0xb3,0xed,0xd5,0xc4,0x40,
+  0xd4,0x67,0xee,0x2e,0x15,0xeb,0x83,0x70,0x96,0x4e,0x6e,0xbd,0x30,0xb5,0x35,0x8d,
+  0xda,0x5f,0xa7,0xdb,0x75,0x2c,0x6f,0xe6,0x30,0x40,0x08,0x58,0x64,0x84,0x9c,0x6a,
+  0xaa,0x7f,0x45,0x8e,0x26,0x79,0x3d,0xf2,0xa6,0x6f,0x78,0xe0,0xed,0x23,0x54,0xdd,
+  0x2d,0xab,0xc9,0x39,0x6b,0x12,0xc6,0xa2,0xdf,0x01,0x9c,0x7e,0x61,0xae,0xe9,0x79,
+  0x1f,0xc5,0x17,0x05,0x2d,0xcf,0x67,0x11,0x75,0xb6,0xe5,0xd8,0xc1,0xac,0xeb,0x95,
+  0x81,0x34,0xe0,0xf8,0xa3,0x6e,0x01,0xcf,0xfe,0x19,0x26,0x21,0xa8,0x43,0x0a,0xd9,
+  0x17,0xfc,0x56,0xc6,0xaf,0xb2,0x75,0x3f,0x23,0xa6,0xfc,0xd8,0xdb,0xc5,0x42,0x83,
+  0xf5,0xca,0xb5,0x3d,0x94,0xda,0xe7,0x07,0x05,0x14,0xbb,0x41,0x35,0xd1,0xa8,0x31,
+  0xa9,0x24,0xd1,0xd7,0xd4,0x4e,0x5d,0xe9,0x53,0x7c,0xd0,0xee,0x87,0xf5,0x20,0x4a,
+  0x58,0xf8,0xf8,0xd7,0x7a,0xc3,0x79,0x22,0x50,0xe7,0x05,0xb4,0xc7,0x42,0xee,0x88,
+  0x60,0xc4,0x33,0x82,0x35,0x70,0xc0,0x94,0xc0,0x6c,0xa5,0xed,0x2c,0x5e,0x0a,0x44,
+  0x5b,0x17,0x8d,0x9c,0xc1,0xb8,0x55,0x47,0xf0,0x3a,0x9c,0x15,0xe3,0x68,0x6e,0xee,
+  0x07,0xb2,0xb2,0x07,0xe7,0x05,0x1d,0x21,0xee,0x13,0x67,0xc3,0xa9,0x37,0xb9,0x11,
+  0x35,0xf8,0xa0,0x9e,0xde,0x9b,0xba,0x6f,0x0a,0x0f,0x08,0x3e,0xb8,0xc0,0x97,0x4f,
+  0xac,0xa0,0x41,0x23,0x72,0x7b,0xaa,0x54,0x4d,0xa8,0xbc,0x26,0xfe,0x16,0x9f,0xed,
+  0xf3,0x85,0xe4,0xaa,0x10,0x56,0xbe,0xff,0x75,0xf9,0xea,0x5b,0x6c,0x51,0x7c,0x3a,
+  0x8d,0x03,0xd2,0x1b,0x4d,0xd7,0xd3,0xe6,0xdf,0x15,0xcc,0x83,0x59,0x50,0x1a,0x96,
+  0x42,0x0c,0xe5,0xe3,0x50,0x21,0x57,0x0b,0x50,0x5e,0x6d,0x71,0x19,0x22,0x78,0x13,
+  0x0a,0xd3,0x9e,0x21,0xa4,0x72,0xf1,0x66,0xa5,0x55,0xbc,0x55,0xe6,0xcb,0x4c,0x1c,
+  0xf3,0x9b,0x56,0x9c,0xd0,0xf4,0xa8,0xb1,0xd2,0xa7,0x0d,0x0b,0x5c,0xa3,0x3a,0x70,
+  0xbe,0x2a,0xf6,0x58,0xc0,0xfc,0xe3,0x04,0x5b,0x1e,0xcd,0x91,0x74,0x88,0xb0,0x98,
+  0x7c,0x3e,0x26,0x38,0xb6,0xc2,0x60,0x9c,0x3b,0x7a,0x64,0x30,0x05,0x31,0x43,0x60,
+  0x27,0x09,0xc7,0x56,0x2f,0xb4,0x5c,0xbf,0x10,0xfe,0x1d,0x14,0x09,0xb8,0xee,0x28,
+  0xa0,0xa3,0xa0,0x7d,0x67,0x8f,0xec,0x99,0xc4,0x51,0x48,0x71,0xa8,0xe0,0xce,0xb3,
+  0x85,0xb2,0xac,0x6f,0xc1,0x3e,0x72,0x61,0x10,0xad,0xcf,0xff,0x9b,0x63,0x01,0x10,
+  0x16,0x11,0xc3,0xea,0xd7,0x01,0xc9,0x21,0x1d,0x74,0x71,0x76,0xf0,0xd3,0x31,0x27,
+  0x16,0xd5,0x10,0xa5,0xe0,0x8e,0x32,0x86,0x3d,0x6f,0x23,0x3a,0xad,0x73,0x88,0xb5,
+  0xa2,0xa1,0x6b,0x8a,0x85,0xc2,0xb0,0xc8,0x28,0xbf,0xbe,0xf7,0xea,0x6e,0x19,0xa2,
+  0x51,0x8a,0xbd,0xcf,0xdf,0x2d,0x41,0xc6,0x56,0x3f,0x42,0xe0,0x75,0x29,0x3f,0x66,
+  0x0f,0x22,0x56,0x39,0x3b,0xa6,0xf7,0x16,0xa0,0xff,0xd9,0x89,0x03,0x50,0x72,0xb9,
+  0x40,0x5a,0xf8,0xb5,0xba,0x16,0xcc,0x71,0x86,0xc1,0x8f,0x28,0x95,0x21,0xec,0xb6,
+  0x14,0x9f,0x21,0x16,0x74,0x8a,0x5b,0x2b,0xd8,0xb8,0xae,0x33,0x56,0x09,0x49,0xdf,
+  0x27,0xfc,0x88,0x91,0xcc,0x97,0x04,0x42,0xc6,0xd7,0x03,0x1f,0xa1,0x52,0x84,0x83,
+  0xc8,0xd0,0x15,0x2a,0x43,0x13,0xb7,0x0a,0xd7,0x92,0x2e,0xec,0x87,0x0d,0x0f,0x30,
+  0x1e,0x28,0x42,0x95,0x15,0x3d,0x0e,0x5a,0x84,0x8b,0x41,0x48,0xf8,0xa5,0xc3,0xa7,
+  0xa8,0x0d,0x1f,0xa3,0x4b,0x7b,0x70,0x9e,0xb1,0xc4,0x19,0xa3,0xc4,0xc8,0x0f,0x3f,
+  0xa3,0x89,0x9b,0x89,0x3c,0x71,0x1c,0xfa,0x3e,0xab,0xb6,0x87,0x92,0x92,0xd1,0xab,
+  0x26,0xd8,0xe6,0x43,0xa0,0xb6,0xce,0xf6,0x1a,0xc1,0x58,0x0a,0x82,0x83,0xc2,0x8c,
+  0x36,0x5e,0x33,0xd0,0x96,0x99,0x2c,0x62,0x6d,0xdc,0x6a,0xfd,0x48,0x0e,0x2e,0xaf,
+  0xce,0xb8,0x0f,0x7b,0x99,0x69,0x1c,0x8d,0x7c,0x30,0x97,0x7c,0xb3,0x3f,0xb8,0x47,
+  0xfe,0xa1,0xef,0x11,0x71,0xc9,0x70,0x17,0x32,0xc6,0x34,0x57,0x15,0x4d,0x60,0xae,
+  0x73,0x7f,0x34,0x47,0xf1,0xb9,0x44,0x96,0x88,0xa2,0xd2,0x9f,0xee,0xcb,0x62,0xf5,
+  0x6c,0x28,0xc6,0x2a,0x33,0xd8,0x0d,0x11,0xa0,0x7c,0xf0,0x7c,0xd2,0xc3,0x6a,0x65,
+  0x46,0xb9,0xd8,0x9a,0xf2,0xa2,0x57,0x44,0x55,0x24,0x10,0x29,0x8a,0x3d,0x6b,0xd8,
+  0x08,0x41,0x22,0xb9,0xf2,0x8d,0xbb,0x11,0xe9,0x09,0xa7,0x81,0x12,0x15,0x77,0x1e,
+  0x0a,0x89,0x8e,0x90,0xd1,0xad,0x28,0xc5,0x36,0xf8,0xa2,0xda,0x9c,0x87,0x0a,0x8d,
+  0x59,0x0e,0x39,0x8a,0x44,0xee,0xa5,0xea,0x22,0x5c,0x2d,0x64,0x81,0xb7,0x10,0x35,
+  0x0a,0xc5,0x56,0xd5,0x38,0x08,0xa4,0xa7,0x43,0x8f,0x4d,0x87,0x22,0x76,0xc5,0x89,
+  0xc8,0x15,0xad,0xd4,0x55,0x73,0x8d,0xf9,0x31,0x23,0xfe,0xa2,0xe2,0xd8,0xd2,0x44,
+  0xa3,0x5b,0x69,0x8c,0x12,0x0a,0x25,0x4a,0xc6,0xb2,0xb6,0x10,0x43,0x1c,0x4c,0x64,
+  0x59,0x13,0xcc,0x92,0xc1,0xc0,0x49,0x15,0x3b,0x66,0xe0,0x13,0x4b,0x85,0x99,0x49,
+  0x2c,0xe6,0xc3,0x0f,0xf8,0xa9,0xb6,0x23,0x54,0x54,0x50,0xdc,0xd1,0xea,0xdd,0xc0,
+  0x8d,0x97,0xf5,0x34,0xa1,0xb4,0x03,0x87,0xc2,0x31,0xb7,0x90,0x44,0xb4,0xb7,0x12,
+  0xe9,0xe3,0x72,0xc4,0x86,0x92,0x2c,0xd1,0xe1,0x34,0xe8,0xd6,0xd5,0x08,0x91,0x4a,
+  0xcb,0x6e,0x90,0x6c,0x32,0x0e,0x0b,0xdc,0xe8,0x24,0xb5,0x1b,0x94,0x6c,0x8e,0x18,
+  0x08,0x28,0x56,0xc3,0xf7,0x38,0x02,0xc3,0xe2,0x60,0xbc,0x86,0xf6,0x71,0x58,0x20,
+  0x48,0xa1,0x67,0xab,0xb6,0x62,0xb0,0x0b,0x92,0x6a,0x2a,0x6c,0x6d,0xbe,0x48,0x47,
+  0x1e,0x13,0x59,0x44,0xd4,0x87,0x3c,0x6f,0x3e,0xae,0x43,0x4a,0x95,0xfa,0x9c,0x18,
+  0x35,0x39,0x66,0x90,0xd0,0x1b,0x75,0x44,0x4e,0x22,0x25,0xc9,0xdc,0x7e,0x32,0x87,
+  0x76,0x11,0x1d,0xe2,0xc5,0x67,0xa7,0x08,0x63,0x1f,0x7e,0x5c,0x6d,0x22,0x32,0xbc,
+  0x2d,0x48,0x09,0x57,0xe8,0xfc,0x4d,0xa1,0x44,0x71,0xd3,0x69,0x2a,0x72,0x38,0x08,
+  0x19,0x13,0x53,0xdd,0xe4,0x60,0x8b,0x1c,0x31,0xa8,0xb9,0x25,0xfe,0xc7,0xa8,0x6c,
+  0x22,0x2b,0x2a,0x6d,0x39,0xd1,0xf8,0xa8,0x3b,0x26,0x09,0x16,0x1d,0x85,0x8e,0xcc,
+  0x44,0x56,0x6e,0xb7,0x05,0x3d,0x8c,0x17,0x5b,0x9c,0xa3,0xd5,0xa9,0x93,0xff,0x2c,
+  0xf3,0xa1,0x48,0x5c,0xc6,0x25,0x2b,0xa3,0xf7,0xb9,0x8c,0x61,0x32,0xfc,0xa1,0xbf,
+  0x55,0xa5,0xe8,0x42,0xcf,0x8a,0x9c,0x6c,0x5c,0x92,0x4c,0x8a,0xc2,0xb4,0xd8,0x05,
+  0xcf,0x64,0x7d,0x0c,0x8c,0xba,0x8a,0xf5,0x8c,0xb6,0x9b,0x88,0x2a,0x13,0x9c,0x00,
+  0xd4,0x86,0x68,0x71,0x40,0x92,0xc8,0xd8,0x96,0x20,0x05,0xa4,0x38,0xe4,0x4e,0xfe,
+  0xee,0x53,0x3a,0xc8,0x33,0xf4,0x22,0x05,0x5a,0x92,0xb4,0x53,0x7b,0xb2,0x46,0xaa,
+  0x3e,0x1a,0xd8,0xb4,0x60,0x1a,0x26,0xdc,0x8b,0xc5,0x4d,0x20,0x3e,0xb5,0x4f,0x98,
+  0x09,0x3b,0x5e,0x6c,0x09,0x88,0xe9,0x0d,0xdb,0x05,0x2c,0x7d,0x12,0x0f,0x0b,0x11,
+  0x8f,0x2c,0x6f,0xcd,0x08,0xea,0x75,0x2e,0xc2,0x27,0x2f,0xfd,0x5c,0xb6,0x9b,0x90,
+  0xf9,0x8e,0xee,0x1d,0xcb,0xcb,0xc6,0x21,0xdf,0x64,0x97,0xcc,0x92,0x8e,0x8f,0x35,
+  0x72,0x31,0x62,0xd6,0xcc,0x22,0xa5,0x97,0x5a,0x98,0xcc,0x68,0x57,0xb2,0x39,0xfe,
+  0x86,0xf2,0xee,0x15,0x80,0x83,0x2f,0xbe,0x92,0xae,0xe0,0xcb,0x6b,0x87,0xdc,0x46,
+  0xd7,0xb9,0xfc,0x54,0x87,0x31,0x58,0x66,0xc0,0x87,0xc3,0x5f,0xe4,0x1a,0x3b,0xec,
+  0x93,0x75,0x0d,0xc8,0x99,0x1b,0x67,0xf9,0x24,0xd3,0x24,0x98,0x74,0x8b,0x2d,0x49,
+  0x1b,0xa6,0xcb,0x0c,0xb5,0xfa,0x70,0x64,0x67,0x6a,0x98,0x83,0x92,0x12,0x21,0xbc,
+  0x3c,0x79,0x0b,0x2d,0x24,0x14,0x2c,0x8a,0x6e,0x10,0x4b,0xce,0xb4,0x01,0x85,0x31,
+  0x07,0x94,0x8e,0x0b,0x7b,0xb7,0x70,0x67,0xb6,0xc3,0x9e,0xd9,0x28,0x1e,0x9f,0xb2,
+  0x8b,0x7c,0x8b,0x69,0x4d,0xd2,0x4a,0x4d,0x84,0x34,0x5f,0x54,0x2b,0x2c,0x8d,0x26,
+  0x72,0xd3,0x34,0xcd,0xfb,0x64,0x2b,0x93,0x1d,0x5c,0xc1,0x9a,0x1e,0xc7,0x5d,0x12,
+  0x3d,0x10,0x09,0x29,0x63,0x63,0x02,0xc1,0x84,0x57,0x6f,0x34,0x15,0x49,0x7b,0x99,
+  0x5e,0x86,0x24,0xd6,0x8b,0x66,0x03,0x01
+};
+
+const CArcBenchRef g_ArcBenchRefs[] =
+{
+  { "Zstd", "zstd", "zstd", kZstd, sizeof(kZstd) },
+  { "WIM:LZMS", "wim", "LZMS", kLzms, sizeof(kLzms) },
+  { "ZIP:LZFSE", "zip", "LZFSE", kLzfse, sizeof(kLzfse) },
+  { "ZIP:Implode", "zip", "Implode", kImplode, sizeof(kImplode) },
+  { "RAR3", "Rar", "Rar", kRar3, sizeof(kRar3) },
+  { "RAR5", "Rar5", "Rar5", kRar5, sizeof(kRar5) },
+  { "Z", "Z", "Z", kZ, sizeof(kZ) }
+};
+
+const unsigned g_NumArcBenchRefs = Z7_ARRAY_SIZE(g_ArcBenchRefs);
@@ -0,0 +1,20 @@
+// ArcBenchRef.h
+
+#ifndef ZIP7_INC_ARC_BENCH_REF_H
+#define ZIP7_INC_ARC_BENCH_REF_H
+
+#include "../../../Common/MyTypes.h"
+
+struct CArcBenchRef
+{
+  const char *Name;
+  const char *Format; // archive type for FindFormatForArchiveType()
+  const char *Method; // method name for rating complexity in BenchArcs()
+  const Byte *Data;
+  unsigned Size;
+};
+
+extern const CArcBenchRef g_ArcBenchRefs[];
+extern const unsigned g_NumArcBenchRefs;
+
+#endif
@@ -39,3 +39,10 @@ HRESULT BenchCon(DECL_EXTERNAL_CODECS_LOC_VARS
   return Bench(EXTERNAL_CODECS_LOC_VARS
       &callback, NULL, props, numIterations, true);
 }
+
+HRESULT BenchArcsCon(const CObjectVector<CBenchArc> &arcs, UInt32 numIterations, FILE *f)
+{
+  CPrintBenchCallback callback;
+  callback._file = f;
+  return BenchArcs(&callback, arcs, numIterations);
+}
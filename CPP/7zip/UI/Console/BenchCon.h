@@ -6,9 +6,12 @@
 #include <stdio.h>
 
 #include "../../Common/CreateCoder.h"
+#include "../../UI/Common/Bench.h"
 #include "../../UI/Common/Property.h"
 
 HRESULT BenchCon(DECL_EXTERNAL_CODECS_LOC_VARS
     const CObjectVector<CProperty> &props, UInt32 numIterations, FILE *f);
 
+HRESULT BenchArcsCon(const CObjectVector<CBenchArc> &arcs, UInt32 numIterations, FILE *f);
+
 #endif
@@ -6,6 +6,8 @@ CFLAGS = $(CFLAGS) -DZ7_DEVICE_FILE
 !ENDIF
 
 CONSOLE_OBJS = \
+  $O\ArcBenchCon.obj \
+  $O\ArcBenchRef.obj \
   $O\BenchCon.obj \
   $O\ConsoleClose.obj \
   $O\ExtractCallbackConsole.obj \
@@ -1180,6 +1180,7 @@ HRESULT ListArchives(
     options.stdInMode = stdInMode;
     options.stream = NULL;
     options.filePath = arcPath;
+    options.writeSeekIndex = listOptions.WriteSeekIndex;
 
     if (enableHeaders)
     {
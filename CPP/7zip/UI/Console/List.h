@@ -12,11 +12,13 @@ struct CListOptions
   bool ExcludeDirItems;
   bool ExcludeFileItems;
   bool DisablePercents;
+  bool WriteSeekIndex;
 
   CListOptions():
     ExcludeDirItems(false),
     ExcludeFileItems(false),
-    DisablePercents(false)
+    DisablePercents(false),
+    WriteSeekIndex(false)
     {}
 };
 
@@ -67,6 +67,7 @@ typedef PROCESS_MEMORY_COUNTERS *PPROCESS_MEMORY_COUNTERS;
 
 #include "../../Common/RegisterCodec.h"
 
+#include "ArcBenchCon.h"
 #include "BenchCon.h"
 #include "ConsoleClose.h"
 #include "ExtractCallbackConsole.h"
@@ -156,6 +157,7 @@ static const char * const kHelpString =
     "  -bd : disable progress indicator\n"
     "  -bs{o|e|p}{0|1|2} : set output stream for output/error/progress line\n"
     "  -bt : show execution time statistics\n"
+    "  -bts : show execution time statistics with times of extraction stages\n"
     "  -i[r[-|0]][m[-|2]][w[-]]{@listfile|!wildcard} : Include filenames\n"
     "  -m{Parameters} : set compression Method\n"
     "    -mmt[N] : set number of CPU threads\n"
@@ -166,6 +168,7 @@ static const char * const kHelpString =
     #endif
     "  -r[-|0] : Recurse subdirectories for name search\n"
     "  -sa{a|e|s} : set Archive name mode\n"
+    "  -sap : append new files to existing archive in place, if possible\n"
     "  -scc{UTF-8|WIN|DOS} : set charset for console input/output\n"
     "  -scs{UTF-8|UTF-16LE|UTF-16BE|WIN|DOS|{id}} : set charset for list files\n"
     "  -scrc[CRC32|CRC64|SHA256"
@@ -180,6 +183,7 @@ static const char * const kHelpString =
     "  -seml[.] : send archive by email\n"
     "  -sfx[{name}] : Create SFX archive\n"
     "  -si[{name}] : read data from stdin\n"
+    "  -sidx : write seek index file (archive.7zidx) for -t{Type}.gz and -t{Type}.bz2\n"
     "  -slp : set Large Pages mode\n"
     "  -slt : show technical information for l (List) command\n"
     "  -snh : store hard links as links\n"
@@ -788,6 +792,118 @@ static void PrintStat(const UInt64 startTime)
 #endif // ! _WIN32
 
 
+static const char * const k_PhaseNames[NPhaseStat::kNumPhases] =
+{
+    "Scan"
+  , "Open"
+  , NULL // it's name of command
+  , "Header"
+};
+
+static const char * const k_IoNames[NIoStat::kNumKinds] =
+{
+    "Read"
+  , "Write"
+  , "Open"
+  , "Close"
+};
+
+static const char * const k_StageNames[NArchive::NExtract::NStage::kNumStages] =
+{
+    "Decode"
+  , "Filter"
+  , "CRC"
+  , "Write"
+};
+
+static void PrintPhaseName(const char *s)
+{
+  *g_StdStream << s;
+  for (unsigned i = MyStringLen(s); i < 8; i++)
+    *g_StdStream << ' ';
+}
+
+static void PrintPercent(UInt64 val, UInt64 total)
+{
+  PrintNum(total == 0 ? 0 : val * 100 / total, 7);
+}
+
+/* (Wait) is time when main thread didn't use CPU:
+     it was waiting for I/O or for other threads.
+   (Main %) and (Other %) is CPU usage of main thread and of all other threads. */
+
+static void PrintPhaseStat(const CPhaseStat &stat, const char *processName)
+{
+  *g_StdStream << endl << "Phase      Calls   Time ms    CPU ms   Wait ms Main % Other %";
+  UInt64 totalTime = 0;
+  for (unsigned i = 0; i < NPhaseStat::kNumPhases; i++)
+  {
+    const CPhaseStatItem &item = stat.Phases[i];
+    if (item.NumCalls == 0)
+      continue;
+    // (kHeader) phase is part of (kProcess) phase
+    if (i != NPhaseStat::kHeader)
+      totalTime += item.Time;
+    *g_StdStream << endl;
+    PrintPhaseName(k_PhaseNames[i] ? k_PhaseNames[i] : processName);
+    PrintNum(item.NumCalls, 7);
+    PrintNum(item.Time / 1000, 10);
+    PrintNum(item.CpuTime / 1000, 10);
+    PrintNum(item.Time > item.ThreadTime ? (item.Time - item.ThreadTime) / 1000 : 0, 10);
+    PrintPercent(item.ThreadTime, item.Time);
+    PrintPercent(item.CpuTime > item.ThreadTime ? item.CpuTime - item.ThreadTime : 0, item.Time);
+  }
+  *g_StdStream << endl;
+
+  *g_StdStream << endl << "I/O        Calls   Size KB   Time ms    Max ms   MB/s";
+  UInt64 ioTime = 0;
+  for (unsigned i = 0; i < NIoStat::kNumKinds; i++)
+  {
+    const CIoStatItem &item = stat.Io.Items[i];
+    if (item.NumCalls == 0)
+      continue;
+    ioTime += item.Time;
+    *g_StdStream << endl;
+    PrintPhaseName(k_IoNames[i]);
+    PrintNum(item.NumCalls, 7);
+    const bool isData = (i == NIoStat::kRead || i == NIoStat::kWrite);
+    if (isData)
+      PrintNum(item.Size >> 10, 10);
+    else
+      *g_StdStream << "          ";
+    PrintNum(item.Time / 1000, 10);
+    PrintNum(item.MaxTime / 1000, 10);
+    if (isData)
+      PrintNum(item.Time == 0 ? 0 : item.Size / item.Time, 7);
+  }
+  *g_StdStream << endl;
+
+  {
+    bool wasReported = false;
+    for (unsigned i = 0; i < NArchive::NExtract::NStage::kNumStages; i++)
+    {
+      const CStageStatItem &item = stat.Stages[i];
+      if (item.Time == 0 && item.Size == 0)
+        continue;
+      if (!wasReported)
+        *g_StdStream << endl << "Stage              Size KB   Time ms   MB/s";
+      wasReported = true;
+      *g_StdStream << endl;
+      PrintPhaseName(k_StageNames[i]);
+      *g_StdStream << "       ";
+      PrintNum(item.Size >> 10, 10);
+      PrintNum(item.Time / 1000, 10);
+      PrintNum(item.Time == 0 ? 0 : item.Size / item.Time, 7);
+    }
+    if (wasReported)
+      *g_StdStream << endl;
+  }
+  
+  // it includes the time of codecs, CRC calculation and waiting for threads
+  *g_StdStream << endl << "Other   Time ms =";
+  PrintNum(totalTime > ioTime ? (totalTime - ioTime) / 1000 : 0, 10);
+  *g_StdStream << endl;
+}
 
 
 
@@ -1052,6 +1168,9 @@ int Main2(
   int retCode = NExitCode::kSuccess;
   HRESULT hresultMain = S_OK;
 
+  CPhaseStat phaseStat;
+  const char *phaseStat_ProcessName = NULL;
+
   // bool showStat = options.ShowTime;
   
   /*
@@ -1255,9 +1374,21 @@ int Main2(
   else if (options.Command.CommandType == NCommandType::kBenchmark)
   {
     CStdOutStream &so = (g_StdStream ? *g_StdStream : g_StdOut);
-    hresultMain = BenchCon(EXTERNAL_CODECS_VARS_L
-        options.Properties, options.NumIterations, (FILE *)so);
-    if (hresultMain == S_FALSE)
+    if (ArcBench_IsDecodeMode(options.Properties))
+      hresultMain = ArcDecBenchCon(codecs, options.Properties, options.NumIterations, so);
+    else if (ArcBench_IsTreeMode(options.Properties))
+      hresultMain = ArcBenchCon(codecs, options.Properties, options.NumIterations, so);
+    else
+      hresultMain = BenchCon(EXTERNAL_CODECS_VARS_L
+          options.Properties, options.NumIterations, (FILE *)so);
+    if (hresultMain == k_Bench_HRESULT_Regression)
+    {
+      if (g_ErrStream)
+        *g_ErrStream << "\nWARNING: Performance regression\n";
+      retCode = NExitCode::kWarning;
+      hresultMain = S_OK;
+    }
+    else if (hresultMain == S_FALSE)
     {
       so << endl;
       if (g_ErrStream)
@@ -1361,8 +1492,16 @@ int Main2(
       
       #ifndef Z7_SFX
       eo.Properties = options.Properties;
+      eo.WriteSeekIndex = options.WriteSeekIndex;
       #endif
 
+      if (options.ShowTime)
+      {
+        eo.PhaseStat = &phaseStat;
+        eo.PhaseStat_Stages = options.ShowStageTime;
+        phaseStat_ProcessName = eo.TestMode ? "Test" : "Extract";
+      }
+
       UString errorMessage;
       CDecompressStat stat;
       CHashBundle hb;
@@ -1497,6 +1636,7 @@ int Main2(
       lo.ExcludeDirItems = options.Censor.ExcludeDirItems;
       lo.ExcludeFileItems = options.Censor.ExcludeFileItems;
       lo.DisablePercents = options.DisablePercents;
+      lo.WriteSeekIndex = options.WriteSeekIndex;
 
       hresultMain = ListArchives(
           lo,
@@ -1540,6 +1680,12 @@ int Main2(
     if (uo.SfxMode && uo.SfxModule.IsEmpty())
       uo.SfxModule = kDefaultSfxModule;
 
+    if (options.ShowTime)
+    {
+      uo.PhaseStat = &phaseStat;
+      phaseStat_ProcessName = "Update";
+    }
+
     COpenCallbackConsole openCallback;
     openCallback.Init(g_StdStream, g_ErrStream, percentsStream, options.DisablePercents);
 
@@ -1620,11 +1766,15 @@ int Main2(
     ShowMessageAndThrowException(kUserErrorMessage, NExitCode::kUserError);
 
   if (options.ShowTime && g_StdStream)
+  {
+    if (phaseStat_ProcessName)
+      PrintPhaseStat(phaseStat, phaseStat_ProcessName);
     PrintStat(
       #ifndef _WIN32
         startTime
       #endif
     );
+  }
 
   ThrowException_if_Error(hresultMain);
 
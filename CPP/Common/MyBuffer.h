@@ -113,6 +113,12 @@ public:
       memset(_items, 0, _size * sizeof(T));
   }
 
+  void Swap(CBuffer &buffer)
+  {
+    T *items = _items;  _items = buffer._items;  buffer._items = items;
+    size_t size = _size;  _size = buffer._size;  buffer._size = size;
+  }
+
   CBuffer& operator=(const CBuffer &buffer)
   {
     if (&buffer != this)
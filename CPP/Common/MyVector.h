@@ -475,7 +475,7 @@ public:
   unsigned Size() const { return _v.Size(); }
   bool IsEmpty() const { return _v.IsEmpty(); }
   void ReserveDown() { _v.ReserveDown(); }
-  // void Reserve(unsigned newCapacity) { _v.Reserve(newCapacity); }
+  void Reserve(unsigned newCapacity) { _v.Reserve(newCapacity); }
   void ClearAndReserve(unsigned newCapacity) { Clear(); _v.ClearAndReserve(newCapacity); }
 
   CObjectVector() {}
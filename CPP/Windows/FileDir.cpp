@@ -1093,6 +1093,62 @@ bool DeleteFileAlways(CFSTR path)
   return (remove(path) == 0);
 }
 
+
+bool RemoveDirWithSubItems(const FString &path)
+{
+  {
+    NFind::CFileInfo fi;
+    if (!fi.Find(path))
+      return false;
+    if (!fi.IsDir())
+    {
+      errno = ENOTDIR;
+      return false;
+    }
+  }
+
+  FString s (path);
+  s.Add_PathSepar();
+  const unsigned prefixSize = s.Len();
+  bool isError = false;
+  int lastError = 0;
+  {
+    NFind::CEnumerator enumerator;
+    enumerator.SetDirPrefix(s);
+    for (;;)
+    {
+      NFind::CDirEntry de;
+      bool found;
+      if (!enumerator.Next(de, found))
+        return false;
+      if (!found)
+        break;
+      s.DeleteFrom(prefixSize);
+      s += de.Name;
+      // we don't follow symbolic links here
+      if (enumerator.DirEntry_IsDir(de, false))
+      {
+        if (!RemoveDirWithSubItems(s))
+        {
+          lastError = errno;
+          isError = true;
+        }
+      }
+      else if (!DeleteFileAlways(s))
+      {
+        lastError = errno;
+        isError = true;
+      }
+    }
+  }
+  if (isError)
+  {
+    errno = lastError;
+    return false;
+  }
+  return RemoveDir(path);
+}
+
 bool SetCurrentDir(CFSTR path)
 {
   return (chdir(path) == 0);
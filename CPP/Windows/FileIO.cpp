@@ -618,6 +618,8 @@ bool COutFile::SetLength_KeepPosition(UInt64 length) throw()
   return (result && result2);
 }
 
+bool COutFile::Flush() throw() { return BOOLToBool(::FlushFileBuffers(_handle)); }
+
 }}}
 
 #else // _WIN32
@@ -628,6 +630,12 @@ bool COutFile::SetLength_KeepPosition(UInt64 length) throw()
 #include <fcntl.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/fs.h>
+#endif
+
 namespace NWindows {
 namespace NFile {
 
@@ -903,6 +911,11 @@ bool COutFile::SetLength(UInt64 length) throw()
   return (iret == 0);
 }
 
+bool COutFile::Flush() throw()
+{
+  return fsync(_handle) == 0;
+}
+
 bool COutFile::Close()
 {
   const bool res = CFileBase::Close();
@@ -948,6 +961,110 @@ bool COutFile::SetMTime(const CFiTime *mTime) throw()
   return true;
 }
 
+
+#ifdef __linux__
+
+#define k_CopyRange_ChunkSizeMax ((size_t)1 << 30)
+
+/* it copies (size) bytes with copy_file_range() that doesn't move file positions.
+   Linux kernel can use server side copy or reflink in that call. */
+static bool CopyFileRange(int inHandle, UInt64 inPos, int outHandle, UInt64 outPos,
+    UInt64 size, UInt64 &processed) throw()
+{
+  processed = 0;
+ #ifdef __NR_copy_file_range
+  while (size != 0)
+  {
+    Int64 inOffset = (Int64)(inPos + processed);
+    Int64 outOffset = (Int64)(outPos + processed);
+    size_t cur = k_CopyRange_ChunkSizeMax;
+    if (cur > size)
+      cur = (size_t)size;
+    const long res = syscall(__NR_copy_file_range, inHandle, &inOffset, outHandle, &outOffset, cur, 0);
+    if (res <= 0)
+    {
+      if (res == 0)
+        SetLastError(0); // unexpected end of input file
+      return false;
+    }
+    processed += (UInt64)res;
+    size -= (UInt64)res;
+  }
+  return true;
+ #else
+  UNUSED_VAR(inHandle)
+  UNUSED_VAR(inPos)
+  UNUSED_VAR(outHandle)
+  UNUSED_VAR(outPos)
+  UNUSED_VAR(size)
+  SetLastError(ENOSYS);
+  return false;
+ #endif
+}
+
+/* FICLONERANGE shares the extents of files (reflink in btrfs, xfs),
+   if offsets and size are aligned for block size of file system. */
+static bool CloneFileRange(int inHandle, UInt64 inPos, int outHandle, UInt64 outPos, UInt64 size) throw()
+{
+ #ifdef FICLONERANGE
+  struct file_clone_range range;
+  range.src_fd = inHandle;
+  range.src_offset = inPos;
+  range.src_length = size;
+  range.dest_offset = outPos;
+  return ioctl(outHandle, FICLONERANGE, &range) == 0;
+ #else
+  UNUSED_VAR(inHandle)
+  UNUSED_VAR(inPos)
+  UNUSED_VAR(outHandle)
+  UNUSED_VAR(outPos)
+  UNUSED_VAR(size)
+  return false;
+ #endif
+}
+
+bool COutFile::CopyRangeFrom(int inHandle, UInt64 inPos, UInt64 size, UInt64 &processed) throw()
+{
+  processed = 0;
+  const off_t outPos = seekToCur();
+  if (outPos == -1)
+    return false;
+  bool res = true;
+  struct stat st;
+  if (fstat(_handle, &st) == 0 && st.st_blksize > 0
+      && (st.st_blksize & (st.st_blksize - 1)) == 0)
+  {
+    const UInt64 mask = (UInt64)st.st_blksize - 1;
+    if (((inPos ^ (UInt64)outPos) & mask) == 0)
+    {
+      // the head and tail that are not aligned are copied with copy_file_range()
+      UInt64 head = (0 - inPos) & mask;
+      if (head > size)
+        head = size;
+      const UInt64 mid = (size - head) & ~mask;
+      if (mid != 0)
+      {
+        UInt64 cur = 0;
+        res = CopyFileRange(inHandle, inPos, _handle, (UInt64)outPos, head, cur);
+        processed = cur;
+        if (res && CloneFileRange(inHandle, inPos + head, _handle, (UInt64)outPos + head, mid))
+          processed += mid;
+      }
+    }
+  }
+  if (res && processed != size)
+  {
+    UInt64 cur = 0;
+    res = CopyFileRange(inHandle, inPos + processed, _handle, (UInt64)outPos + processed, size - processed, cur);
+    processed += cur;
+  }
+  if (seek(outPos + (off_t)processed, SEEK_SET) == -1)
+    return false;
+  return res;
+}
+
+#endif // __linux__
+
 }}}
 
 
@@ -312,6 +312,7 @@ public:
   bool SetEndOfFile() throw();
   bool SetLength(UInt64 length) throw();
   bool SetLength_KeepPosition(UInt64 length) throw();
+  bool Flush() throw();
 };
 
 }
@@ -361,6 +362,7 @@ public:
   off_t seekToCur() const throw();
   // bool SeekToBegin() throw();
   int my_fstat(struct stat *st) const  { return fstat(_handle, st); }
+  int GetHandle() const { return _handle; }
   /*
   int my_ioctl_BLKGETSIZE64(unsigned long long *val);
   int GetDeviceSize_InBytes(UInt64 &size);
@@ -434,8 +436,16 @@ public:
   {
     return SetLength(length);
   }
+  bool Flush() throw();
   bool SetTime(const CFiTime *cTime, const CFiTime *aTime, const CFiTime *mTime) throw();
   bool SetMTime(const CFiTime *mTime) throw();
+ #ifdef __linux__
+  /* it copies data from (inHandle) file at (inPos) to current position
+     with reflink / copy_file_range() without reading to user space.
+     (processed) bytes are copied and file position is moved by (processed),
+     also if it returns false. */
+  bool CopyRangeFrom(int inHandle, UInt64 inPos, UInt64 size, UInt64 &processed) throw();
+ #endif
 };
 
 }
@@ -367,24 +367,6 @@ static void PrintPage(AString &s, UInt64 v)
   s += t;
 }
 
-#ifdef _WIN32
-
-static AString TypeToString2(const char * const table[], unsigned num, UInt32 value)
-{
-  char sz[16];
-  const char *p = NULL;
-  if (value < num)
-    p = table[value];
-  if (!p)
-  {
-    ConvertUInt32ToString(value, sz);
-    p = sz;
-  }
-  return (AString)p;
-}
-
-// #if defined(Z7_LARGE_PAGES) || defined(_WIN32)
-// #ifdef _WIN32
 void PrintSize_KMGT_Or_Hex(AString &s, UInt64 v)
 {
   char c = 0;
@@ -404,8 +386,22 @@ void PrintSize_KMGT_Or_Hex(AString &s, UInt64 v)
     s.Add_Char(c);
   s.Add_Char('B');
 }
-// #endif
-// #endif
+
+#ifdef _WIN32
+
+static AString TypeToString2(const char * const table[], unsigned num, UInt32 value)
+{
+  char sz[16];
+  const char *p = NULL;
+  if (value < num)
+    p = table[value];
+  if (!p)
+  {
+    ConvertUInt32ToString(value, sz);
+    p = sz;
+  }
+  return (AString)p;
+}
 
 static void SysInfo_To_String(AString &s, const SYSTEM_INFO &si)
 {
@@ -7,6 +7,7 @@
 
 
 void GetCpuName_MultiLine(AString &s, AString &registers);
+void AddCpuFeatures(AString &s);
 
 void GetOsInfoText(AString &sRes);
 void GetSystemInfoText(AString &s);
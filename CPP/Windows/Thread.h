@@ -39,6 +39,25 @@ public:
   #endif
 };
 
+// the thread from global pool of threads. Thread function must be finished before destruction.
+
+class CPoolThread  MY_UNCOPYABLE
+{
+  ::CPoolThread thread;
+public:
+  CPoolThread() { PoolThread_CONSTRUCT(&thread); }
+  ~CPoolThread() { Wait_Close(); }
+  bool IsCreated() { return PoolThread_WasCreated(&thread) != 0; }
+  WRes Wait_Close() { return PoolThread_Wait_Close(&thread); }
+
+  WRes Create(THREAD_FUNC_TYPE startAddress, LPVOID param)
+    { return PoolThread_Create(&thread, startAddress, param); }
+  WRes Create_With_Affinity(THREAD_FUNC_TYPE startAddress, LPVOID param, CAffinityMask affinity)
+    { return PoolThread_Create_With_Affinity(&thread, startAddress, param, affinity); }
+  WRes Create_With_CpuSet(THREAD_FUNC_TYPE startAddress, LPVOID param, const CCpuSet *cpuSet)
+    { return PoolThread_Create_With_CpuSet(&thread, startAddress, param, cpuSet); }
+};
+
 }
 
 #endif